@@ -339,7 +339,10 @@ TESTSUITE_MIXD_GEN := input.general.mixed
 TESTSUITE_MIXD_OPS := input.operations.mixed
 TESTSUITE_SALT_GEN := input.general.salt
 TESTSUITE_SALT_OPS := input.operations.salt
+TESTSUITE_SUP_GEN  := input.general.sup
+TESTSUITE_SUP_OPS  := input.operations.sup
 TESTSUITE_OUT_FILE := output.testsuite
+TESTSUITE_SUP_OUT_FILE := output.testsuite.sup
 
 # CHANGELOG file.
 CHANGELOG          := CHANGELOG
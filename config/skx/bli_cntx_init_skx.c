@@ -47,34 +47,60 @@ void bli_cntx_init_skx( cntx_t* cntx )
 	// their storage preferences.
 	bli_cntx_set_l3_nat_ukrs
 	(
-	  2,
+	  6,
 	  // gemm
 	  BLIS_GEMM_UKR,       BLIS_FLOAT ,   bli_sgemm_skx_asm_32x12_l2,   FALSE,
 	  BLIS_GEMM_UKR,       BLIS_DOUBLE,   bli_dgemm_skx_asm_16x14,      FALSE,
+	  // gemm_nt
+	  BLIS_GEMM_NT_UKR,    BLIS_FLOAT ,   bli_sgemm_nt_skx_int_32x12,   FALSE,
+	  BLIS_GEMM_NT_UKR,    BLIS_DOUBLE,   bli_dgemm_nt_skx_int_16x14,   FALSE,
+	  // gemm_edge
+	  BLIS_GEMM_EDGE_UKR,  BLIS_FLOAT ,   bli_sgemm_edge_skx_int_32x12, FALSE,
+	  BLIS_GEMM_EDGE_UKR,  BLIS_DOUBLE,   bli_dgemm_edge_skx_int_16x14, FALSE,
 	  cntx
 	);
 
+	// Update the context with optimized matrix transpose kernels.
+	bli_cntx_set_transm_ker_dt( bli_stransm_haswell_int_8x8, BLIS_FLOAT,  cntx );
+	bli_cntx_set_transm_ker_dt( bli_dtransm_haswell_int_4x4, BLIS_DOUBLE, cntx );
+
 	// Update the context with optimized level-1f kernels.
 	bli_cntx_set_l1f_kers
 	(
-	  4,
+	  6,
 	  // axpyf
-	  BLIS_AXPYF_KER,     BLIS_FLOAT,  bli_saxpyf_zen_int_8,
-	  BLIS_AXPYF_KER,     BLIS_DOUBLE, bli_daxpyf_zen_int_8,
+	  BLIS_AXPYF_KER,     BLIS_FLOAT,    bli_saxpyf_zen_int_8,
+	  BLIS_AXPYF_KER,     BLIS_DOUBLE,   bli_daxpyf_zen_int_8,
+	  BLIS_AXPYF_KER,     BLIS_SCOMPLEX, bli_caxpyf_zen_int_8,
+	  BLIS_AXPYF_KER,     BLIS_DCOMPLEX, bli_zaxpyf_zen_int_8,
 	  // dotxf
-	  BLIS_DOTXF_KER,     BLIS_FLOAT,  bli_sdotxf_zen_int_8,
-	  BLIS_DOTXF_KER,     BLIS_DOUBLE, bli_ddotxf_zen_int_8,
+	  BLIS_DOTXF_KER,     BLIS_FLOAT,    bli_sdotxf_zen_int_8,
+	  BLIS_DOTXF_KER,     BLIS_DOUBLE,   bli_ddotxf_zen_int_8,
 	  cntx
 	);
 
 	// Update the context with optimized level-1v kernels.
 	bli_cntx_set_l1v_kers
 	(
-	  10,
+	  36,
 #if 1
 	  // amaxv
-	  BLIS_AMAXV_KER,  BLIS_FLOAT,  bli_samaxv_zen_int,
-	  BLIS_AMAXV_KER,  BLIS_DOUBLE, bli_damaxv_zen_int,
+	  BLIS_AMAXV_KER,  BLIS_FLOAT,    bli_samaxv_skx_int,
+	  BLIS_AMAXV_KER,  BLIS_DOUBLE,   bli_damaxv_skx_int,
+	  BLIS_AMAXV_KER,  BLIS_SCOMPLEX, bli_camaxv_skx_int,
+	  BLIS_AMAXV_KER,  BLIS_DCOMPLEX, bli_zamaxv_skx_int,
+
+	  // aminv
+	  BLIS_AMINV_KER,  BLIS_FLOAT,    bli_saminv_skx_int,
+	  BLIS_AMINV_KER,  BLIS_DOUBLE,   bli_daminv_skx_int,
+	  BLIS_AMINV_KER,  BLIS_SCOMPLEX, bli_caminv_skx_int,
+	  BLIS_AMINV_KER,  BLIS_DCOMPLEX, bli_zaminv_skx_int,
+
+	  // asumv
+	  BLIS_ASUMV_KER,  BLIS_FLOAT,    bli_sasumv_skx_int,
+	  BLIS_ASUMV_KER,  BLIS_DOUBLE,   bli_dasumv_skx_int,
+	  BLIS_ASUMV_KER,  BLIS_SCOMPLEX, bli_casumv_skx_int,
+	  BLIS_ASUMV_KER,  BLIS_DCOMPLEX, bli_zasumv_skx_int,
 #endif
 	  // axpyv
 #if 0
@@ -98,6 +124,26 @@ void bli_cntx_init_skx( cntx_t* cntx )
 	  BLIS_SCALV_KER,  BLIS_FLOAT,  bli_sscalv_zen_int10,
 	  BLIS_SCALV_KER,  BLIS_DOUBLE, bli_dscalv_zen_int10,
 #endif
+	  // normfv
+	  BLIS_NORMFV_KER, BLIS_FLOAT,    bli_snormfv_skx_int,
+	  BLIS_NORMFV_KER, BLIS_DOUBLE,   bli_dnormfv_skx_int,
+	  BLIS_NORMFV_KER, BLIS_SCOMPLEX, bli_cnormfv_skx_int,
+	  BLIS_NORMFV_KER, BLIS_DCOMPLEX, bli_znormfv_skx_int,
+	  // sumsqv
+	  BLIS_SUMSQV_KER, BLIS_FLOAT,    bli_ssumsqv_skx_int,
+	  BLIS_SUMSQV_KER, BLIS_DOUBLE,   bli_dsumsqv_skx_int,
+	  BLIS_SUMSQV_KER, BLIS_SCOMPLEX, bli_csumsqv_skx_int,
+	  BLIS_SUMSQV_KER, BLIS_DCOMPLEX, bli_zsumsqv_skx_int,
+	  // rotmv
+	  BLIS_ROTMV_KER, BLIS_FLOAT,    bli_srotmv_skx_int,
+	  BLIS_ROTMV_KER, BLIS_DOUBLE,   bli_drotmv_skx_int,
+	  BLIS_ROTMV_KER, BLIS_SCOMPLEX, bli_crotmv_skx_int,
+	  BLIS_ROTMV_KER, BLIS_DCOMPLEX, bli_zrotmv_skx_int,
+	  // rotv
+	  BLIS_ROTV_KER,  BLIS_FLOAT,    bli_srotv_skx_int,
+	  BLIS_ROTV_KER,  BLIS_DOUBLE,   bli_drotv_skx_int,
+	  BLIS_ROTV_KER,  BLIS_SCOMPLEX, bli_crotv_skx_int,
+	  BLIS_ROTV_KER,  BLIS_DCOMPLEX, bli_zrotv_skx_int,
 	  cntx
 	);
 
@@ -49,7 +49,7 @@ void bli_cntx_init_zen2( cntx_t* cntx )
 	// their storage preferences.
 	bli_cntx_set_l3_nat_ukrs
 	(
-	  8,
+	  17,
 
 	  // gemm
 	  BLIS_GEMM_UKR,       BLIS_FLOAT,    bli_sgemm_haswell_asm_6x16,       TRUE,
@@ -64,6 +64,24 @@ void bli_cntx_init_zen2( cntx_t* cntx )
 	  // gemmtrsm_u
 	  BLIS_GEMMTRSM_U_UKR, BLIS_FLOAT,    bli_sgemmtrsm_u_haswell_asm_6x16, TRUE,
 	  BLIS_GEMMTRSM_U_UKR, BLIS_DOUBLE,   bli_dgemmtrsm_u_haswell_asm_6x8,  TRUE,
+
+	  // gemmt_l/u
+	  BLIS_GEMMT_L_UKR,    BLIS_DOUBLE,   bli_dgemmt_l_haswell_int_6x8,     TRUE,
+	  BLIS_GEMMT_U_UKR,    BLIS_DOUBLE,   bli_dgemmt_u_haswell_int_6x8,     TRUE,
+
+	  // gemm_edge
+	  BLIS_GEMM_EDGE_UKR,  BLIS_FLOAT,    bli_sgemm_edge_haswell_int_6x16,  TRUE,
+	  BLIS_GEMM_EDGE_UKR,  BLIS_DOUBLE,   bli_dgemm_edge_haswell_int_6x8,   TRUE,
+
+	  // spmm_csr
+	  BLIS_SPMM_CSR_UKR,   BLIS_FLOAT,    bli_sspmm_csr_haswell_int_16,     TRUE,
+	  BLIS_SPMM_CSR_UKR,   BLIS_DOUBLE,   bli_dspmm_csr_haswell_int_8,      TRUE,
+
+	  // gemm_nt
+	  BLIS_GEMM_NT_UKR,    BLIS_FLOAT,    bli_sgemm_nt_haswell_int_6x16,    TRUE,
+	  BLIS_GEMM_NT_UKR,    BLIS_DOUBLE,   bli_dgemm_nt_haswell_int_6x8,     TRUE,
+	  // gemm_bf16b
+	  BLIS_GEMM_BF16B_UKR, BLIS_FLOAT,    bli_sgemm_bf16b_haswell_int_6x16, TRUE,
 	  cntx
 	);
 
@@ -84,29 +102,49 @@ void bli_cntx_init_zen2( cntx_t* cntx )
 	);
 #endif
 
+	// Update the context with optimized matrix transpose kernels.
+	bli_cntx_set_transm_ker_dt( bli_stransm_haswell_int_8x8, BLIS_FLOAT,  cntx );
+	bli_cntx_set_transm_ker_dt( bli_dtransm_haswell_int_4x4, BLIS_DOUBLE, cntx );
+
 	// Update the context with optimized level-1f kernels.
 	bli_cntx_set_l1f_kers
 	(
-	  4,
+	  6,
 
 	  // axpyf
-	  BLIS_AXPYF_KER,     BLIS_FLOAT,  bli_saxpyf_zen_int_5,
-	  BLIS_AXPYF_KER,     BLIS_DOUBLE, bli_daxpyf_zen_int_5,
+	  BLIS_AXPYF_KER,     BLIS_FLOAT,    bli_saxpyf_zen_int_5,
+	  BLIS_AXPYF_KER,     BLIS_DOUBLE,   bli_daxpyf_zen_int_5,
+	  BLIS_AXPYF_KER,     BLIS_SCOMPLEX, bli_caxpyf_zen_int_8,
+	  BLIS_AXPYF_KER,     BLIS_DCOMPLEX, bli_zaxpyf_zen_int_8,
 
 	  // dotxf
-	  BLIS_DOTXF_KER,     BLIS_FLOAT,  bli_sdotxf_zen_int_8,
-	  BLIS_DOTXF_KER,     BLIS_DOUBLE, bli_ddotxf_zen_int_8,
+	  BLIS_DOTXF_KER,     BLIS_FLOAT,    bli_sdotxf_zen_int_8,
+	  BLIS_DOTXF_KER,     BLIS_DOUBLE,   bli_ddotxf_zen_int_8,
 	  cntx
 	);
 
 	// Update the context with optimized level-1v kernels.
 	bli_cntx_set_l1v_kers
 	(
-	  16,
+	  42,
 
 	  // amaxv
-	  BLIS_AMAXV_KER,  BLIS_FLOAT,  bli_samaxv_zen_int,
-	  BLIS_AMAXV_KER,  BLIS_DOUBLE, bli_damaxv_zen_int,
+	  BLIS_AMAXV_KER,  BLIS_FLOAT,    bli_samaxv_zen_int,
+	  BLIS_AMAXV_KER,  BLIS_DOUBLE,   bli_damaxv_zen_int,
+	  BLIS_AMAXV_KER,  BLIS_SCOMPLEX, bli_camaxv_zen_int,
+	  BLIS_AMAXV_KER,  BLIS_DCOMPLEX, bli_zamaxv_zen_int,
+
+	  // aminv
+	  BLIS_AMINV_KER,  BLIS_FLOAT,    bli_saminv_zen_int,
+	  BLIS_AMINV_KER,  BLIS_DOUBLE,   bli_daminv_zen_int,
+	  BLIS_AMINV_KER,  BLIS_SCOMPLEX, bli_caminv_zen_int,
+	  BLIS_AMINV_KER,  BLIS_DCOMPLEX, bli_zaminv_zen_int,
+
+	  // asumv
+	  BLIS_ASUMV_KER,  BLIS_FLOAT,    bli_sasumv_zen_int,
+	  BLIS_ASUMV_KER,  BLIS_DOUBLE,   bli_dasumv_zen_int,
+	  BLIS_ASUMV_KER,  BLIS_SCOMPLEX, bli_casumv_zen_int,
+	  BLIS_ASUMV_KER,  BLIS_DCOMPLEX, bli_zasumv_zen_int,
 
 	  // axpyv
 	  BLIS_AXPYV_KER,  BLIS_FLOAT,  bli_saxpyv_zen_int10,
@@ -135,6 +173,30 @@ void bli_cntx_init_zen2( cntx_t* cntx )
 	  //set
 	  BLIS_SETV_KER,  BLIS_FLOAT,  bli_ssetv_zen_int,
 	  BLIS_SETV_KER,  BLIS_DOUBLE, bli_dsetv_zen_int,
+
+	  // normfv
+	  BLIS_NORMFV_KER, BLIS_FLOAT,    bli_snormfv_zen_int,
+	  BLIS_NORMFV_KER, BLIS_DOUBLE,   bli_dnormfv_zen_int,
+	  BLIS_NORMFV_KER, BLIS_SCOMPLEX, bli_cnormfv_zen_int,
+	  BLIS_NORMFV_KER, BLIS_DCOMPLEX, bli_znormfv_zen_int,
+
+	  // sumsqv
+	  BLIS_SUMSQV_KER, BLIS_FLOAT,    bli_ssumsqv_zen_int,
+	  BLIS_SUMSQV_KER, BLIS_DOUBLE,   bli_dsumsqv_zen_int,
+	  BLIS_SUMSQV_KER, BLIS_SCOMPLEX, bli_csumsqv_zen_int,
+	  BLIS_SUMSQV_KER, BLIS_DCOMPLEX, bli_zsumsqv_zen_int,
+
+	  // rotmv
+	  BLIS_ROTMV_KER, BLIS_FLOAT,    bli_srotmv_zen_int,
+	  BLIS_ROTMV_KER, BLIS_DOUBLE,   bli_drotmv_zen_int,
+	  BLIS_ROTMV_KER, BLIS_SCOMPLEX, bli_crotmv_zen_int,
+	  BLIS_ROTMV_KER, BLIS_DCOMPLEX, bli_zrotmv_zen_int,
+
+	  // rotv
+	  BLIS_ROTV_KER,  BLIS_FLOAT,    bli_srotv_zen_int,
+	  BLIS_ROTV_KER,  BLIS_DOUBLE,   bli_drotv_zen_int,
+	  BLIS_ROTV_KER,  BLIS_SCOMPLEX, bli_crotv_zen_int,
+	  BLIS_ROTV_KER,  BLIS_DCOMPLEX, bli_zrotv_zen_int,
 	  cntx
 	);
 
@@ -69,6 +69,7 @@ void PASTEMAC(opname,_check) \
 }
 
 GENFRONT( amaxv )
+GENFRONT( aminv )
 
 
 #undef  GENFRONT
@@ -88,6 +89,55 @@ void PASTEMAC(opname,_check) \
 GENFRONT( axpbyv )
 
 
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       obj_t*  x, \
+       obj_t*  y, \
+       obj_t*  param  \
+     ) \
+{ \
+	err_t e_val; \
+\
+	bli_l1v_xy_check( x, y ); \
+\
+	/* Check the parameter vector, which must hold five elements of the
+	   real projection of the datatype of x. */ \
+	e_val = bli_check_object_real_proj_of( x, param ); \
+	bli_check_error_code( e_val ); \
+\
+	e_val = bli_check_vector_object( param ); \
+	bli_check_error_code( e_val ); \
+\
+	e_val = bli_check_vector_dim_equals( param, 5 ); \
+	bli_check_error_code( e_val ); \
+\
+	e_val = bli_check_object_buffer( param ); \
+	bli_check_error_code( e_val ); \
+}
+
+GENFRONT( rotmv )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       obj_t*  x, \
+       obj_t*  y, \
+       obj_t*  c, \
+       obj_t*  s  \
+     ) \
+{ \
+	bli_l1v_axby_check( c, x, s, y ); \
+}
+
+GENFRONT( rotv )
+
+
 #undef  GENFRONT
 #define GENFRONT( opname ) \
 \
@@ -62,6 +62,7 @@ void PASTEMAC(opname,_check) \
      );
 
 GENTPROT( amaxv )
+GENTPROT( aminv )
 
 
 #undef  GENTPROT
@@ -78,6 +79,33 @@ void PASTEMAC(opname,_check) \
 GENTPROT( axpbyv )
 
 
+#undef  GENTPROT
+#define GENTPROT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       obj_t*  x, \
+       obj_t*  y, \
+       obj_t*  param  \
+     );
+
+GENTPROT( rotmv )
+
+
+#undef  GENTPROT
+#define GENTPROT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       obj_t*  x, \
+       obj_t*  y, \
+       obj_t*  c, \
+       obj_t*  s  \
+     );
+
+GENTPROT( rotv )
+
+
 #undef  GENTPROT
 #define GENTPROT( opname ) \
 \
@@ -54,12 +54,15 @@ GENFRONT( addv )
 GENFRONT( copyv )
 GENFRONT( subv )
 GENFRONT( amaxv )
+GENFRONT( aminv )
 GENFRONT( axpbyv )
 GENFRONT( axpyv )
 GENFRONT( scal2v )
 GENFRONT( dotv )
 GENFRONT( dotxv )
 GENFRONT( invertv )
+GENFRONT( rotmv )
+GENFRONT( rotv )
 GENFRONT( scalv )
 GENFRONT( setv )
 GENFRONT( swapv )
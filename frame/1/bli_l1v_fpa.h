@@ -46,12 +46,15 @@ GENPROT( addv )
 GENPROT( copyv )
 GENPROT( subv )
 GENPROT( amaxv )
+GENPROT( aminv )
 GENPROT( axpbyv )
 GENPROT( axpyv )
 GENPROT( scal2v )
 GENPROT( dotv )
 GENPROT( dotxv )
 GENPROT( invertv )
+GENPROT( rotmv )
+GENPROT( rotv )
 GENPROT( scalv )
 GENPROT( setv )
 GENPROT( swapv )
@@ -55,7 +55,7 @@ INSERT_GENTDEF( addv )
 INSERT_GENTDEF( copyv )
 INSERT_GENTDEF( subv )
 
-// amaxv
+// amaxv, aminv
 
 #undef  GENTDEF
 #define GENTDEF( ctype, ch, opname, tsuf ) \
@@ -69,6 +69,7 @@ typedef void (*PASTECH3(ch,opname,EX_SUF,tsuf)) \
      );
 
 INSERT_GENTDEF( amaxv )
+INSERT_GENTDEF( aminv )
 
 // axpbyv
 
@@ -158,6 +159,39 @@ typedef void (*PASTECH3(ch,opname,EX_SUF,tsuf)) \
 
 INSERT_GENTDEF( invertv )
 
+// rotmv
+
+#undef  GENTDEFR
+#define GENTDEFR( ctype, ctype_r, ch, chr, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,EX_SUF,tsuf)) \
+     ( \
+       dim_t     n, \
+       ctype*    x, inc_t incx, \
+       ctype*    y, inc_t incy, \
+       ctype_r*  param  \
+       BLIS_TAPI_EX_PARAMS  \
+     );
+
+INSERT_GENTDEFR( rotmv )
+
+// rotv
+
+#undef  GENTDEFR
+#define GENTDEFR( ctype, ctype_r, ch, chr, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,EX_SUF,tsuf)) \
+     ( \
+       dim_t     n, \
+       ctype*    x, inc_t incx, \
+       ctype*    y, inc_t incy, \
+       ctype_r*  c, \
+       ctype_r*  s  \
+       BLIS_TAPI_EX_PARAMS  \
+     );
+
+INSERT_GENTDEFR( rotv )
+
 // scalv, setv
 
 #undef  GENTDEF
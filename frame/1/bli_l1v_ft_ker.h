@@ -58,7 +58,7 @@ INSERT_GENTDEF( addv )
 INSERT_GENTDEF( copyv )
 INSERT_GENTDEF( subv )
 
-// amaxv
+// amaxv, aminv
 
 #undef  GENTDEF
 #define GENTDEF( ctype, ch, opname, tsuf ) \
@@ -72,6 +72,22 @@ typedef void (*PASTECH3(ch,opname,_ker,tsuf)) \
      );
 
 INSERT_GENTDEF( amaxv )
+INSERT_GENTDEF( aminv )
+
+// asumv
+
+#undef  GENTDEFR
+#define GENTDEFR( ctype, ctype_r, ch, chr, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,_ker,tsuf)) \
+     ( \
+       dim_t             n, \
+       ctype*   restrict x, inc_t incx, \
+       ctype_r* restrict asum, \
+       cntx_t*           cntx  \
+     );
+
+INSERT_GENTDEFR( asumv )
 
 // axpbyv
 
@@ -161,6 +177,54 @@ typedef void (*PASTECH3(ch,opname,_ker,tsuf)) \
 
 INSERT_GENTDEF( invertv )
 
+// normfv
+
+#undef  GENTDEFR
+#define GENTDEFR( ctype, ctype_r, ch, chr, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,_ker,tsuf)) \
+     ( \
+       dim_t             n, \
+       ctype*   restrict x, inc_t incx, \
+       ctype_r* restrict norm, \
+       cntx_t*           cntx  \
+     );
+
+INSERT_GENTDEFR( normfv )
+
+// rotmv
+
+#undef  GENTDEFR
+#define GENTDEFR( ctype, ctype_r, ch, chr, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,_ker,tsuf)) \
+     ( \
+       dim_t             n, \
+       ctype*   restrict x, inc_t incx, \
+       ctype*   restrict y, inc_t incy, \
+       ctype_r* restrict h, \
+       cntx_t*           cntx  \
+     );
+
+INSERT_GENTDEFR( rotmv )
+
+// rotv
+
+#undef  GENTDEFR
+#define GENTDEFR( ctype, ctype_r, ch, chr, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,_ker,tsuf)) \
+     ( \
+       dim_t             n, \
+       ctype*   restrict x, inc_t incx, \
+       ctype*   restrict y, inc_t incy, \
+       ctype_r* restrict c, \
+       ctype_r* restrict s, \
+       cntx_t*           cntx  \
+     );
+
+INSERT_GENTDEFR( rotv )
+
 // scalv, setv
 
 #undef  GENTDEF
@@ -178,6 +242,22 @@ typedef void (*PASTECH3(ch,opname,_ker,tsuf)) \
 INSERT_GENTDEF( scalv )
 INSERT_GENTDEF( setv )
 
+// sumsqv
+
+#undef  GENTDEFR
+#define GENTDEFR( ctype, ctype_r, ch, chr, opname, tsuf ) \
+\
+typedef void (*PASTECH3(ch,opname,_ker,tsuf)) \
+     ( \
+       dim_t             n, \
+       ctype*   restrict x, inc_t incx, \
+       ctype_r* restrict scale, \
+       ctype_r* restrict sumsq, \
+       cntx_t*           cntx  \
+     );
+
+INSERT_GENTDEFR( sumsqv )
+
 // swapv
 
 #undef  GENTDEF
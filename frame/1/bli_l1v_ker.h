@@ -54,6 +54,18 @@ INSERT_GENTPROT_BASIC0( addv_ker_name )
 INSERT_GENTPROT_BASIC0( amaxv_ker_name )
 
 
+#undef  GENTPROT
+#define GENTPROT AMINV_KER_PROT
+
+INSERT_GENTPROT_BASIC0( aminv_ker_name )
+
+
+#undef  GENTPROTR
+#define GENTPROTR ASUMV_KER_PROT
+
+INSERT_GENTPROTR_BASIC0( asumv_ker_name )
+
+
 #undef  GENTPROT
 #define GENTPROT AXPBYV_KER_PROT
 
@@ -90,6 +102,24 @@ INSERT_GENTPROT_BASIC0( dotxv_ker_name )
 INSERT_GENTPROT_BASIC0( invertv_ker_name )
 
 
+#undef  GENTPROTR
+#define GENTPROTR NORMFV_KER_PROT
+
+INSERT_GENTPROTR_BASIC0( normfv_ker_name )
+
+
+#undef  GENTPROTR
+#define GENTPROTR ROTMV_KER_PROT
+
+INSERT_GENTPROTR_BASIC0( rotmv_ker_name )
+
+
+#undef  GENTPROTR
+#define GENTPROTR ROTV_KER_PROT
+
+INSERT_GENTPROTR_BASIC0( rotv_ker_name )
+
+
 #undef  GENTPROT
 #define GENTPROT SCALV_KER_PROT
 
@@ -114,6 +144,12 @@ INSERT_GENTPROT_BASIC0( setv_ker_name )
 INSERT_GENTPROT_BASIC0( subv_ker_name )
 
 
+#undef  GENTPROTR
+#define GENTPROTR SUMSQV_KER_PROT
+
+INSERT_GENTPROTR_BASIC0( sumsqv_ker_name )
+
+
 #undef  GENTPROT
 #define GENTPROT SWAPV_KER_PROT
 
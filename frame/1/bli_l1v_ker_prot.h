@@ -60,6 +60,28 @@ void PASTEMAC(ch,opname) \
      ); \
 
 
+#define AMINV_KER_PROT( ctype, ch, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t            n, \
+       ctype*  restrict x, inc_t incx, \
+       dim_t*  restrict index, \
+       cntx_t* restrict cntx  \
+     ); \
+
+
+#define ASUMV_KER_PROT( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t              n, \
+       ctype*    restrict x, inc_t incx, \
+       ctype_r*  restrict asum, \
+       cntx_t*   restrict cntx  \
+     ); \
+
+
 #define AXPBYV_KER_PROT( ctype, ch, opname ) \
 \
 void PASTEMAC(ch,opname) \
@@ -139,6 +161,42 @@ void PASTEMAC(ch,opname) \
      ); \
 
 
+#define NORMFV_KER_PROT( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t              n, \
+       ctype*    restrict x, inc_t incx, \
+       ctype_r*  restrict norm, \
+       cntx_t*   restrict cntx  \
+     ); \
+
+
+#define ROTMV_KER_PROT( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t              n, \
+       ctype*    restrict x, inc_t incx, \
+       ctype*    restrict y, inc_t incy, \
+       ctype_r*  restrict h, \
+       cntx_t*   restrict cntx  \
+     ); \
+
+
+#define ROTV_KER_PROT( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t              n, \
+       ctype*    restrict x, inc_t incx, \
+       ctype*    restrict y, inc_t incy, \
+       ctype_r*  restrict c, \
+       ctype_r*  restrict s, \
+       cntx_t*   restrict cntx  \
+     ); \
+
+
 #define SCALV_KER_PROT( ctype, ch, opname ) \
 \
 void PASTEMAC(ch,opname) \
@@ -188,6 +246,18 @@ void PASTEMAC(ch,opname) \
       );
 
 
+#define SUMSQV_KER_PROT( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t              n, \
+       ctype*    restrict x, inc_t incx, \
+       ctype_r*  restrict scale, \
+       ctype_r*  restrict sumsq, \
+       cntx_t*   restrict cntx  \
+     ); \
+
+
 #define SWAPV_KER_PROT( ctype, ch, opname ) \
 \
 void PASTEMAC(ch,opname) \
@@ -63,6 +63,7 @@ BLIS_EXPORT_BLIS void PASTEMAC(opname,EX_SUF) \
      );
 
 GENTPROT( amaxv )
+GENTPROT( aminv )
 
 
 #undef  GENTPROT
@@ -151,6 +152,35 @@ GENTPROT( scalv )
 GENTPROT( setv )
 
 
+#undef  GENTPROT
+#define GENTPROT( opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(opname,EX_SUF) \
+     ( \
+       obj_t*  x, \
+       obj_t*  y, \
+       obj_t*  param  \
+       BLIS_OAPI_EX_PARAMS  \
+     );
+
+GENTPROT( rotmv )
+
+
+#undef  GENTPROT
+#define GENTPROT( opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC(opname,EX_SUF) \
+     ( \
+       obj_t*  x, \
+       obj_t*  y, \
+       obj_t*  c, \
+       obj_t*  s  \
+       BLIS_OAPI_EX_PARAMS  \
+     );
+
+GENTPROT( rotv )
+
+
 #undef  GENTPROT
 #define GENTPROT( opname ) \
 \
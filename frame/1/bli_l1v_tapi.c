@@ -110,6 +110,7 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 }
 
 INSERT_GENTFUNC_BASIC( amaxv, BLIS_AMAXV_KER )
+INSERT_GENTFUNC_BASIC( aminv, BLIS_AMINV_KER )
 
 
 #undef  GENTFUNC
@@ -308,6 +309,103 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 INSERT_GENTFUNC_BASIC( invertv, BLIS_INVERTV_KER )
 
 
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, kerid ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       dim_t     n, \
+       ctype*    x, inc_t incx, \
+       ctype*    y, inc_t incy, \
+       ctype_r*  param  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	const num_t dt   = PASTEMAC(ch,type); \
+	ctype_r     flag = param[0]; \
+	ctype_r     h[4]; \
+\
+	/* If H is the identity (flag = -2), return early. */ \
+	if ( bli_zero_dim1( n ) || flag == ( ctype_r )-2 ) return; \
+\
+	/* Expand the compact forms of H encoded by flag, so that the kernel
+	   always receives the full matrix (h11, h21, h12, h22) by columns. */ \
+	if      ( flag < ( ctype_r )0 ) \
+	{ \
+		h[0] = param[1]; h[1] = param[2]; \
+		h[2] = param[3]; h[3] = param[4]; \
+	} \
+	else if ( flag == ( ctype_r )0 ) \
+	{ \
+		h[0] = ( ctype_r )1; h[1] = param[2]; \
+		h[2] = param[3];     h[3] = ( ctype_r )1; \
+	} \
+	else \
+	{ \
+		h[0] = param[1];     h[1] = ( ctype_r )-1; \
+		h[2] = ( ctype_r )1; h[3] = param[4]; \
+	} \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	PASTECH2(ch,opname,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+\
+	f \
+	( \
+	   n, \
+	   x, incx, \
+	   y, incy, \
+	   h, \
+	   cntx  \
+	); \
+}
+
+INSERT_GENTFUNCR_BASIC( rotmv, BLIS_ROTMV_KER )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, kerid ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       dim_t     n, \
+       ctype*    x, inc_t incx, \
+       ctype*    y, inc_t incy, \
+       ctype_r*  c, \
+       ctype_r*  s  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* Obtain a valid context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	PASTECH2(ch,opname,_ker_ft) f = bli_cntx_get_l1v_ker_dt( dt, kerid, cntx ); \
+\
+	f \
+	( \
+	   n, \
+	   x, incx, \
+	   y, incy, \
+	   c, \
+	   s, \
+	   cntx  \
+	); \
+}
+
+INSERT_GENTFUNCR_BASIC( rotv, BLIS_ROTV_KER )
+
+
 #undef  GENTFUNC
 #define GENTFUNC( ctype, ch, opname, kerid ) \
 \
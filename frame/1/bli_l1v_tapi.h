@@ -66,6 +66,7 @@ BLIS_EXPORT_BLIS void PASTEMAC2(ch,opname,EX_SUF) \
      ); \
 
 INSERT_GENTPROT_BASIC0( amaxv )
+INSERT_GENTPROT_BASIC0( aminv )
 
 
 #undef  GENTPROT
@@ -151,6 +152,37 @@ BLIS_EXPORT_BLIS void PASTEMAC2(ch,opname,EX_SUF) \
 INSERT_GENTPROT_BASIC0( invertv )
 
 
+#undef  GENTPROTR
+#define GENTPROTR( ctype, ctype_r, ch, chr, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       dim_t     n, \
+       ctype*    x, inc_t incx, \
+       ctype*    y, inc_t incy, \
+       ctype_r*  param  \
+       BLIS_TAPI_EX_PARAMS  \
+     ); \
+
+INSERT_GENTPROTR_BASIC0( rotmv )
+
+
+#undef  GENTPROTR
+#define GENTPROTR( ctype, ctype_r, ch, chr, opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       dim_t     n, \
+       ctype*    x, inc_t incx, \
+       ctype*    y, inc_t incy, \
+       ctype_r*  c, \
+       ctype_r*  s  \
+       BLIS_TAPI_EX_PARAMS  \
+     ); \
+
+INSERT_GENTPROTR_BASIC0( rotv )
+
+
 #undef  GENTPROT
 #define GENTPROT( ctype, ch, opname ) \
 \
@@ -70,3 +70,6 @@
 #include "bli_packm.h"
 #include "bli_unpackm.h"
 
+// Matrix transpose (omatcopy/imatcopy)
+#include "bli_transm.h"
+
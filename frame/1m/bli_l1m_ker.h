@@ -133,3 +133,11 @@ INSERT_GENTPROT_BASIC0( packm_12xk_1er_ker_name )
 INSERT_GENTPROT_BASIC0( packm_14xk_1er_ker_name )
 INSERT_GENTPROT_BASIC0( packm_16xk_1er_ker_name )
 
+
+// transm kernels
+
+#undef  GENTPROT
+#define GENTPROT TRANSM_KER_PROT
+
+INSERT_GENTPROT_BASIC0( transm_ker_name )
+
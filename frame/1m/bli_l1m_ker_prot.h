@@ -139,3 +139,19 @@ void PASTEMAC(ch,varname) \
        cntx_t* restrict cntx  \
      );
 
+
+// transm kernels
+
+#define TRANSM_KER_PROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       conj_t           conja, \
+       dim_t            m, \
+       dim_t            n, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a, inc_t lda, \
+       ctype*  restrict b, inc_t ldb, \
+       cntx_t* restrict cntx  \
+     );
+
@@ -47,12 +47,14 @@
 #include "bli_packm_struc_cxk_3mis.h"
 #include "bli_packm_struc_cxk_rih.h"
 #include "bli_packm_struc_cxk_1er.h"
+#include "bli_packm_struc_cxk_bf16.h"
 
 #include "bli_packm_cxk.h"
 #include "bli_packm_cxk_4mi.h"
 #include "bli_packm_cxk_3mis.h"
 #include "bli_packm_cxk_rih.h"
 #include "bli_packm_cxk_1er.h"
+#include "bli_packm_cxk_bf16.h"
 
 // Mixed datatype support.
 #ifdef BLIS_ENABLE_GEMM_MD
@@ -98,6 +98,9 @@ static func_t packm_struc_cxk_kers[BLIS_NUM_PACK_SCHEMA_TYPES] =
 // 1001 row/col panels: 1m-reordered (1r)
     { { NULL,                      bli_cpackm_struc_cxk_1er,
         NULL,                      bli_zpackm_struc_cxk_1er,  } },
+// 1010 row/col panels: bfloat16 (sgemm only)
+    { { bli_spackm_struc_cxk_bf16, NULL,
+        NULL,                      NULL,                      } },
 };
 
 
@@ -0,0 +1,104 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// Round a float to the nearest bfloat16 (ties to even), which keeps the
+// upper 16 bits of its IEEE representation. NaNs are kept quiet so that
+// rounding cannot turn them into infinities.
+BLIS_INLINE uint16_t bli_sbf16( float x )
+{
+	uint32_t u;
+
+	memcpy( &u, &x, sizeof( u ) );
+
+	if ( ( u & 0x7fffffff ) > 0x7f800000 )
+		return ( uint16_t )( ( u >> 16 ) | 0x0040 );
+
+	u += 0x7fff + ( ( u >> 16 ) & 1 );
+
+	return ( uint16_t )( u >> 16 );
+}
+
+void bli_spackm_cxk_bf16
+     (
+       conj_t  conja,
+       pack_t  schema,
+       dim_t   panel_dim,
+       dim_t   panel_dim_max,
+       dim_t   panel_len,
+       dim_t   panel_len_max,
+       float*  kappa,
+       float*  a, inc_t inca, inc_t lda,
+       float*  p,             inc_t ldp,
+       cntx_t* cntx
+     )
+{
+	// The micropanel is panel_dim_max x panel_len_max and column-stored
+	// (unit row stride, column stride ldp), as with the other pack kernels,
+	// except that its elements are bfloat16 rather than float. Conjugation
+	// is meaningless in the real domain and is ignored.
+	uint16_t* restrict pb = ( uint16_t* )p;
+	const float        kappa_r = *kappa;
+
+	if ( kappa_r == 1.0F )
+	{
+		for ( dim_t l = 0; l < panel_len; ++l )
+		for ( dim_t i = 0; i < panel_dim; ++i )
+			pb[ i + l*ldp ] = bli_sbf16( a[ i*inca + l*lda ] );
+	}
+	else
+	{
+		for ( dim_t l = 0; l < panel_len; ++l )
+		for ( dim_t i = 0; i < panel_dim; ++i )
+			pb[ i + l*ldp ] = bli_sbf16( kappa_r * a[ i*inca + l*lda ] );
+	}
+
+	// If panel_dim < panel_dim_max, then we zero those unused rows.
+	if ( panel_dim != panel_dim_max )
+	{
+		for ( dim_t l = 0; l < panel_len; ++l )
+		for ( dim_t i = panel_dim; i < panel_dim_max; ++i )
+			pb[ i + l*ldp ] = 0;
+	}
+
+	// If panel_len < panel_len_max, then we zero those unused columns.
+	if ( panel_len != panel_len_max )
+	{
+		for ( dim_t l = panel_len; l < panel_len_max; ++l )
+		for ( dim_t i = 0; i < panel_dim_max; ++i )
+			pb[ i + l*ldp ] = 0;
+	}
+}
+
@@ -427,6 +427,15 @@ siz_t bli_packm_init_pack
 			// actual stored element, we divide the panel_stride by 2.
 			ps_p = ps_p / 2;
 		}
+		else if ( bli_is_bf16_packed( schema ) )
+		{
+			// The packed micropanels contain bfloat16 elements, which are
+			// half the size of the float elements in whose units ps_p is
+			// measured (ps_p is even at this point). Halving the panel
+			// stride makes the micropanels contiguous, which is what halves
+			// the memory footprint and traffic of the packed matrix.
+			ps_p = ps_p / 2;
+		}
 
 		// Set the imaginary stride (in units of fundamental elements) for
 		// 3m and 4m (separated or interleaved). We use ps_p_orig since
@@ -521,6 +530,15 @@ siz_t bli_packm_init_pack
 			// actual stored element, we divide the panel_stride by 2.
 			ps_p = ps_p / 2;
 		}
+		else if ( bli_is_bf16_packed( schema ) )
+		{
+			// The packed micropanels contain bfloat16 elements, which are
+			// half the size of the float elements in whose units ps_p is
+			// measured (ps_p is even at this point). Halving the panel
+			// stride makes the micropanels contiguous, which is what halves
+			// the memory footprint and traffic of the packed matrix.
+			ps_p = ps_p / 2;
+		}
 
 		// Set the imaginary stride (in units of fundamental elements) for
 		// 3m and 4m (separated or interleaved). We use ps_p_orig since
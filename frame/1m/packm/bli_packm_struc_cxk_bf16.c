@@ -0,0 +1,108 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+void bli_spackm_struc_cxk_bf16
+     (
+       struc_t         strucc,
+       doff_t          diagoffp,
+       diag_t          diagc,
+       uplo_t          uploc,
+       conj_t          conjc,
+       pack_t          schema,
+       bool            invdiag,
+       dim_t           m_panel,
+       dim_t           n_panel,
+       dim_t           m_panel_max,
+       dim_t           n_panel_max,
+       float* restrict kappa,
+       float* restrict c, inc_t rs_c, inc_t cs_c,
+       float* restrict p, inc_t rs_p, inc_t cs_p,
+                          inc_t is_p,
+       cntx_t*         cntx
+     )
+{
+	dim_t  panel_dim;
+	dim_t  panel_dim_max;
+	dim_t  panel_len;
+	dim_t  panel_len_max;
+	inc_t  incc, ldc;
+	inc_t        ldp;
+
+	// bfloat16 packing is only requested for the general matrix operands
+	// of sgemm, so micropanels of structured matrices are not supported.
+	if ( !bli_is_general( strucc ) )
+		bli_check_error_code( BLIS_NOT_YET_IMPLEMENTED );
+
+	// Determine the dimensions and relative strides of the micro-panel
+	// based on its pack schema.
+	if ( bli_is_col_packed( schema ) )
+	{
+		// Prepare to pack to row-stored column panel.
+		panel_dim     = n_panel;
+		panel_dim_max = n_panel_max;
+		panel_len     = m_panel;
+		panel_len_max = m_panel_max;
+		incc          = cs_c;
+		ldc           = rs_c;
+		ldp           = rs_p;
+	}
+	else /* if ( bli_is_row_packed( schema ) ) */
+	{
+		// Prepare to pack to column-stored row panel.
+		panel_dim     = m_panel;
+		panel_dim_max = m_panel_max;
+		panel_len     = n_panel;
+		panel_len_max = n_panel_max;
+		incc          = rs_c;
+		ldc           = cs_c;
+		ldp           = cs_p;
+	}
+
+	bli_spackm_cxk_bf16
+	(
+	  conjc,
+	  schema,
+	  panel_dim,
+	  panel_dim_max,
+	  panel_len,
+	  panel_len_max,
+	  kappa,
+	  c, incc, ldc,
+	  p,       ldp,
+	  cntx
+	);
+}
+
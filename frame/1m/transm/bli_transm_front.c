@@ -0,0 +1,269 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Return TRUE if B := alpha * transa( A ) must move elements across the
+// diagonal in memory; that is, if A (with its transposition absorbed into
+// its strides) and B are stored with unit stride in opposite directions.
+// Vectors and matrices with general stride are excluded since they gain
+// nothing from the transpose kernel.
+static bool bli_transm_is_needed( obj_t* a, obj_t* b )
+{
+	if ( bli_obj_length( b ) == 1 || bli_obj_width( b ) == 1 ) return FALSE;
+
+	return ( bool )
+	       ( ( bli_obj_row_stride( a ) == 1 && bli_obj_col_stride( b ) == 1 ) ||
+	         ( bli_obj_col_stride( a ) == 1 && bli_obj_row_stride( b ) == 1 ) );
+}
+
+// Run one of the transpose variants on all threads. On entry, a and c are
+// already in the canonical form the variant expects.
+static void bli_transm_launch
+     (
+       l3supint_t func,
+       obj_t*     alpha,
+       obj_t*     a,
+       obj_t*     c,
+       cntx_t*    cntx,
+       rntm_t*    rntm
+     )
+{
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	// Resolve the total number of threads (treating each element as one
+	// unit of work) and assign all of them to a single loop; the variants
+	// partition the tiles themselves.
+	bli_rntm_set_ways_from_rntm_sup
+	(
+	  bli_obj_dt( c ),
+	  bli_obj_length( c ),
+	  bli_obj_width( c ),
+	  1,
+	  NULL,
+	  rntm
+	);
+
+	const dim_t nt = bli_rntm_num_threads( rntm );
+
+	bli_rntm_set_ways_only( nt, 1, 1, 1, 1, rntm );
+
+	bli_l3_sup_thread_decorator
+	(
+	  func,
+	  BLIS_NOID,
+	  alpha,
+	  a,
+	  NULL,
+	  NULL,
+	  c,
+	  cntx,
+	  rntm
+	);
+}
+
+void bli_omatcopy_front
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	obj_t alpha_local;
+	obj_t a_local;
+	obj_t b_local;
+
+	// If B has a zero dimension, return early.
+	if ( bli_obj_has_zero_dim( b ) ) return;
+
+	// If alpha is zero, set B to zero and return early.
+	if ( bli_obj_equals( alpha, &BLIS_ZERO ) )
+	{
+		bli_setm_ex( &BLIS_ZERO, b, cntx, rntm );
+		return;
+	}
+
+	// Absorb any transposition of A into its dimensions and strides. Any
+	// conjugation stays with the object and is honored by the variant.
+	bli_obj_alias_to( a, &a_local );
+	bli_obj_alias_to( b, &b_local );
+
+	if ( bli_obj_has_trans( &a_local ) )
+	{
+		bli_obj_induce_trans( &a_local );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &a_local );
+	}
+
+	// If A and B are stored in the same direction, the operation is an
+	// ordinary scaled copy, which scal2m already performs one contiguous
+	// vector at a time.
+	if ( !bli_transm_is_needed( &a_local, &b_local ) )
+	{
+		bli_scal2m_ex( alpha, a, b, cntx, rntm );
+		return;
+	}
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Create a local copy of alpha in the datatype of B.
+	bli_obj_scalar_init_detached_copy_of( bli_obj_dt( b ), BLIS_NO_CONJUGATE,
+	                                      alpha, &alpha_local );
+
+	// The variant expects B to be column-stored (and thus A row-stored). If
+	// B is row-stored, we instead compute B^T := alpha * A^T.
+	if ( bli_obj_is_row_stored( &b_local ) )
+	{
+		bli_obj_induce_trans( &a_local );
+		bli_obj_induce_trans( &b_local );
+	}
+
+	bli_transm_launch
+	(
+	  bli_transm_int,
+	  &alpha_local,
+	  &a_local,
+	  &b_local,
+	  cntx,
+	  rntm
+	);
+}
+
+void bli_imatcopy_front
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	obj_t alpha_local;
+	obj_t a_local;
+	obj_t b_local;
+
+	// If B has a zero dimension, return early.
+	if ( bli_obj_has_zero_dim( b ) ) return;
+
+	// If alpha is zero, set B to zero and return early.
+	if ( bli_obj_equals( alpha, &BLIS_ZERO ) )
+	{
+		bli_setm_ex( &BLIS_ZERO, b, cntx, rntm );
+		return;
+	}
+
+	bli_obj_alias_to( a, &a_local );
+	bli_obj_alias_to( b, &b_local );
+
+	if ( bli_obj_has_trans( &a_local ) )
+	{
+		bli_obj_induce_trans( &a_local );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, &a_local );
+	}
+
+	// If every element of B occupies the same storage as the element of A
+	// from which it is computed, the operation is an elementwise scaling
+	// (and possibly conjugation) in place.
+	const bool same_origin = ( bli_obj_buffer_at_off( &a_local ) ==
+	                           bli_obj_buffer_at_off( &b_local ) );
+
+	if ( same_origin &&
+	     bli_obj_row_stride( &a_local ) == bli_obj_row_stride( &b_local ) &&
+	     bli_obj_col_stride( &a_local ) == bli_obj_col_stride( &b_local ) )
+	{
+		if ( bli_obj_has_noconj( &a_local ) )
+			bli_scalm_ex( alpha, b, cntx, rntm );
+		else
+			bli_scal2m_ex( alpha, &a_local, b, cntx, rntm );
+		return;
+	}
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	if ( bli_transm_is_needed( &a_local, &b_local ) )
+	{
+		if ( bli_obj_is_row_stored( &b_local ) )
+		{
+			bli_obj_induce_trans( &a_local );
+			bli_obj_induce_trans( &b_local );
+		}
+
+		// A square matrix whose leading dimension is unchanged can be
+		// transposed in place by swapping mirror-image tiles.
+		if ( same_origin &&
+		     bli_obj_length( &b_local ) == bli_obj_width( &b_local ) &&
+		     bli_obj_row_stride( &a_local ) == bli_obj_col_stride( &b_local ) )
+		{
+			bli_obj_scalar_init_detached_copy_of( bli_obj_dt( b ), BLIS_NO_CONJUGATE,
+			                                      alpha, &alpha_local );
+
+			bli_transm_launch
+			(
+			  bli_transm_sq_int,
+			  &alpha_local,
+			  &a_local,
+			  &b_local,
+			  cntx,
+			  rntm
+			);
+			return;
+		}
+	}
+
+	// Otherwise, the elements of A may be overwritten before they are read,
+	// so we compute the result into a temporary matrix stored in the same
+	// direction as B and then copy it into place.
+	obj_t t;
+
+	if ( bli_obj_is_row_stored( b ) )
+		bli_obj_create( bli_obj_dt( b ), bli_obj_length( b ), bli_obj_width( b ),
+		                bli_obj_width( b ), 1, &t );
+	else
+		bli_obj_create( bli_obj_dt( b ), bli_obj_length( b ), bli_obj_width( b ),
+		                1, bli_obj_length( b ), &t );
+
+	bli_omatcopy_front( alpha, a, &t, cntx, rntm );
+	bli_copym_ex( &t, b, cntx, rntm );
+
+	bli_obj_free( &t );
+}
+
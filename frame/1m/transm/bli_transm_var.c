@@ -0,0 +1,303 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#define FUNCPTR_T transm_fp
+
+typedef void (*FUNCPTR_T)
+     (
+       conj_t     conja,
+       dim_t      m,
+       dim_t      n,
+       void*      alpha,
+       void*      a, inc_t lda,
+       void*      b, inc_t ldb,
+       cntx_t*    cntx,
+       rntm_t*    rntm,
+       thrinfo_t* thread
+     );
+
+static FUNCPTR_T GENARRAY(ftypes,transm_var1);
+
+err_t bli_transm_int
+     (
+       obj_t*     alpha,
+       obj_t*     a,
+       obj_t*     b,
+       obj_t*     beta,
+       obj_t*     c,
+       cntx_t*    cntx,
+       rntm_t*    rntm,
+       thrinfo_t* thread
+     )
+{
+	// On entry, A is row-stored and C is column-stored, and both are m x n.
+	// Viewed by columns, A is therefore an n x m matrix whose (scaled)
+	// transpose is to be written to C. B and beta are unused.
+	const num_t    dt        = bli_obj_dt( c );
+
+	const conj_t   conja     = bli_obj_conj_status( a );
+
+	const dim_t    m         = bli_obj_length( c );
+	const dim_t    n         = bli_obj_width( c );
+
+	void* restrict buf_a     = bli_obj_buffer_at_off( a );
+	const inc_t    rs_a      = bli_obj_row_stride( a );
+
+	void* restrict buf_c     = bli_obj_buffer_at_off( c );
+	const inc_t    cs_c      = bli_obj_col_stride( c );
+
+	void* restrict buf_alpha = bli_obj_buffer_for_1x1( dt, alpha );
+
+	FUNCPTR_T      f         = ftypes[dt];
+
+	( void )b;
+	( void )beta;
+
+	f
+	(
+	  conja,
+	  n, m,
+	  buf_alpha,
+	  buf_a, rs_a,
+	  buf_c, cs_c,
+	  cntx,
+	  rntm,
+	  thread
+	);
+
+	return BLIS_SUCCESS;
+}
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       conj_t     conja, \
+       dim_t      m, \
+       dim_t      n, \
+       void*      alpha, \
+       void*      a, inc_t lda, \
+       void*      b, inc_t ldb, \
+       cntx_t*    cntx, \
+       rntm_t*    rntm, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t     dt         = PASTEMAC(ch,type); \
+\
+	ctype* restrict alpha_cast = alpha; \
+	ctype* restrict a_cast     = a; \
+	ctype* restrict b_cast     = b; \
+\
+	/* The tile size, in units of elements. */ \
+	const dim_t     tb         = BLIS_TRANSM_TILE_SIZE / sizeof( ctype ); \
+\
+	PASTECH2(ch,transm,_ker_ft) f = bli_cntx_get_transm_ker_dt( dt, cntx ); \
+\
+	( void )rntm; \
+\
+	/* Partition the longer of the two dimensions among the threads in
+	   multiples of the tile size. When m is partitioned, each thread
+	   writes whole columns of B; otherwise, the boundaries between the
+	   threads' rows of B fall on tile (and thus cache line) boundaries. */ \
+	dim_t m_start = 0, m_end = m; \
+	dim_t n_start = 0, n_end = n; \
+\
+	if ( m >= n ) bli_thread_range_sub( thread, m, tb, FALSE, &m_start, &m_end ); \
+	else          bli_thread_range_sub( thread, n, tb, FALSE, &n_start, &n_end ); \
+\
+	/* Sweep the tiles so that consecutive tiles fill consecutive rows of
+	   the same columns of B. */ \
+	for ( dim_t i = m_start; i < m_end; i += tb ) \
+	{ \
+		const dim_t mb = bli_min( tb, m_end - i ); \
+\
+		for ( dim_t j = n_start; j < n_end; j += tb ) \
+		{ \
+			const dim_t nb = bli_min( tb, n_end - j ); \
+\
+			f \
+			( \
+			  conja, \
+			  mb, nb, \
+			  alpha_cast, \
+			  a_cast + i + j*lda, lda, \
+			  b_cast + j + i*ldb, ldb, \
+			  cntx  \
+			); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( transm_var1 )
+
+
+#undef  FUNCPTR_T
+#define FUNCPTR_T transm_sq_fp
+
+typedef void (*FUNCPTR_T)
+     (
+       conj_t     conja,
+       dim_t      m,
+       void*      alpha,
+       void*      a, inc_t lda,
+       cntx_t*    cntx,
+       rntm_t*    rntm,
+       thrinfo_t* thread
+     );
+
+static FUNCPTR_T GENARRAY(ftypes_sq,transm_sq_var1);
+
+err_t bli_transm_sq_int
+     (
+       obj_t*     alpha,
+       obj_t*     a,
+       obj_t*     b,
+       obj_t*     beta,
+       obj_t*     c,
+       cntx_t*    cntx,
+       rntm_t*    rntm,
+       thrinfo_t* thread
+     )
+{
+	// On entry, C is a square column-stored matrix that is to be overwritten
+	// by its (scaled) transpose. A is an alias of C that carries the
+	// conjugation. B and beta are unused.
+	const num_t    dt        = bli_obj_dt( c );
+
+	const conj_t   conja     = bli_obj_conj_status( a );
+
+	const dim_t    m         = bli_obj_length( c );
+
+	void* restrict buf_c     = bli_obj_buffer_at_off( c );
+	const inc_t    cs_c      = bli_obj_col_stride( c );
+
+	void* restrict buf_alpha = bli_obj_buffer_for_1x1( dt, alpha );
+
+	FUNCPTR_T      f         = ftypes_sq[dt];
+
+	( void )b;
+	( void )beta;
+
+	f
+	(
+	  conja,
+	  m,
+	  buf_alpha,
+	  buf_c, cs_c,
+	  cntx,
+	  rntm,
+	  thread
+	);
+
+	return BLIS_SUCCESS;
+}
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       conj_t     conja, \
+       dim_t      m, \
+       void*      alpha, \
+       void*      a, inc_t lda, \
+       cntx_t*    cntx, \
+       rntm_t*    rntm, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t     dt         = PASTEMAC(ch,type); \
+\
+	ctype* restrict alpha_cast = alpha; \
+	ctype* restrict a_cast     = a; \
+\
+	/* The tile size, in units of elements. */ \
+	const dim_t     tb         = BLIS_TRANSM_TILE_SIZE / sizeof( ctype ); \
+\
+	/* A buffer that holds one transposed tile while its mirror image is
+	   moved into place. */ \
+	ctype           t[ ( BLIS_TRANSM_TILE_SIZE / sizeof( ctype ) ) * \
+	                   ( BLIS_TRANSM_TILE_SIZE / sizeof( ctype ) ) ] \
+	                   __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	const inc_t     ldt        = tb; \
+\
+	PASTECH2(ch,transm,_ker_ft) f     = bli_cntx_get_transm_ker_dt( dt, cntx ); \
+	PASTECH2(ch,copyv,_ker_ft)  copyv = bli_cntx_get_l1v_ker_dt( dt, BLIS_COPYV_KER, cntx ); \
+\
+	const dim_t     n_tiles    = m / tb + ( m % tb ? 1 : 0 ); \
+\
+	const dim_t     nt         = bli_thread_n_way( thread ); \
+	const dim_t     tid        = bli_thread_work_id( thread ); \
+\
+	( void )rntm; \
+\
+	/* Visit each pair of mirror-image tiles (and each diagonal tile) once,
+	   dealing the pairs out to the threads in round-robin fashion. */ \
+	dim_t idx = 0; \
+\
+	for ( dim_t jt = 0; jt < n_tiles; ++jt ) \
+	for ( dim_t it = 0; it <= jt; ++it, ++idx ) \
+	{ \
+		if ( idx % nt != tid ) continue; \
+\
+		const dim_t i    = it * tb; \
+		const dim_t j    = jt * tb; \
+		const dim_t mb   = bli_min( tb, m - i ); \
+		const dim_t nb   = bli_min( tb, m - j ); \
+\
+		ctype*      a_ij = a_cast + i + j*lda; \
+		ctype*      a_ji = a_cast + j + i*lda; \
+\
+		/* T := alpha * conja( A_ij )^T */ \
+		f( conja, mb, nb, alpha_cast, a_ij, lda, t, ldt, cntx ); \
+\
+		/* A_ij := alpha * conja( A_ji )^T */ \
+		if ( it != jt ) \
+			f( conja, nb, mb, alpha_cast, a_ji, lda, a_ij, lda, cntx ); \
+\
+		/* A_ji := T */ \
+		for ( dim_t l = 0; l < mb; ++l ) \
+			copyv( BLIS_NO_CONJUGATE, nb, t + l*ldt, 1, a_ji + l*lda, 1, cntx ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( transm_sq_var1 )
+
@@ -0,0 +1,352 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Perform the checks common to all banded and packed operations. Since the
+// storage of A does not have the logical dimensions of A, its dimensions are
+// checked separately by each operation. Either of beta and y may be NULL.
+static void bli_bandpack_xxmv_check
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  x,
+       obj_t*  beta,
+       obj_t*  y
+     )
+{
+	err_t e_val;
+
+	// Check object datatypes.
+
+	e_val = bli_check_noninteger_object( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_floating_object( a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_floating_object( x );
+	bli_check_error_code( e_val );
+
+	// Check object dimensions.
+
+	e_val = bli_check_scalar_object( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_matrix_object( a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_vector_object( x );
+	bli_check_error_code( e_val );
+
+	// Check for consistent datatypes.
+
+	e_val = bli_check_consistent_object_datatypes( a, x );
+	bli_check_error_code( e_val );
+
+	// Check object buffers (for non-NULLness).
+
+	e_val = bli_check_object_buffer( alpha );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( a );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_object_buffer( x );
+	bli_check_error_code( e_val );
+
+	if ( beta != NULL )
+	{
+		e_val = bli_check_noninteger_object( beta );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_scalar_object( beta );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_object_buffer( beta );
+		bli_check_error_code( e_val );
+	}
+
+	if ( y != NULL )
+	{
+		e_val = bli_check_floating_object( y );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_vector_object( y );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_consistent_object_datatypes( a, y );
+		bli_check_error_code( e_val );
+
+		e_val = bli_check_object_buffer( y );
+		bli_check_error_code( e_val );
+	}
+}
+
+// Check that the packed storage ap of an m x m triangle holds m(m+1)/2
+// elements with unit stride.
+static void bli_bandpack_packed_check
+     (
+       obj_t*  ap,
+       dim_t   m
+     )
+{
+	err_t e_val;
+
+	e_val = bli_check_vector_object( ap );
+	bli_check_error_code( e_val );
+
+	e_val = bli_check_vector_dim_equals( ap, ( m * ( m + 1 ) ) / 2 );
+	bli_check_error_code( e_val );
+
+	if ( m > 1 && bli_obj_vector_inc( ap ) != 1 )
+		bli_check_error_code( BLIS_INVALID_DIM_STRIDE_COMBINATION );
+}
+
+
+void bli_gbmv_check
+     (
+       dim_t   kl,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  x,
+       obj_t*  beta,
+       obj_t*  y 
+     )
+{
+	err_t e_val;
+
+	bli_bandpack_xxmv_check( alpha, a, x, beta, y );
+
+	// Check that the band (which holds kl subdiagonals and the diagonal)
+	// fits within the storage of A.
+
+	if ( kl < 0 || bli_obj_length( a ) <= kl )
+		bli_check_error_code( BLIS_UNEXPECTED_OBJECT_LENGTH );
+
+	// Check object dimensions. Only one of x and y is tied to the number
+	// of columns of A.
+
+	if ( bli_obj_has_notrans( a ) )
+		e_val = bli_check_vector_dim_equals( x, bli_obj_width( a ) );
+	else
+		e_val = bli_check_vector_dim_equals( y, bli_obj_width( a ) );
+	bli_check_error_code( e_val );
+}
+
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  a, \
+       obj_t*  x, \
+       obj_t*  beta, \
+       obj_t*  y  \
+     ) \
+{ \
+	err_t e_val; \
+\
+	bli_bandpack_xxmv_check( alpha, a, x, beta, y ); \
+\
+	/* Check object dimensions. */ \
+\
+	e_val = bli_check_vector_dim_equals( x, bli_obj_width( a ) ); \
+	bli_check_error_code( e_val ); \
+\
+	e_val = bli_check_vector_dim_equals( y, bli_obj_width( a ) ); \
+	bli_check_error_code( e_val ); \
+\
+	/* Check matrix storage. */ \
+\
+	e_val = bli_check_upper_or_lower_object( a ); \
+	bli_check_error_code( e_val ); \
+}
+
+GENFRONT( hbmv )
+GENFRONT( sbmv )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  a, \
+       obj_t*  x, \
+       obj_t*  beta, \
+       obj_t*  y  \
+     ) \
+{ \
+	err_t e_val; \
+\
+	bli_bandpack_xxmv_check( alpha, a, x, beta, y ); \
+\
+	/* Check object dimensions. */ \
+\
+	bli_bandpack_packed_check( a, bli_obj_vector_dim( x ) ); \
+\
+	e_val = bli_check_equal_vector_lengths( x, y ); \
+	bli_check_error_code( e_val ); \
+\
+	/* Check matrix storage. */ \
+\
+	e_val = bli_check_upper_or_lower_object( a ); \
+	bli_check_error_code( e_val ); \
+}
+
+GENFRONT( hpmv )
+GENFRONT( spmv )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  a, \
+       obj_t*  x  \
+     ) \
+{ \
+	err_t e_val; \
+\
+	bli_bandpack_xxmv_check( alpha, a, x, NULL, NULL ); \
+\
+	/* Check object dimensions. */ \
+\
+	e_val = bli_check_vector_dim_equals( x, bli_obj_width( a ) ); \
+	bli_check_error_code( e_val ); \
+\
+	/* Check matrix storage. */ \
+\
+	e_val = bli_check_upper_or_lower_object( a ); \
+	bli_check_error_code( e_val ); \
+}
+
+GENFRONT( tbmv )
+GENFRONT( tbsv )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  a, \
+       obj_t*  x  \
+     ) \
+{ \
+	err_t e_val; \
+\
+	bli_bandpack_xxmv_check( alpha, a, x, NULL, NULL ); \
+\
+	/* Check object dimensions. */ \
+\
+	bli_bandpack_packed_check( a, bli_obj_vector_dim( x ) ); \
+\
+	/* Check matrix storage. */ \
+\
+	e_val = bli_check_upper_or_lower_object( a ); \
+	bli_check_error_code( e_val ); \
+}
+
+GENFRONT( tpmv )
+GENFRONT( tpsv )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  x, \
+       obj_t*  a  \
+     ) \
+{ \
+	err_t e_val; \
+\
+	bli_bandpack_xxmv_check( alpha, a, x, NULL, NULL ); \
+\
+	/* Check object dimensions. */ \
+\
+	bli_bandpack_packed_check( a, bli_obj_vector_dim( x ) ); \
+\
+	/* Check matrix storage. */ \
+\
+	e_val = bli_check_upper_or_lower_object( a ); \
+	bli_check_error_code( e_val ); \
+}
+
+GENFRONT( hpr )
+GENFRONT( spr )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,_check) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  x, \
+       obj_t*  y, \
+       obj_t*  a  \
+     ) \
+{ \
+	err_t e_val; \
+\
+	bli_bandpack_xxmv_check( alpha, a, x, NULL, y ); \
+\
+	/* Check object dimensions. */ \
+\
+	bli_bandpack_packed_check( a, bli_obj_vector_dim( x ) ); \
+\
+	e_val = bli_check_equal_vector_lengths( x, y ); \
+	bli_check_error_code( e_val ); \
+\
+	/* Check matrix storage. */ \
+\
+	e_val = bli_check_upper_or_lower_object( a ); \
+	bli_check_error_code( e_val ); \
+}
+
+GENFRONT( hpr2 )
+GENFRONT( spr2 )
+
@@ -0,0 +1,690 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Describe the m x n banded matrix A whose (kl+ku+1) x n band storage is
+// given by the object a. Row ks of the band storage holds the diagonal.
+static void bli_bpmat_init_band
+     (
+       obj_t*   a,
+       dim_t    m,
+       dim_t    n,
+       dim_t    kl,
+       dim_t    ku,
+       doff_t   ks,
+       bpmat_t* bp
+     )
+{
+	bp->buf    = bli_obj_buffer_at_off( a );
+	bp->packed = FALSE;
+	bp->rs     = bli_obj_row_stride( a );
+	bp->cs     = bli_obj_col_stride( a );
+	bp->ks     = ks;
+
+	bp->m      = m;
+	bp->n      = n;
+	bp->kl     = kl;
+	bp->ku     = ku;
+
+	bp->uplo   = bli_obj_uplo( a );
+	bp->trans  = bli_obj_conjtrans_status( a );
+	bp->conjh  = BLIS_NO_CONJUGATE;
+	bp->diag   = bli_obj_diag( a );
+}
+
+// Describe the m x m matrix A whose upper or lower triangle is packed by
+// columns into the vector object ap.
+static void bli_bpmat_init_packed
+     (
+       obj_t*   ap,
+       dim_t    m,
+       bpmat_t* bp
+     )
+{
+	const uplo_t uplo = bli_obj_uplo( ap );
+
+	bp->buf    = bli_obj_buffer_at_off( ap );
+	bp->packed = TRUE;
+	bp->rs     = 1;
+	bp->cs     = 1;
+	bp->ks     = 0;
+
+	bp->m      = m;
+	bp->n      = m;
+	bp->kl     = ( bli_is_lower( uplo ) ? m - 1 : 0 );
+	bp->ku     = ( bli_is_upper( uplo ) ? m - 1 : 0 );
+
+	bp->uplo   = uplo;
+	bp->trans  = bli_obj_conjtrans_status( ap );
+	bp->conjh  = BLIS_NO_CONJUGATE;
+	bp->diag   = bli_obj_diag( ap );
+}
+
+// Return the number of threads to use for an operation that references work
+// elements of A: the number requested via rntm (or the global settings if
+// rntm is NULL), but no more than gives each thread BLIS_THREAD_L2_MIN_ELEMS
+// elements, since a thread that streams through less than that cannot
+// recoup the cost of its own startup.
+static dim_t bli_bandpack_num_threads
+     (
+       dim_t   work,
+       rntm_t* rntm
+     )
+{
+#ifdef BLIS_ENABLE_MULTITHREADING
+	rntm_t rntm_l;
+
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+
+	dim_t nt = bli_rntm_num_threads( rntm );
+
+	// If only the ways of parallelism were given, use as many threads as
+	// they imply in total; all of them are assigned to a single loop.
+	if ( nt < 1 )
+	{
+		nt  = bli_max( bli_rntm_jc_ways( rntm ), 1 );
+		nt *= bli_max( bli_rntm_pc_ways( rntm ), 1 );
+		nt *= bli_max( bli_rntm_ic_ways( rntm ), 1 );
+		nt *= bli_max( bli_rntm_jr_ways( rntm ), 1 );
+		nt *= bli_max( bli_rntm_ir_ways( rntm ), 1 );
+	}
+
+	return bli_min( nt, bli_max( work / BLIS_THREAD_L2_MIN_ELEMS, 1 ) );
+#else
+	( void )work;
+	( void )rntm;
+
+	return 1;
+#endif
+}
+
+// The arguments of a threaded variant, as passed to each thread by
+// bli_thread_launch().
+typedef struct bpparams_s
+{
+	bpint_t  func;
+	bpmat_t* a;
+	obj_t*   alpha;
+	obj_t*   x;
+	obj_t*   beta;
+	obj_t*   y;
+	cntx_t*  cntx;
+} bpparams_t;
+
+static void bli_bandpack_thread_entry
+     (
+       thrcomm_t*  gl_comm,
+       dim_t       tid,
+       const void* params
+     )
+{
+	const bpparams_t* p = params;
+
+	thrinfo_t thread;
+
+	// All of the threads partition a single loop.
+	bli_thrinfo_init
+	(
+	  &thread,
+	  gl_comm,
+	  tid,
+	  bli_thrcomm_num_threads( gl_comm ),
+	  tid,
+	  FALSE,
+	  BLIS_NO_PART,
+	  NULL
+	);
+
+	p->func( p->a, p->alpha, p->x, p->beta, p->y, p->cntx, &thread );
+}
+
+// Run one of the variants on nt threads.
+static void bli_bandpack_launch
+     (
+       bpint_t  func,
+       dim_t    nt,
+       bpmat_t* a,
+       obj_t*   alpha,
+       obj_t*   x,
+       obj_t*   beta,
+       obj_t*   y,
+       cntx_t*  cntx
+     )
+{
+	const bpparams_t params =
+	{
+	  .func  = func,
+	  .a     = a,
+	  .alpha = alpha,
+	  .x     = x,
+	  .beta  = beta,
+	  .y     = y,
+	  .cntx  = cntx,
+	};
+
+	bli_thread_launch( nt, bli_bandpack_thread_entry, &params );
+}
+
+// Compute y := beta * y + alpha * A * x, where A is described by bp and x
+// and y are already conformal to it.
+static void bli_bpmv_launch
+     (
+       bpint_t  func,
+       bpmat_t* bp,
+       dim_t    nt,
+       obj_t*   alpha,
+       obj_t*   x,
+       obj_t*   beta,
+       obj_t*   y,
+       cntx_t*  cntx
+     )
+{
+	const num_t dt = bli_obj_dt( y );
+
+	obj_t alpha_local;
+	obj_t beta_local;
+
+	// Create local copies of the scalars in the datatype of y.
+	bli_obj_scalar_init_detached_copy_of( dt, BLIS_NO_CONJUGATE,
+	                                      alpha, &alpha_local );
+	bli_obj_scalar_init_detached_copy_of( dt, BLIS_NO_CONJUGATE,
+	                                      beta, &beta_local );
+
+	bli_bandpack_launch
+	(
+	  func,
+	  nt,
+	  bp,
+	  &alpha_local,
+	  x,
+	  &beta_local,
+	  y,
+	  cntx
+	);
+}
+
+// Compute x := alpha * transa( A ) * x, where A is a triangular matrix
+// described by bp.
+static void bli_bptmv_launch
+     (
+       bpmat_t* bp,
+       dim_t    work,
+       obj_t*   alpha,
+       obj_t*   x,
+       cntx_t*  cntx,
+       rntm_t*  rntm
+     )
+{
+	const num_t dt = bli_obj_dt( x );
+	const dim_t nt = bli_bandpack_num_threads( work, rntm );
+
+	obj_t w;
+
+	// A single thread computes the product in place.
+	if ( nt == 1 )
+	{
+		obj_t alpha_local;
+
+		bli_obj_scalar_init_detached_copy_of( dt, BLIS_NO_CONJUGATE,
+		                                      alpha, &alpha_local );
+
+		bli_bpmv_tri_int( bp, &alpha_local, x, cntx );
+		return;
+	}
+
+	// Exclude an implicit unit diagonal from the band; the variant adds
+	// it in separately.
+	if ( bli_is_unit_diag( bp->diag ) )
+	{
+		if ( bli_is_upper( bp->uplo ) ) bp->kl = -1;
+		else                            bp->ku = -1;
+	}
+
+	// Otherwise, every element of x is needed to compute each element of
+	// the result, so the product is computed from a copy of x and written
+	// into x.
+	bli_obj_create( dt, bli_obj_vector_dim( x ), 1, 0, 0, &w );
+	bli_copyv_ex( x, &w, cntx, rntm );
+
+	bli_bpmv_launch
+	(
+	  bli_bpmv_gen_int,
+	  bp,
+	  nt,
+	  alpha,
+	  &w,
+	  &BLIS_ZERO,
+	  x,
+	  cntx
+	);
+
+	bli_obj_free( &w );
+}
+
+// Solve transa( A ) * x = alpha * x, where A is a triangular matrix
+// described by bp.
+static void bli_bptsv_launch
+     (
+       bpmat_t* bp,
+       obj_t*   alpha,
+       obj_t*   x,
+       cntx_t*  cntx
+     )
+{
+	obj_t alpha_local;
+
+	bli_obj_scalar_init_detached_copy_of( bli_obj_dt( x ), BLIS_NO_CONJUGATE,
+	                                      alpha, &alpha_local );
+
+	bli_bpsv_int( bp, &alpha_local, x, cntx );
+}
+
+// Compute A := A + alpha * x * y^H (+ conj( alpha ) * y * x^H), where the
+// stored triangle of A is packed into ap. If y is NULL, the rank-1 update
+// A := A + alpha * x * x^H is computed instead.
+static void bli_bpr_launch
+     (
+       conj_t  conjh,
+       obj_t*  alpha,
+       obj_t*  x,
+       obj_t*  y,
+       obj_t*  ap,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	const num_t dt = bli_obj_dt( ap );
+	const dim_t m  = bli_obj_vector_dim( x );
+
+	bpmat_t bp;
+	obj_t   alpha_local;
+
+	// If x has a zero dimension, or if alpha is zero, return early.
+	if ( m == 0 || bli_obj_equals( alpha, &BLIS_ZERO ) ) return;
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	bli_obj_scalar_init_detached_copy_of( dt, BLIS_NO_CONJUGATE,
+	                                      alpha, &alpha_local );
+
+	bli_bpmat_init_packed( ap, m, &bp );
+	bp.conjh = conjh;
+
+	bli_bandpack_launch
+	(
+	  ( y == NULL ? bli_bpr_int : bli_bpr2_int ),
+	  bli_bandpack_num_threads( ( m * ( m + 1 ) ) / 2, rntm ),
+	  &bp,
+	  &alpha_local,
+	  x,
+	  NULL,
+	  y,
+	  cntx
+	);
+}
+
+
+void bli_gbmv_front
+     (
+       dim_t   kl,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  x,
+       obj_t*  beta,
+       obj_t*  y,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	const bool  notrans = bli_obj_has_notrans( a );
+	const dim_t n       = bli_obj_width( a );
+	const dim_t m       = bli_obj_vector_dim( notrans ? y : x );
+	const dim_t ku      = bli_obj_length( a ) - kl - 1;
+
+	bpmat_t bp;
+
+	// If y has a zero dimension, return early.
+	if ( bli_obj_has_zero_dim( y ) ) return;
+
+	// If alpha is zero, or if x has a zero dimension, scale y by beta and
+	// return early.
+	if ( bli_obj_equals( alpha, &BLIS_ZERO ) ||
+	     bli_obj_has_zero_dim( x ) )
+	{
+		bli_scalv_ex( beta, y, cntx, rntm );
+		return;
+	}
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	bli_bpmat_init_band( a, m, n, kl, ku, ku, &bp );
+	bp.uplo = BLIS_DENSE;
+	bp.diag = BLIS_NONUNIT_DIAG;
+
+	bli_bpmv_launch
+	(
+	  bli_bpmv_gen_int,
+	  &bp,
+	  bli_bandpack_num_threads( ( kl + ku + 1 ) * n, rntm ),
+	  alpha,
+	  x,
+	  beta,
+	  y,
+	  cntx
+	);
+}
+
+
+#undef  GENFRONT
+#define GENFRONT( opname, conjhval ) \
+\
+void PASTEMAC(opname,_front) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  a, \
+       obj_t*  x, \
+       obj_t*  beta, \
+       obj_t*  y, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	const dim_t m = bli_obj_width( a ); \
+	const dim_t k = bli_obj_length( a ) - 1; \
+\
+	bpmat_t bp; \
+\
+	/* If y has a zero dimension, return early. */ \
+	if ( bli_obj_has_zero_dim( y ) ) return; \
+\
+	/* If alpha is zero, scale y by beta and return early. */ \
+	if ( bli_obj_equals( alpha, &BLIS_ZERO ) ) \
+	{ \
+		bli_scalv_ex( beta, y, cntx, rntm ); \
+		return; \
+	} \
+\
+	/* Obtain a valid (native) context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	/* Only the stored triangle of the band is referenced. */ \
+	if ( bli_obj_is_upper( a ) ) bli_bpmat_init_band( a, m, m, 0, k, k, &bp ); \
+	else                         bli_bpmat_init_band( a, m, m, k, 0, 0, &bp ); \
+	bp.conjh = conjhval; \
+\
+	bli_bpmv_launch \
+	( \
+	  bli_bpmv_her_int, \
+	  &bp, \
+	  bli_bandpack_num_threads( ( 2 * k + 1 ) * m, rntm ), \
+	  alpha, \
+	  x, \
+	  beta, \
+	  y, \
+	  cntx  \
+	); \
+}
+
+GENFRONT( hbmv, BLIS_CONJUGATE )
+GENFRONT( sbmv, BLIS_NO_CONJUGATE )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname, conjhval ) \
+\
+void PASTEMAC(opname,_front) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  a, \
+       obj_t*  x, \
+       obj_t*  beta, \
+       obj_t*  y, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	const dim_t m = bli_obj_vector_dim( x ); \
+\
+	bpmat_t bp; \
+\
+	/* If y has a zero dimension, return early. */ \
+	if ( bli_obj_has_zero_dim( y ) ) return; \
+\
+	/* If alpha is zero, scale y by beta and return early. */ \
+	if ( bli_obj_equals( alpha, &BLIS_ZERO ) ) \
+	{ \
+		bli_scalv_ex( beta, y, cntx, rntm ); \
+		return; \
+	} \
+\
+	/* Obtain a valid (native) context from the gks if necessary. */ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
+\
+	bli_bpmat_init_packed( a, m, &bp ); \
+	bp.conjh = conjhval; \
+\
+	bli_bpmv_launch \
+	( \
+	  bli_bpmv_her_int, \
+	  &bp, \
+	  bli_bandpack_num_threads( m * m, rntm ), \
+	  alpha, \
+	  x, \
+	  beta, \
+	  y, \
+	  cntx  \
+	); \
+}
+
+GENFRONT( hpmv, BLIS_CONJUGATE )
+GENFRONT( spmv, BLIS_NO_CONJUGATE )
+
+
+void bli_tbmv_front
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  x,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	const dim_t m = bli_obj_width( a );
+	const dim_t k = bli_obj_length( a ) - 1;
+
+	bpmat_t bp;
+
+	// If x has a zero dimension, return early.
+	if ( bli_obj_has_zero_dim( x ) ) return;
+
+	// If alpha is zero, set x to zero and return early.
+	if ( bli_obj_equals( alpha, &BLIS_ZERO ) )
+	{
+		bli_setv_ex( &BLIS_ZERO, x, cntx, rntm );
+		return;
+	}
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	if ( bli_obj_is_upper( a ) ) bli_bpmat_init_band( a, m, m, 0, k, k, &bp );
+	else                         bli_bpmat_init_band( a, m, m, k, 0, 0, &bp );
+
+	bli_bptmv_launch( &bp, ( k + 1 ) * m, alpha, x, cntx, rntm );
+}
+
+void bli_tpmv_front
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  x,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	const dim_t m = bli_obj_vector_dim( x );
+
+	bpmat_t bp;
+
+	// If x has a zero dimension, return early.
+	if ( bli_obj_has_zero_dim( x ) ) return;
+
+	// If alpha is zero, set x to zero and return early.
+	if ( bli_obj_equals( alpha, &BLIS_ZERO ) )
+	{
+		bli_setv_ex( &BLIS_ZERO, x, cntx, rntm );
+		return;
+	}
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	bli_bpmat_init_packed( a, m, &bp );
+
+	bli_bptmv_launch( &bp, ( m * ( m + 1 ) ) / 2, alpha, x, cntx, rntm );
+}
+
+void bli_tbsv_front
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  x,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	const dim_t m = bli_obj_width( a );
+	const dim_t k = bli_obj_length( a ) - 1;
+
+	bpmat_t bp;
+
+	// The solve is not threaded.
+	( void )rntm;
+
+	// If x has a zero dimension, return early.
+	if ( bli_obj_has_zero_dim( x ) ) return;
+
+	// If alpha is zero, set x to zero and return early.
+	if ( bli_obj_equals( alpha, &BLIS_ZERO ) )
+	{
+		bli_setv_ex( &BLIS_ZERO, x, cntx, rntm );
+		return;
+	}
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	if ( bli_obj_is_upper( a ) ) bli_bpmat_init_band( a, m, m, 0, k, k, &bp );
+	else                         bli_bpmat_init_band( a, m, m, k, 0, 0, &bp );
+
+	bli_bptsv_launch( &bp, alpha, x, cntx );
+}
+
+void bli_tpsv_front
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  x,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	const dim_t m = bli_obj_vector_dim( x );
+
+	bpmat_t bp;
+
+	// The solve is not threaded.
+	( void )rntm;
+
+	// If x has a zero dimension, return early.
+	if ( bli_obj_has_zero_dim( x ) ) return;
+
+	// If alpha is zero, set x to zero and return early.
+	if ( bli_obj_equals( alpha, &BLIS_ZERO ) )
+	{
+		bli_setv_ex( &BLIS_ZERO, x, cntx, rntm );
+		return;
+	}
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	bli_bpmat_init_packed( a, m, &bp );
+
+	bli_bptsv_launch( &bp, alpha, x, cntx );
+}
+
+
+#undef  GENFRONT
+#define GENFRONT( opname, conjhval ) \
+\
+void PASTEMAC(opname,_front) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  x, \
+       obj_t*  a, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	bli_bpr_launch( conjhval, alpha, x, NULL, a, cntx, rntm ); \
+}
+
+GENFRONT( hpr, BLIS_CONJUGATE )
+GENFRONT( spr, BLIS_NO_CONJUGATE )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname, conjhval ) \
+\
+void PASTEMAC(opname,_front) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  x, \
+       obj_t*  y, \
+       obj_t*  a, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	bli_bpr_launch( conjhval, alpha, x, y, a, cntx, rntm ); \
+}
+
+GENFRONT( hpr2, BLIS_CONJUGATE )
+GENFRONT( spr2, BLIS_NO_CONJUGATE )
+
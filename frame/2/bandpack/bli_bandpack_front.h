@@ -0,0 +1,117 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+void bli_gbmv_front
+     (
+       dim_t   kl,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  x,
+       obj_t*  beta,
+       obj_t*  y,
+       cntx_t* cntx,
+       rntm_t* rntm
+     );
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+void PASTEMAC(opname,_front) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  a, \
+       obj_t*  x, \
+       obj_t*  beta, \
+       obj_t*  y, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     );
+
+GENPROT( hbmv )
+GENPROT( sbmv )
+GENPROT( hpmv )
+GENPROT( spmv )
+
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+void PASTEMAC(opname,_front) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  a, \
+       obj_t*  x, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     );
+
+GENPROT( tbmv )
+GENPROT( tpmv )
+GENPROT( tbsv )
+GENPROT( tpsv )
+
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+void PASTEMAC(opname,_front) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  x, \
+       obj_t*  a, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     );
+
+GENPROT( hpr )
+GENPROT( spr )
+
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+void PASTEMAC(opname,_front) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  x, \
+       obj_t*  y, \
+       obj_t*  a, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     );
+
+GENPROT( hpr2 )
+GENPROT( spr2 )
+
@@ -0,0 +1,215 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+// Guard the function definitions so that they are only compiled when
+// #included from files that define the object API macros.
+#ifdef BLIS_ENABLE_OAPI
+
+//
+// Define object-based interfaces.
+//
+
+void PASTEMAC(gbmv,EX_SUF)
+     (
+       dim_t   kl,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  x,
+       obj_t*  beta,
+       obj_t*  y
+       BLIS_OAPI_EX_PARAMS
+     )
+{
+	bli_init_once();
+
+	BLIS_OAPI_EX_DECLS
+
+	if ( bli_error_checking_is_enabled() )
+	    bli_gbmv_check( kl, alpha, a, x, beta, y );
+
+	bli_gbmv_front
+	(
+	  kl,
+	  alpha,
+	  a,
+	  x,
+	  beta,
+	  y,
+	  cntx,
+	  rntm
+	);
+}
+
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,EX_SUF) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  a, \
+       obj_t*  x, \
+       obj_t*  beta, \
+       obj_t*  y  \
+       BLIS_OAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_OAPI_EX_DECLS \
+\
+	if ( bli_error_checking_is_enabled() ) \
+	    PASTEMAC(opname,_check)( alpha, a, x, beta, y ); \
+\
+	PASTEMAC(opname,_front) \
+	( \
+	  alpha, \
+	  a, \
+	  x, \
+	  beta, \
+	  y, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+GENFRONT( hbmv )
+GENFRONT( sbmv )
+GENFRONT( hpmv )
+GENFRONT( spmv )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,EX_SUF) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  a, \
+       obj_t*  x  \
+       BLIS_OAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_OAPI_EX_DECLS \
+\
+	if ( bli_error_checking_is_enabled() ) \
+	    PASTEMAC(opname,_check)( alpha, a, x ); \
+\
+	PASTEMAC(opname,_front) \
+	( \
+	  alpha, \
+	  a, \
+	  x, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+GENFRONT( tbmv )
+GENFRONT( tpmv )
+GENFRONT( tbsv )
+GENFRONT( tpsv )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,EX_SUF) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  x, \
+       obj_t*  a  \
+       BLIS_OAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_OAPI_EX_DECLS \
+\
+	if ( bli_error_checking_is_enabled() ) \
+	    PASTEMAC(opname,_check)( alpha, x, a ); \
+\
+	PASTEMAC(opname,_front) \
+	( \
+	  alpha, \
+	  x, \
+	  a, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+GENFRONT( hpr )
+GENFRONT( spr )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+void PASTEMAC(opname,EX_SUF) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  x, \
+       obj_t*  y, \
+       obj_t*  a  \
+       BLIS_OAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_OAPI_EX_DECLS \
+\
+	if ( bli_error_checking_is_enabled() ) \
+	    PASTEMAC(opname,_check)( alpha, x, y, a ); \
+\
+	PASTEMAC(opname,_front) \
+	( \
+	  alpha, \
+	  x, \
+	  y, \
+	  a, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+GENFRONT( hpr2 )
+GENFRONT( spr2 )
+
+
+#endif
+
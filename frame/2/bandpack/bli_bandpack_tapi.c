@@ -0,0 +1,464 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+// Guard the function definitions so that they are only compiled when
+// #included from files that define the typed API macros.
+#ifdef BLIS_ENABLE_TAPI
+
+//
+// Define BLAS-like interfaces with typed operands.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       trans_t transa, \
+       conj_t  conjx, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   kl, \
+       dim_t   ku, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	obj_t       alphao = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       ao     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       xo     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       betao  = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       yo     = BLIS_OBJECT_INITIALIZER; \
+\
+	dim_t       m_x, m_y; \
+\
+	bli_set_dims_with_trans( transa, n, m, &m_x, &m_y ); \
+\
+	bli_obj_init_finish_1x1( dt, alpha, &alphao ); \
+	bli_obj_init_finish_1x1( dt, beta,  &betao  ); \
+\
+	bli_obj_init_finish( dt, kl + ku + 1, n, a, rs_a, cs_a, &ao ); \
+	bli_obj_init_finish( dt, m_x, 1, x, incx, m_x, &xo ); \
+	bli_obj_init_finish( dt, m_y, 1, y, incy, m_y, &yo ); \
+\
+	bli_obj_set_conjtrans( transa, &ao ); \
+	bli_obj_set_conj( conjx, &xo ); \
+\
+	PASTEMAC(opname,_front) \
+	( \
+	  kl, \
+	  &alphao, \
+	  &ao, \
+	  &xo, \
+	  &betao, \
+	  &yo, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( gbmv )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conja, \
+       conj_t  conjx, \
+       dim_t   m, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	obj_t       alphao = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       ao     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       xo     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       betao  = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       yo     = BLIS_OBJECT_INITIALIZER; \
+\
+	bli_obj_init_finish_1x1( dt, alpha, &alphao ); \
+	bli_obj_init_finish_1x1( dt, beta,  &betao  ); \
+\
+	bli_obj_init_finish( dt, k + 1, m, a, rs_a, cs_a, &ao ); \
+	bli_obj_init_finish( dt, m, 1, x, incx, m, &xo ); \
+	bli_obj_init_finish( dt, m, 1, y, incy, m, &yo ); \
+\
+	bli_obj_set_uplo( uploa, &ao ); \
+	bli_obj_set_conj( conja, &ao ); \
+	bli_obj_set_conj( conjx, &xo ); \
+\
+	PASTEMAC(opname,_front) \
+	( \
+	  &alphao, \
+	  &ao, \
+	  &xo, \
+	  &betao, \
+	  &yo, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( hbmv )
+INSERT_GENTFUNC_BASIC0( sbmv )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conja, \
+       conj_t  conjx, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  ap, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+	const dim_t mp = ( m * ( m + 1 ) ) / 2; \
+\
+	obj_t       alphao = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       apo    = BLIS_OBJECT_INITIALIZER; \
+	obj_t       xo     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       betao  = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       yo     = BLIS_OBJECT_INITIALIZER; \
+\
+	bli_obj_init_finish_1x1( dt, alpha, &alphao ); \
+	bli_obj_init_finish_1x1( dt, beta,  &betao  ); \
+\
+	bli_obj_init_finish( dt, mp, 1, ap, 1, mp, &apo ); \
+	bli_obj_init_finish( dt, m, 1, x, incx, m, &xo ); \
+	bli_obj_init_finish( dt, m, 1, y, incy, m, &yo ); \
+\
+	bli_obj_set_uplo( uploa, &apo ); \
+	bli_obj_set_conj( conja, &apo ); \
+	bli_obj_set_conj( conjx, &xo ); \
+\
+	PASTEMAC(opname,_front) \
+	( \
+	  &alphao, \
+	  &apo, \
+	  &xo, \
+	  &betao, \
+	  &yo, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( hpmv )
+INSERT_GENTFUNC_BASIC0( spmv )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       dim_t   m, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	obj_t       alphao = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       ao     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       xo     = BLIS_OBJECT_INITIALIZER; \
+\
+	bli_obj_init_finish_1x1( dt, alpha, &alphao ); \
+\
+	bli_obj_init_finish( dt, k + 1, m, a, rs_a, cs_a, &ao ); \
+	bli_obj_init_finish( dt, m, 1, x, incx, m, &xo ); \
+\
+	bli_obj_set_uplo( uploa, &ao ); \
+	bli_obj_set_conjtrans( transa, &ao ); \
+	bli_obj_set_diag( diaga, &ao ); \
+\
+	PASTEMAC(opname,_front) \
+	( \
+	  &alphao, \
+	  &ao, \
+	  &xo, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( tbmv )
+INSERT_GENTFUNC_BASIC0( tbsv )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  ap, \
+       ctype*  x, inc_t incx  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+	const dim_t mp = ( m * ( m + 1 ) ) / 2; \
+\
+	obj_t       alphao = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       apo    = BLIS_OBJECT_INITIALIZER; \
+	obj_t       xo     = BLIS_OBJECT_INITIALIZER; \
+\
+	bli_obj_init_finish_1x1( dt, alpha, &alphao ); \
+\
+	bli_obj_init_finish( dt, mp, 1, ap, 1, mp, &apo ); \
+	bli_obj_init_finish( dt, m, 1, x, incx, m, &xo ); \
+\
+	bli_obj_set_uplo( uploa, &apo ); \
+	bli_obj_set_conjtrans( transa, &apo ); \
+	bli_obj_set_diag( diaga, &apo ); \
+\
+	PASTEMAC(opname,_front) \
+	( \
+	  &alphao, \
+	  &apo, \
+	  &xo, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( tpmv )
+INSERT_GENTFUNC_BASIC0( tpsv )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t   uploa, \
+       conj_t   conjx, \
+       dim_t    m, \
+       ctype_r* alpha, \
+       ctype*   x, inc_t incx, \
+       ctype*   ap  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	const num_t dt   = PASTEMAC(ch,type); \
+	const num_t dt_r = PASTEMAC(chr,type); \
+	const dim_t mp   = ( m * ( m + 1 ) ) / 2; \
+\
+	obj_t       alphao = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       xo     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       apo    = BLIS_OBJECT_INITIALIZER; \
+\
+	bli_obj_init_finish_1x1( dt_r, alpha, &alphao ); \
+\
+	bli_obj_init_finish( dt, m, 1, x, incx, m, &xo ); \
+	bli_obj_init_finish( dt, mp, 1, ap, 1, mp, &apo ); \
+\
+	bli_obj_set_conj( conjx, &xo ); \
+	bli_obj_set_uplo( uploa, &apo ); \
+\
+	PASTEMAC(opname,_front) \
+	( \
+	  &alphao, \
+	  &xo, \
+	  &apo, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNCR_BASIC0( hpr )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conjx, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  x, inc_t incx, \
+       ctype*  ap  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+	const dim_t mp = ( m * ( m + 1 ) ) / 2; \
+\
+	obj_t       alphao = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       xo     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       apo    = BLIS_OBJECT_INITIALIZER; \
+\
+	bli_obj_init_finish_1x1( dt, alpha, &alphao ); \
+\
+	bli_obj_init_finish( dt, m, 1, x, incx, m, &xo ); \
+	bli_obj_init_finish( dt, mp, 1, ap, 1, mp, &apo ); \
+\
+	bli_obj_set_conj( conjx, &xo ); \
+	bli_obj_set_uplo( uploa, &apo ); \
+\
+	PASTEMAC(opname,_front) \
+	( \
+	  &alphao, \
+	  &xo, \
+	  &apo, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( spr )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+void PASTEMAC2(ch,opname,EX_SUF) \
+     ( \
+       uplo_t  uploa, \
+       conj_t  conjx, \
+       conj_t  conjy, \
+       dim_t   m, \
+       ctype*  alpha, \
+       ctype*  x, inc_t incx, \
+       ctype*  y, inc_t incy, \
+       ctype*  ap  \
+       BLIS_TAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_TAPI_EX_DECLS \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+	const dim_t mp = ( m * ( m + 1 ) ) / 2; \
+\
+	obj_t       alphao = BLIS_OBJECT_INITIALIZER_1X1; \
+	obj_t       xo     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       yo     = BLIS_OBJECT_INITIALIZER; \
+	obj_t       apo    = BLIS_OBJECT_INITIALIZER; \
+\
+	bli_obj_init_finish_1x1( dt, alpha, &alphao ); \
+\
+	bli_obj_init_finish( dt, m, 1, x, incx, m, &xo ); \
+	bli_obj_init_finish( dt, m, 1, y, incy, m, &yo ); \
+	bli_obj_init_finish( dt, mp, 1, ap, 1, mp, &apo ); \
+\
+	bli_obj_set_conj( conjx, &xo ); \
+	bli_obj_set_conj( conjy, &yo ); \
+	bli_obj_set_uplo( uploa, &apo ); \
+\
+	PASTEMAC(opname,_front) \
+	( \
+	  &alphao, \
+	  &xo, \
+	  &yo, \
+	  &apo, \
+	  cntx, \
+	  rntm  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( hpr2 )
+INSERT_GENTFUNC_BASIC0( spr2 )
+
+
+#endif
+
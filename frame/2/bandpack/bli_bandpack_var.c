@@ -0,0 +1,1330 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+// Find the range of indices [start,end) of the vector of length n (which
+// is either y or the columns of A) that is assigned to the current thread.
+// For packed matrices, the number of stored elements varies linearly with
+// the index, so the range is chosen to balance the area of the triangle
+// rather than the length of the vector.
+static void bli_bpmat_range
+     (
+       thrinfo_t* thread,
+       bool       packed,
+       uplo_t     uplo,
+       dim_t      n,
+       dim_t*     start,
+       dim_t*     end
+     )
+{
+	if ( packed )
+		bli_thread_range_weighted_sub( thread, 0, uplo, n, n, 1, FALSE, start, end );
+	else
+		bli_thread_range_sub( thread, n, 1, FALSE, start, end );
+}
+
+
+//
+// Within a narrow band, the columns (and rows) of A are only a few elements
+// long, so the cost of calling a level-1v kernel would exceed the cost of
+// the work it performs. These wrappers perform such short operations inline
+// and defer to the kernel otherwise.
+//
+
+// y := y + alpha * conjx( x )
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+BLIS_INLINE void PASTEMAC(ch,opname) \
+     ( \
+       PASTECH(ch,axpyv_ker_ft) kfp, \
+       conj_t     conjx, \
+       dim_t      n, \
+       ctype*     alpha, \
+       ctype*     x, inc_t incx, \
+       ctype*     y, inc_t incy, \
+       cntx_t*    cntx  \
+     ) \
+{ \
+	if ( BLIS_BANDPACK_KER_MIN_LEN <= n ) \
+	{ \
+		kfp( conjx, n, alpha, x, incx, y, incy, cntx ); \
+	} \
+	else if ( bli_is_conj( conjx ) ) \
+	{ \
+		for ( dim_t i = 0; i < n; ++i ) \
+			PASTEMAC(ch,axpyjs)( *alpha, x[ i*incx ], y[ i*incy ] ); \
+	} \
+	else \
+	{ \
+		for ( dim_t i = 0; i < n; ++i ) \
+			PASTEMAC(ch,axpys)( *alpha, x[ i*incx ], y[ i*incy ] ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( bpaxpyv )
+
+
+// rho := beta * rho + alpha * conjx( x )^T * conjy( y )
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+BLIS_INLINE void PASTEMAC(ch,opname) \
+     ( \
+       PASTECH(ch,dotxv_ker_ft) kfp, \
+       conj_t     conjx, \
+       conj_t     conjy, \
+       dim_t      n, \
+       ctype*     alpha, \
+       ctype*     x, inc_t incx, \
+       ctype*     y, inc_t incy, \
+       ctype*     beta, \
+       ctype*     rho, \
+       cntx_t*    cntx  \
+     ) \
+{ \
+	if ( BLIS_BANDPACK_KER_MIN_LEN <= n ) \
+	{ \
+		kfp( conjx, conjy, n, alpha, x, incx, y, incy, beta, rho, cntx ); \
+		return; \
+	} \
+\
+	ctype dotxy; \
+\
+	PASTEMAC(ch,set0s)( dotxy ); \
+\
+	/* If y must be conjugated, we do so indirectly by first toggling the
+	   effective conjugation of x and then conjugating the resulting dot
+	   product. */ \
+	if ( bli_is_conj( bli_apply_conj( conjy, conjx ) ) ) \
+	{ \
+		for ( dim_t i = 0; i < n; ++i ) \
+			PASTEMAC(ch,dotjs)( x[ i*incx ], y[ i*incy ], dotxy ); \
+	} \
+	else \
+	{ \
+		for ( dim_t i = 0; i < n; ++i ) \
+			PASTEMAC(ch,dots)( x[ i*incx ], y[ i*incy ], dotxy ); \
+	} \
+\
+	if ( bli_is_conj( conjy ) ) { PASTEMAC(ch,conjs)( dotxy ); } \
+\
+	/* If beta is zero, clear rho. Otherwise, scale by beta. */ \
+	if ( PASTEMAC(ch,eq0)( *beta ) ) { PASTEMAC(ch,set0s)( *rho ); } \
+	else                             { PASTEMAC(ch,scals)( *beta, *rho ); } \
+\
+	PASTEMAC(ch,axpys)( *alpha, dotxy, *rho ); \
+}
+
+INSERT_GENTFUNC_BASIC0( bpdotxv )
+
+
+#define FUNCPTR_T bpmv_fp
+
+typedef void (*FUNCPTR_T)
+     (
+       bpmat_t*   a,
+       conj_t     conjx,
+       void*      alpha,
+       void*      x, inc_t incx,
+       void*      beta,
+       void*      y, inc_t incy,
+       cntx_t*    cntx,
+       thrinfo_t* thread
+     );
+
+static FUNCPTR_T GENARRAY(ftypes_gen,bpmv_gen_var1);
+static FUNCPTR_T GENARRAY(ftypes_her,bpmv_her_var1);
+
+
+#undef  GENFRONT
+#define GENFRONT( opname, ftypes ) \
+\
+void PASTEMAC0(opname) \
+     ( \
+       bpmat_t*   a, \
+       obj_t*     alpha, \
+       obj_t*     x, \
+       obj_t*     beta, \
+       obj_t*     y, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t    dt        = bli_obj_dt( y ); \
+\
+	const conj_t   conjx     = bli_obj_conj_status( x ); \
+\
+	void* restrict buf_x     = bli_obj_buffer_at_off( x ); \
+	const inc_t    incx      = bli_obj_vector_inc( x ); \
+\
+	void* restrict buf_y     = bli_obj_buffer_at_off( y ); \
+	const inc_t    incy      = bli_obj_vector_inc( y ); \
+\
+	void* restrict buf_alpha = bli_obj_buffer_for_1x1( dt, alpha ); \
+	void* restrict buf_beta  = bli_obj_buffer_for_1x1( dt, beta ); \
+\
+	FUNCPTR_T      f         = ftypes[dt]; \
+\
+	f \
+	( \
+	  a, \
+	  conjx, \
+	  buf_alpha, \
+	  buf_x, incx, \
+	  buf_beta, \
+	  buf_y, incy, \
+	  cntx, \
+	  thread  \
+	); \
+}
+
+GENFRONT( bpmv_gen_int, ftypes_gen )
+GENFRONT( bpmv_her_int, ftypes_her )
+
+
+#undef  FUNCPTR_T
+#define FUNCPTR_T bpr_fp
+
+typedef void (*FUNCPTR_T)
+     (
+       conj_t     conjx,
+       conj_t     conjy,
+       void*      alpha,
+       void*      x, inc_t incx,
+       void*      y, inc_t incy,
+       bpmat_t*   a,
+       cntx_t*    cntx,
+       thrinfo_t* thread
+     );
+
+static FUNCPTR_T GENARRAY(ftypes_r,bpr_var1);
+static FUNCPTR_T GENARRAY(ftypes_r2,bpr2_var1);
+
+
+#undef  GENFRONT
+#define GENFRONT( opname, ftypes ) \
+\
+void PASTEMAC0(opname) \
+     ( \
+       bpmat_t*   a, \
+       obj_t*     alpha, \
+       obj_t*     x, \
+       obj_t*     beta, \
+       obj_t*     y, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t    dt        = bli_obj_dt( x ); \
+\
+	const conj_t   conjx     = bli_obj_conj_status( x ); \
+	void* restrict buf_x     = bli_obj_buffer_at_off( x ); \
+	const inc_t    incx      = bli_obj_vector_inc( x ); \
+\
+	/* The rank-1 update has no y operand; pass x in its place. */ \
+	if ( y == NULL ) y = x; \
+\
+	const conj_t   conjy     = bli_obj_conj_status( y ); \
+	void* restrict buf_y     = bli_obj_buffer_at_off( y ); \
+	const inc_t    incy      = bli_obj_vector_inc( y ); \
+\
+	void* restrict buf_alpha = bli_obj_buffer_for_1x1( dt, alpha ); \
+\
+	FUNCPTR_T      f         = ftypes[dt]; \
+\
+	( void )beta; \
+\
+	f \
+	( \
+	  conjx, \
+	  conjy, \
+	  buf_alpha, \
+	  buf_x, incx, \
+	  buf_y, incy, \
+	  a, \
+	  cntx, \
+	  thread  \
+	); \
+}
+
+GENFRONT( bpr_int,  ftypes_r )
+GENFRONT( bpr2_int, ftypes_r2 )
+
+
+#undef  FUNCPTR_T
+#define FUNCPTR_T bpsv_fp
+
+typedef void (*FUNCPTR_T)
+     (
+       bpmat_t*   a,
+       void*      alpha,
+       void*      x, inc_t incx,
+       cntx_t*    cntx
+     );
+
+static FUNCPTR_T GENARRAY(ftypes_tri,bpmv_tri_var1);
+static FUNCPTR_T GENARRAY(ftypes_sv,bpsv_var1);
+
+
+#undef  GENFRONT
+#define GENFRONT( opname, ftypes ) \
+\
+void PASTEMAC0(opname) \
+     ( \
+       bpmat_t*   a, \
+       obj_t*     alpha, \
+       obj_t*     x, \
+       cntx_t*    cntx  \
+     ) \
+{ \
+	const num_t    dt        = bli_obj_dt( x ); \
+\
+	void* restrict buf_x     = bli_obj_buffer_at_off( x ); \
+	const inc_t    incx      = bli_obj_vector_inc( x ); \
+\
+	void* restrict buf_alpha = bli_obj_buffer_for_1x1( dt, alpha ); \
+\
+	FUNCPTR_T      f         = ftypes[dt]; \
+\
+	f \
+	( \
+	  a, \
+	  buf_alpha, \
+	  buf_x, incx, \
+	  cntx  \
+	); \
+}
+
+GENFRONT( bpmv_tri_int, ftypes_tri )
+GENFRONT( bpsv_int,     ftypes_sv )
+
+
+//
+// y := beta * y + alpha * transa( A ) * conjx( x ), where A is a general
+// banded or packed matrix (or a triangular one, whose implicit unit
+// diagonal, if any, is excluded from its band).
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       bpmat_t*   a, \
+       conj_t     conjx, \
+       void*      alpha, \
+       void*      x, inc_t incx, \
+       void*      beta, \
+       void*      y, inc_t incy, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t     dt         = PASTEMAC(ch,type); \
+\
+	ctype* restrict a_cast     = a->buf; \
+	ctype* restrict x_cast     = x; \
+	ctype* restrict y_cast     = y; \
+	ctype* restrict alpha_cast = alpha; \
+	ctype* restrict beta_cast  = beta; \
+\
+	const conj_t    conja      = bli_extract_conj( a->trans ); \
+	const inc_t     inca       = bli_bpmat_inc( a ); \
+	const dim_t     m          = a->m; \
+	const dim_t     n          = a->n; \
+	const dim_t     kl         = a->kl; \
+	const dim_t     ku         = a->ku; \
+	const bool      beta_zero  = PASTEMAC(ch,eq0)( *beta_cast ); \
+\
+	PASTECH(ch,axpyv_ker_ft) kfp_av = bli_cntx_get_l1v_ker_dt( dt, BLIS_AXPYV_KER, cntx ); \
+	PASTECH(ch,dotxv_ker_ft) kfp_dv = bli_cntx_get_l1v_ker_dt( dt, BLIS_DOTXV_KER, cntx ); \
+	PASTECH(ch,scalv_ker_ft) kfp_sv = bli_cntx_get_l1v_ker_dt( dt, BLIS_SCALV_KER, cntx ); \
+\
+	dim_t s, e; \
+\
+	if ( bli_does_notrans( a->trans ) && !a->packed && \
+	     kl + ku + 1 < BLIS_BANDPACK_KER_MIN_LEN ) \
+	{ \
+		/* Within a narrow band, each element of y is computed as a dot
+		   product with one row of A so that y is read and written only
+		   once. Consecutive elements of a row of the band storage are
+		   cs - rs apart. */ \
+		const inc_t  rs       = a->rs; \
+		const inc_t  cs       = a->cs; \
+		const doff_t ks       = a->ks; \
+		const inc_t  inca_row = cs - rs; \
+\
+		bli_thread_range_sub( thread, m, 1, FALSE, &s, &e ); \
+\
+		/* The rows are short, so the dot products are computed inline.
+		   Conjugation of x is applied by conjugating both operands and
+		   then the result. */ \
+		const conj_t conjax = bli_apply_conj( conjx, conja ); \
+\
+		for ( dim_t i = s; i < e; ++i ) \
+		{ \
+			const dim_t j_start = bli_max( 0, i - kl ); \
+			const dim_t j_end   = bli_min( n, i + ku + 1 ); \
+\
+			ctype* restrict a1   = a_cast + ( ks + i - j_start )*rs + j_start*cs; \
+			ctype* restrict x1   = x_cast + j_start*incx; \
+			ctype* restrict psi1 = y_cast + i*incy; \
+			ctype           rho; \
+\
+			/* rho := a(i,j_start:j_end-1) * conjx( x(j_start:j_end-1) ); */ \
+			PASTEMAC(ch,set0s)( rho ); \
+\
+			if ( bli_is_conj( conjax ) ) \
+			{ \
+				for ( dim_t l = 0; l < j_end - j_start; ++l ) \
+					PASTEMAC(ch,dotjs)( a1[ l*inca_row ], x1[ l*incx ], rho ); \
+			} \
+			else \
+			{ \
+				for ( dim_t l = 0; l < j_end - j_start; ++l ) \
+					PASTEMAC(ch,dots)( a1[ l*inca_row ], x1[ l*incx ], rho ); \
+			} \
+\
+			if ( bli_is_conj( conjx ) ) { PASTEMAC(ch,conjs)( rho ); } \
+\
+			/* Add the contribution of the implicit unit diagonal. */ \
+			if ( bli_is_unit_diag( a->diag ) ) \
+			{ \
+				ctype conjx_chi1; \
+\
+				PASTEMAC(ch,copycjs)( conjx, x_cast[ i*incx ], conjx_chi1 ); \
+				PASTEMAC(ch,adds)( conjx_chi1, rho ); \
+			} \
+\
+			/* psi1 := beta * psi1 + alpha * rho; */ \
+			if ( beta_zero ) \
+			{ \
+				PASTEMAC(ch,scal2s)( *alpha_cast, rho, *psi1 ); \
+			} \
+			else \
+			{ \
+				PASTEMAC(ch,scals)( *beta_cast, *psi1 ); \
+				PASTEMAC(ch,axpys)( *alpha_cast, rho, *psi1 ); \
+			} \
+		} \
+	} \
+	else if ( bli_does_notrans( a->trans ) ) \
+	{ \
+		/* Each thread updates its own rows of y, one column of A at a
+		   time. The rows of an upper triangle shrink with the row index,
+		   so they are balanced as if they were the columns of a lower
+		   triangle (and vice versa). */ \
+		uplo_t uplot = a->uplo; \
+		bli_toggle_uplo( &uplot ); \
+\
+		bli_bpmat_range( thread, a->packed, uplot, m, &s, &e ); \
+\
+		/* y := beta * y; */ \
+		kfp_sv( BLIS_NO_CONJUGATE, e - s, beta_cast, y_cast + s*incy, incy, cntx ); \
+\
+		const dim_t j_start = bli_max( 0, s - kl ); \
+		const dim_t j_end   = bli_min( n, e + ku ); \
+\
+		for ( dim_t j = j_start; j < j_end; ++j ) \
+		{ \
+			const dim_t i_start = bli_max( s, j - ku ); \
+			const dim_t i_end   = bli_min( e, j + kl + 1 ); \
+\
+			if ( i_end <= i_start ) continue; \
+\
+			ctype alpha_chi1; \
+\
+			/* y(i_start:i_end-1) += alpha * conjx( chi1 ) * a(i_start:i_end-1,j); */ \
+			PASTEMAC(ch,copycjs)( conjx, x_cast[ j*incx ], alpha_chi1 ); \
+			PASTEMAC(ch,scals)( *alpha_cast, alpha_chi1 ); \
+\
+			PASTEMAC(ch,bpaxpyv) \
+			( \
+			  kfp_av, \
+			  conja, \
+			  i_end - i_start, \
+			  &alpha_chi1, \
+			  a_cast + bli_bpmat_off( a, i_start, j ), inca, \
+			  y_cast + i_start*incy, incy, \
+			  cntx  \
+			); \
+		} \
+\
+		/* Add the contribution of the implicit unit diagonal. */ \
+		if ( bli_is_unit_diag( a->diag ) && s < e ) \
+		{ \
+			kfp_av \
+			( \
+			  conjx, \
+			  e - s, \
+			  alpha_cast, \
+			  x_cast + s*incx, incx, \
+			  y_cast + s*incy, incy, \
+			  cntx  \
+			); \
+		} \
+	} \
+	else /* if ( bli_does_trans( a->trans ) ) */ \
+	{ \
+		/* Each element of y is a dot product with one column of A. */ \
+		bli_bpmat_range( thread, a->packed, a->uplo, n, &s, &e ); \
+\
+		/* Within a narrow band, the columns [b_start,b_end) that are not
+		   truncated by the top or bottom of A all have the same (short)
+		   length and are a constant distance apart, so their dot products
+		   are computed inline. */ \
+		dim_t b_start = 0; \
+		dim_t b_end   = 0; \
+\
+		if ( !a->packed && kl + ku + 1 < BLIS_BANDPACK_KER_MIN_LEN ) \
+		{ \
+			const dim_t len = kl + ku + 1; \
+			const inc_t  cs  = a->cs; \
+			const doff_t ks  = a->ks; \
+\
+			b_start = bli_min( bli_max( s, ku ), e ); \
+			b_end   = bli_max( bli_min( e, m - kl ), b_start ); \
+\
+			/* Conjugation of x is applied by conjugating both operands and
+			   then the result. */ \
+			const conj_t conjax = bli_apply_conj( conjx, conja ); \
+\
+			for ( dim_t j = b_start; j < b_end; ++j ) \
+			{ \
+				ctype* restrict a1   = a_cast + ( ks - ku )*inca + j*cs; \
+				ctype* restrict x1   = x_cast + ( j - ku )*incx; \
+				ctype* restrict psi1 = y_cast + j*incy; \
+				ctype           rho; \
+\
+				/* rho := a(j-ku:j+kl,j)^T * conjx( x(j-ku:j+kl) ); */ \
+				PASTEMAC(ch,set0s)( rho ); \
+\
+				if ( bli_is_conj( conjax ) ) \
+				{ \
+					for ( dim_t l = 0; l < len; ++l ) \
+						PASTEMAC(ch,dotjs)( a1[ l*inca ], x1[ l*incx ], rho ); \
+				} \
+				else \
+				{ \
+					for ( dim_t l = 0; l < len; ++l ) \
+						PASTEMAC(ch,dots)( a1[ l*inca ], x1[ l*incx ], rho ); \
+				} \
+\
+				if ( bli_is_conj( conjx ) ) { PASTEMAC(ch,conjs)( rho ); } \
+\
+				/* Add the contribution of the implicit unit diagonal. */ \
+				if ( bli_is_unit_diag( a->diag ) ) \
+				{ \
+					ctype conjx_chi1; \
+\
+					PASTEMAC(ch,copycjs)( conjx, x_cast[ j*incx ], conjx_chi1 ); \
+					PASTEMAC(ch,adds)( conjx_chi1, rho ); \
+				} \
+\
+				/* psi1 := beta * psi1 + alpha * rho; */ \
+				if ( beta_zero ) \
+				{ \
+					PASTEMAC(ch,scal2s)( *alpha_cast, rho, *psi1 ); \
+				} \
+				else \
+				{ \
+					PASTEMAC(ch,scals)( *beta_cast, *psi1 ); \
+					PASTEMAC(ch,axpys)( *alpha_cast, rho, *psi1 ); \
+				} \
+			} \
+		} \
+\
+		for ( dim_t j = s; j < e; ++j ) \
+		{ \
+			/* Skip the columns that were handled above. */ \
+			if ( j == b_start && b_start < b_end ) { j = b_end - 1; continue; } \
+\
+			dim_t i_start, i_end; \
+\
+			bli_bpmat_col_range( a, j, &i_start, &i_end ); \
+\
+			const dim_t len = bli_max( 0, i_end - i_start ); \
+\
+			/* psi1 := beta * psi1 + alpha * a(i_start:i_end-1,j)^T * x(i_start:i_end-1); */ \
+			PASTEMAC(ch,bpdotxv) \
+			( \
+			  kfp_dv, \
+			  conja, \
+			  conjx, \
+			  len, \
+			  alpha_cast, \
+			  a_cast + ( len ? bli_bpmat_off( a, i_start, j ) : 0 ), inca, \
+			  x_cast + ( len ? i_start*incx : 0 ), incx, \
+			  beta_cast, \
+			  y_cast + j*incy, \
+			  cntx  \
+			); \
+\
+			/* Add the contribution of the implicit unit diagonal. */ \
+			if ( bli_is_unit_diag( a->diag ) ) \
+			{ \
+				ctype alpha_chi1; \
+\
+				PASTEMAC(ch,copycjs)( conjx, x_cast[ j*incx ], alpha_chi1 ); \
+				PASTEMAC(ch,scals)( *alpha_cast, alpha_chi1 ); \
+				PASTEMAC(ch,adds)( alpha_chi1, y_cast[ j*incy ] ); \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( bpmv_gen_var1 )
+
+
+//
+// y := beta * y + alpha * A * conjx( x ), where A is Hermitian (or, if conjh
+// is BLIS_NO_CONJUGATE, symmetric) and only the triangle given by uplo is
+// stored within its band or packed storage.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       bpmat_t*   a, \
+       conj_t     conjx, \
+       void*      alpha, \
+       void*      x, inc_t incx, \
+       void*      beta, \
+       void*      y, inc_t incy, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t     dt         = PASTEMAC(ch,type); \
+\
+	ctype*          one        = PASTEMAC(ch,1); \
+	ctype* restrict a_cast     = a->buf; \
+	ctype* restrict x_cast     = x; \
+	ctype* restrict y_cast     = y; \
+	ctype* restrict alpha_cast = alpha; \
+	ctype* restrict beta_cast  = beta; \
+\
+	/* The stored triangle is read with conja; its mirror image across the
+	   diagonal is read with conjh applied on top of that. */ \
+	const conj_t    conja      = bli_extract_conj( a->trans ); \
+	const conj_t    conjh      = a->conjh; \
+	const conj_t    conjat     = bli_apply_conj( conjh, conja ); \
+	const inc_t     inca       = bli_bpmat_inc( a ); \
+	const dim_t     m          = a->m; \
+	const dim_t     kl         = a->kl; \
+	const dim_t     ku         = a->ku; \
+\
+	PASTECH(ch,axpyv_ker_ft) kfp_av = bli_cntx_get_l1v_ker_dt( dt, BLIS_AXPYV_KER, cntx ); \
+	PASTECH(ch,dotxv_ker_ft) kfp_dv = bli_cntx_get_l1v_ker_dt( dt, BLIS_DOTXV_KER, cntx ); \
+	PASTECH(ch,scalv_ker_ft) kfp_sv = bli_cntx_get_l1v_ker_dt( dt, BLIS_SCALV_KER, cntx ); \
+\
+	/* Each row of the full matrix holds the same number of elements (save
+	   for the ends of a band), so the rows of y are divided evenly. */ \
+	dim_t s, e; \
+\
+	bli_thread_range_sub( thread, m, 1, FALSE, &s, &e ); \
+\
+	/* y := beta * y; */ \
+	kfp_sv( BLIS_NO_CONJUGATE, e - s, beta_cast, y_cast + s*incy, incy, cntx ); \
+\
+	const bool  is_upper = bli_is_upper( a->uplo ); \
+	const dim_t j_start  = bli_max( 0, s - kl ); \
+	const dim_t j_end    = bli_min( m, e + ku ); \
+\
+	/* Within a narrow band, the columns [b_start,b_end) whose strictly
+	   upper or lower parts lie entirely within our own rows all have the
+	   same (short) length and are a constant distance apart. Each of them
+	   is traversed only once, both to update y1 and to accumulate the dot
+	   product for psi1. */ \
+	dim_t b_start = 0; \
+	dim_t b_end   = 0; \
+\
+	if ( !a->packed && kl + ku < BLIS_BANDPACK_KER_MIN_LEN ) \
+	{ \
+		const dim_t len  = ( is_upper ? ku : kl ); \
+		const doff_t off = ( is_upper ? -ku : 1 ); \
+		const inc_t  cs  = a->cs; \
+		const doff_t ks  = a->ks; \
+\
+		b_start = ( is_upper ? bli_min( s + ku, e ) : s ); \
+		b_end   = ( is_upper ? e : bli_max( s, e - kl ) ); \
+\
+		for ( dim_t j = b_start; j < b_end; ++j ) \
+		{ \
+			ctype* restrict a1      = a_cast + ( ks + off )*inca + j*cs; \
+			ctype* restrict alpha11 = a_cast + ( ks       )*inca + j*cs; \
+			ctype* restrict x1      = x_cast + ( j + off )*incx; \
+			ctype* restrict y1      = y_cast + ( j + off )*incy; \
+			ctype* restrict psi1    = y_cast + j*incy; \
+			ctype           alpha_chi1; \
+			ctype           alpha11_c; \
+			ctype           rho; \
+\
+			PASTEMAC(ch,copycjs)( conjx, x_cast[ j*incx ], alpha_chi1 ); \
+			PASTEMAC(ch,scals)( *alpha_cast, alpha_chi1 ); \
+			PASTEMAC(ch,set0s)( rho ); \
+\
+			/* y1 += alpha * conjx( chi1 ) * a1;
+			   rho = conjh( a1 )^T * conjx( x1 ); */ \
+			for ( dim_t l = 0; l < len; ++l ) \
+			{ \
+				ctype alpha10; \
+				ctype chi0; \
+\
+				PASTEMAC(ch,copycjs)( conja, a1[ l*inca ], alpha10 ); \
+				PASTEMAC(ch,axpys)( alpha_chi1, alpha10, y1[ l*incy ] ); \
+				PASTEMAC(ch,copycjs)( conjh, alpha10, alpha10 ); \
+				PASTEMAC(ch,copycjs)( conjx, x1[ l*incx ], chi0 ); \
+				PASTEMAC(ch,dots)( alpha10, chi0, rho ); \
+			} \
+\
+			/* psi1 += alpha * rho + alpha11 * alpha * conjx( chi1 ); */ \
+			PASTEMAC(ch,copycjs)( conja, *alpha11, alpha11_c ); \
+			if ( bli_is_conj( conjh ) ) PASTEMAC(ch,seti0s)( alpha11_c ); \
+			PASTEMAC(ch,axpys)( *alpha_cast, rho, *psi1 ); \
+			PASTEMAC(ch,axpys)( alpha11_c, alpha_chi1, *psi1 ); \
+		} \
+	} \
+\
+	for ( dim_t j = j_start; j < j_end; ++j ) \
+	{ \
+		/* Skip the columns that were handled above. */ \
+		if ( j == b_start && b_start < b_end ) { j = b_end - 1; continue; } \
+\
+		/* Find the strictly upper or lower part of column j. */ \
+		dim_t i_start, i_end; \
+\
+		if ( is_upper ) { i_start = bli_max( 0, j - ku ); i_end = j; } \
+		else            { i_start = j + 1; i_end = bli_min( m, j + kl + 1 ); } \
+\
+		ctype* restrict a1    = a_cast + bli_bpmat_off( a, i_start, j ); \
+		ctype* restrict chi1  = x_cast + j*incx; \
+		ctype* restrict psi1  = y_cast + j*incy; \
+		ctype           alpha_chi1; \
+\
+		PASTEMAC(ch,copycjs)( conjx, *chi1, alpha_chi1 ); \
+		PASTEMAC(ch,scals)( *alpha_cast, alpha_chi1 ); \
+\
+		/* y1 += alpha * conjx( chi1 ) * a1, restricted to our own rows. */ \
+		const dim_t r_start = bli_max( s, i_start ); \
+		const dim_t r_end   = bli_min( e, i_end ); \
+\
+		if ( r_start < r_end ) \
+		{ \
+			PASTEMAC(ch,bpaxpyv) \
+			( \
+			  kfp_av, \
+			  conja, \
+			  r_end - r_start, \
+			  &alpha_chi1, \
+			  a1 + ( r_start - i_start )*inca, inca, \
+			  y_cast + r_start*incy, incy, \
+			  cntx  \
+			); \
+		} \
+\
+		if ( j < s || e <= j ) continue; \
+\
+		/* psi1 += alpha * conjh( a1 )^T * conjx( x1 ); */ \
+		if ( i_start < i_end ) \
+		{ \
+			PASTEMAC(ch,bpdotxv) \
+			( \
+			  kfp_dv, \
+			  conjat, \
+			  conjx, \
+			  i_end - i_start, \
+			  alpha_cast, \
+			  a1, inca, \
+			  x_cast + i_start*incx, incx, \
+			  one, \
+			  psi1, \
+			  cntx  \
+			); \
+		} \
+\
+		/* psi1 += alpha11 * alpha * conjx( chi1 ), where the imaginary part
+		   of alpha11 is ignored if A is Hermitian. */ \
+		ctype alpha11; \
+\
+		PASTEMAC(ch,copycjs)( conja, a_cast[ bli_bpmat_off( a, j, j ) ], alpha11 ); \
+		if ( bli_is_conj( conjh ) ) PASTEMAC(ch,seti0s)( alpha11 ); \
+		PASTEMAC(ch,axpys)( alpha11, alpha_chi1, *psi1 ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( bpmv_her_var1 )
+
+
+//
+// A := A + alpha * conjx( x ) * conjh( conjx( x ) )^T, where A is Hermitian
+// (or symmetric) and only its stored (packed) triangle is updated.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       conj_t     conjx, \
+       conj_t     conjy, \
+       void*      alpha, \
+       void*      x, inc_t incx, \
+       void*      y, inc_t incy, \
+       bpmat_t*   a, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t     dt         = PASTEMAC(ch,type); \
+\
+	ctype* restrict a_cast     = a->buf; \
+	ctype* restrict x_cast     = x; \
+	ctype* restrict alpha_cast = alpha; \
+\
+	const inc_t     inca       = bli_bpmat_inc( a ); \
+\
+	PASTECH(ch,axpyv_ker_ft) kfp_av = bli_cntx_get_l1v_ker_dt( dt, BLIS_AXPYV_KER, cntx ); \
+\
+	( void )conjy; \
+	( void )y; \
+	( void )incy; \
+\
+	/* Each thread updates its own columns of A. */ \
+	dim_t s, e; \
+\
+	bli_bpmat_range( thread, a->packed, a->uplo, a->m, &s, &e ); \
+\
+	for ( dim_t j = s; j < e; ++j ) \
+	{ \
+		dim_t i_start, i_end; \
+\
+		bli_bpmat_col_range( a, j, &i_start, &i_end ); \
+\
+		ctype* restrict a1 = a_cast + bli_bpmat_off( a, i_start, j ); \
+		ctype           alpha_chi1; \
+\
+		/* a1 += alpha * conjh( conjx( chi1 ) ) * conjx( x1 ); */ \
+		PASTEMAC(ch,copycjs)( bli_apply_conj( a->conjh, conjx ), x_cast[ j*incx ], alpha_chi1 ); \
+		PASTEMAC(ch,scals)( *alpha_cast, alpha_chi1 ); \
+\
+		PASTEMAC(ch,bpaxpyv) \
+		( \
+		  kfp_av, \
+		  conjx, \
+		  i_end - i_start, \
+		  &alpha_chi1, \
+		  x_cast + i_start*incx, incx, \
+		  a1, inca, \
+		  cntx  \
+		); \
+\
+		/* Explicitly clear the imaginary part of the diagonal element if A
+		   is Hermitian. */ \
+		if ( bli_is_conj( a->conjh ) ) \
+			PASTEMAC(ch,seti0s)( a_cast[ bli_bpmat_off( a, j, j ) ] ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( bpr_var1 )
+
+
+//
+// A := A + alpha * conjx( x ) * conjh( conjy( y ) )^T
+//        + conjh( alpha ) * conjy( y ) * conjh( conjx( x ) )^T,
+//
+// where A is Hermitian (or symmetric) and only its stored (packed) triangle
+// is updated.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       conj_t     conjx, \
+       conj_t     conjy, \
+       void*      alpha, \
+       void*      x, inc_t incx, \
+       void*      y, inc_t incy, \
+       bpmat_t*   a, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t     dt         = PASTEMAC(ch,type); \
+\
+	ctype* restrict a_cast     = a->buf; \
+	ctype* restrict x_cast     = x; \
+	ctype* restrict y_cast     = y; \
+	ctype* restrict alpha_cast = alpha; \
+\
+	const inc_t     inca       = bli_bpmat_inc( a ); \
+\
+	ctype           alpha0     = *alpha_cast; \
+	ctype           alpha1; \
+\
+	PASTEMAC(ch,copycjs)( a->conjh, *alpha_cast, alpha1 ); \
+\
+	PASTECH(ch,axpy2v_ker_ft) kfp_2v = bli_cntx_get_l1f_ker_dt( dt, BLIS_AXPY2V_KER, cntx ); \
+\
+	/* Each thread updates its own columns of A. */ \
+	dim_t s, e; \
+\
+	bli_bpmat_range( thread, a->packed, a->uplo, a->m, &s, &e ); \
+\
+	for ( dim_t j = s; j < e; ++j ) \
+	{ \
+		dim_t i_start, i_end; \
+\
+		bli_bpmat_col_range( a, j, &i_start, &i_end ); \
+\
+		ctype* restrict a1 = a_cast + bli_bpmat_off( a, i_start, j ); \
+		ctype           alpha0_psi1; \
+		ctype           alpha1_chi1; \
+\
+		PASTEMAC(ch,copycjs)( bli_apply_conj( a->conjh, conjy ), y_cast[ j*incy ], alpha0_psi1 ); \
+		PASTEMAC(ch,scals)( alpha0, alpha0_psi1 ); \
+		PASTEMAC(ch,copycjs)( bli_apply_conj( a->conjh, conjx ), x_cast[ j*incx ], alpha1_chi1 ); \
+		PASTEMAC(ch,scals)( alpha1, alpha1_chi1 ); \
+\
+		/* a1 += alpha0 * conjh( conjy( psi1 ) ) * conjx( x1 )
+		       + alpha1 * conjh( conjx( chi1 ) ) * conjy( y1 ); */ \
+		kfp_2v \
+		( \
+		  conjx, \
+		  conjy, \
+		  i_end - i_start, \
+		  &alpha0_psi1, \
+		  &alpha1_chi1, \
+		  x_cast + i_start*incx, incx, \
+		  y_cast + i_start*incy, incy, \
+		  a1, inca, \
+		  cntx  \
+		); \
+\
+		/* Explicitly clear the imaginary part of the diagonal element if A
+		   is Hermitian. */ \
+		if ( bli_is_conj( a->conjh ) ) \
+			PASTEMAC(ch,seti0s)( a_cast[ bli_bpmat_off( a, j, j ) ] ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( bpr2_var1 )
+
+
+//
+// x := alpha * inv( transa( A ) ) * x, where A is a triangular banded or
+// packed matrix. The substitution is inherently sequential, so this variant
+// is not threaded.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       bpmat_t*   a, \
+       void*      alpha, \
+       void*      x, inc_t incx, \
+       cntx_t*    cntx  \
+     ) \
+{ \
+	const num_t     dt         = PASTEMAC(ch,type); \
+\
+	ctype*          one        = PASTEMAC(ch,1); \
+	ctype*          minus_one  = PASTEMAC(ch,m1); \
+	ctype* restrict a_cast     = a->buf; \
+	ctype* restrict x_cast     = x; \
+	ctype* restrict alpha_cast = alpha; \
+\
+	const conj_t    conja      = bli_extract_conj( a->trans ); \
+	const inc_t     inca       = bli_bpmat_inc( a ); \
+	const dim_t     m          = a->m; \
+	const bool      is_upper   = bli_is_upper( a->uplo ); \
+	const bool      is_notrans = bli_does_notrans( a->trans ); \
+\
+	PASTECH(ch,axpyv_ker_ft) kfp_av = bli_cntx_get_l1v_ker_dt( dt, BLIS_AXPYV_KER, cntx ); \
+	PASTECH(ch,dotxv_ker_ft) kfp_dv = bli_cntx_get_l1v_ker_dt( dt, BLIS_DOTXV_KER, cntx ); \
+	PASTECH(ch,scalv_ker_ft) kfp_sv = bli_cntx_get_l1v_ker_dt( dt, BLIS_SCALV_KER, cntx ); \
+\
+	/* x := alpha * x; */ \
+	if ( !PASTEMAC(ch,eq1)( *alpha_cast ) ) \
+		kfp_sv( BLIS_NO_CONJUGATE, m, alpha_cast, x_cast, incx, cntx ); \
+\
+	/* An upper triangular system is solved backwards, as is the transpose
+	   of a lower triangular one. */ \
+	const bool      backward   = ( is_upper == is_notrans ); \
+\
+	/* Within a narrow band, the strictly upper or lower parts of the
+	   columns [b_start,b_end) all have the same (short) length and are a
+	   constant distance apart, so they are processed inline. */ \
+	dim_t b_start = 0; \
+	dim_t b_end   = 0; \
+\
+	if ( !a->packed && a->kl + a->ku < BLIS_BANDPACK_KER_MIN_LEN ) \
+	{ \
+		b_start = ( is_upper ? bli_min( a->ku, m ) : 0 ); \
+		b_end   = ( is_upper ? m : bli_max( m - a->kl, 0 ) ); \
+	} \
+\
+	const dim_t     len        = ( is_upper ? a->ku : a->kl ); \
+	const doff_t    off        = ( is_upper ? -a->ku : 1 ); \
+	const inc_t     cs         = a->cs; \
+	const doff_t    ks         = a->ks; \
+	const bool      is_nonunit = bli_is_nonunit_diag( a->diag ); \
+\
+	for ( dim_t iter = 0; iter < m; ++iter ) \
+	{ \
+		const dim_t j = ( backward ? m - iter - 1 : iter ); \
+\
+		if ( b_start <= j && j < b_end ) \
+		{ \
+			ctype* restrict a1      = a_cast + ( ks + off )*inca + j*cs; \
+			ctype* restrict alpha11 = a_cast + ( ks       )*inca + j*cs; \
+			ctype* restrict x1      = x_cast + ( j + off )*incx; \
+			ctype* restrict chi1    = x_cast + j*incx; \
+			ctype           alpha11_c; \
+			ctype           alpha10; \
+			ctype           rho; \
+\
+			if ( is_notrans ) \
+			{ \
+				/* chi1 := chi1 / alpha11;
+				   x1 := x1 - chi1 * a1; */ \
+				if ( is_nonunit ) \
+				{ \
+					PASTEMAC(ch,copycjs)( conja, *alpha11, alpha11_c ); \
+					PASTEMAC(ch,invscals)( alpha11_c, *chi1 ); \
+				} \
+\
+				PASTEMAC(ch,neg2s)( *chi1, rho ); \
+\
+				for ( dim_t l = 0; l < len; ++l ) \
+				{ \
+					PASTEMAC(ch,copycjs)( conja, a1[ l*inca ], alpha10 ); \
+					PASTEMAC(ch,axpys)( rho, alpha10, x1[ l*incx ] ); \
+				} \
+			} \
+			else \
+			{ \
+				/* chi1 := chi1 - a1^T * x1;
+				   chi1 := chi1 / alpha11; */ \
+				PASTEMAC(ch,set0s)( rho ); \
+\
+				for ( dim_t l = 0; l < len; ++l ) \
+				{ \
+					PASTEMAC(ch,copycjs)( conja, a1[ l*inca ], alpha10 ); \
+					PASTEMAC(ch,dots)( alpha10, x1[ l*incx ], rho ); \
+				} \
+\
+				PASTEMAC(ch,subs)( rho, *chi1 ); \
+\
+				if ( is_nonunit ) \
+				{ \
+					PASTEMAC(ch,copycjs)( conja, *alpha11, alpha11_c ); \
+					PASTEMAC(ch,invscals)( alpha11_c, *chi1 ); \
+				} \
+			} \
+\
+			continue; \
+		} \
+\
+		/* Find the strictly upper or lower part of column j. */ \
+		dim_t i_start, i_end; \
+\
+		if ( is_upper ) { i_start = bli_max( 0, j - a->ku ); i_end = j; } \
+		else            { i_start = j + 1; i_end = bli_min( m, j + a->kl + 1 ); } \
+\
+		ctype* restrict a1   = a_cast + bli_bpmat_off( a, i_start, j ); \
+		ctype* restrict x1   = x_cast + i_start*incx; \
+		ctype* restrict chi1 = x_cast + j*incx; \
+		ctype           alpha11; \
+		ctype           minus_chi1; \
+\
+		if ( is_notrans ) \
+		{ \
+			/* chi1 := chi1 / alpha11; */ \
+			if ( is_nonunit ) \
+			{ \
+				PASTEMAC(ch,copycjs)( conja, a_cast[ bli_bpmat_off( a, j, j ) ], alpha11 ); \
+				PASTEMAC(ch,invscals)( alpha11, *chi1 ); \
+			} \
+\
+			/* x1 := x1 - chi1 * a1; */ \
+			PASTEMAC(ch,neg2s)( *chi1, minus_chi1 ); \
+			PASTEMAC(ch,bpaxpyv) \
+			( \
+			  kfp_av, \
+			  conja, \
+			  i_end - i_start, \
+			  &minus_chi1, \
+			  a1, inca, \
+			  x1, incx, \
+			  cntx  \
+			); \
+		} \
+		else \
+		{ \
+			/* chi1 := chi1 - a1^T * x1; */ \
+			PASTEMAC(ch,bpdotxv) \
+			( \
+			  kfp_dv, \
+			  conja, \
+			  BLIS_NO_CONJUGATE, \
+			  i_end - i_start, \
+			  minus_one, \
+			  a1, inca, \
+			  x1, incx, \
+			  one, \
+			  chi1, \
+			  cntx  \
+			); \
+\
+			/* chi1 := chi1 / alpha11; */ \
+			if ( is_nonunit ) \
+			{ \
+				PASTEMAC(ch,copycjs)( conja, a_cast[ bli_bpmat_off( a, j, j ) ], alpha11 ); \
+				PASTEMAC(ch,invscals)( alpha11, *chi1 ); \
+			} \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( bpsv_var1 )
+
+
+
+//
+// x := alpha * transa( A ) * x, where A is a triangular banded or packed
+// matrix. The product is computed in place, one column of A at a time,
+// which requires the columns to be visited in order; thus, this variant is
+// not threaded.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       bpmat_t*   a, \
+       void*      alpha, \
+       void*      x, inc_t incx, \
+       cntx_t*    cntx  \
+     ) \
+{ \
+	const num_t     dt         = PASTEMAC(ch,type); \
+\
+	ctype*          one        = PASTEMAC(ch,1); \
+	ctype* restrict a_cast     = a->buf; \
+	ctype* restrict x_cast     = x; \
+	ctype* restrict alpha_cast = alpha; \
+\
+	const conj_t    conja      = bli_extract_conj( a->trans ); \
+	const inc_t     inca       = bli_bpmat_inc( a ); \
+	const dim_t     m          = a->m; \
+	const bool      is_upper   = bli_is_upper( a->uplo ); \
+	const bool      is_notrans = bli_does_notrans( a->trans ); \
+\
+	PASTECH(ch,axpyv_ker_ft) kfp_av = bli_cntx_get_l1v_ker_dt( dt, BLIS_AXPYV_KER, cntx ); \
+	PASTECH(ch,dotxv_ker_ft) kfp_dv = bli_cntx_get_l1v_ker_dt( dt, BLIS_DOTXV_KER, cntx ); \
+	PASTECH(ch,scalv_ker_ft) kfp_sv = bli_cntx_get_l1v_ker_dt( dt, BLIS_SCALV_KER, cntx ); \
+\
+	/* x := alpha * x; */ \
+	if ( !PASTEMAC(ch,eq1)( *alpha_cast ) ) \
+		kfp_sv( BLIS_NO_CONJUGATE, m, alpha_cast, x_cast, incx, cntx ); \
+\
+	/* Each column must be applied while the elements of x that it reads
+	   still hold their original values. For an upper triangular matrix
+	   (or the transpose of a lower triangular one), this means proceeding
+	   forwards. */ \
+	const bool      forward    = ( is_upper == is_notrans ); \
+\
+	/* Within a narrow band, the strictly upper or lower parts of the
+	   columns [b_start,b_end) all have the same (short) length and are a
+	   constant distance apart, so they are processed inline. */ \
+	dim_t b_start = 0; \
+	dim_t b_end   = 0; \
+\
+	if ( !a->packed && a->kl + a->ku < BLIS_BANDPACK_KER_MIN_LEN ) \
+	{ \
+		b_start = ( is_upper ? bli_min( a->ku, m ) : 0 ); \
+		b_end   = ( is_upper ? m : bli_max( m - a->kl, 0 ) ); \
+	} \
+\
+	const dim_t     len        = ( is_upper ? a->ku : a->kl ); \
+	const doff_t    off        = ( is_upper ? -a->ku : 1 ); \
+	const inc_t     cs         = a->cs; \
+	const doff_t    ks         = a->ks; \
+	const bool      is_nonunit = bli_is_nonunit_diag( a->diag ); \
+\
+	for ( dim_t iter = 0; iter < m; ++iter ) \
+	{ \
+		const dim_t j = ( forward ? iter : m - iter - 1 ); \
+\
+		if ( j == ( forward ? b_start : b_end - 1 ) && b_start < b_end ) \
+		{ \
+			const dim_t     n_b     = b_end - b_start; \
+			const inc_t     da      = ( forward ? cs : -cs ); \
+			const inc_t     dx      = ( forward ? incx : -incx ); \
+			ctype* restrict a1      = a_cast + ( ks + off )*inca + j*cs; \
+			ctype* restrict alpha11 = a_cast + ( ks       )*inca + j*cs; \
+			ctype* restrict x1      = x_cast + ( j + off )*incx; \
+			ctype* restrict chi1    = x_cast + j*incx; \
+			ctype           alpha11_c; \
+			ctype           alpha10; \
+			ctype           rho; \
+\
+			if ( is_notrans ) \
+			{ \
+				for ( dim_t b = 0; b < n_b; ++b ) \
+				{ \
+					/* x1 := x1 + chi1 * a1;
+					   chi1 := alpha11 * chi1; */ \
+					PASTEMAC(ch,copys)( *chi1, rho ); \
+\
+					for ( dim_t l = 0; l < len; ++l ) \
+					{ \
+						PASTEMAC(ch,copycjs)( conja, a1[ l*inca ], alpha10 ); \
+						PASTEMAC(ch,axpys)( rho, alpha10, x1[ l*incx ] ); \
+					} \
+\
+					if ( is_nonunit ) \
+					{ \
+						PASTEMAC(ch,copycjs)( conja, *alpha11, alpha11_c ); \
+						PASTEMAC(ch,scals)( alpha11_c, *chi1 ); \
+					} \
+\
+					a1 += da; alpha11 += da; x1 += dx; chi1 += dx; \
+				} \
+			} \
+			else \
+			{ \
+				for ( dim_t b = 0; b < n_b; ++b ) \
+				{ \
+					/* chi1 := alpha11 * chi1;
+					   chi1 := chi1 + a1^T * x1; */ \
+					PASTEMAC(ch,copys)( *chi1, rho ); \
+\
+					if ( is_nonunit ) \
+					{ \
+						PASTEMAC(ch,copycjs)( conja, *alpha11, alpha11_c ); \
+						PASTEMAC(ch,scals)( alpha11_c, rho ); \
+					} \
+\
+					for ( dim_t l = 0; l < len; ++l ) \
+					{ \
+						PASTEMAC(ch,copycjs)( conja, a1[ l*inca ], alpha10 ); \
+						PASTEMAC(ch,dots)( alpha10, x1[ l*incx ], rho ); \
+					} \
+\
+					PASTEMAC(ch,copys)( rho, *chi1 ); \
+\
+					a1 += da; alpha11 += da; x1 += dx; chi1 += dx; \
+				} \
+			} \
+\
+			/* Resume with the first column after the band body. */ \
+			iter += n_b - 1; \
+			continue; \
+		} \
+\
+		/* Find the strictly upper or lower part of column j. */ \
+		dim_t i_start, i_end; \
+\
+		if ( is_upper ) { i_start = bli_max( 0, j - a->ku ); i_end = j; } \
+		else            { i_start = j + 1; i_end = bli_min( m, j + a->kl + 1 ); } \
+\
+		ctype* restrict a1   = a_cast + bli_bpmat_off( a, i_start, j ); \
+		ctype* restrict x1   = x_cast + i_start*incx; \
+		ctype* restrict chi1 = x_cast + j*incx; \
+		ctype           alpha11; \
+		ctype           chi1_orig; \
+\
+		if ( is_notrans ) \
+		{ \
+			/* x1 := x1 + chi1 * a1; */ \
+			PASTEMAC(ch,copys)( *chi1, chi1_orig ); \
+			PASTEMAC(ch,bpaxpyv) \
+			( \
+			  kfp_av, \
+			  conja, \
+			  i_end - i_start, \
+			  &chi1_orig, \
+			  a1, inca, \
+			  x1, incx, \
+			  cntx  \
+			); \
+\
+			/* chi1 := alpha11 * chi1; */ \
+			if ( is_nonunit ) \
+			{ \
+				PASTEMAC(ch,copycjs)( conja, a_cast[ bli_bpmat_off( a, j, j ) ], alpha11 ); \
+				PASTEMAC(ch,scals)( alpha11, *chi1 ); \
+			} \
+		} \
+		else \
+		{ \
+			/* chi1 := alpha11 * chi1; */ \
+			if ( is_nonunit ) \
+			{ \
+				PASTEMAC(ch,copycjs)( conja, a_cast[ bli_bpmat_off( a, j, j ) ], alpha11 ); \
+				PASTEMAC(ch,scals)( alpha11, *chi1 ); \
+			} \
+\
+			/* chi1 := chi1 + a1^T * x1; */ \
+			PASTEMAC(ch,bpdotxv) \
+			( \
+			  kfp_dv, \
+			  conja, \
+			  BLIS_NO_CONJUGATE, \
+			  i_end - i_start, \
+			  one, \
+			  a1, inca, \
+			  x1, incx, \
+			  one, \
+			  chi1, \
+			  cntx  \
+			); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( bpmv_tri_var1 )
+
@@ -0,0 +1,209 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+//
+// A banded or packed matrix (bp for short), as seen by the variants of the
+// banded and packed level-2 operations. The logical matrix A is m x n; only
+// the elements of column j in rows max(0,j-ku) through min(m,j+kl+1)-1 are
+// referenced. Either of kl or ku may be -1 to exclude the diagonal (as is
+// done for triangular matrices with an implicit unit diagonal).
+//
+// In band storage, element (i,j) of A is located at
+//
+//   buf + (ks + i - j)*rs + j*cs
+//
+// where ks is the row of the band array that holds the diagonal. In packed
+// storage, the stored triangle of the m x m matrix A (given by uplo) is kept
+// column by column without gaps.
+//
+
+typedef struct bpmat_s
+{
+	void*   buf;
+	bool    packed;
+	inc_t   rs;
+	inc_t   cs;
+	doff_t  ks;
+
+	dim_t   m;
+	dim_t   n;
+	dim_t   kl;
+	dim_t   ku;
+
+	uplo_t  uplo;
+	trans_t trans;
+	conj_t  conjh;
+	diag_t  diag;
+} bpmat_t;
+
+// Return the offset of element (i,j) of A relative to the start of its
+// storage.
+BLIS_INLINE inc_t bli_bpmat_off( bpmat_t* a, dim_t i, dim_t j )
+{
+	if ( !a->packed )
+		return ( a->ks + i - j ) * a->rs + j * a->cs;
+	else if ( bli_is_upper( a->uplo ) )
+		return ( j * ( j + 1 ) ) / 2 + i;
+	else
+		return ( j * ( 2 * a->m - j - 1 ) ) / 2 + i;
+}
+
+// Return the distance between consecutive elements within a column of A.
+BLIS_INLINE inc_t bli_bpmat_inc( bpmat_t* a )
+{
+	return ( a->packed ? 1 : a->rs );
+}
+
+// Return the range of rows [i_start,i_end) referenced in column j of A.
+BLIS_INLINE void bli_bpmat_col_range( bpmat_t* a, dim_t j, dim_t* i_start, dim_t* i_end )
+{
+	*i_start = bli_max( 0, j - a->ku );
+	*i_end   = bli_min( a->m, j + a->kl + 1 );
+}
+
+
+//
+// Prototype object-based thread entry points (see bli_bandpack_front.c).
+//
+// NOTE: The matrix-vector operations (bpmv_gen_int, bpmv_her_int) compute
+// y := beta * y + alpha * A * x. The rank updates (bpr_int, bpr2_int)
+// compute A := A + alpha * x * y^H (+ conj( alpha ) * y * x^H), where y is
+// NULL for bpr_int, and do not use beta.
+//
+
+typedef void (*bpint_t)
+     (
+       bpmat_t*   a,
+       obj_t*     alpha,
+       obj_t*     x,
+       obj_t*     beta,
+       obj_t*     y,
+       cntx_t*    cntx,
+       thrinfo_t* thread
+     );
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+void PASTEMAC0(opname) \
+     ( \
+       bpmat_t*   a, \
+       obj_t*     alpha, \
+       obj_t*     x, \
+       obj_t*     beta, \
+       obj_t*     y, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     );
+
+GENPROT( bpmv_gen_int )
+GENPROT( bpmv_her_int )
+GENPROT( bpr_int )
+GENPROT( bpr2_int )
+
+
+// The in-place triangular products and the triangular solves are not
+// threaded, so their object-based entry points take no thrinfo_t.
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+void PASTEMAC0(opname) \
+     ( \
+       bpmat_t*   a, \
+       obj_t*     alpha, \
+       obj_t*     x, \
+       cntx_t*    cntx  \
+     );
+
+GENPROT( bpmv_tri_int )
+GENPROT( bpsv_int )
+
+//
+// Prototype BLAS-like interfaces with void pointer operands.
+//
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       bpmat_t*   a, \
+       conj_t     conjx, \
+       void*      alpha, \
+       void*      x, inc_t incx, \
+       void*      beta, \
+       void*      y, inc_t incy, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     );
+
+INSERT_GENTPROT_BASIC0( bpmv_gen_var1 )
+INSERT_GENTPROT_BASIC0( bpmv_her_var1 )
+
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       conj_t     conjx, \
+       conj_t     conjy, \
+       void*      alpha, \
+       void*      x, inc_t incx, \
+       void*      y, inc_t incy, \
+       bpmat_t*   a, \
+       cntx_t*    cntx, \
+       thrinfo_t* thread  \
+     );
+
+INSERT_GENTPROT_BASIC0( bpr_var1 )
+INSERT_GENTPROT_BASIC0( bpr2_var1 )
+
+
+#undef  GENTPROT
+#define GENTPROT( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       bpmat_t*   a, \
+       void*      alpha, \
+       void*      x, inc_t incx, \
+       cntx_t*    cntx  \
+     );
+
+INSERT_GENTPROT_BASIC0( bpmv_tri_var1 )
+INSERT_GENTPROT_BASIC0( bpsv_var1 )
+
@@ -102,3 +102,4 @@
 #include "bli_trmm3.h"
 #include "bli_trsm.h"
 #include "bli_gemmt.h"
+#include "bli_spmm.h"
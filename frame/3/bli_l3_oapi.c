@@ -42,7 +42,7 @@
 //
 
 #undef  GENFRONT
-#define GENFRONT( opname ) \
+#define GENFRONT( opname, opid ) \
 \
 void PASTEMAC(opname,EX_SUF) \
      ( \
@@ -57,11 +57,21 @@ void PASTEMAC(opname,EX_SUF) \
 	bli_init_once(); \
 \
 	BLIS_OAPI_EX_DECLS \
+\
+	/* Record the shape of the call if workload capture is enabled. */ \
+	bli_capture_l3( opid, BLIS_LEFT, a, b, c, rntm ); \
 \
 	/* If the rntm is non-NULL, it may indicate that we should forgo sup
 	   handling altogether. */ \
 	bool enable_sup = TRUE; \
 	if ( rntm != NULL ) enable_sup = bli_rntm_l3_sup( rntm ); \
+\
+	/* Streaming stores to C are only implemented by the conventional code
+	   path, so forgo sup handling if they were requested and would apply. */ \
+	if ( bli_gemm_stream_is_applicable( beta, c, rntm ) ) enable_sup = FALSE; \
+\
+	/* The same goes for packing B in bfloat16. */ \
+	if ( bli_gemm_bf16_is_applicable( a, b, c, cntx, rntm ) ) enable_sup = FALSE; \
 \
 	if ( enable_sup ) \
 	{ \
@@ -101,11 +111,11 @@ void PASTEMAC(opname,EX_SUF) \
 	} \
 }
 
-GENFRONT( gemm )
+GENFRONT( gemm, BLIS_GEMM )
 
 
 #undef  GENFRONT
-#define GENFRONT( opname ) \
+#define GENFRONT( opname, opid ) \
 \
 void PASTEMAC(opname,EX_SUF) \
      ( \
@@ -120,33 +130,28 @@ void PASTEMAC(opname,EX_SUF) \
 	bli_init_once(); \
 \
 	BLIS_OAPI_EX_DECLS \
+\
+	/* Record the shape of the call if workload capture is enabled. */ \
+	bli_capture_l3( opid, BLIS_LEFT, a, b, c, rntm ); \
 \
 	/* If the rntm is non-NULL, it may indicate that we should forgo sup
 	   handling altogether. */ \
-	/*
 	bool enable_sup = TRUE; \
 	if ( rntm != NULL ) enable_sup = bli_rntm_l3_sup( rntm ); \
-	*/ \
 \
-	/* NOTE: The sup handling for gemmt is disabled here because gemmtsup
-	   is not yet fully implemented. */ \
-	/*
 	if ( enable_sup ) \
 	{ \
-	*/ \
 		/* Execute the small/unpacked oapi handler. If it finds that the problem
 		   does not fall within the thresholds that define "small", or for some
 		   other reason decides not to use the small/unpacked implementation,
 		   the function returns with BLIS_FAILURE, which causes execution to
 		   proceed towards the conventional implementation. */ \
-	/*
 		err_t result = PASTEMAC(opname,sup)( alpha, a, b, beta, c, cntx, rntm ); \
 		if ( result == BLIS_SUCCESS ) \
 		{ \
 			return; \
 		} \
 	} \
-	*/ \
 \
 	/* Only proceed with an induced method if each of the operands have a
 	   complex storage datatype. NOTE: Allowing precisions to vary while
@@ -170,11 +175,11 @@ void PASTEMAC(opname,EX_SUF) \
 	} \
 }
 
-GENFRONT( gemmt )
+GENFRONT( gemmt, BLIS_GEMMT )
 
 
 #undef  GENFRONT
-#define GENFRONT( opname ) \
+#define GENFRONT( opname, opid ) \
 \
 void PASTEMAC(opname,EX_SUF) \
      ( \
@@ -189,6 +194,9 @@ void PASTEMAC(opname,EX_SUF) \
 	bli_init_once(); \
 \
 	BLIS_OAPI_EX_DECLS \
+\
+	/* Record the shape of the call if workload capture is enabled. */ \
+	bli_capture_l3( opid, BLIS_LEFT, a, b, c, rntm ); \
 \
 	/* Only proceed with an induced method if each of the operands have a
 	   complex storage datatype. NOTE: Allowing precisions to vary while
@@ -214,12 +222,12 @@ void PASTEMAC(opname,EX_SUF) \
 	} \
 }
 
-GENFRONT( her2k )
-GENFRONT( syr2k )
+GENFRONT( her2k, BLIS_HER2K )
+GENFRONT( syr2k, BLIS_SYR2K )
 
 
 #undef  GENFRONT
-#define GENFRONT( opname ) \
+#define GENFRONT( opname, opid ) \
 \
 void PASTEMAC(opname,EX_SUF) \
      ( \
@@ -235,6 +243,28 @@ void PASTEMAC(opname,EX_SUF) \
 	bli_init_once(); \
 \
 	BLIS_OAPI_EX_DECLS \
+\
+	/* Record the shape of the call if workload capture is enabled. */ \
+	bli_capture_l3( opid, side, a, b, c, rntm ); \
+\
+	/* If the rntm is non-NULL, it may indicate that we should forgo sup
+	   handling altogether. */ \
+	bool enable_sup = TRUE; \
+	if ( rntm != NULL ) enable_sup = bli_rntm_l3_sup( rntm ); \
+\
+	if ( enable_sup ) \
+	{ \
+		/* Execute the small/unpacked oapi handler. If it finds that the problem
+		   does not fall within the thresholds that define "small", or for some
+		   other reason decides not to use the small/unpacked implementation,
+		   the function returns with BLIS_FAILURE, which causes execution to
+		   proceed towards the conventional implementation. */ \
+		err_t result = PASTEMAC(opname,sup)( side, alpha, a, b, beta, c, cntx, rntm ); \
+		if ( result == BLIS_SUCCESS ) \
+		{ \
+			return; \
+		} \
+	} \
 \
 	/* Only proceed with an induced method if all operands have the same
 	   (complex) datatype. If any datatypes differ, skip the induced method
@@ -257,18 +287,19 @@ void PASTEMAC(opname,EX_SUF) \
 	} \
 }
 
-GENFRONT( hemm )
-GENFRONT( symm )
-GENFRONT( trmm3 )
+GENFRONT( hemm, BLIS_HEMM )
+GENFRONT( symm, BLIS_SYMM )
 
 
 #undef  GENFRONT
-#define GENFRONT( opname ) \
+#define GENFRONT( opname, opid ) \
 \
 void PASTEMAC(opname,EX_SUF) \
      ( \
+       side_t  side, \
        obj_t*  alpha, \
        obj_t*  a, \
+       obj_t*  b, \
        obj_t*  beta, \
        obj_t*  c  \
        BLIS_OAPI_EX_PARAMS  \
@@ -277,6 +308,71 @@ void PASTEMAC(opname,EX_SUF) \
 	bli_init_once(); \
 \
 	BLIS_OAPI_EX_DECLS \
+\
+	/* Record the shape of the call if workload capture is enabled. */ \
+	bli_capture_l3( opid, side, a, b, c, rntm ); \
+\
+	/* Only proceed with an induced method if all operands have the same
+	   (complex) datatype. If any datatypes differ, skip the induced method
+	   chooser function and proceed directly with native execution, which is
+	   where mixed datatype support will be implemented (if at all). */ \
+	if ( bli_obj_dt( a ) == bli_obj_dt( c ) && \
+	     bli_obj_dt( b ) == bli_obj_dt( c ) && \
+	     bli_obj_is_complex( c ) ) \
+	{ \
+		/* Invoke the operation's "ind" function--its induced method front-end.
+		   For complex problems, it calls the highest priority induced method
+		   that is available (ie: implemented and enabled), and if none are
+		   enabled, it calls native execution. (For real problems, it calls
+		   the operation's native execution interface.) */ \
+		PASTEMAC(opname,ind)( side, alpha, a, b, beta, c, cntx, rntm ); \
+	} \
+	else \
+	{ \
+		PASTEMAC(opname,nat)( side, alpha, a, b, beta, c, cntx, rntm ); \
+	} \
+}
+
+GENFRONT( trmm3, BLIS_TRMM3 )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname, opid ) \
+\
+void PASTEMAC(opname,EX_SUF) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  a, \
+       obj_t*  beta, \
+       obj_t*  c  \
+       BLIS_OAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_OAPI_EX_DECLS \
+\
+	/* Record the shape of the call if workload capture is enabled. */ \
+	bli_capture_l3( opid, BLIS_LEFT, a, NULL, c, rntm ); \
+\
+	/* If the rntm is non-NULL, it may indicate that we should forgo sup
+	   handling altogether. */ \
+	bool enable_sup = TRUE; \
+	if ( rntm != NULL ) enable_sup = bli_rntm_l3_sup( rntm ); \
+\
+	if ( enable_sup ) \
+	{ \
+		/* Execute the small/unpacked oapi handler. If it finds that the problem
+		   does not fall within the thresholds that define "small", or for some
+		   other reason decides not to use the small/unpacked implementation,
+		   the function returns with BLIS_FAILURE, which causes execution to
+		   proceed towards the conventional implementation. */ \
+		err_t result = PASTEMAC(opname,sup)( alpha, a, beta, c, cntx, rntm ); \
+		if ( result == BLIS_SUCCESS ) \
+		{ \
+			return; \
+		} \
+	} \
 \
 	/* Only proceed with an induced method if all operands have the same
 	   (complex) datatype. If any datatypes differ, skip the induced method
@@ -298,12 +394,73 @@ void PASTEMAC(opname,EX_SUF) \
 	} \
 }
 
-GENFRONT( herk )
-GENFRONT( syrk )
+GENFRONT( herk, BLIS_HERK )
+GENFRONT( syrk, BLIS_SYRK )
+
+
+#undef  GENFRONT
+#define GENFRONT( opname, opid ) \
+\
+void PASTEMAC(opname,EX_SUF) \
+     ( \
+       side_t  side, \
+       obj_t*  alpha, \
+       obj_t*  a, \
+       obj_t*  b  \
+       BLIS_OAPI_EX_PARAMS  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	BLIS_OAPI_EX_DECLS \
+\
+	/* Record the shape of the call if workload capture is enabled. */ \
+	bli_capture_l3( opid, side, a, NULL, b, rntm ); \
+\
+	/* If the rntm is non-NULL, it may indicate that we should forgo sup
+	   handling altogether. */ \
+	bool enable_sup = TRUE; \
+	if ( rntm != NULL ) enable_sup = bli_rntm_l3_sup( rntm ); \
+\
+	if ( enable_sup ) \
+	{ \
+		/* Execute the small/unpacked oapi handler. If it finds that the problem
+		   does not fall within the thresholds that define "small", or for some
+		   other reason decides not to use the small/unpacked implementation,
+		   the function returns with BLIS_FAILURE, which causes execution to
+		   proceed towards the conventional implementation. */ \
+		err_t result = PASTEMAC(opname,sup)( side, alpha, a, b, cntx, rntm ); \
+		if ( result == BLIS_SUCCESS ) \
+		{ \
+			return; \
+		} \
+	} \
+\
+	/* Only proceed with an induced method if all operands have the same
+	   (complex) datatype. If any datatypes differ, skip the induced method
+	   chooser function and proceed directly with native execution, which is
+	   where mixed datatype support will be implemented (if at all). */ \
+	if ( bli_obj_dt( a ) == bli_obj_dt( b ) && \
+	     bli_obj_is_complex( b ) ) \
+	{ \
+		/* Invoke the operation's "ind" function--its induced method front-end.
+		   For complex problems, it calls the highest priority induced method
+		   that is available (ie: implemented and enabled), and if none are
+		   enabled, it calls native execution. (For real problems, it calls
+		   the operation's native execution interface.) */ \
+		PASTEMAC(opname,ind)( side, alpha, a, b, cntx, rntm ); \
+	} \
+	else \
+	{ \
+		PASTEMAC(opname,nat)( side, alpha, a, b, cntx, rntm ); \
+	} \
+}
+
+GENFRONT( trmm, BLIS_TRMM )
 
 
 #undef  GENFRONT
-#define GENFRONT( opname ) \
+#define GENFRONT( opname, opid ) \
 \
 void PASTEMAC(opname,EX_SUF) \
      ( \
@@ -317,6 +474,9 @@ void PASTEMAC(opname,EX_SUF) \
 	bli_init_once(); \
 \
 	BLIS_OAPI_EX_DECLS \
+\
+	/* Record the shape of the call if workload capture is enabled. */ \
+	bli_capture_l3( opid, side, a, NULL, b, rntm ); \
 \
 	/* Only proceed with an induced method if all operands have the same
 	   (complex) datatype. If any datatypes differ, skip the induced method
@@ -338,8 +498,7 @@ void PASTEMAC(opname,EX_SUF) \
 	} \
 }
 
-GENFRONT( trmm )
-GENFRONT( trsm )
+GENFRONT( trsm, BLIS_TRSM )
 
 
 #endif
@@ -49,6 +49,9 @@ void bli_l3_packm
 	mem_t*    cntl_mem_p;
 	siz_t     size_needed;
 
+	BLIS_PROF_START( t_prof );
+	BLIS_TRACE_START( t_trace );
+
 	// FGVZ: Not sure why we need this barrier, but we do.
 	bli_thread_barrier( thread );
 
@@ -67,7 +70,11 @@ void bli_l3_packm
 
 	// If zero was returned, no memory needs to be allocated and so we can
 	// return early.
-	if ( size_needed == 0 ) return;
+	if ( size_needed == 0 )
+	{
+		BLIS_PROF_STOP( BLIS_PROF_PACKM, t_prof );
+		return;
+	}
 
 	// Query the pack buffer type from the control tree node.
 	pack_buf_type = bli_cntl_packm_params_pack_buf_type( cntl );
@@ -183,5 +190,10 @@ void bli_l3_packm
 
 	// Barrier so that packing is done before computation.
 	bli_thread_barrier( thread );
+
+	BLIS_PROF_STOP( BLIS_PROF_PACKM, t_prof );
+	BLIS_TRACE_STOP( bli_trace_packm_id( pack_buf_type ), t_trace,
+	                 bli_obj_length( x ), bli_obj_width( x ), size_needed,
+	                 0, 0 );
 }
 
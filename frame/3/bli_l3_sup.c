@@ -201,3 +201,351 @@ err_t bli_gemmtsup
 }
 
 
+err_t bli_hemmsup
+     (
+       side_t  side,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	// Return early if small matrix handling is disabled at configure-time.
+	#ifdef BLIS_DISABLE_SUP_HANDLING
+	return BLIS_FAILURE;
+	#endif
+
+	// Return early if this is a mixed-datatype computation.
+	if ( bli_obj_dt( c ) != bli_obj_dt( a ) ||
+	     bli_obj_dt( c ) != bli_obj_dt( b ) ||
+	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) return BLIS_FAILURE;
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Return early if the problem dimensions exceed their sup thresholds.
+	// The Hermitian matrix A is m x m when applied from the left and n x n
+	// when applied from the right; in either case, its order plays the
+	// role of the k dimension.
+	if ( bli_cntx_l3_vir_ukr_dislikes_storage_of( c, BLIS_GEMM_UKR, cntx ) )
+	{
+		const num_t dt = bli_obj_dt( c );
+		const dim_t m  = bli_obj_length( c );
+		const dim_t n  = bli_obj_width( c );
+		const dim_t k  = bli_obj_length( a );
+
+		// Pass in m and n reversed, which simulates a transposition of the
+		// entire operation pursuant to the microkernel storage preference.
+		if ( !bli_cntx_l3_sup_thresh_is_met( dt, n, m, k, cntx ) )
+			return BLIS_FAILURE;
+	}
+	else // ukr_prefers_storage_of( c, ... )
+	{
+		const num_t dt = bli_obj_dt( c );
+		const dim_t m  = bli_obj_length( c );
+		const dim_t n  = bli_obj_width( c );
+		const dim_t k  = bli_obj_length( a );
+
+		if ( !bli_cntx_l3_sup_thresh_is_met( dt, m, n, k, cntx ) )
+			return BLIS_FAILURE;
+	}
+
+	// Query the small/unpacked handler from the context. If the
+	// subconfiguration did not register one, use the conventional code path.
+	hemmsup_oft hemmsup_fp = bli_cntx_get_l3_sup_handler( BLIS_HEMM, cntx );
+
+	if ( hemmsup_fp == NULL ) return BLIS_FAILURE;
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	return
+	hemmsup_fp
+	(
+	  side,
+	  alpha,
+	  a,
+	  b,
+	  beta,
+	  c,
+	  cntx,
+	  rntm
+	);
+}
+
+
+err_t bli_symmsup
+     (
+       side_t  side,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	// Return early if small matrix handling is disabled at configure-time.
+	#ifdef BLIS_DISABLE_SUP_HANDLING
+	return BLIS_FAILURE;
+	#endif
+
+	// Return early if this is a mixed-datatype computation.
+	if ( bli_obj_dt( c ) != bli_obj_dt( a ) ||
+	     bli_obj_dt( c ) != bli_obj_dt( b ) ||
+	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) return BLIS_FAILURE;
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Return early if the problem dimensions exceed their sup thresholds.
+	// The symmetric matrix A is m x m when applied from the left and n x n
+	// when applied from the right; in either case, its order plays the
+	// role of the k dimension.
+	if ( bli_cntx_l3_vir_ukr_dislikes_storage_of( c, BLIS_GEMM_UKR, cntx ) )
+	{
+		const num_t dt = bli_obj_dt( c );
+		const dim_t m  = bli_obj_length( c );
+		const dim_t n  = bli_obj_width( c );
+		const dim_t k  = bli_obj_length( a );
+
+		// Pass in m and n reversed, which simulates a transposition of the
+		// entire operation pursuant to the microkernel storage preference.
+		if ( !bli_cntx_l3_sup_thresh_is_met( dt, n, m, k, cntx ) )
+			return BLIS_FAILURE;
+	}
+	else // ukr_prefers_storage_of( c, ... )
+	{
+		const num_t dt = bli_obj_dt( c );
+		const dim_t m  = bli_obj_length( c );
+		const dim_t n  = bli_obj_width( c );
+		const dim_t k  = bli_obj_length( a );
+
+		if ( !bli_cntx_l3_sup_thresh_is_met( dt, m, n, k, cntx ) )
+			return BLIS_FAILURE;
+	}
+
+	// Query the small/unpacked handler from the context. If the
+	// subconfiguration did not register one, use the conventional code path.
+	symmsup_oft symmsup_fp = bli_cntx_get_l3_sup_handler( BLIS_SYMM, cntx );
+
+	if ( symmsup_fp == NULL ) return BLIS_FAILURE;
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	return
+	symmsup_fp
+	(
+	  side,
+	  alpha,
+	  a,
+	  b,
+	  beta,
+	  c,
+	  cntx,
+	  rntm
+	);
+}
+
+
+err_t bli_herksup
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	// Return early if small matrix handling is disabled at configure-time.
+	#ifdef BLIS_DISABLE_SUP_HANDLING
+	return BLIS_FAILURE;
+	#endif
+
+	// Return early if this is a mixed-datatype computation.
+	if ( bli_obj_dt( c ) != bli_obj_dt( a ) ||
+	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) return BLIS_FAILURE;
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Return early if the problem dimensions exceed their sup thresholds.
+	// As with gemmt, the storage preference of the microkernel does not
+	// matter here since C is square.
+	{
+		const num_t dt = bli_obj_dt( c );
+		const dim_t m  = bli_obj_length( c );
+		const dim_t k  = bli_obj_width_after_trans( a );
+
+		if ( !bli_cntx_l3_sup_thresh_is_met( dt, m, m, k, cntx ) )
+			return BLIS_FAILURE;
+	}
+
+	// Query the small/unpacked handler from the context. If the
+	// subconfiguration did not register one, use the conventional code path.
+	herksup_oft herksup_fp = bli_cntx_get_l3_sup_handler( BLIS_HERK, cntx );
+
+	if ( herksup_fp == NULL ) return BLIS_FAILURE;
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	return
+	herksup_fp
+	(
+	  alpha,
+	  a,
+	  beta,
+	  c,
+	  cntx,
+	  rntm
+	);
+}
+
+
+err_t bli_syrksup
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	// Return early if small matrix handling is disabled at configure-time.
+	#ifdef BLIS_DISABLE_SUP_HANDLING
+	return BLIS_FAILURE;
+	#endif
+
+	// Return early if this is a mixed-datatype computation.
+	if ( bli_obj_dt( c ) != bli_obj_dt( a ) ||
+	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) return BLIS_FAILURE;
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Return early if the problem dimensions exceed their sup thresholds.
+	// As with gemmt, the storage preference of the microkernel does not
+	// matter here since C is square.
+	{
+		const num_t dt = bli_obj_dt( c );
+		const dim_t m  = bli_obj_length( c );
+		const dim_t k  = bli_obj_width_after_trans( a );
+
+		if ( !bli_cntx_l3_sup_thresh_is_met( dt, m, m, k, cntx ) )
+			return BLIS_FAILURE;
+	}
+
+	// Query the small/unpacked handler from the context. If the
+	// subconfiguration did not register one, use the conventional code path.
+	syrksup_oft syrksup_fp = bli_cntx_get_l3_sup_handler( BLIS_SYRK, cntx );
+
+	if ( syrksup_fp == NULL ) return BLIS_FAILURE;
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	return
+	syrksup_fp
+	(
+	  alpha,
+	  a,
+	  beta,
+	  c,
+	  cntx,
+	  rntm
+	);
+}
+
+
+err_t bli_trmmsup
+     (
+       side_t  side,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	// Return early if small matrix handling is disabled at configure-time.
+	#ifdef BLIS_DISABLE_SUP_HANDLING
+	return BLIS_FAILURE;
+	#endif
+
+	// Return early if this is a mixed-datatype computation.
+	if ( bli_obj_dt( b ) != bli_obj_dt( a ) ||
+	     bli_obj_comp_prec( b ) != bli_obj_prec( b ) ) return BLIS_FAILURE;
+
+	// Obtain a valid (native) context from the gks if necessary.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	// Return early if the problem dimensions exceed their sup thresholds.
+	// The triangular matrix A is m x m when applied from the left and n x n
+	// when applied from the right; in either case, its order plays the role
+	// of the k dimension.
+	if ( bli_cntx_l3_vir_ukr_dislikes_storage_of( b, BLIS_GEMM_UKR, cntx ) )
+	{
+		const num_t dt = bli_obj_dt( b );
+		const dim_t m  = bli_obj_length( b );
+		const dim_t n  = bli_obj_width( b );
+		const dim_t k  = bli_obj_length( a );
+
+		// Pass in m and n reversed, which simulates a transposition of the
+		// entire operation pursuant to the microkernel storage preference.
+		if ( !bli_cntx_l3_sup_thresh_is_met( dt, n, m, k, cntx ) )
+			return BLIS_FAILURE;
+	}
+	else // ukr_prefers_storage_of( b, ... )
+	{
+		const num_t dt = bli_obj_dt( b );
+		const dim_t m  = bli_obj_length( b );
+		const dim_t n  = bli_obj_width( b );
+		const dim_t k  = bli_obj_length( a );
+
+		if ( !bli_cntx_l3_sup_thresh_is_met( dt, m, n, k, cntx ) )
+			return BLIS_FAILURE;
+	}
+
+	// Query the small/unpacked handler from the context. If the
+	// subconfiguration did not register one, use the conventional code path.
+	trmmsup_oft trmmsup_fp = bli_cntx_get_l3_sup_handler( BLIS_TRMM, cntx );
+
+	if ( trmmsup_fp == NULL ) return BLIS_FAILURE;
+
+	// Initialize a local runtime with global settings if necessary. Note
+	// that in the case that a runtime is passed in, we make a local copy.
+	rntm_t rntm_l;
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+	else                { rntm_l = *rntm;                       rntm = &rntm_l; }
+
+	return
+	trmmsup_fp
+	(
+	  side,
+	  alpha,
+	  a,
+	  b,
+	  cntx,
+	  rntm
+	);
+}
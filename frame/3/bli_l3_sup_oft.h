@@ -58,5 +58,64 @@ typedef err_t (*PASTECH(opname,_oft)) \
 
 GENTDEF( gemmsup )
 GENTDEF( gemmtsup )
+
+
+// hemm, symm
+
+#undef  GENTDEF
+#define GENTDEF( opname ) \
+\
+typedef err_t (*PASTECH(opname,_oft)) \
+( \
+  side_t  side, \
+  obj_t*  alpha, \
+  obj_t*  a, \
+  obj_t*  b, \
+  obj_t*  beta, \
+  obj_t*  c, \
+  cntx_t* cntx, \
+  rntm_t* rntm  \
+);
+
+GENTDEF( hemmsup )
+GENTDEF( symmsup )
+
+
+// herk, syrk
+
+#undef  GENTDEF
+#define GENTDEF( opname ) \
+\
+typedef err_t (*PASTECH(opname,_oft)) \
+( \
+  obj_t*  alpha, \
+  obj_t*  a, \
+  obj_t*  beta, \
+  obj_t*  c, \
+  cntx_t* cntx, \
+  rntm_t* rntm  \
+);
+
+GENTDEF( herksup )
+GENTDEF( syrksup )
+
+
+// trmm
+
+#undef  GENTDEF
+#define GENTDEF( opname ) \
+\
+typedef err_t (*PASTECH(opname,_oft)) \
+( \
+  side_t  side, \
+  obj_t*  alpha, \
+  obj_t*  a, \
+  obj_t*  b, \
+  cntx_t* cntx, \
+  rntm_t* rntm  \
+);
+
+GENTDEF( trmmsup )
+
 #endif
 
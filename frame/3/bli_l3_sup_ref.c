@@ -54,6 +54,11 @@ err_t bli_gemmsup_ref
 	if ( bli_error_checking_is_enabled() )
 		bli_gemm_check( alpha, a, b, beta, c, cntx );
 
+	// If one of m, n, or k is unit, perform the operation as the level-1v or
+	// level-2 operation that it degenerates into, if possible.
+	if ( bli_gemm_redirect( alpha, a, b, beta, c, cntx, rntm ) == BLIS_SUCCESS )
+		return BLIS_SUCCESS;
+
 #if 0
 	// NOTE: This special case handling is done within the variants.
 
@@ -91,9 +96,11 @@ err_t bli_gemmsup_ref
 	// set the ways of parallelism for each loop.
 	bli_rntm_set_ways_from_rntm_sup
 	(
+	  bli_obj_dt( c ),
 	  bli_obj_length( c ),
 	  bli_obj_width( c ),
 	  bli_obj_width( a ),
+	  cntx,
 	  rntm
 	);
 
@@ -161,21 +168,16 @@ err_t bli_gemmtsup_ref
 	}
 #endif
 
-	// Parse and interpret the contents of the rntm_t object to properly
-	// set the ways of parallelism for each loop.
-	bli_rntm_set_ways_from_rntm_sup
-	(
-	  bli_obj_length( c ),
-	  bli_obj_width( c ),
-	  bli_obj_width( a ),
-	  rntm
-	);
+	const stor3_t stor_id = bli_obj_stor3_from_strides( c, a, b );
 
-	return
-	bli_l3_sup_thread_decorator
+	// Don't use the small/unpacked implementation if one of the matrices
+	// uses general stride, or if C is not a diagonal-aligned triangle.
+	if ( stor_id == BLIS_XXX ) return BLIS_FAILURE;
+	if ( !bli_obj_is_upper_or_lower( c ) ||
+	     bli_obj_diag_offset( c ) != 0 ) return BLIS_FAILURE;
+
+	bli_gemmtsup_ref_blk
 	(
-	  bli_gemmtsup_int,
-	  BLIS_GEMMT, // operation family id
 	  alpha,
 	  a,
 	  b,
@@ -184,5 +186,332 @@ err_t bli_gemmtsup_ref
 	  cntx,
 	  rntm
 	);
+
+	return BLIS_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+err_t PASTEMAC(opname,sup_ref) \
+     ( \
+       side_t  side, \
+       obj_t*  alpha, \
+       obj_t*  a, \
+       obj_t*  b, \
+       obj_t*  beta, \
+       obj_t*  c, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	obj_t a_dense; \
+\
+	/* Check parameters. */ \
+	if ( bli_error_checking_is_enabled() ) \
+		PASTEMAC(opname,_check)( side, alpha, a, b, beta, c, cntx ); \
+\
+	/* Let the conventional implementation handle degenerate cases and
+	   general stride, since we cannot give the latter to the gemmsup
+	   handler anyway. */ \
+	if ( bli_obj_has_zero_dim( a ) ) return BLIS_FAILURE; \
+	if ( bli_obj_stor3_from_strides( c, a, b ) == BLIS_XXX ) \
+		return BLIS_FAILURE; \
+\
+	/* Expand the stored triangle of A into a full matrix. Since A is at most
+	   as large as the sup thresholds, this costs little compared to the
+	   control tree creation and packing incurred by the large code path. */ \
+	bli_l3_sup_ref_densify( a, c, &a_dense ); \
+\
+	if ( bli_is_left( side ) ) \
+		bli_gemmsup_ref_gemm( alpha, &a_dense, b, beta, c, cntx, rntm ); \
+	else \
+		bli_gemmsup_ref_gemm( alpha, b, &a_dense, beta, c, cntx, rntm ); \
+\
+	bli_obj_free( &a_dense ); \
+\
+	return BLIS_SUCCESS; \
+}
+
+GENFRONT( hemm )
+GENFRONT( symm )
+
+// -----------------------------------------------------------------------------
+
+#undef  GENFRONT
+#define GENFRONT( opname ) \
+\
+err_t PASTEMAC(opname,sup_ref) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  a, \
+       obj_t*  beta, \
+       obj_t*  c, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	obj_t ah_local; \
+\
+	/* Check parameters. */ \
+	if ( bli_error_checking_is_enabled() ) \
+		PASTEMAC(opname,_check)( alpha, a, beta, c, cntx ); \
+\
+	/* For herk, the right-hand "B" operand is simply A'. For syrk, it is
+	   A^T. */ \
+	bli_obj_alias_to( a, &ah_local ); \
+	bli_obj_induce_trans( &ah_local ); \
+	if ( bli_obj_is_hermitian( c ) ) bli_obj_toggle_conj( &ah_local ); \
+\
+	if ( bli_obj_stor3_from_strides( c, a, &ah_local ) == BLIS_XXX ) \
+		return BLIS_FAILURE; \
+	if ( bli_obj_diag_offset( c ) != 0 ) return BLIS_FAILURE; \
+\
+	/* The conventional implementation only computes the stored triangle of
+	   C, whereas we also compute the unstored half of each diagonal block.
+	   Thus, we enforce a stricter threshold on m. (On haswell with k above
+	   the gemm threshold, double real sup wins up to m ~= 100 and loses
+	   from m ~= 120 on, which matches halving the gemm m threshold.) */ \
+	if ( !bli_cntx_l3_sup_thresh_is_met( bli_obj_dt( c ), \
+	                                     2 * bli_obj_length( c ), \
+	                                     2 * bli_obj_length( c ), \
+	                                     bli_obj_width_after_trans( a ), \
+	                                     cntx ) ) return BLIS_FAILURE; \
+\
+	bli_gemmtsup_ref_blk( alpha, a, &ah_local, beta, c, cntx, rntm ); \
+\
+	/* As with the conventional herk implementation, explicitly zero the
+	   imaginary components of the diagonal of C, which may have accumulated
+	   meaningless non-zero values. */ \
+	if ( bli_obj_is_hermitian( c ) ) bli_setid( &BLIS_ZERO, c ); \
+\
+	return BLIS_SUCCESS; \
+}
+
+GENFRONT( herk )
+GENFRONT( syrk )
+
+// -----------------------------------------------------------------------------
+
+err_t bli_trmmsup_ref
+     (
+       side_t  side,
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	obj_t a_dense;
+	obj_t b_copy;
+
+	// Check parameters.
+	if ( bli_error_checking_is_enabled() )
+		bli_trmm_check( side, alpha, a, b, &BLIS_ZERO, b, cntx );
+
+	// Let the conventional implementation handle degenerate cases and
+	// general stride.
+	if ( bli_obj_has_zero_dim( a ) ) return BLIS_FAILURE;
+	if ( bli_obj_stor3_from_strides( b, a, b ) == BLIS_XXX )
+		return BLIS_FAILURE;
+
+	// The conventional implementation skips the zero triangle of A, whereas
+	// we multiply by it explicitly and also pay for densifying A and copying
+	// B. Measurements on haswell show that this only pays off when A itself
+	// is small (order <= ~50 in double real), independent of the other
+	// dimension of B; a small B dimension alone is not enough. Thus, we
+	// enforce a threshold on the order of A (the k dimension of the
+	// product) of a quarter of the gemm k threshold.
+	if ( 4 * bli_obj_length( a ) >=
+	     bli_cntx_get_l3_sup_thresh_dt( bli_obj_dt( b ), BLIS_KT, cntx ) )
+		return BLIS_FAILURE;
+
+	// Expand the triangular matrix A into a full matrix with explicit zeros
+	// in the unstored triangle, and make a copy of B since it is overwritten
+	// with the product.
+	bli_l3_sup_ref_densify( a, b, &a_dense );
+	bli_obj_create_conf_to( b, &b_copy );
+	bli_copym( b, &b_copy );
+
+	if ( bli_is_left( side ) )
+		bli_gemmsup_ref_gemm( alpha, &a_dense, &b_copy, &BLIS_ZERO, b, cntx, rntm );
+	else
+		bli_gemmsup_ref_gemm( alpha, &b_copy, &a_dense, &BLIS_ZERO, b, cntx, rntm );
+
+	bli_obj_free( &b_copy );
+	bli_obj_free( &a_dense );
+
+	return BLIS_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_gemmsup_ref_gemm
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	if ( bli_obj_has_zero_dim( c ) ) return;
+
+	// Each invocation of the gemmsup handler sets the ways of parallelism in
+	// the rntm_t according to the dimensions of the problem, so we give it
+	// a fresh copy each time.
+	rntm_t rntm_l = *rntm;
+
+	gemmsup_oft gemmsup_fp = bli_cntx_get_l3_sup_handler( BLIS_GEMM, cntx );
+
+	err_t r_val = gemmsup_fp( alpha, a, b, beta, c, cntx, &rntm_l );
+
+	// If the handler declined the subproblem, compute it with the native
+	// (conventional) implementation instead.
+	if ( r_val != BLIS_SUCCESS )
+	{
+		rntm_l = *rntm;
+		bli_gemmnat( alpha, a, b, beta, c, cntx, &rntm_l );
+	}
+}
+
+void bli_gemmtsup_ref_blk
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	const num_t dt = bli_obj_dt( c );
+	const dim_t m  = bli_obj_length( c );
+
+	if ( bli_zero_dim1( m ) ) return;
+
+	const dim_t MR = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MR, cntx );
+	const dim_t NR = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_NR, cntx );
+
+	// Partition the stored triangle of C into a handful of diagonal blocks
+	// and the rectangular panels between them. The panels are computed
+	// directly into C by the gemmsup handler while the diagonal blocks are
+	// computed in full into a temporary matrix, after which only the stored
+	// triangle is accumulated into C. The block size is a multiple of the
+	// register blocksizes so that only the last block has edge cases.
+	const dim_t b_mult = bli_max( MR, NR );
+	const dim_t b_alg  = bli_align_dim_to_mult( ( m + 3 ) / 4, b_mult );
+
+	obj_t ct;
+
+	if ( bli_obj_is_row_stored( c ) )
+		bli_obj_create( dt, b_alg, b_alg, b_alg, 1, &ct );
+	else
+		bli_obj_create( dt, b_alg, b_alg, 1, b_alg, &ct );
+
+	for ( dim_t i = 0; i < m; i += b_alg )
+	{
+		const dim_t b_use = bli_min( b_alg, m - i );
+
+		obj_t a1, b1, c11, ct11;
+
+		bli_acquire_mpart_t2b( BLIS_SUBPART1, i, b_use, a, &a1 );
+		bli_acquire_mpart_l2r( BLIS_SUBPART1, i, b_use, b, &b1 );
+		bli_acquire_mpart_tl2br( BLIS_SUBPART11, i, b_use, c, &c11 );
+		bli_acquire_mpart( 0, 0, b_use, b_use, &ct, &ct11 );
+
+		// ct11 := alpha * a1 * b1;
+		// c11  := beta * c11 + ct11; (stored triangle only)
+		bli_gemmsup_ref_gemm( alpha, &a1, &b1, &BLIS_ZERO, &ct11, cntx, rntm );
+
+		bli_obj_set_struc( BLIS_TRIANGULAR, &ct11 );
+		bli_obj_set_uplo( bli_obj_uplo( c ), &ct11 );
+		bli_xpbym( &ct11, beta, &c11 );
+
+		if ( bli_obj_is_lower( c ) )
+		{
+			obj_t a2, c21;
+
+			// c21 := beta * c21 + alpha * a2 * b1;
+			bli_acquire_mpart_t2b( BLIS_SUBPART2, i, b_use, a, &a2 );
+			bli_acquire_mpart_tl2br( BLIS_SUBPART21, i, b_use, c, &c21 );
+			bli_obj_set_struc( BLIS_GENERAL, &c21 );
+			bli_obj_set_uplo( BLIS_DENSE, &c21 );
+
+			bli_gemmsup_ref_gemm( alpha, &a2, &b1, beta, &c21, cntx, rntm );
+		}
+		else // if ( bli_obj_is_upper( c ) )
+		{
+			obj_t a0, c01;
+
+			// c01 := beta * c01 + alpha * a0 * b1;
+			bli_acquire_mpart_t2b( BLIS_SUBPART0, i, b_use, a, &a0 );
+			bli_acquire_mpart_tl2br( BLIS_SUBPART01, i, b_use, c, &c01 );
+			bli_obj_set_struc( BLIS_GENERAL, &c01 );
+			bli_obj_set_uplo( BLIS_DENSE, &c01 );
+
+			bli_gemmsup_ref_gemm( alpha, &a0, &b1, beta, &c01, cntx, rntm );
+		}
+	}
+
+	bli_obj_free( &ct );
+}
+
+void bli_l3_sup_ref_densify
+     (
+       obj_t*  a,
+       obj_t*  c,
+       obj_t*  a_dense
+     )
+{
+	const num_t dt = bli_obj_dt( a );
+	const dim_t m  = bli_obj_length( a );
+
+	// Store the full copy of A the same way as C so that the gemmsup
+	// handler sees one of the storage combinations it handles best.
+	if ( bli_obj_is_row_stored( c ) )
+		bli_obj_create( dt, m, m, m, 1, a_dense );
+	else
+		bli_obj_create( dt, m, m, 1, m, a_dense );
+
+	// Determine which triangle of the copy will be written by copym, which
+	// applies any transposition indicated by A.
+	uplo_t uplo = bli_obj_uplo( a );
+	if ( bli_obj_has_trans( a ) ) bli_toggle_uplo( &uplo );
+
+	if ( bli_obj_is_triangular( a ) )
+	{
+		// Zero the unstored triangle and copy the stored one (including a
+		// unit diagonal, if applicable).
+		bli_setm( &BLIS_ZERO, a_dense );
+		bli_copym( a, a_dense );
+	}
+	else // if ( bli_obj_is_symmetric( a ) || bli_obj_is_hermitian( a ) )
+	{
+		// Copy the stored triangle and reflect it into the unstored one.
+		bli_copym( a, a_dense );
+
+		bli_obj_set_struc( bli_obj_struc( a ), a_dense );
+		bli_obj_set_uplo( uplo, a_dense );
+
+		if ( bli_obj_is_hermitian( a ) )
+		{
+			bli_mkherm( a_dense );
+			bli_setid( &BLIS_ZERO, a_dense );
+		}
+		else
+		{
+			bli_mksymm( a_dense );
+		}
+	}
+
+	bli_obj_set_struc( BLIS_GENERAL, a_dense );
+	bli_obj_set_uplo( BLIS_DENSE, a_dense );
 }
 
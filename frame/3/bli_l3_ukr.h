@@ -60,3 +60,10 @@ INSERT_GENTPROT_BASIC0( gemmtrsm_u_ukr_name )
 INSERT_GENTPROT_BASIC0( trsm_l_ukr_name )
 INSERT_GENTPROT_BASIC0( trsm_u_ukr_name )
 
+
+#undef  GENTPROT
+#define GENTPROT GEMMT_UKR_PROT
+
+INSERT_GENTPROT_BASIC0( gemmt_l_ukr_name )
+INSERT_GENTPROT_BASIC0( gemmt_u_ukr_name )
+
@@ -55,4 +55,6 @@ GENFRONT( gemmtrsm, gemmtrsm_l_ukernel )
 GENFRONT( gemmtrsm, gemmtrsm_u_ukernel )
 GENFRONT( trsm,     trsm_l_ukernel )
 GENFRONT( trsm,     trsm_u_ukernel )
+GENFRONT( gemmt,    gemmt_l_ukernel )
+GENFRONT( gemmt,    gemmt_u_ukernel )
 
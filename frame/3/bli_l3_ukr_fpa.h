@@ -47,4 +47,6 @@ GENPROT( gemmtrsm, gemmtrsm_l_ukernel )
 GENPROT( gemmtrsm, gemmtrsm_u_ukernel )
 GENPROT( trsm,     trsm_l_ukernel )
 GENPROT( trsm,     trsm_u_ukernel )
+GENPROT( gemmt,    gemmt_l_ukernel )
+GENPROT( gemmt,    gemmt_u_ukernel )
 
@@ -238,3 +238,65 @@ void PASTEMAC0(opname) \
 
 GENFRONT( trsm, trsm_ukernel, trsm_l_ukernel, trsm_u_ukernel )
 
+
+#undef  GENFRONT
+#define GENFRONT( tname, opname, opnamel, opnameu ) \
+\
+void PASTEMAC0(opname) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  a, \
+       obj_t*  b, \
+       obj_t*  beta, \
+       obj_t*  c, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	num_t     dt        = bli_obj_dt( c ); \
+\
+	doff_t    diagoffc  = bli_obj_diag_offset( c ); \
+	dim_t     m         = bli_obj_length( c ); \
+	dim_t     n         = bli_obj_width( c ); \
+	dim_t     k         = bli_obj_width( a ); \
+	void*     buf_a     = bli_obj_buffer_at_off( a ); \
+	void*     buf_b     = bli_obj_buffer_at_off( b ); \
+	void*     buf_c     = bli_obj_buffer_at_off( c ); \
+	inc_t     rs_c      = bli_obj_row_stride( c ); \
+	inc_t     cs_c      = bli_obj_col_stride( c ); \
+	void*     buf_alpha = bli_obj_buffer_for_1x1( dt, alpha ); \
+	void*     buf_beta  = bli_obj_buffer_for_1x1( dt, beta ); \
+\
+	auxinfo_t data; \
+\
+	/* Fill the auxinfo_t struct in case the micro-kernel uses it. */ \
+	bli_auxinfo_set_next_a( buf_a, &data ); \
+	bli_auxinfo_set_next_b( buf_b, &data ); \
+	bli_auxinfo_set_is_a( 1, &data ); \
+	bli_auxinfo_set_is_b( 1, &data ); \
+\
+	/* Query a type-specific function pointer, except one that uses
+	   void* for function arguments instead of typed pointers. */ \
+	PASTECH2(tname,_ukr,_vft) f = \
+	( bli_obj_is_lower( c ) ? PASTEMAC(opnamel,_qfp)( dt ) \
+	                        : PASTEMAC(opnameu,_qfp)( dt ) ); \
+\
+	f \
+	( \
+	  diagoffc, \
+	  m, \
+	  n, \
+	  k, \
+	  buf_alpha, \
+	  buf_a, \
+	  buf_b, \
+	  buf_beta, \
+	  buf_c, rs_c, cs_c, \
+	  &data, \
+	  cntx  \
+	); \
+} \
+
+GENFRONT( gemmt, gemmt_ukernel, gemmt_l_ukernel, gemmt_u_ukernel )
+
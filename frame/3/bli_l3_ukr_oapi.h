@@ -83,3 +83,19 @@ BLIS_EXPORT_BLIS void PASTEMAC0(opname) \
 
 GENPROT( trsm_ukernel )
 
+
+#undef  GENPROT
+#define GENPROT( opname ) \
+\
+BLIS_EXPORT_BLIS void PASTEMAC0(opname) \
+     ( \
+       obj_t*  alpha, \
+       obj_t*  a, \
+       obj_t*  b, \
+       obj_t*  beta, \
+       obj_t*  c, \
+       cntx_t* cntx  \
+     );
+
+GENPROT( gemmt_ukernel )
+
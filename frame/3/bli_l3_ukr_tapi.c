@@ -148,3 +148,49 @@ void PASTEMAC(ch,opname) \
 INSERT_GENTFUNC_BASIC2( trsm_l_ukernel, trsm, BLIS_TRSM_L_UKR )
 INSERT_GENTFUNC_BASIC2( trsm_u_ukernel, trsm, BLIS_TRSM_U_UKR )
 
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, tname, kerid ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       doff_t              diagoff, \
+       dim_t               m, \
+       dim_t               n, \
+       dim_t               k, \
+       ctype*     restrict alpha, \
+       ctype*     restrict a, \
+       ctype*     restrict b, \
+       ctype*     restrict beta, \
+       ctype*     restrict c, inc_t rs_c, inc_t cs_c, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     ) \
+{ \
+	bli_init_once(); \
+\
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	/* Query the context for the function address of the current
+	   datatype's micro-kernel. */ \
+	PASTECH2(ch,tname,_ukr_ft) f = bli_cntx_get_l3_vir_ukr_dt( dt, kerid, cntx ); \
+\
+	/* Invoke the typed function for the given datatype. */ \
+	f( \
+	   diagoff, \
+	   m, \
+	   n, \
+	   k, \
+	   alpha, \
+	   a, \
+	   b, \
+	   beta, \
+	   c, rs_c, cs_c, \
+	   data, \
+	   cntx  \
+	 ); \
+} \
+
+INSERT_GENTFUNC_BASIC2( gemmt_l_ukernel, gemmt, BLIS_GEMMT_L_UKR )
+INSERT_GENTFUNC_BASIC2( gemmt_u_ukernel, gemmt, BLIS_GEMMT_U_UKR )
+
@@ -50,6 +50,11 @@
 #undef  trsm_u_ukr_name
 #define trsm_u_ukr_name     trsm_u_ukernel
 
+#undef  gemmt_l_ukr_name
+#define gemmt_l_ukr_name    gemmt_l_ukernel
+#undef  gemmt_u_ukr_name
+#define gemmt_u_ukr_name    gemmt_u_ukernel
+
 // Include the level-3 micro-kernel API template.
 
 #include "bli_l3_ukr.h"
@@ -34,6 +34,10 @@
 
 #include "bli_gemm_cntl.h"
 #include "bli_gemm_front.h"
+#include "bli_gemm_redirect.h"
+#include "bli_gemm_strassen.h"
+#include "bli_gemm_stream.h"
+#include "bli_gemm_bf16.h"
 #include "bli_gemm_int.h"
 
 #include "bli_gemm_var.h"
@@ -0,0 +1,109 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The global rntm_t structure. (The definition resides in bli_rntm.c.)
+extern rntm_t global_rntm;
+
+// A mutex to allow synchronous access to global_rntm. (The definition
+// resides in bli_rntm.c.)
+extern bli_pthread_mutex_t global_rntm_mutex;
+
+// -----------------------------------------------------------------------------
+
+void bli_gemm_bf16_init( void )
+{
+	// NOTE: We don't need to acquire the global_rntm_mutex here because this
+	// function is only called by bli_init_once().
+
+	// Read BLIS_PACK_B_BF16, defaulting to zero (ie: B is packed in float)
+	// if it is unset.
+	gint_t pack_b_bf16 = bli_env_get_var( "BLIS_PACK_B_BF16", 0 );
+
+	bli_rntm_set_pack_b_bf16( ( bool )( pack_b_bf16 != 0 ), &global_rntm );
+}
+
+bool bli_gemm_bf16_get_pack_b( void )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	return bli_rntm_pack_b_bf16( &global_rntm );
+}
+
+void bli_gemm_bf16_set_pack_b( bool pack_b_bf16 )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	// Acquire the mutex protecting global_rntm.
+	bli_pthread_mutex_lock( &global_rntm_mutex );
+
+	bli_rntm_set_pack_b_bf16( pack_b_bf16, &global_rntm );
+
+	// Release the mutex protecting global_rntm.
+	bli_pthread_mutex_unlock( &global_rntm_mutex );
+}
+
+// -----------------------------------------------------------------------------
+
+bool bli_gemm_bf16_is_applicable
+     (
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	// A NULL rntm_t defers to the global setting.
+	if ( rntm == NULL ) rntm = &global_rntm;
+
+	if ( !bli_rntm_pack_b_bf16( rntm ) ) return FALSE;
+
+	// Only sgemm with homogeneous datatypes and single precision computation
+	// is supported...
+	if ( bli_obj_dt( a ) != BLIS_FLOAT ||
+	     bli_obj_dt( b ) != BLIS_FLOAT ||
+	     bli_obj_dt( c ) != BLIS_FLOAT ||
+	     bli_obj_comp_prec( c ) != BLIS_SINGLE_PREC ) return FALSE;
+
+	// ...and only if the context provides a microkernel that reads packed
+	// B in bfloat16.
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	return ( bli_cntx_get_l3_vir_ukr_dt( BLIS_FLOAT, BLIS_GEMM_BF16B_UKR, cntx ) != NULL );
+}
+
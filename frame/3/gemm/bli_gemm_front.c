@@ -73,6 +73,25 @@ void bli_gemm_front
 		return;
 	}
 
+	// If one of m, n, or k is unit, perform the operation as the level-1v or
+	// level-2 operation that it degenerates into, if possible.
+	if ( bli_gemm_redirect( alpha, a, b, beta, c, cntx, rntm ) == BLIS_SUCCESS )
+		return;
+
+	// If the runtime object requests it, and the problem is large enough,
+	// perform the operation via the reference implementation of Strassen's
+	// algorithm.
+	if ( bli_gemm_strassen_is_applicable( a, b, c, rntm ) )
+	{
+		bli_gemm_strassen( alpha, a, b, beta, c, cntx, rntm );
+		return;
+	}
+
+	// Leave the request for streaming stores to C in the runtime object only
+	// if they are expected to help. The macrokernel consults it when writing
+	// full tiles of C.
+	bli_rntm_set_stream_c( bli_gemm_stream_is_applicable( beta, c, rntm ), rntm );
+
 #if 0
 #ifdef BLIS_ENABLE_SMALL_MATRIX
 	// Only handle small problems separately for homogeneous datatypes.
@@ -170,6 +189,14 @@ void bli_gemm_front
 		bli_obj_swap_pack_schemas( &a_local, &b_local );
 	}
 
+	// If the runtime object requests it and the context supports it, pack
+	// B (which, after any transposition above, is the operand whose panels
+	// are reused across the ic loop) in bfloat16. This must follow the
+	// transposition so that the schema lands on the operand actually packed
+	// into micropanels of B.
+	if ( bli_gemm_bf16_is_applicable( &a_local, &b_local, &c_local, cntx, rntm ) )
+		bli_obj_set_pack_schema( BLIS_PACKED_COL_PANELS_BF16, &b_local );
+
 	// Parse and interpret the contents of the rntm_t object to properly
 	// set the ways of parallelism for each loop, and then make any
 	// additional modifications necessary for the current operation.
@@ -177,9 +204,11 @@ void bli_gemm_front
 	(
 	  BLIS_GEMM,
 	  BLIS_LEFT, // ignored for gemm/hemm/symm
+	  bli_obj_exec_dt( &c_local ),
 	  bli_obj_length( &c_local ),
 	  bli_obj_width( &c_local ),
 	  bli_obj_width( &a_local ),
+	  cntx,
 	  rntm
 	);
 
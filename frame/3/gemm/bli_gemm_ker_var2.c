@@ -222,6 +222,33 @@ void PASTEMAC(ch,varname) \
 	   function pointer type. */ \
 	PASTECH(ch,gemm_ukr_ft) \
 	                gemm_ukr   = bli_cntx_get_l3_vir_ukr_dt( dt, BLIS_GEMM_UKR, cntx ); \
+\
+	/* Query the context for the masked-edge micro-kernel. If the context
+	   provides one, edge cases are computed directly on C; otherwise, we
+	   fall back to the temporary buffer below. */ \
+	PASTECH(ch,gemm_edge_ukr_ft) \
+	                edge_ukr   = bli_cntx_get_l3_vir_ukr_dt( dt, BLIS_GEMM_EDGE_UKR, cntx ); \
+\
+	/* Query the context for the streaming-store micro-kernel. If the rntm_t
+	   requests streaming stores and beta is zero, full tiles are written to
+	   C with non-temporal stores (which avoid reading C into the cache);
+	   otherwise, full tiles use the regular micro-kernel. */ \
+	PASTECH(ch,gemm_ukr_ft) \
+	                full_ukr   = bli_cntx_get_l3_vir_ukr_dt( dt, BLIS_GEMM_NT_UKR, cntx ); \
+	if ( full_ukr == NULL || !bli_rntm_stream_c( rntm ) || \
+	     !PASTEMAC(ch,eq0)( *( ( ctype* )beta ) ) ) \
+		full_ukr = gemm_ukr; \
+\
+	/* If B was packed in bfloat16, every tile must be computed with the
+	   microkernel that reads such micropanels. (bli_gemm_front() only
+	   requests this schema when the context provides that microkernel.)
+	   Edge cases then go through the temporary buffer below. */ \
+	if ( bli_is_bf16_packed( schema_b ) ) \
+	{ \
+		gemm_ukr = bli_cntx_get_l3_vir_ukr_dt( dt, BLIS_GEMM_BF16B_UKR, cntx ); \
+		full_ukr = gemm_ukr; \
+		edge_ukr = NULL; \
+	} \
 \
 	/* Temporary C buffer for edge cases. Note that the strides of this
 	   temporary buffer are set so that they match the storage of the
@@ -271,6 +298,7 @@ void PASTEMAC(ch,varname) \
 	if ( bli_zero_dim3( m, n, k ) ) return; \
 \
 	/* Clear the temporary C buffer in case it has any infs or NaNs. */ \
+	if ( edge_ukr == NULL ) \
 	PASTEMAC(ch,set0s_mxn)( MR, NR, \
 	                        ct, rs_ct, cs_ct ); \
 \
@@ -366,8 +394,25 @@ void PASTEMAC(ch,varname) \
 			if ( m_cur == MR && n_cur == NR ) \
 			{ \
 				/* Invoke the gemm micro-kernel. */ \
-				gemm_ukr \
+				full_ukr \
+				( \
+				  k, \
+				  alpha_cast, \
+				  a1, \
+				  b1, \
+				  beta_cast, \
+				  c11, rs_c, cs_c, \
+				  &aux, \
+				  cntx  \
+				); \
+			} \
+			else if ( edge_ukr != NULL ) \
+			{ \
+				/* Invoke the masked-edge gemm micro-kernel. */ \
+				edge_ukr \
 				( \
+				  m_cur, \
+				  n_cur, \
 				  k, \
 				  alpha_cast, \
 				  a1, \
@@ -401,6 +446,10 @@ void PASTEMAC(ch,varname) \
 			} \
 		} \
 	} \
+\
+	/* If any full tiles were written with streaming stores, make them
+	   visible before returning (see bli_gemm_stream_fence()). */ \
+	if ( full_ukr != gemm_ukr ) bli_gemm_stream_fence(); \
 \
 /*
 PASTEMAC(ch,fprintm)( stdout, "gemm_ker_var2: b1", k, NR, b1, NR, 1, "%4.1f", "" ); \
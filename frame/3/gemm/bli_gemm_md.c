@@ -689,9 +689,11 @@ void bli_gemm_md_front
 	(
 	  BLIS_GEMM,
 	  BLIS_LEFT, // ignored for gemm/hemm/symm
+	  bli_obj_exec_dt( &c_local ),
 	  bli_obj_length( &c_local ),
 	  bli_obj_width( &c_local ),
 	  bli_obj_width( &a_local ),
+	  cntx,
 	  rntm
 	);
 
@@ -830,9 +832,11 @@ void bli_gemm_md_zgemm
 	(
 	  BLIS_GEMM,
 	  BLIS_LEFT, // ignored for gemm/hemm/symm
+	  bli_obj_exec_dt( &c_local ),
 	  bli_obj_length( &c_local ),
 	  bli_obj_width( &c_local ),
 	  bli_obj_width( &a_local ),
+	  cntx,
 	  rntm
 	);
 
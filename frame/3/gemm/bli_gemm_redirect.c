@@ -0,0 +1,342 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// When one of the dimensions of a gemm problem is unit, the operation
+// degenerates into a level-1v or level-2 operation:
+//
+//   m = n = 1         ->  dotxv   (rho := beta * rho + alpha * a^T b)
+//   k = 1, m or n = 1 ->  axpbyv  (y := beta * y + (alpha * a0) * b)
+//   n = 1             ->  gemv    (y := beta * y + alpha * A * x)
+//   m = 1             ->  gemv    (y^T := beta * y^T + alpha * B^T * x^T)
+//   k = 1             ->  scalm + ger  (C := beta * C + alpha * a * b^T)
+//
+// These shapes are bound by memory bandwidth rather than floating-point
+// throughput, and the level-1v/level-2 kernels handle them without packing,
+// blocking, or partitioning for the gemm microkernel. Since the level-1v and
+// level-2 operations are not multithreaded, the gemv and ger cases are only
+// redirected when the runtime calls for a single thread; when more threads
+// are requested, those shapes remain with gemm so that all of the threads
+// may contribute.
+//
+
+typedef err_t (*FUNCPTR_T)
+     (
+       trans_t transa,
+       trans_t transb,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       void*   alpha,
+       void*   a, inc_t rs_a, inc_t cs_a,
+       void*   b, inc_t rs_b, inc_t cs_b,
+       void*   beta,
+       void*   c, inc_t rs_c, inc_t cs_c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     );
+
+static FUNCPTR_T GENARRAY(ftypes,gemm_redirect);
+
+err_t bli_gemm_redirect
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	const dim_t m = bli_obj_length( c );
+	const dim_t n = bli_obj_width( c );
+	const dim_t k = bli_obj_width_after_trans( a );
+
+	// Return early if none of the dimensions are unit.
+	if ( m != 1 && n != 1 && k != 1 ) return BLIS_FAILURE;
+
+	// Return early if this is a mixed-datatype computation.
+	if ( bli_obj_dt( c ) != bli_obj_dt( a ) ||
+	     bli_obj_dt( c ) != bli_obj_dt( b ) ||
+	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) return BLIS_FAILURE;
+
+	const num_t   dt        = bli_obj_dt( c );
+
+	const trans_t transa    = bli_obj_conjtrans_status( a );
+	const trans_t transb    = bli_obj_conjtrans_status( b );
+
+	void*         buf_a     = bli_obj_buffer_at_off( a );
+	const inc_t   rs_a      = bli_obj_row_stride( a );
+	const inc_t   cs_a      = bli_obj_col_stride( a );
+
+	void*         buf_b     = bli_obj_buffer_at_off( b );
+	const inc_t   rs_b      = bli_obj_row_stride( b );
+	const inc_t   cs_b      = bli_obj_col_stride( b );
+
+	void*         buf_c     = bli_obj_buffer_at_off( c );
+	inc_t         rs_c      = bli_obj_row_stride( c );
+	inc_t         cs_c      = bli_obj_col_stride( c );
+
+	void*         buf_alpha = bli_obj_buffer_for_1x1( dt, alpha );
+	void*         buf_beta  = bli_obj_buffer_for_1x1( dt, beta );
+
+	// The dimensions of C above already account for any transposition of C,
+	// so the strides must be made to agree with them.
+	if ( bli_obj_has_trans( c ) ) bli_swap_incs( &rs_c, &cs_c );
+
+	// Index into the type combination array to extract the correct
+	// function pointer.
+	FUNCPTR_T f = ftypes[dt];
+
+	return
+	f
+	(
+	  transa,
+	  transb,
+	  m,
+	  n,
+	  k,
+	  buf_alpha,
+	  buf_a, rs_a, cs_a,
+	  buf_b, rs_b, cs_b,
+	  buf_beta,
+	  buf_c, rs_c, cs_c,
+	  cntx,
+	  rntm
+	);
+}
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+err_t PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       void*   alpha, \
+       void*   a, inc_t rs_a, inc_t cs_a, \
+       void*   b, inc_t rs_b, inc_t cs_b, \
+       void*   beta, \
+       void*   c, inc_t rs_c, inc_t cs_c, \
+       cntx_t* cntx, \
+       rntm_t* rntm  \
+     ) \
+{ \
+	/* Return early if none of the dimensions are unit. */ \
+	if ( m != 1 && n != 1 && k != 1 ) return BLIS_FAILURE; \
+\
+	/* Return early if any dimension is zero so that the caller's usual
+	   handling of empty problems applies. */ \
+	if ( bli_zero_dim3( m, n, k ) ) return BLIS_FAILURE; \
+\
+	ctype*          alpha_cast = alpha; \
+	ctype*          a_cast     = a; \
+	ctype*          b_cast     = b; \
+	ctype*          beta_cast  = beta; \
+	ctype*          c_cast     = c; \
+\
+	const conj_t conja = bli_extract_conj( transa ); \
+	const conj_t conjb = bli_extract_conj( transb ); \
+\
+	/* Absorb any transpositions of A and B into their strides so that A is
+	   m x k and B is k x n from here on. */ \
+	if ( bli_does_trans( transa ) ) bli_swap_incs( &rs_a, &cs_a ); \
+	if ( bli_does_trans( transb ) ) bli_swap_incs( &rs_b, &cs_b ); \
+\
+	if ( m == 1 && n == 1 ) \
+	{ \
+		/* c00 := beta * c00 + alpha * conja(a)^T * conjb(b), where a is the
+		   row of A and b is the column of B. */ \
+		PASTEMAC2(ch,dotxv,BLIS_TAPI_EX_SUF) \
+		( \
+		  conja, \
+		  conjb, \
+		  k, \
+		  alpha_cast, \
+		  a_cast, cs_a, \
+		  b_cast, rs_b, \
+		  beta_cast, \
+		  c_cast, \
+		  cntx, \
+		  rntm  \
+		); \
+\
+		return BLIS_SUCCESS; \
+	} \
+\
+	if ( k == 1 && n == 1 ) \
+	{ \
+		ctype b00, alpha_b00; \
+\
+		/* c := beta * c + ( alpha * conjb(b00) ) * conja(a), where a and
+		   c are the columns of A and C. */ \
+		PASTEMAC(ch,copycjs)( conjb, *b_cast, b00 ); \
+		PASTEMAC(ch,scal2s)( *alpha_cast, b00, alpha_b00 ); \
+\
+		PASTEMAC2(ch,axpbyv,BLIS_TAPI_EX_SUF) \
+		( \
+		  conja, \
+		  m, \
+		  &alpha_b00, \
+		  a_cast, rs_a, \
+		  beta_cast, \
+		  c_cast, rs_c, \
+		  cntx, \
+		  rntm  \
+		); \
+\
+		return BLIS_SUCCESS; \
+	} \
+\
+	if ( k == 1 && m == 1 ) \
+	{ \
+		ctype a00, alpha_a00; \
+\
+		/* c := beta * c + ( alpha * conja(a00) ) * conjb(b), where b and
+		   c are the rows of B and C. */ \
+		PASTEMAC(ch,copycjs)( conja, *a_cast, a00 ); \
+		PASTEMAC(ch,scal2s)( *alpha_cast, a00, alpha_a00 ); \
+\
+		PASTEMAC2(ch,axpbyv,BLIS_TAPI_EX_SUF) \
+		( \
+		  conjb, \
+		  n, \
+		  &alpha_a00, \
+		  b_cast, cs_b, \
+		  beta_cast, \
+		  c_cast, cs_c, \
+		  cntx, \
+		  rntm  \
+		); \
+\
+		return BLIS_SUCCESS; \
+	} \
+\
+	/* The remaining cases would give up the parallelism that gemm offers,
+	   so leave them to gemm if more than one thread was requested. */ \
+	rntm_t rntm_l; \
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; } \
+\
+	if ( bli_rntm_num_threads( rntm ) > 1 || \
+	     bli_rntm_calc_num_threads( rntm ) > 1 ) return BLIS_FAILURE; \
+\
+	if ( n == 1 ) \
+	{ \
+		/* c := beta * c + alpha * conja(A) * conjb(b), where b and c are the
+		   columns of B and C. */ \
+		PASTEMAC2(ch,gemv,BLIS_TAPI_EX_SUF) \
+		( \
+		  ( bli_is_conj( conja ) ? BLIS_CONJ_NO_TRANSPOSE : BLIS_NO_TRANSPOSE ), \
+		  conjb, \
+		  m, \
+		  k, \
+		  alpha_cast, \
+		  a_cast, rs_a, cs_a, \
+		  b_cast, rs_b, \
+		  beta_cast, \
+		  c_cast, rs_c, \
+		  cntx, \
+		  rntm  \
+		); \
+	} \
+	else if ( m == 1 ) \
+	{ \
+		/* c^T := beta * c^T + alpha * conjb(B)^T * conja(a)^T, where a and
+		   c are the rows of A and C. */ \
+		PASTEMAC2(ch,gemv,BLIS_TAPI_EX_SUF) \
+		( \
+		  ( bli_is_conj( conjb ) ? BLIS_CONJ_TRANSPOSE : BLIS_TRANSPOSE ), \
+		  conja, \
+		  k, \
+		  n, \
+		  alpha_cast, \
+		  b_cast, rs_b, cs_b, \
+		  a_cast, cs_a, \
+		  beta_cast, \
+		  c_cast, cs_c, \
+		  cntx, \
+		  rntm  \
+		); \
+	} \
+	else /* if ( k == 1 ) */ \
+	{ \
+		/* ger does not scale C, so apply beta first. (scalm overwrites C
+		   with zeros when beta is zero.) */ \
+		if ( !PASTEMAC(ch,eq1)( *beta_cast ) ) \
+		{ \
+			PASTEMAC2(ch,scalm,BLIS_TAPI_EX_SUF) \
+			( \
+			  BLIS_NO_CONJUGATE, \
+			  0, \
+			  BLIS_NONUNIT_DIAG, \
+			  BLIS_DENSE, \
+			  m, \
+			  n, \
+			  beta_cast, \
+			  c_cast, rs_c, cs_c, \
+			  cntx, \
+			  rntm  \
+			); \
+		} \
+\
+		/* C := C + alpha * conja(a) * conjb(b)^T, where a is the column of
+		   A and b is the row of B. */ \
+		PASTEMAC2(ch,ger,BLIS_TAPI_EX_SUF) \
+		( \
+		  conja, \
+		  conjb, \
+		  m, \
+		  n, \
+		  alpha_cast, \
+		  a_cast, rs_a, \
+		  b_cast, cs_b, \
+		  c_cast, rs_c, cs_c, \
+		  cntx, \
+		  rntm  \
+		); \
+	} \
+\
+	return BLIS_SUCCESS; \
+}
+
+INSERT_GENTFUNC_BASIC0( gemm_redirect )
+
@@ -0,0 +1,823 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The global rntm_t structure. (The definition resides in bli_rntm.c.)
+extern rntm_t global_rntm;
+
+// A mutex to allow synchronous access to global_rntm. (The definition
+// resides in bli_rntm.c.)
+extern bli_pthread_mutex_t global_rntm_mutex;
+
+// -----------------------------------------------------------------------------
+
+void bli_gemm_strassen_init( void )
+{
+	// NOTE: We don't need to acquire the global_rntm_mutex here because this
+	// function is only called by bli_init_once().
+
+	// Read BLIS_STRASSEN_LEVELS, defaulting to zero (ie: the conventional
+	// gemm algorithm) if it is unset or negative.
+	gint_t levels = bli_env_get_var( "BLIS_STRASSEN_LEVELS", 0 );
+
+	if ( levels < 0 ) levels = 0;
+
+	bli_rntm_set_strassen_levels( ( dim_t )levels, &global_rntm );
+}
+
+dim_t bli_gemm_strassen_get_levels( void )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	return bli_rntm_strassen_levels( &global_rntm );
+}
+
+void bli_gemm_strassen_set_levels( dim_t levels )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	// Acquire the mutex protecting global_rntm.
+	bli_pthread_mutex_lock( &global_rntm_mutex );
+
+	bli_rntm_set_strassen_levels( bli_max( levels, 0 ), &global_rntm );
+
+	// Release the mutex protecting global_rntm.
+	bli_pthread_mutex_unlock( &global_rntm_mutex );
+}
+
+// -----------------------------------------------------------------------------
+
+bool bli_gemm_strassen_is_applicable
+     (
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  c,
+       rntm_t* rntm
+     )
+{
+	if ( bli_rntm_strassen_levels( rntm ) < 1 ) return FALSE;
+
+	// Strassen is only supported for homogeneous real-domain problems.
+	const num_t dt = bli_obj_dt( c );
+
+	if ( !bli_is_real( dt ) ||
+	     bli_obj_dt( a ) != dt ||
+	     bli_obj_dt( b ) != dt ||
+	     bli_obj_comp_prec( c ) != bli_obj_prec( c ) ) return FALSE;
+
+	const dim_t m = bli_obj_length_after_trans( c );
+	const dim_t n = bli_obj_width_after_trans( c );
+	const dim_t k = bli_obj_width_after_trans( a );
+
+	// Only apply a level if each dimension of the resulting subproblems is
+	// large enough for the savings in flops to outweigh the extra packing
+	// and write-back work of forming the operand sums and accumulating the
+	// products.
+	if ( m / 2 < BLIS_STRASSEN_MIN_DIM ||
+	     n / 2 < BLIS_STRASSEN_MIN_DIM ||
+	     k / 2 < BLIS_STRASSEN_MIN_DIM ) return FALSE;
+
+	return TRUE;
+}
+
+// -----------------------------------------------------------------------------
+
+// A linear combination of blocks of a matrix that has been partitioned into
+// a 2^L x 2^L grid of equally-sized blocks: the sum over t < n of s[t] times
+// block ( i[t], j[t] ).
+typedef struct
+{
+	dim_t n;
+	dim_t i[ BLIS_STRASSEN_MAX_TERMS ];
+	dim_t j[ BLIS_STRASSEN_MAX_TERMS ];
+	int   s[ BLIS_STRASSEN_MAX_TERMS ];
+} strsum_t;
+
+// One of the 7^L products of L levels of Strassen's algorithm: the sums of
+// blocks of A and B that form its operands, and the blocks of C (with their
+// signs) that the product is added to.
+typedef struct
+{
+	strsum_t a;
+	strsum_t b;
+	strsum_t c;
+} strprod_t;
+
+// The seven products of one level of Strassen's algorithm, in terms of the
+// 2 x 2 quadrants of A, B, and C:
+//
+//   M1 = (A11 + A22)(B11 + B22);  C11 += M1;  C22 += M1;
+//   M2 = (A21 + A22) B11;         C21 += M2;  C22 -= M2;
+//   M3 = A11 (B12 - B22);         C12 += M3;  C22 += M3;
+//   M4 = A22 (B21 - B11);         C11 += M4;  C21 += M4;
+//   M5 = (A11 + A12) B22;         C11 -= M5;  C12 += M5;
+//   M6 = (A21 - A11)(B11 + B12);  C22 += M6;
+//   M7 = (A12 - A22)(B21 + B22);  C11 += M7;
+static const strprod_t strassen_one_level[ 7 ] =
+{
+	{ { 2, { 0, 1 }, { 0, 1 }, { 1,  1 } },
+	  { 2, { 0, 1 }, { 0, 1 }, { 1,  1 } },
+	  { 2, { 0, 1 }, { 0, 1 }, { 1,  1 } } },
+	{ { 2, { 1, 1 }, { 0, 1 }, { 1,  1 } },
+	  { 1, { 0    }, { 0    }, { 1     } },
+	  { 2, { 1, 1 }, { 0, 1 }, { 1, -1 } } },
+	{ { 1, { 0    }, { 0    }, { 1     } },
+	  { 2, { 0, 1 }, { 1, 1 }, { 1, -1 } },
+	  { 2, { 0, 1 }, { 1, 1 }, { 1,  1 } } },
+	{ { 1, { 1    }, { 1    }, { 1     } },
+	  { 2, { 1, 0 }, { 0, 0 }, { 1, -1 } },
+	  { 2, { 0, 1 }, { 0, 0 }, { 1,  1 } } },
+	{ { 2, { 0, 0 }, { 0, 1 }, { 1,  1 } },
+	  { 1, { 1    }, { 1    }, { 1     } },
+	  { 2, { 0, 0 }, { 0, 1 }, { -1, 1 } } },
+	{ { 2, { 1, 0 }, { 0, 0 }, { 1, -1 } },
+	  { 2, { 0, 0 }, { 0, 1 }, { 1,  1 } },
+	  { 1, { 1    }, { 1    }, { 1     } } },
+	{ { 2, { 0, 1 }, { 1, 1 }, { 1, -1 } },
+	  { 2, { 1, 1 }, { 0, 1 }, { 1,  1 } },
+	  { 1, { 0    }, { 0    }, { 1     } } },
+};
+
+// Refine the sum x over a 2^l x 2^l grid by the one-level sum y, which
+// splits each block of x into 2 x 2 quadrants, yielding a sum z over the
+// 2^(l+1) x 2^(l+1) grid.
+static void bli_gemm_strassen_refine
+     (
+       const strsum_t* x,
+       const strsum_t* y,
+             strsum_t* z
+     )
+{
+	z->n = 0;
+
+	for ( dim_t tx = 0; tx < x->n; ++tx )
+	for ( dim_t ty = 0; ty < y->n; ++ty )
+	{
+		z->i[ z->n ] = 2 * x->i[ tx ] + y->i[ ty ];
+		z->j[ z->n ] = 2 * x->j[ tx ] + y->j[ ty ];
+		z->s[ z->n ] = x->s[ tx ] * y->s[ ty ];
+		z->n += 1;
+	}
+}
+
+// Build the 7^levels products of the given number of levels of Strassen's
+// algorithm and return how many there are.
+static dim_t bli_gemm_strassen_plan
+     (
+       dim_t      levels,
+       strprod_t* prods
+     )
+{
+	strprod_t prev[ BLIS_STRASSEN_MAX_PRODS ];
+	dim_t     n_prods = 1;
+
+	// Zero levels: the single product A B, added to C.
+	prods[ 0 ].a.n = 1; prods[ 0 ].a.i[ 0 ] = 0; prods[ 0 ].a.j[ 0 ] = 0; prods[ 0 ].a.s[ 0 ] = 1;
+	prods[ 0 ].b = prods[ 0 ].a;
+	prods[ 0 ].c = prods[ 0 ].a;
+
+	for ( dim_t l = 0; l < levels; ++l )
+	{
+		for ( dim_t p = 0; p < n_prods; ++p ) prev[ p ] = prods[ p ];
+
+		for ( dim_t p = 0; p < n_prods; ++p )
+		for ( dim_t q = 0; q < 7; ++q )
+		{
+			strprod_t* z = &prods[ 7 * p + q ];
+
+			bli_gemm_strassen_refine( &prev[ p ].a, &strassen_one_level[ q ].a, &z->a );
+			bli_gemm_strassen_refine( &prev[ p ].b, &strassen_one_level[ q ].b, &z->b );
+			bli_gemm_strassen_refine( &prev[ p ].c, &strassen_one_level[ q ].c, &z->c );
+		}
+
+		n_prods *= 7;
+	}
+
+	return n_prods;
+}
+
+// -----------------------------------------------------------------------------
+
+// The arguments of bli_gemm_strassen_thread_entry(), as passed to each
+// thread by bli_thread_launch(). The operands are partitioned into grids of
+// mb x kb (A), kb x nb (B), and mb x nb (C) blocks, and B~ is the packed
+// buffer that the threads share.
+typedef struct
+{
+	num_t            dt;
+	dim_t            mb;
+	dim_t            nb;
+	dim_t            kb;
+	void*            alpha;
+	void*            a; inc_t rs_a; inc_t cs_a;
+	void*            b; inc_t rs_b; inc_t cs_b;
+	void*            c; inc_t rs_c; inc_t cs_c;
+	const strprod_t* prods;
+	dim_t            n_prods;
+	void*            bp;
+	cntx_t*          cntx;
+} strparams_t;
+
+#undef  GENTFUNCRO
+#define GENTFUNCRO( ctype, ch, opname ) \
+\
+/* Pack the mc x kc block alpha * sum_t s[t] * A_t into MR x kc micropanels,
+   zero-padding the last micropanel out to MR rows. */ \
+static void PASTEMAC(ch,opname ## _packa) \
+     ( \
+       dim_t           mc, \
+       dim_t           kc, \
+       dim_t           n_t, \
+       ctype* restrict a[], \
+       ctype           s[], \
+       inc_t           rs_a, \
+       inc_t           cs_a, \
+       dim_t           MR, \
+       dim_t           PACKMR, \
+       ctype* restrict ap  \
+     ) \
+{ \
+	for ( dim_t i = 0; i < mc; i += MR ) \
+	{ \
+		const dim_t     mr_cur = bli_min( MR, mc - i ); \
+		ctype* restrict ap_i   = ap + ( i / MR ) * PACKMR * kc; \
+\
+		if ( bli_abs( cs_a ) < bli_abs( rs_a ) ) \
+		{ \
+			/* Row-stored A: read along the rows of the micropanel. */ \
+			for ( dim_t ii = 0; ii < mr_cur; ++ii ) \
+			{ \
+				ctype* restrict a0 = a[ 0 ] + ( i + ii ) * rs_a; \
+\
+				for ( dim_t l = 0; l < kc; ++l ) \
+					ap_i[ ii + l * PACKMR ] = s[ 0 ] * a0[ l * cs_a ]; \
+\
+				for ( dim_t t = 1; t < n_t; ++t ) \
+				{ \
+					ctype* restrict at = a[ t ] + ( i + ii ) * rs_a; \
+\
+					for ( dim_t l = 0; l < kc; ++l ) \
+						ap_i[ ii + l * PACKMR ] += s[ t ] * at[ l * cs_a ]; \
+				} \
+			} \
+		} \
+		else \
+		{ \
+			for ( dim_t l = 0; l < kc; ++l ) \
+			{ \
+				ctype* restrict ap_il = ap_i + l * PACKMR; \
+				ctype* restrict a0    = a[ 0 ] + i * rs_a + l * cs_a; \
+\
+				for ( dim_t ii = 0; ii < mr_cur; ++ii ) \
+					ap_il[ ii ] = s[ 0 ] * a0[ ii * rs_a ]; \
+\
+				for ( dim_t t = 1; t < n_t; ++t ) \
+				{ \
+					ctype* restrict at = a[ t ] + i * rs_a + l * cs_a; \
+\
+					for ( dim_t ii = 0; ii < mr_cur; ++ii ) \
+						ap_il[ ii ] += s[ t ] * at[ ii * rs_a ]; \
+				} \
+			} \
+		} \
+\
+		for ( dim_t l = 0; l < kc; ++l ) \
+		for ( dim_t ii = mr_cur; ii < PACKMR; ++ii ) \
+			ap_i[ ii + l * PACKMR ] = 0; \
+	} \
+} \
+\
+/* Pack the NR columns of the kc x nc block sum_t s[t] * B_t that begin at
+   column j into a kc x NR micropanel, zero-padding it out to NR columns. */ \
+static void PASTEMAC(ch,opname ## _packb) \
+     ( \
+       dim_t           j, \
+       dim_t           kc, \
+       dim_t           nc, \
+       dim_t           n_t, \
+       ctype* restrict b[], \
+       ctype           s[], \
+       inc_t           rs_b, \
+       inc_t           cs_b, \
+       dim_t           NR, \
+       dim_t           PACKNR, \
+       ctype* restrict bp_j  \
+     ) \
+{ \
+	const dim_t nr_cur = bli_min( NR, nc - j ); \
+\
+	for ( dim_t l = 0; l < kc; ++l ) \
+	{ \
+		ctype* restrict bp_jl = bp_j + l * PACKNR; \
+		ctype* restrict b0    = b[ 0 ] + l * rs_b + j * cs_b; \
+\
+		for ( dim_t jj = 0; jj < nr_cur; ++jj ) \
+			bp_jl[ jj ] = s[ 0 ] * b0[ jj * cs_b ]; \
+\
+		for ( dim_t t = 1; t < n_t; ++t ) \
+		{ \
+			ctype* restrict bt = b[ t ] + l * rs_b + j * cs_b; \
+\
+			for ( dim_t jj = 0; jj < nr_cur; ++jj ) \
+				bp_jl[ jj ] += s[ t ] * bt[ jj * cs_b ]; \
+		} \
+\
+		for ( dim_t jj = nr_cur; jj < PACKNR; ++jj ) \
+			bp_jl[ jj ] = 0; \
+	} \
+} \
+\
+/* Accumulate s[t] times the m x n tile ct into each of the n_t tiles c[t],
+   reading ct only once and traversing it in the order in which C is
+   stored. */ \
+static void PASTEMAC(ch,opname ## _axpyt) \
+     ( \
+       dim_t           m, \
+       dim_t           n, \
+       dim_t           n_t, \
+       ctype           s[], \
+       ctype* restrict ct, inc_t rs_ct, inc_t cs_ct, \
+       ctype*          c[], inc_t rs_c,  inc_t cs_c  \
+     ) \
+{ \
+	if ( cs_c == 1 && cs_ct == 1 ) \
+	{ \
+		for ( dim_t i = 0; i < m; ++i ) \
+		for ( dim_t t = 0; t < n_t; ++t ) \
+		{ \
+			ctype* restrict ct_i = ct     + i * rs_ct; \
+			ctype* restrict c_i  = c[ t ] + i * rs_c; \
+\
+			for ( dim_t j = 0; j < n; ++j ) \
+				c_i[ j ] += s[ t ] * ct_i[ j ]; \
+		} \
+	} \
+	else if ( rs_c == 1 && rs_ct == 1 ) \
+	{ \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t t = 0; t < n_t; ++t ) \
+		{ \
+			ctype* restrict ct_j = ct     + j * cs_ct; \
+			ctype* restrict c_j  = c[ t ] + j * cs_c; \
+\
+			for ( dim_t i = 0; i < m; ++i ) \
+				c_j[ i ] += s[ t ] * ct_j[ i ]; \
+		} \
+	} \
+	else \
+	{ \
+		for ( dim_t t = 0; t < n_t; ++t ) \
+		for ( dim_t j = 0; j < n; ++j ) \
+		for ( dim_t i = 0; i < m; ++i ) \
+			c[ t ][ i * rs_c + j * cs_c ] += s[ t ] * ct[ i * rs_ct + j * cs_ct ]; \
+	} \
+} \
+\
+/* Compute every product in p->prods on the threads of gl_comm. For each
+   product, the operand sums are formed while packing A~ and B~, and each
+   microtile of the product is added to all of the blocks of C that it
+   contributes to as soon as it is computed, so no temporary matrices are
+   needed. The threads share each packed B~ and split the ic loop, each
+   packing its own A~. */ \
+static void PASTEMAC(ch,opname) \
+     ( \
+       const strparams_t* p, \
+       thrcomm_t*         gl_comm, \
+       dim_t              tid  \
+     ) \
+{ \
+	const num_t     dt      = PASTEMAC(ch,type); \
+	cntx_t*         cntx    = p->cntx; \
+\
+	const dim_t     MR      = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t     NR      = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ); \
+	const dim_t     PACKMR  = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx ); \
+	const dim_t     PACKNR  = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx ); \
+	const dim_t     MC      = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx ); \
+	const dim_t     KC      = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx ); \
+	const dim_t     NC      = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx ); \
+\
+	const dim_t     nt      = bli_thrcomm_num_threads( gl_comm ); \
+\
+	PASTECH(ch,gemm_ukr_ft) \
+	                gemm_ukr = bli_cntx_get_l3_nat_ukr_dt( dt, BLIS_GEMM_UKR, cntx ); \
+\
+	/* Temporary microtile for products that go to more than one block of C
+	   and for edge cases, stored as the micro-kernel prefers. */ \
+	ctype           ct[ BLIS_STACK_BUF_MAX_SIZE \
+	                    / sizeof( ctype ) ] \
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	const bool      col_pref = bli_cntx_l3_nat_ukr_prefers_cols_dt( dt, BLIS_GEMM_UKR, cntx ); \
+	const inc_t     rs_ct    = ( col_pref ? 1 : NR ); \
+	const inc_t     cs_ct    = ( col_pref ? MR : 1 ); \
+\
+	ctype* restrict zero     = PASTEMAC(ch,0); \
+	ctype* restrict one      = PASTEMAC(ch,1); \
+	ctype* restrict alpha    = p->alpha; \
+	ctype* restrict a_cast   = p->a; \
+	ctype* restrict b_cast   = p->b; \
+	ctype* restrict c_cast   = p->c; \
+	ctype* restrict bp       = p->bp; \
+	const inc_t     rs_a     = p->rs_a, cs_a = p->cs_a; \
+	const inc_t     rs_b     = p->rs_b, cs_b = p->cs_b; \
+	const inc_t     rs_c     = p->rs_c, cs_c = p->cs_c; \
+	const dim_t     mb       = p->mb; \
+	const dim_t     nb       = p->nb; \
+	const dim_t     kb       = p->kb; \
+\
+	ctype*          a_t[ BLIS_STRASSEN_MAX_TERMS ]; \
+	ctype*          b_t[ BLIS_STRASSEN_MAX_TERMS ]; \
+	ctype*          c_t[ BLIS_STRASSEN_MAX_TERMS ]; \
+	ctype*          c_tile[ BLIS_STRASSEN_MAX_TERMS ]; \
+	ctype           sa[ BLIS_STRASSEN_MAX_TERMS ]; \
+	ctype           sb[ BLIS_STRASSEN_MAX_TERMS ]; \
+	ctype           sc[ BLIS_STRASSEN_MAX_TERMS ]; \
+	auxinfo_t       aux; \
+	err_t           r_val; \
+\
+	/* Each thread packs its own A~. */ \
+	const dim_t     mc_max   = bli_min( MC, mb ); \
+	const size_t    ap_size  = ( ( mc_max + MR - 1 ) / MR ) * PACKMR * \
+	                           bli_min( KC, kb ) * sizeof( ctype ); \
+	ctype* restrict ap       = bli_fmalloc_align( BLIS_MALLOC_INTL, ap_size, \
+	                                              BLIS_POOL_ADDR_ALIGN_SIZE_A, \
+	                                              &r_val ); \
+\
+	bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, &aux ); \
+	bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, &aux ); \
+	bli_auxinfo_set_is_a( 1, &aux ); \
+	bli_auxinfo_set_is_b( 1, &aux ); \
+\
+	for ( dim_t q = 0; q < p->n_prods; ++q ) \
+	{ \
+		const strprod_t* prod = &p->prods[ q ]; \
+\
+		/* Locate the blocks that make up this product. Alpha is applied
+		   while packing A~. */ \
+		for ( dim_t t = 0; t < prod->a.n; ++t ) \
+		{ \
+			a_t[ t ] = a_cast + prod->a.i[ t ] * mb * rs_a + prod->a.j[ t ] * kb * cs_a; \
+			sa[ t ]  = prod->a.s[ t ] * *alpha; \
+		} \
+		for ( dim_t t = 0; t < prod->b.n; ++t ) \
+		{ \
+			b_t[ t ] = b_cast + prod->b.i[ t ] * kb * rs_b + prod->b.j[ t ] * nb * cs_b; \
+			sb[ t ]  = prod->b.s[ t ]; \
+		} \
+		for ( dim_t t = 0; t < prod->c.n; ++t ) \
+		{ \
+			c_t[ t ] = c_cast + prod->c.i[ t ] * mb * rs_c + prod->c.j[ t ] * nb * cs_c; \
+			sc[ t ]  = prod->c.s[ t ]; \
+		} \
+\
+		for ( dim_t jc = 0; jc < nb; jc += NC ) \
+		{ \
+			const dim_t nc     = bli_min( NC, nb - jc ); \
+			const dim_t n_iter = ( nc + NR - 1 ) / NR; \
+\
+			for ( dim_t pc = 0; pc < kb; pc += KC ) \
+			{ \
+				const dim_t kc = bli_min( KC, kb - pc ); \
+				ctype*      b_pc[ BLIS_STRASSEN_MAX_TERMS ]; \
+\
+				for ( dim_t t = 0; t < prod->b.n; ++t ) \
+					b_pc[ t ] = b_t[ t ] + pc * rs_b + jc * cs_b; \
+\
+				/* The threads pack B~ together, one micropanel at a time,
+				   and wait for each other before using it. */ \
+				for ( dim_t jr = tid; jr < n_iter; jr += nt ) \
+					PASTEMAC(ch,opname ## _packb) \
+					( \
+					  jr * NR, kc, nc, prod->b.n, b_pc, sb, rs_b, cs_b, \
+					  NR, PACKNR, bp + jr * PACKNR * kc \
+					); \
+\
+				bli_thrcomm_barrier( tid, gl_comm ); \
+\
+				for ( dim_t ic = tid * MC; ic < mb; ic += nt * MC ) \
+				{ \
+					const dim_t mc     = bli_min( MC, mb - ic ); \
+					const dim_t m_iter = ( mc + MR - 1 ) / MR; \
+					ctype*      a_ic[ BLIS_STRASSEN_MAX_TERMS ]; \
+\
+					for ( dim_t t = 0; t < prod->a.n; ++t ) \
+						a_ic[ t ] = a_t[ t ] + ic * rs_a + pc * cs_a; \
+\
+					PASTEMAC(ch,opname ## _packa) \
+					( \
+					  mc, kc, prod->a.n, a_ic, sa, rs_a, cs_a, \
+					  MR, PACKMR, ap \
+					); \
+\
+					for ( dim_t jr = 0; jr < n_iter; ++jr ) \
+					for ( dim_t ir = 0; ir < m_iter; ++ir ) \
+					{ \
+						const dim_t     m_cur = bli_min( MR, mc - ir * MR ); \
+						const dim_t     n_cur = bli_min( NR, nc - jr * NR ); \
+						const inc_t     off_c = ( ic + ir * MR ) * rs_c + \
+						                        ( jc + jr * NR ) * cs_c; \
+						ctype* restrict a1    = ap + ir * PACKMR * kc; \
+						ctype* restrict b1    = bp + jr * PACKNR * kc; \
+\
+						/* Save addresses of next panels of A and B to the
+						   auxinfo_t object. */ \
+						bli_auxinfo_set_next_a( ir + 1 < m_iter ? a1 + PACKMR * kc : ap, &aux ); \
+						bli_auxinfo_set_next_b( ir + 1 < m_iter ? b1 : \
+						                        ( jr + 1 < n_iter ? b1 + PACKNR * kc : bp ), &aux ); \
+\
+						if ( prod->c.n == 1 && m_cur == MR && n_cur == NR ) \
+						{ \
+							/* Update the only block of C directly. */ \
+							gemm_ukr \
+							( \
+							  kc, \
+							  &sc[ 0 ], \
+							  a1, \
+							  b1, \
+							  one, \
+							  c_t[ 0 ] + off_c, rs_c, cs_c, \
+							  &aux, \
+							  cntx  \
+							); \
+						} \
+						else \
+						{ \
+							/* Compute the microtile once, and add it to each
+							   block of C while it is still in the L1 cache. */ \
+							gemm_ukr \
+							( \
+							  kc, \
+							  one, \
+							  a1, \
+							  b1, \
+							  zero, \
+							  ct, rs_ct, cs_ct, \
+							  &aux, \
+							  cntx  \
+							); \
+\
+							for ( dim_t t = 0; t < prod->c.n; ++t ) \
+								c_tile[ t ] = c_t[ t ] + off_c; \
+\
+							PASTEMAC(ch,opname ## _axpyt) \
+							( \
+							  m_cur, n_cur, prod->c.n, sc, \
+							  ct, rs_ct, cs_ct, \
+							  c_tile, rs_c, cs_c \
+							); \
+						} \
+					} \
+				} \
+\
+				/* Wait for all of the threads to finish with B~ before it is
+				   repacked. */ \
+				bli_thrcomm_barrier( tid, gl_comm ); \
+			} \
+		} \
+	} \
+\
+	bli_ffree_align( BLIS_FREE_INTL, ap ); \
+}
+
+INSERT_GENTFUNCRO_BASIC0( gemm_strassen_int )
+
+static void bli_gemm_strassen_thread_entry
+     (
+       thrcomm_t*  gl_comm,
+       dim_t       tid,
+       const void* params
+     )
+{
+	const strparams_t* p = params;
+
+	if ( p->dt == BLIS_FLOAT ) bli_sgemm_strassen_int( p, gl_comm, tid );
+	else                       bli_dgemm_strassen_int( p, gl_comm, tid );
+}
+
+// Return the number of threads requested via rntm. If only the ways of
+// parallelism were given, use as many threads as they imply in total, since
+// the fused products parallelize a single loop.
+static dim_t bli_gemm_strassen_num_threads
+     (
+       rntm_t* rntm
+     )
+{
+#ifdef BLIS_ENABLE_MULTITHREADING
+	dim_t nt = bli_rntm_num_threads( rntm );
+
+	if ( nt < 1 )
+	{
+		nt  = bli_max( bli_rntm_jc_ways( rntm ), 1 );
+		nt *= bli_max( bli_rntm_pc_ways( rntm ), 1 );
+		nt *= bli_max( bli_rntm_ic_ways( rntm ), 1 );
+		nt *= bli_max( bli_rntm_jr_ways( rntm ), 1 );
+		nt *= bli_max( bli_rntm_ir_ways( rntm ), 1 );
+	}
+
+	return nt;
+#else
+	( void )rntm;
+
+	return 1;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+static void bli_gemm_strassen_untrans
+     (
+       obj_t* x
+     )
+{
+	// Absorb any transposition into the object's strides so that it may be
+	// partitioned in terms of its stored dimensions.
+	if ( bli_obj_has_trans( x ) )
+	{
+		bli_obj_induce_trans( x );
+		bli_obj_set_onlytrans( BLIS_NO_TRANSPOSE, x );
+	}
+}
+
+// Perform gemm via the fused formulation of Strassen's algorithm, in which
+// the operand sums are formed while packing and each product is added to C
+// during write-back. This is a reference implementation: it calls the native
+// micro-kernel as a black box, so a product that updates more than one block
+// of C is computed into a temporary microtile and then added to each block
+// once per kc iteration. That traffic currently outweighs the saved flops on
+// the configurations that were measured, so Strassen remains disabled by
+// default.
+void bli_gemm_strassen
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	obj_t a_local, b_local, c_local;
+
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx();
+
+	bli_obj_alias_to( a, &a_local );
+	bli_obj_alias_to( b, &b_local );
+	bli_obj_alias_to( c, &c_local );
+
+	// As in bli_gemm_front(), if the micro-kernel prefers the opposite
+	// storage of C, compute C^T = B^T A^T instead.
+	if ( bli_cntx_l3_nat_ukr_dislikes_storage_of( &c_local, BLIS_GEMM_UKR, cntx ) )
+	{
+		bli_obj_swap( &a_local, &b_local );
+
+		bli_obj_induce_trans( &a_local );
+		bli_obj_induce_trans( &b_local );
+		bli_obj_induce_trans( &c_local );
+	}
+
+	bli_gemm_strassen_untrans( &a_local );
+	bli_gemm_strassen_untrans( &b_local );
+	bli_gemm_strassen_untrans( &c_local );
+
+	const num_t dt = bli_obj_dt( &c_local );
+
+	const dim_t m  = bli_obj_length( &c_local );
+	const dim_t n  = bli_obj_width( &c_local );
+	const dim_t k  = bli_obj_width( &a_local );
+
+	// Use as many of the requested levels as are supported and leave
+	// subproblems that are large enough.
+	dim_t levels = bli_min( bli_rntm_strassen_levels( rntm ),
+	                        BLIS_STRASSEN_MAX_LEVELS );
+
+	while ( levels > 1 &&
+	        ( ( m >> levels ) < BLIS_STRASSEN_MIN_DIM ||
+	          ( n >> levels ) < BLIS_STRASSEN_MIN_DIM ||
+	          ( k >> levels ) < BLIS_STRASSEN_MIN_DIM ) ) levels -= 1;
+
+	// Partition the leading ms x ks, ks x ns, and ms x ns submatrices of A,
+	// B, and C into grids of 2^levels x 2^levels equally-sized blocks.
+	const dim_t mb = m >> levels;
+	const dim_t nb = n >> levels;
+	const dim_t kb = k >> levels;
+	const dim_t ms = mb << levels;
+	const dim_t ns = nb << levels;
+	const dim_t ks = kb << levels;
+
+	// Apply beta up front so that each of the products below (and the
+	// fringe updates for the remaining rows and columns) may simply
+	// accumulate into C.
+	if ( !bli_obj_equals( beta, &BLIS_ONE ) )
+		bli_scalm( beta, &c_local );
+
+	strprod_t prods[ BLIS_STRASSEN_MAX_PRODS ];
+	obj_t     alpha_local;
+
+	bli_obj_scalar_init_detached_copy_of( dt, BLIS_NO_CONJUGATE,
+	                                      alpha, &alpha_local );
+
+	strparams_t params;
+
+	params.dt      = dt;
+	params.mb      = mb;
+	params.nb      = nb;
+	params.kb      = kb;
+	params.alpha   = bli_obj_buffer_for_1x1( dt, &alpha_local );
+	params.a       = bli_obj_buffer_at_off( &a_local );
+	params.rs_a    = bli_obj_row_stride( &a_local );
+	params.cs_a    = bli_obj_col_stride( &a_local );
+	params.b       = bli_obj_buffer_at_off( &b_local );
+	params.rs_b    = bli_obj_row_stride( &b_local );
+	params.cs_b    = bli_obj_col_stride( &b_local );
+	params.c       = bli_obj_buffer_at_off( &c_local );
+	params.rs_c    = bli_obj_row_stride( &c_local );
+	params.cs_c    = bli_obj_col_stride( &c_local );
+	params.prods   = prods;
+	params.n_prods = bli_gemm_strassen_plan( levels, prods );
+	params.cntx    = cntx;
+
+	// The packed B~ that the threads share.
+	const dim_t  NR      = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	const dim_t  PACKNR  = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx );
+	const dim_t  KC      = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx );
+	const dim_t  NC      = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx );
+	const size_t bp_size = ( ( bli_min( NC, nb ) + NR - 1 ) / NR ) * PACKNR *
+	                       bli_min( KC, kb ) * bli_dt_size( dt );
+	err_t        r_val;
+
+	params.bp = bli_fmalloc_align( BLIS_MALLOC_INTL, bp_size,
+	                               BLIS_POOL_ADDR_ALIGN_SIZE_B, &r_val );
+
+	bli_thread_launch( bli_gemm_strassen_num_threads( rntm ),
+	                   bli_gemm_strassen_thread_entry, &params );
+
+	bli_ffree_align( BLIS_FREE_INTL, params.bp );
+
+	// Handle the rows and columns that did not fit into the grids by
+	// updating the fringes of C with the conventional algorithm ("dynamic
+	// peeling").
+	rntm_t rntm_l = *rntm;
+	bli_rntm_set_strassen_levels( 0, &rntm_l );
+
+	obj_t a_x, b_x, c_x;
+
+	if ( ks < k )
+	{
+		// C(0:ms,0:ns) += alpha * A(0:ms,ks:k) B(ks:k,0:ns);
+		bli_acquire_mpart( 0,  ks, ms, k - ks, &a_local, &a_x );
+		bli_acquire_mpart( ks, 0,  k - ks, ns, &b_local, &b_x );
+		bli_acquire_mpart( 0,  0,  ms, ns,     &c_local, &c_x );
+		bli_gemm_ex( alpha, &a_x, &b_x, &BLIS_ONE, &c_x, cntx, &rntm_l );
+	}
+	if ( ns < n )
+	{
+		// C(:,ns:n) += alpha * A B(:,ns:n);
+		bli_acquire_mpart( 0, ns, k, n - ns, &b_local, &b_x );
+		bli_acquire_mpart( 0, ns, m, n - ns, &c_local, &c_x );
+		bli_gemm_ex( alpha, &a_local, &b_x, &BLIS_ONE, &c_x, cntx, &rntm_l );
+	}
+	if ( ms < m )
+	{
+		// C(ms:m,0:ns) += alpha * A(ms:m,:) B(:,0:ns);
+		bli_acquire_mpart( ms, 0, m - ms, k,  &a_local, &a_x );
+		bli_acquire_mpart( 0,  0, k,      ns, &b_local, &b_x );
+		bli_acquire_mpart( ms, 0, m - ms, ns, &c_local, &c_x );
+		bli_gemm_ex( alpha, &a_x, &b_x, &BLIS_ONE, &c_x, cntx, &rntm_l );
+	}
+}
+
@@ -0,0 +1,78 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_GEMM_STRASSEN_H
+#define BLIS_GEMM_STRASSEN_H
+
+// The minimum size of each of the m, n, and k dimensions of a subproblem
+// (that is, of each block of the grid that a level of Strassen partitions
+// the operands into) for which that level is applied.
+#ifndef BLIS_STRASSEN_MIN_DIM
+#define BLIS_STRASSEN_MIN_DIM 1024
+#endif
+
+// The maximum number of levels of Strassen that are applied; requests for
+// more levels are limited to this. Each of the 7^L products of L levels
+// sums up to 2^L blocks of A and of B while packing them, and adds its
+// result to up to 2^L blocks of C.
+#define BLIS_STRASSEN_MAX_LEVELS 2
+#define BLIS_STRASSEN_MAX_TERMS  4
+#define BLIS_STRASSEN_MAX_PRODS  49
+
+void  bli_gemm_strassen_init( void );
+
+BLIS_EXPORT_BLIS dim_t bli_gemm_strassen_get_levels( void );
+BLIS_EXPORT_BLIS void  bli_gemm_strassen_set_levels( dim_t levels );
+
+bool  bli_gemm_strassen_is_applicable
+     (
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  c,
+       rntm_t* rntm
+     );
+
+void  bli_gemm_strassen
+     (
+       obj_t*  alpha,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  beta,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     );
+
+#endif
+
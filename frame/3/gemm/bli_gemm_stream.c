@@ -0,0 +1,136 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#if defined(__SSE__)
+  #include <xmmintrin.h>
+#endif
+
+// The global rntm_t structure. (The definition resides in bli_rntm.c.)
+extern rntm_t global_rntm;
+
+// A mutex to allow synchronous access to global_rntm. (The definition
+// resides in bli_rntm.c.)
+extern bli_pthread_mutex_t global_rntm_mutex;
+
+// -----------------------------------------------------------------------------
+
+void bli_gemm_stream_init( void )
+{
+	// NOTE: We don't need to acquire the global_rntm_mutex here because this
+	// function is only called by bli_init_once().
+
+	// Read BLIS_STREAM_C, defaulting to zero (ie: regular stores to C) if it
+	// is unset.
+	gint_t stream_c = bli_env_get_var( "BLIS_STREAM_C", 0 );
+
+	bli_rntm_set_stream_c( ( bool )( stream_c != 0 ), &global_rntm );
+}
+
+bool bli_gemm_stream_get_c( void )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	return bli_rntm_stream_c( &global_rntm );
+}
+
+void bli_gemm_stream_set_c( bool stream_c )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	// Acquire the mutex protecting global_rntm.
+	bli_pthread_mutex_lock( &global_rntm_mutex );
+
+	bli_rntm_set_stream_c( stream_c, &global_rntm );
+
+	// Release the mutex protecting global_rntm.
+	bli_pthread_mutex_unlock( &global_rntm_mutex );
+}
+
+// -----------------------------------------------------------------------------
+
+bool bli_gemm_stream_is_applicable
+     (
+       obj_t*  beta,
+       obj_t*  c,
+       rntm_t* rntm
+     )
+{
+	// A NULL rntm_t defers to the global setting.
+	if ( rntm == NULL ) rntm = &global_rntm;
+
+	if ( !bli_rntm_stream_c( rntm ) ) return FALSE;
+
+	// Streaming stores bypass the cache and avoid reading C, so they only
+	// pay off when C is overwritten rather than updated...
+	if ( !bli_obj_equals( beta, &BLIS_ZERO ) ) return FALSE;
+
+	// ...and when C is too large to still be in cache when it is next read.
+	// We take the largest cache level that can be detected as the last-level
+	// cache.
+	cacheinfo_t info;
+	dim_t       llc_size = BLIS_GEMM_STREAM_MIN_SIZE;
+
+	for ( dim_t level = BLIS_CACHE_NUM_LEVELS; level >= 1; --level )
+	{
+		if ( bli_cache_query( level, &info ) ) { llc_size = info.size; break; }
+	}
+
+	const dim_t c_size = bli_obj_length( c ) * bli_obj_width( c ) *
+	                     bli_obj_elem_size( c );
+
+	return ( c_size >= llc_size );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_gemm_stream_fence( void )
+{
+	// Non-temporal stores are weakly ordered with respect to other stores,
+	// including a plain store that a caller might use to publish C to another
+	// thread. A thread barrier would order them (its locked instructions
+	// drain the write-combining buffers), but with one thread the barrier
+	// returns early and gemm can return with the stores still pending. So
+	// each thread that streamed part of C issues a store fence once it is
+	// done.
+#if defined(__SSE__)
+	_mm_sfence();
+#else
+	__atomic_thread_fence( __ATOMIC_SEQ_CST );
+#endif
+}
@@ -99,9 +99,11 @@ void bli_gemmt_front
 	(
 	  BLIS_GEMM,
 	  BLIS_LEFT, // ignored for gemm/hemm/symm/gemmt
+	  bli_obj_exec_dt( &c_local ),
 	  bli_obj_length( &c_local ),
 	  bli_obj_width( &c_local ),
 	  bli_obj_width( &a_local ),
+	  cntx,
 	  rntm
 	);
 
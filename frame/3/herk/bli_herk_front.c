@@ -93,9 +93,11 @@ void bli_herk_front
 	(
 	  BLIS_HERK,
 	  BLIS_LEFT, // ignored for her[2]k/syr[2]k
+	  bli_obj_exec_dt( &c_local ),
 	  bli_obj_length( &c_local ),
 	  bli_obj_width( &c_local ),
 	  bli_obj_width( &a_local ),
+	  cntx,
 	  rntm
 	);
 
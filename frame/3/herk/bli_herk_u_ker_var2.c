@@ -175,6 +175,8 @@ void PASTEMAC(ch,varname) \
 	   function pointer type. */ \
 	PASTECH(ch,gemm_ukr_ft) \
 	                gemm_ukr   = bli_cntx_get_l3_vir_ukr_dt( dt, BLIS_GEMM_UKR, cntx ); \
+	PASTECH(ch,gemmt_ukr_ft) \
+	                gemmt_ukr  = bli_cntx_get_l3_vir_ukr_dt( dt, BLIS_GEMMT_U_UKR, cntx ); \
 \
 	/* Temporary C buffer for edge cases. Note that the strides of this
 	   temporary buffer are set so that they match the storage of the
@@ -377,33 +379,29 @@ void PASTEMAC(ch,varname) \
 			bli_auxinfo_set_next_b( b2, &aux ); \
 \
 			/* If the diagonal intersects the current MR x NR submatrix, we
-			   compute it the temporary buffer and then add in the elements
-			   on or below the diagonal.
+			   invoke the gemmt micro-kernel, which updates only the elements
+			   on or above the diagonal of the m_cur x n_cur submatrix of C.
 			   Otherwise, if the submatrix is strictly above the diagonal,
 			   we compute and store as we normally would.
 			   And if we're strictly below the diagonal, we do nothing and
 			   continue. */ \
 			if ( bli_intersects_diag_n( diagoffc_ij, m_cur, n_cur ) ) \
 			{ \
-				/* Invoke the gemm micro-kernel. */ \
-				gemm_ukr \
+				/* Invoke the gemmt micro-kernel. */ \
+				gemmt_ukr \
 				( \
+				  diagoffc_ij, \
+				  m_cur, \
+				  n_cur, \
 				  k, \
 				  alpha_cast, \
 				  a1, \
 				  b1, \
-				  zero, \
-				  ct, rs_ct, cs_ct, \
+				  beta_cast, \
+				  c11, rs_c, cs_c, \
 				  &aux, \
 				  cntx  \
 				); \
-\
-				/* Scale C and add the result to only the stored part. */ \
-				PASTEMAC(ch,xpbys_mxn_u)( diagoffc_ij, \
-				                          m_cur, n_cur, \
-				                          ct,  rs_ct, cs_ct, \
-				                          beta_cast, \
-				                          c11, rs_c,  cs_c ); \
 			} \
 			else if ( bli_is_strictly_above_diag_n( diagoffc_ij, m_cur, n_cur ) ) \
 			{ \
@@ -0,0 +1,402 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#define FUNCPTR_T spmm_fp
+
+typedef void (*FUNCPTR_T)
+     (
+       dim_t      m,
+       dim_t      n,
+       dim_t      k,
+       void*      alpha,
+       void*      a_val, inc_t* a_ptr, dim_t* a_ind,
+       void*      b, inc_t rs_b, inc_t cs_b,
+       void*      beta,
+       void*      c, inc_t rs_c, inc_t cs_c,
+       cntx_t*    cntx,
+       rntm_t*    rntm,
+       thrinfo_t* thread
+     );
+
+static FUNCPTR_T GENARRAY(ftypes_csr,spmm_csr_var1);
+static FUNCPTR_T GENARRAY(ftypes_csc,spmm_csc_var1);
+
+
+#undef  GENFRONT
+#define GENFRONT( opname, ftypes ) \
+\
+err_t PASTEMAC0(opname) \
+     ( \
+       obj_t*     alpha, \
+       obj_t*     a, \
+       obj_t*     b, \
+       obj_t*     beta, \
+       obj_t*     c, \
+       cntx_t*    cntx, \
+       rntm_t*    rntm, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t    dt        = bli_obj_dt( c ); \
+\
+	const dim_t    m         = bli_obj_length( c ); \
+	const dim_t    n         = bli_obj_width( c ); \
+	const dim_t    k         = bli_obj_width( a ); \
+\
+	spmat_t*       spa       = bli_obj_buffer( a ); \
+\
+	void* restrict buf_b     = bli_obj_buffer_at_off( b ); \
+	const inc_t    rs_b      = bli_obj_row_stride( b ); \
+	const inc_t    cs_b      = bli_obj_col_stride( b ); \
+\
+	void* restrict buf_c     = bli_obj_buffer_at_off( c ); \
+	const inc_t    rs_c      = bli_obj_row_stride( c ); \
+	const inc_t    cs_c      = bli_obj_col_stride( c ); \
+\
+	void* restrict buf_alpha = bli_obj_buffer_for_1x1( dt, alpha ); \
+	void* restrict buf_beta  = bli_obj_buffer_for_1x1( dt, beta ); \
+\
+	FUNCPTR_T      f         = ftypes[dt]; \
+\
+	f \
+	( \
+	  m, n, k, \
+	  buf_alpha, \
+	  spa->val, spa->ptr, spa->ind, \
+	  buf_b, rs_b, cs_b, \
+	  buf_beta, \
+	  buf_c, rs_c, cs_c, \
+	  cntx, \
+	  rntm, \
+	  thread  \
+	); \
+\
+	return BLIS_SUCCESS; \
+}
+
+GENFRONT( spmm_csr_int, ftypes_csr )
+GENFRONT( spmm_csc_int, ftypes_csc )
+
+
+// Find the range of rows [start,end) assigned to the current thread such
+// that each thread receives roughly the same amount of work, where the
+// cost of a row is taken to be its number of nonzeros plus one (for the
+// output update).
+
+static void bli_spmm_range_nnz
+     (
+       thrinfo_t* thread,
+       dim_t      m,
+       inc_t*     ptr,
+       dim_t*     start,
+       dim_t*     end
+     )
+{
+	const dim_t nt    = bli_thread_n_way( thread );
+	const dim_t tid   = bli_thread_work_id( thread );
+
+	const inc_t total = ( ptr[ m ] - ptr[ 0 ] ) + m;
+
+	dim_t       bound[ 2 ];
+
+	for ( dim_t t = 0; t < 2; ++t )
+	{
+		const dim_t part = tid + t;
+
+		if      ( part == 0  ) { bound[ t ] = 0; continue; }
+		else if ( part == nt ) { bound[ t ] = m; continue; }
+
+		const inc_t target = ( total * part ) / nt;
+
+		// Binary search for the first row whose cumulative cost reaches
+		// the target.
+		dim_t lo = 0, hi = m;
+		while ( lo < hi )
+		{
+			const dim_t mid = lo + ( hi - lo ) / 2;
+
+			if ( ( ptr[ mid ] - ptr[ 0 ] ) + mid < target ) lo = mid + 1;
+			else                                            hi = mid;
+		}
+		bound[ t ] = lo;
+	}
+
+	*start = bound[ 0 ];
+	*end   = bound[ 1 ];
+}
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       dim_t      m, \
+       dim_t      n, \
+       dim_t      k, \
+       void*      alpha, \
+       void*      a_val, inc_t* a_ptr, dim_t* a_ind, \
+       void*      b, inc_t rs_b, inc_t cs_b, \
+       void*      beta, \
+       void*      c, inc_t rs_c, inc_t cs_c, \
+       cntx_t*    cntx, \
+       rntm_t*    rntm, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t     dt         = PASTEMAC(ch,type); \
+\
+	const dim_t     NR         = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ); \
+	const dim_t     NC         = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx ); \
+\
+	/* Query the sparse-times-dense microkernel from the context. */ \
+	PASTECH2(ch,spmm_csr,_ukr_ft) \
+	                spmm_ukr   = bli_cntx_get_l3_nat_ukr_dt( dt, BLIS_SPMM_CSR_UKR, cntx ); \
+\
+	ctype* restrict one        = PASTEMAC(ch,1); \
+	ctype* restrict alpha_cast = alpha; \
+	ctype* restrict beta_cast  = beta; \
+	ctype* restrict val_cast   = a_val; \
+	ctype* restrict b_cast     = b; \
+	ctype* restrict c_cast     = c; \
+\
+	mem_t           mem_b      = BLIS_MEM_INITIALIZER; \
+\
+	ctype*          bp; \
+	inc_t           rs_bp, cs_bp, ps_bp; \
+\
+	auxinfo_t       aux; \
+\
+	dim_t           ic_start, ic_end; \
+\
+	/* Partition the rows of C (and A) so that each thread receives about
+	   the same number of nonzeros. */ \
+	bli_spmm_range_nnz( thread, m, a_ptr, &ic_start, &ic_end ); \
+\
+	for ( dim_t jj = 0; jj < n; jj += NC ) \
+	{ \
+		const dim_t     nc_cur = bli_min( NC, n - jj ); \
+\
+		ctype* restrict b_jc   = b_cast + jj*cs_b; \
+		ctype* restrict c_jc   = c_cast + jj*cs_c; \
+\
+		/* Pack the k x nc_cur block of B into row-stored micropanels of
+		   width NR. All threads participate and meet at a barrier before
+		   returning. */ \
+		PASTEMAC(ch,packm_sup_b) \
+		( \
+		  TRUE, \
+		  BLIS_BUFFER_FOR_B_PANEL, \
+		  BLIS_RRR, \
+		  BLIS_NO_TRANSPOSE, \
+		  k, NC, \
+		  k, nc_cur, NR, \
+		  one, \
+		  b_jc, rs_b,  cs_b, \
+		  &bp,  &rs_bp, &cs_bp, \
+		              &ps_bp, \
+		  cntx, \
+		  rntm, \
+		  &mem_b, \
+		  thread  \
+		); \
+\
+		/* Stream this thread's sparse rows against one packed micropanel
+		   at a time so that the micropanel stays in cache while the rows
+		   gather from it. */ \
+		for ( dim_t jr = 0; jr < nc_cur; jr += NR ) \
+		{ \
+			const dim_t     nr_cur = bli_min( NR, nc_cur - jr ); \
+\
+			ctype* restrict bp_j   = bp + ( jr / NR ) * ps_bp; \
+			ctype* restrict c_ij   = c_jc + ic_start*rs_c + jr*cs_c; \
+\
+			bli_auxinfo_set_next_a( val_cast, &aux ); \
+			bli_auxinfo_set_next_b( bp_j, &aux ); \
+\
+			spmm_ukr \
+			( \
+			  ic_end - ic_start, \
+			  nr_cur, \
+			  alpha_cast, \
+			  val_cast, a_ptr + ic_start, a_ind, \
+			  bp_j, rs_bp, \
+			  beta_cast, \
+			  c_ij, rs_c, cs_c, \
+			  &aux, \
+			  cntx  \
+			); \
+		} \
+	} \
+\
+	/* Make sure every thread is done with the packed buffer before the
+	   chief thread releases it. */ \
+	bli_thread_barrier( thread ); \
+\
+	PASTEMAC(ch,packm_sup_finalize_mem_b) \
+	( \
+	  TRUE, \
+	  rntm, \
+	  &mem_b, \
+	  thread  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( spmm_csr_var1 )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       dim_t      m, \
+       dim_t      n, \
+       dim_t      k, \
+       void*      alpha, \
+       void*      a_val, inc_t* a_ptr, dim_t* a_ind, \
+       void*      b, inc_t rs_b, inc_t cs_b, \
+       void*      beta, \
+       void*      c, inc_t rs_c, inc_t cs_c, \
+       cntx_t*    cntx, \
+       rntm_t*    rntm, \
+       thrinfo_t* thread  \
+     ) \
+{ \
+	const num_t     dt         = PASTEMAC(ch,type); \
+\
+	const dim_t     NR         = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ); \
+	const dim_t     NC         = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx ); \
+\
+	ctype* restrict one        = PASTEMAC(ch,1); \
+	ctype* restrict alpha_cast = alpha; \
+	ctype* restrict val_cast   = a_val; \
+	ctype* restrict b_cast     = b; \
+	ctype* restrict c_cast     = c; \
+\
+	mem_t           mem_b      = BLIS_MEM_INITIALIZER; \
+\
+	ctype*          bp; \
+	inc_t           rs_bp, cs_bp, ps_bp; \
+\
+	for ( dim_t jj = 0; jj < n; jj += NC ) \
+	{ \
+		const dim_t     nc_cur = bli_min( NC, n - jj ); \
+\
+		ctype* restrict b_jc   = b_cast + jj*cs_b; \
+		ctype* restrict c_jc   = c_cast + jj*cs_c; \
+\
+		dim_t           jr_start, jr_end; \
+\
+		/* Pack the k x nc_cur block of B into row-stored micropanels of
+		   width NR. */ \
+		PASTEMAC(ch,packm_sup_b) \
+		( \
+		  TRUE, \
+		  BLIS_BUFFER_FOR_B_PANEL, \
+		  BLIS_RRR, \
+		  BLIS_NO_TRANSPOSE, \
+		  k, NC, \
+		  k, nc_cur, NR, \
+		  one, \
+		  b_jc, rs_b,  cs_b, \
+		  &bp,  &rs_bp, &cs_bp, \
+		              &ps_bp, \
+		  cntx, \
+		  rntm, \
+		  &mem_b, \
+		  thread  \
+		); \
+\
+		/* A stored by columns scatters into arbitrary rows of C, so the
+		   threads instead own disjoint sets of NR-wide column panels. */ \
+		bli_thread_range_sub( thread, nc_cur, NR, FALSE, &jr_start, &jr_end ); \
+\
+		for ( dim_t jr = jr_start; jr < jr_end; jr += NR ) \
+		{ \
+			const dim_t     nr_cur = bli_min( NR, jr_end - jr ); \
+\
+			ctype* restrict bp_j   = bp + ( jr / NR ) * ps_bp; \
+			ctype* restrict c_j    = c_jc + jr*cs_c; \
+\
+			/* Scale the current column panel of C by beta. */ \
+			PASTEMAC2(ch,scalm,BLIS_TAPI_EX_SUF) \
+			( \
+			  BLIS_NO_CONJUGATE, \
+			  0, \
+			  BLIS_NONUNIT_DIAG, \
+			  BLIS_DENSE, \
+			  m, nr_cur, \
+			  beta, \
+			  c_j, rs_c, cs_c, \
+			  cntx, \
+			  rntm  \
+			); \
+\
+			/* Accumulate alpha * a(:,l) * b(l,:) for each column of A. */ \
+			for ( dim_t l = 0; l < k; ++l ) \
+			{ \
+				ctype* restrict bl = bp_j + l*NR; \
+\
+				for ( inc_t p = a_ptr[ l ]; p < a_ptr[ l + 1 ]; ++p ) \
+				{ \
+					ctype* restrict c_i = c_j + a_ind[ p ]*rs_c; \
+					ctype           ap; \
+\
+					PASTEMAC(ch,scal2s)( *alpha_cast, val_cast[ p ], ap ); \
+\
+					for ( dim_t j = 0; j < nr_cur; ++j ) \
+						PASTEMAC(ch,axpys)( ap, bl[ j ], c_i[ j*cs_c ] ); \
+				} \
+			} \
+		} \
+	} \
+\
+	/* Make sure every thread is done with the packed buffer before the
+	   chief thread releases it. */ \
+	bli_thread_barrier( thread ); \
+\
+	PASTEMAC(ch,packm_sup_finalize_mem_b) \
+	( \
+	  TRUE, \
+	  rntm, \
+	  &mem_b, \
+	  thread  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( spmm_csc_var1 )
+
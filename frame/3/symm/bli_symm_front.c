@@ -69,6 +69,10 @@ void bli_symm_front
 	bli_obj_alias_to( b, &b_local );
 	bli_obj_alias_to( c, &c_local );
 
+	// Leave the request for streaming stores to C in the runtime object only
+	// if they are expected to help.
+	bli_rntm_set_stream_c( bli_gemm_stream_is_applicable( beta, c, rntm ), rntm );
+
 #ifdef BLIS_DISABLE_SYMM_RIGHT
 	// NOTE: This case casts right-side symm in terms of left side. This is
 	// necessary when the current subconfiguration uses a gemm microkernel
@@ -143,9 +147,11 @@ void bli_symm_front
 	(
 	  BLIS_SYMM,
 	  BLIS_LEFT, // ignored for gemm/hemm/symm
+	  bli_obj_exec_dt( &c_local ),
 	  bli_obj_length( &c_local ),
 	  bli_obj_width( &c_local ),
 	  bli_obj_width( &a_local ),
+	  cntx,
 	  rntm
 	);
 
@@ -94,9 +94,11 @@ void bli_syr2k_front
 	(
 	  BLIS_SYR2K,
 	  BLIS_LEFT, // ignored for her[2]k/syr[2]k
+	  bli_obj_exec_dt( &c_local ),
 	  bli_obj_length( &c_local ),
 	  bli_obj_width( &c_local ),
 	  bli_obj_width( &a_local ),
+	  cntx,
 	  rntm
 	);
 
@@ -162,9 +162,11 @@ void bli_trmm_front
 	(
 	  BLIS_TRMM,
 	  side,
+	  bli_obj_exec_dt( &c_local ),
 	  bli_obj_length( &c_local ),
 	  bli_obj_width( &c_local ),
 	  bli_obj_width( &a_local ),
+	  cntx,
 	  rntm
 	);
 
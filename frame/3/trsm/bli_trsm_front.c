@@ -136,9 +136,11 @@ void bli_trsm_front
 	(
 	  BLIS_TRSM,
 	  side,
+	  bli_obj_exec_dt( &c_local ),
 	  bli_obj_length( &c_local ),
 	  bli_obj_width( &c_local ),
 	  bli_obj_width( &a_local ),
+	  cntx,
 	  rntm
 	);
 
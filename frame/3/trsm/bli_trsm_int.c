@@ -127,6 +127,9 @@ void bli_trsm_int
 	// Extract the function pointer from the current control tree node.
 	f = bli_cntl_var_func( cntl );
 
+	BLIS_PROF_START( t_prof );
+	BLIS_TRACE_START( t_trace );
+
 	// Invoke the variant.
 	f
 	(
@@ -138,5 +141,18 @@ void bli_trsm_int
 	  cntl,
 	  thread
 	);
+
+	// Only the time spent in the macrokernel node (whose sub-node is the
+	// leaf of the tree) is attributed to the kernel phase; the time spent
+	// in the nodes above it is dominated by packing, which is recorded
+	// separately by bli_l3_packm().
+	if ( bli_cntl_is_leaf( bli_cntl_sub_node( cntl ) ) )
+		BLIS_PROF_STOP( BLIS_PROF_KER, t_prof );
+
+	// Record the range of C (and the k dimension) covered by this node.
+	BLIS_TRACE_STOP( bli_trace_l3_node_id( cntl ), t_trace,
+	                 bli_obj_length( &c_local ), bli_obj_width( &c_local ),
+	                 bli_obj_width( &a_local ),
+	                 bli_obj_row_off( &c_local ), bli_obj_col_off( &c_local ) );
 }
 
@@ -0,0 +1,292 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386) || defined(_M_IX86)
+#include "cpuid.h"
+#endif
+
+// The detected geometry of the L1, L2, and L3 data caches, indexed by
+// level - 1. Levels that could not be detected have a size of zero.
+static cacheinfo_t cache_info[ BLIS_CACHE_NUM_LEVELS ];
+
+static bli_pthread_once_t cache_once = BLIS_PTHREAD_ONCE_INIT;
+
+// -----------------------------------------------------------------------------
+
+static void bli_cache_set_level
+     (
+       dim_t level,
+       dim_t size,
+       dim_t ways,
+       dim_t sets,
+       dim_t line
+     )
+{
+	if ( level < 1 || BLIS_CACHE_NUM_LEVELS < level ) return;
+	if ( ways <= 0 || line <= 0 ) return;
+
+	// Derive whichever of the size and number of sets was not provided.
+	if ( sets <= 0 ) sets = size / ( ways * line );
+	if ( size <= 0 ) size = sets * ways * line;
+
+	if ( sets <= 0 ) return;
+
+	cacheinfo_t* info = &cache_info[ level - 1 ];
+
+	info->size = size;
+	info->ways = ways;
+	info->sets = sets;
+	info->line = line;
+}
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386) || defined(_M_IX86)
+
+// Enumerate the cache parameters reported by the given deterministic cache
+// parameters leaf: 4 on Intel, or 0x8000001D on AMD processors that support
+// topology extensions. Return the number of data or unified caches found.
+static dim_t bli_cache_query_cpuid_leaf( uint32_t leaf )
+{
+	uint32_t eax, ebx, ecx, edx;
+	dim_t    n_found = 0;
+
+	if ( __get_cpuid_max( leaf & 0x80000000u, 0 ) < leaf ) return 0;
+
+	for ( uint32_t i = 0; i < 16; ++i )
+	{
+		__cpuid_count( leaf, i, eax, ebx, ecx, edx );
+
+		// Cache type: 0 = no more caches, 1 = data, 2 = instruction,
+		// 3 = unified.
+		const uint32_t type = eax & 0x1f;
+
+		if ( type == 0 ) break;
+		if ( type == 2 ) continue;
+
+		const dim_t level = ( eax >> 5 ) & 0x7;
+		const dim_t ways  = ( ( ebx >> 22 ) & 0x3ff ) + 1;
+		const dim_t parts = ( ( ebx >> 12 ) & 0x3ff ) + 1;
+		const dim_t line  = (   ebx         & 0xfff ) + 1;
+		const dim_t sets  = ( dim_t )ecx + 1;
+
+		bli_cache_set_level( level, 0, ways, sets, parts * line );
+
+		n_found += 1;
+	}
+
+	return n_found;
+}
+
+#endif
+
+#if defined(__linux__)
+
+static dim_t bli_cache_read_sysfs( const char* dir, const char* name, char* buf, size_t len )
+{
+	char  path[ 256 ];
+	FILE* file;
+
+	snprintf( path, sizeof( path ), "%s/%s", dir, name );
+
+	if ( ( file = fopen( path, "r" ) ) == NULL ) return -1;
+
+	char* r_val = fgets( buf, ( int )len, file );
+
+	fclose( file );
+
+	if ( r_val == NULL ) return -1;
+
+	// Parse a number with an optional K/M/G suffix (as used by "size").
+	char* end;
+	dim_t val = ( dim_t )strtol( buf, &end, 10 );
+
+	if      ( *end == 'K' ) val *= 1024;
+	else if ( *end == 'M' ) val *= 1024 * 1024;
+	else if ( *end == 'G' ) val *= 1024 * 1024 * 1024;
+
+	return val;
+}
+
+// Read the cache parameters that Linux exposes for cpu0 under sysfs.
+// Return the number of data or unified caches found.
+static dim_t bli_cache_query_sysfs( void )
+{
+	char  dir[ 128 ];
+	char  buf[ 64 ];
+	dim_t n_found = 0;
+
+	for ( dim_t i = 0; i < 16; ++i )
+	{
+		snprintf( dir, sizeof( dir ),
+		          "/sys/devices/system/cpu/cpu0/cache/index%d", ( int )i );
+
+		const dim_t level = bli_cache_read_sysfs( dir, "level", buf, sizeof( buf ) );
+
+		if ( level < 0 ) break;
+
+		// Skip instruction caches; the type is read into buf above.
+		bli_cache_read_sysfs( dir, "type", buf, sizeof( buf ) );
+		if ( strncmp( buf, "Instruction", 11 ) == 0 ) continue;
+
+		const dim_t size = bli_cache_read_sysfs( dir, "size",                  buf, sizeof( buf ) );
+		const dim_t ways = bli_cache_read_sysfs( dir, "ways_of_associativity", buf, sizeof( buf ) );
+		const dim_t line = bli_cache_read_sysfs( dir, "coherency_line_size",   buf, sizeof( buf ) );
+		const dim_t sets = bli_cache_read_sysfs( dir, "number_of_sets",        buf, sizeof( buf ) );
+
+		bli_cache_set_level( level, size, ways, sets, line );
+
+		n_found += 1;
+	}
+
+	return n_found;
+}
+
+#endif
+
+static void bli_cache_detect( void )
+{
+	dim_t n_found = 0;
+
+	memset( cache_info, 0, sizeof( cache_info ) );
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386) || defined(_M_IX86)
+	n_found = bli_cache_query_cpuid_leaf( 4 );
+
+	if ( n_found == 0 )
+		n_found = bli_cache_query_cpuid_leaf( 0x8000001Du );
+#endif
+
+#if defined(__linux__)
+	if ( n_found == 0 )
+		n_found = bli_cache_query_sysfs();
+#endif
+
+	( void )n_found;
+}
+
+bool bli_cache_query( dim_t level, cacheinfo_t* info )
+{
+	bli_pthread_once( &cache_once, bli_cache_detect );
+
+	if ( level < 1 || BLIS_CACHE_NUM_LEVELS < level ) return FALSE;
+
+	*info = cache_info[ level - 1 ];
+
+	return ( info->size > 0 );
+}
+
+// -----------------------------------------------------------------------------
+
+// Clamp a derived blocksize to within a factor of BLIS_CACHE_BLKSZ_RANGE of
+// the value set by the sub-configuration.
+static dim_t bli_cache_clamp( dim_t val, dim_t def )
+{
+	return bli_min( bli_max( val, def / BLIS_CACHE_BLKSZ_RANGE ),
+	                def * BLIS_CACHE_BLKSZ_RANGE );
+}
+
+void bli_cntx_set_blkszs_from_cache( cntx_t* cntx )
+{
+	cacheinfo_t l1, l2, l3;
+
+	// The model below follows Low et al., "Analytical Modeling Is Enough for
+	// High-Performance BLIS" (ACM TOMS, 2016). The micropanel of B is kept
+	// in the L1 cache, the block of A in the L2 cache, and the panel of B in
+	// the L3 cache, each occupying a whole number of ways so that the other
+	// operands streaming through the same cache do not evict it.
+
+	if ( !bli_cache_query( 1, &l1 ) || !bli_cache_query( 2, &l2 ) ) return;
+
+	const bool has_l3 = bli_cache_query( 3, &l3 );
+
+	for ( num_t dt = BLIS_DT_LO; dt <= BLIS_DT_HI; ++dt )
+	{
+		const dim_t s  = bli_dt_size( dt );
+		const dim_t mr = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+		const dim_t nr = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+
+		if ( mr <= 0 || nr <= 0 ) continue;
+
+		// KC: of the L1 ways (less one), the kc x mr micropanel of A gets a
+		// share C_A proportional to mr / ( mr + nr ), and the resident kc x nr
+		// micropanel of B gets the rest. kc is chosen so that the micropanel
+		// of A fills exactly its C_A ways; this is why mr, not nr, appears in
+		// the divisor.
+		const dim_t ca_l1 = ( ( l1.ways - 1 ) * mr ) / ( mr + nr );
+		      dim_t kc    = ( ca_l1 * l1.sets * l1.line ) / ( mr * s );
+
+		if ( kc <= 0 ) continue;
+
+		kc = bli_cache_clamp( kc, bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx ) );
+		bli_cntx_profile_set( "kc", dt, kc, cntx );
+		kc = bli_cntx_get_blksz_def_dt( dt, BLIS_KC, cntx );
+
+		// MC: the ways of L2 not needed by a micropanel of B (plus one for
+		// streaming C) hold an mc x kc block of A.
+		const dim_t cb_l2 = ( nr * kc * s + l2.sets * l2.line - 1 ) / ( l2.sets * l2.line );
+		const dim_t ca_l2 = l2.ways - 1 - cb_l2;
+		      dim_t mc    = ( ca_l2 * l2.sets * l2.line ) / ( kc * s );
+
+		if ( mc > 0 )
+		{
+			mc = bli_cache_clamp( mc, bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx ) );
+			bli_cntx_profile_set( "mc", dt, mc, cntx );
+		}
+		mc = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx );
+
+		if ( !has_l3 ) continue;
+
+		// NC: the ways of L3 not needed by a block of A (plus one for
+		// streaming C) hold a kc x nc panel of B.
+		const dim_t ca_l3 = ( mc * kc * s + l3.sets * l3.line - 1 ) / ( l3.sets * l3.line );
+		const dim_t cb_l3 = l3.ways - 1 - ca_l3;
+		      dim_t nc    = ( cb_l3 * l3.sets * l3.line ) / ( kc * s );
+
+		if ( nc > 0 )
+		{
+			nc = bli_cache_clamp( nc, bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx ) );
+			bli_cntx_profile_set( "nc", dt, nc, cntx );
+		}
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_cache_blkszs_apply_env( cntx_t* cntx )
+{
+	if ( bli_env_get_var( BLIS_CACHE_BLKSZ_ENV, 0 ) != 0 )
+		bli_cntx_set_blkszs_from_cache( cntx );
+}
+
@@ -0,0 +1,67 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_CACHE_H
+#define BLIS_CACHE_H
+
+// Geometry of one level of the data (or unified) cache hierarchy, as
+// detected on the running machine.
+
+typedef struct
+{
+	dim_t size;  // total size in bytes
+	dim_t ways;  // associativity
+	dim_t sets;  // number of sets
+	dim_t line;  // line size in bytes
+} cacheinfo_t;
+
+#define BLIS_CACHE_NUM_LEVELS 3
+
+// The environment variable that, when set to a nonzero value, causes the
+// cache blocksizes of each native context to be derived from the detected
+// cache geometry as the context is registered with the gks.
+#define BLIS_CACHE_BLKSZ_ENV "BLIS_BLKSZ_FROM_CACHE"
+
+// The factor by which derived cache blocksizes may differ from those set
+// by the sub-configuration.
+#define BLIS_CACHE_BLKSZ_RANGE 4
+
+BLIS_EXPORT_BLIS bool bli_cache_query( dim_t level, cacheinfo_t* info );
+
+BLIS_EXPORT_BLIS void bli_cntx_set_blkszs_from_cache( cntx_t* cntx );
+
+void bli_cache_blkszs_apply_env( cntx_t* cntx );
+
+#endif
+
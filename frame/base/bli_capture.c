@@ -0,0 +1,229 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The capture file (if capture is enabled) and the mutex that serializes
+// writes to it.
+static bool                capture_enabled = FALSE;
+static FILE*               capture_file    = NULL;
+static bli_pthread_mutex_t capture_mutex   = BLIS_PTHREAD_MUTEX_INITIALIZER;
+
+static const char* capture_op_strings[ BLIS_NUM_CAPTURE_OPS ] =
+{
+	"gemm",
+	"gemmt",
+	"hemm",
+	"herk",
+	"her2k",
+	"symm",
+	"syrk",
+	"syr2k",
+	"trmm3",
+	"trmm",
+	"trsm",
+	"gemv",
+	"ger",
+	"hemv",
+	"symv",
+	"trmv",
+	"trsv",
+};
+
+// -----------------------------------------------------------------------------
+
+void bli_capture_init( void )
+{
+	const char* filename = getenv( "BLIS_CAPTURE_FILE" );
+
+	if ( filename == NULL || *filename == '\0' ) return;
+
+	// Open the file for appending so that a finalize/re-initialize cycle
+	// does not discard the records captured so far.
+	capture_file = fopen( filename, "ab" );
+
+	if ( capture_file == NULL ) return;
+
+	// Write the header only if the file is empty.
+	fseek( capture_file, 0, SEEK_END );
+
+	if ( ftell( capture_file ) == 0 )
+	{
+		capture_hdr_t hdr;
+
+		memset( &hdr, 0, sizeof( capture_hdr_t ) );
+		strncpy( hdr.magic, BLIS_CAPTURE_MAGIC, sizeof( hdr.magic ) );
+		hdr.version  = BLIS_CAPTURE_VERSION;
+		hdr.rec_size = sizeof( capture_rec_t );
+
+		fwrite( &hdr, sizeof( capture_hdr_t ), 1, capture_file );
+	}
+
+	capture_enabled = TRUE;
+}
+
+void bli_capture_finalize( void )
+{
+	if ( !capture_enabled ) return;
+
+	bli_pthread_mutex_lock( &capture_mutex );
+
+	fclose( capture_file );
+
+	capture_file    = NULL;
+	capture_enabled = FALSE;
+
+	bli_pthread_mutex_unlock( &capture_mutex );
+}
+
+bool bli_capture_is_enabled( void )
+{
+	return capture_enabled;
+}
+
+const char* bli_capture_op_string( capop_t op )
+{
+	return capture_op_strings[ op ];
+}
+
+// -----------------------------------------------------------------------------
+
+static void bli_capture_write( capture_rec_t* rec, rntm_t* rntm )
+{
+	rntm_t rntm_l;
+
+	// Record the threading settings that will be used by the call. If the
+	// caller did not pass a rntm_t, the global settings apply.
+	if ( rntm == NULL ) { bli_rntm_init_from_global( &rntm_l ); rntm = &rntm_l; }
+
+	rec->n_threads = bli_rntm_num_threads( rntm );
+	rec->ways[ 0 ] = bli_rntm_jc_ways( rntm );
+	rec->ways[ 1 ] = bli_rntm_pc_ways( rntm );
+	rec->ways[ 2 ] = bli_rntm_ic_ways( rntm );
+	rec->ways[ 3 ] = bli_rntm_jr_ways( rntm );
+	rec->ways[ 4 ] = bli_rntm_ir_ways( rntm );
+	rec->reserved  = 0;
+
+	bli_pthread_mutex_lock( &capture_mutex );
+
+	if ( capture_file != NULL )
+		fwrite( rec, sizeof( capture_rec_t ), 1, capture_file );
+
+	bli_pthread_mutex_unlock( &capture_mutex );
+}
+
+void bli_capture_l3
+     (
+       opid_t  op,
+       side_t  side,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  c,
+       rntm_t* rntm
+     )
+{
+	if ( !capture_enabled ) return;
+
+	capture_rec_t rec;
+
+	// The uplo of interest belongs to C for operations that update only
+	// one triangle of C, and to A otherwise.
+	bool uplo_of_c = ( op == BLIS_GEMMT || op == BLIS_HERK  ||
+	                   op == BLIS_SYRK  || op == BLIS_HER2K ||
+	                   op == BLIS_SYR2K );
+
+	rec.op      = op;
+	rec.dt      = bli_obj_dt( c );
+	rec.trans_a = bli_obj_conjtrans_status( a );
+	rec.trans_b = ( b != NULL ? bli_obj_conjtrans_status( b )
+	                          : BLIS_NO_TRANSPOSE );
+	rec.side    = side;
+	rec.uplo    = ( uplo_of_c ? bli_obj_uplo( c ) : bli_obj_uplo( a ) );
+	rec.diag    = bli_obj_diag( a );
+
+	rec.m       = bli_obj_length( c );
+	rec.n       = bli_obj_width( c );
+	rec.k       = bli_obj_width_after_trans( a );
+
+	rec.rs_a    = bli_obj_row_stride( a );
+	rec.cs_a    = bli_obj_col_stride( a );
+	rec.rs_b    = ( b != NULL ? bli_obj_row_stride( b ) : 0 );
+	rec.cs_b    = ( b != NULL ? bli_obj_col_stride( b ) : 0 );
+	rec.rs_c    = bli_obj_row_stride( c );
+	rec.cs_c    = bli_obj_col_stride( c );
+
+	bli_capture_write( &rec, rntm );
+}
+
+void bli_capture_l2
+     (
+       capop_t op,
+       num_t   dt,
+       trans_t transa,
+       uplo_t  uploa,
+       diag_t  diaga,
+       dim_t   m,
+       dim_t   n,
+       inc_t   rs_a,
+       inc_t   cs_a,
+       inc_t   incx,
+       inc_t   incy
+     )
+{
+	if ( !capture_enabled ) return;
+
+	capture_rec_t rec;
+
+	rec.op      = op;
+	rec.dt      = dt;
+	rec.trans_a = transa;
+	rec.trans_b = BLIS_NO_TRANSPOSE;
+	rec.side    = BLIS_LEFT;
+	rec.uplo    = uploa;
+	rec.diag    = diaga;
+
+	rec.m       = m;
+	rec.n       = n;
+	rec.k       = 0;
+
+	rec.rs_a    = rs_a;
+	rec.cs_a    = cs_a;
+	rec.rs_b    = incx;
+	rec.cs_b    = 0;
+	rec.rs_c    = incy;
+	rec.cs_c    = 0;
+
+	bli_capture_write( &rec, NULL );
+}
+
@@ -0,0 +1,151 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_CAPTURE_H
+#define BLIS_CAPTURE_H
+
+// -- Workload capture ---------------------------------------------------------
+
+// If the BLIS_CAPTURE_FILE environment variable is set when BLIS is
+// initialized, every level-3 object API call (which includes level-3 calls
+// made via the typed API, BLAS, and CBLAS) and every level-2 BLAS call to
+// gemv, ger, hemv, symv, trmv, and trsv appends one fixed-size capture_rec_t
+// to the named file. The record describes the shape of the call (operation,
+// datatype, dimensions, transposition, structure, and strides) and the
+// threading settings in effect, but none of the data. The file may be
+// replayed with test/other/test_replay.c. When the variable is not set, each
+// capture point costs one predictable branch.
+
+// The capture operation ids. Note that the level-3 values match those of
+// opid_t.
+typedef enum
+{
+	BLIS_CAPTURE_GEMM = BLIS_GEMM,
+	BLIS_CAPTURE_GEMMT,
+	BLIS_CAPTURE_HEMM,
+	BLIS_CAPTURE_HERK,
+	BLIS_CAPTURE_HER2K,
+	BLIS_CAPTURE_SYMM,
+	BLIS_CAPTURE_SYRK,
+	BLIS_CAPTURE_SYR2K,
+	BLIS_CAPTURE_TRMM3,
+	BLIS_CAPTURE_TRMM,
+	BLIS_CAPTURE_TRSM,
+
+	BLIS_CAPTURE_GEMV,
+	BLIS_CAPTURE_GER,
+	BLIS_CAPTURE_HEMV,
+	BLIS_CAPTURE_SYMV,
+	BLIS_CAPTURE_TRMV,
+	BLIS_CAPTURE_TRSV
+} capop_t;
+
+#define BLIS_NUM_CAPTURE_OPS 17
+
+// The capture file consists of a capture_hdr_t followed by zero or more
+// capture_rec_t records, all in the byte order of the capturing host.
+
+#define BLIS_CAPTURE_MAGIC   "BLISCAP"
+#define BLIS_CAPTURE_VERSION 1
+
+typedef struct capture_hdr_s
+{
+	char     magic[ 8 ];
+	int32_t  version;
+	int32_t  rec_size;
+
+} capture_hdr_t;
+
+typedef struct capture_rec_s
+{
+	int32_t  op;        // capop_t
+	int32_t  dt;        // num_t of the output operand
+	int32_t  trans_a;   // trans_t
+	int32_t  trans_b;   // trans_t
+	int32_t  side;      // side_t
+	int32_t  uplo;      // uplo_t
+	int32_t  diag;      // diag_t
+	int32_t  reserved;
+
+	int32_t  n_threads; // -1 if unset
+	int32_t  ways[ 5 ]; // jc, pc, ic, jr, ir ways (-1 if unset)
+
+	int64_t  m;
+	int64_t  n;
+	int64_t  k;
+
+	// For level-2 operations, x and y are recorded as b and c with their
+	// increments stored in rs_b and rs_c.
+	int64_t  rs_a, cs_a;
+	int64_t  rs_b, cs_b;
+	int64_t  rs_c, cs_c;
+
+} capture_rec_t;
+
+// -- Function prototypes ------------------------------------------------------
+
+void bli_capture_init( void );
+void bli_capture_finalize( void );
+
+BLIS_EXPORT_BLIS bool bli_capture_is_enabled( void );
+
+BLIS_EXPORT_BLIS const char* bli_capture_op_string( capop_t op );
+
+void bli_capture_l3
+     (
+       opid_t  op,
+       side_t  side,
+       obj_t*  a,
+       obj_t*  b,
+       obj_t*  c,
+       rntm_t* rntm
+     );
+
+void bli_capture_l2
+     (
+       capop_t op,
+       num_t   dt,
+       trans_t transa,
+       uplo_t  uploa,
+       diag_t  diaga,
+       dim_t   m,
+       dim_t   n,
+       inc_t   rs_a,
+       inc_t   cs_a,
+       inc_t   incx,
+       inc_t   incy
+     );
+
+#endif
+
@@ -132,6 +132,10 @@ BLIS_INLINE func_t* bli_cntx_unpackm_kers_buf( cntx_t* cntx )
 {
 	return cntx->unpackm_kers;
 }
+BLIS_INLINE func_t* bli_cntx_transm_ker_buf( cntx_t* cntx )
+{
+	return &(cntx->transm_ker);
+}
 BLIS_INLINE ind_t bli_cntx_method( cntx_t* cntx )
 {
 	return cntx->method;
@@ -493,6 +497,15 @@ BLIS_INLINE void_fp bli_cntx_get_unpackm_ker_dt( num_t dt, l1mkr_t ker_id, cntx_
 
 // -----------------------------------------------------------------------------
 
+BLIS_INLINE void_fp bli_cntx_get_transm_ker_dt( num_t dt, cntx_t* cntx )
+{
+	func_t* func = bli_cntx_transm_ker_buf( cntx );
+
+	return bli_func_get_dt( dt, func );
+}
+
+// -----------------------------------------------------------------------------
+
 BLIS_INLINE bool bli_cntx_l3_nat_ukr_prefers_rows_dt( num_t dt, l3ukr_t ukr_id, cntx_t* cntx )
 {
 	const bool prefs = bli_cntx_get_l3_nat_ukr_prefs_dt( dt, ukr_id, cntx );
@@ -727,6 +740,20 @@ BLIS_INLINE void bli_cntx_set_unpackm_ker_dt( void_fp fp, num_t dt, l1mkr_t ker_
 	bli_func_set_dt( fp, dt, func );
 }
 
+BLIS_INLINE void bli_cntx_set_transm_ker( func_t* func, cntx_t* cntx )
+{
+	func_t* funcs = bli_cntx_transm_ker_buf( cntx );
+
+	*funcs = *func;
+}
+
+BLIS_INLINE void bli_cntx_set_transm_ker_dt( void_fp fp, num_t dt, cntx_t* cntx )
+{
+	func_t* func = bli_cntx_transm_ker_buf( cntx );
+
+	bli_func_set_dt( fp, dt, func );
+}
+
 // -----------------------------------------------------------------------------
 
 // Function prototypes
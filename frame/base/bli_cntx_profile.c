@@ -0,0 +1,275 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+typedef enum
+{
+	BLIS_PROFILE_BLKSZ,
+	BLIS_PROFILE_THRESH,
+} profkind_t;
+
+typedef struct
+{
+	const char* name;
+	profkind_t  kind;
+	gint_t      id;
+} profparam_t;
+
+static profparam_t bli_cntx_profile_params[] =
+{
+	{ "mc", BLIS_PROFILE_BLKSZ,  BLIS_MC },
+	{ "kc", BLIS_PROFILE_BLKSZ,  BLIS_KC },
+	{ "nc", BLIS_PROFILE_BLKSZ,  BLIS_NC },
+	{ "mt", BLIS_PROFILE_THRESH, BLIS_MT },
+	{ "nt", BLIS_PROFILE_THRESH, BLIS_NT },
+	{ "kt", BLIS_PROFILE_THRESH, BLIS_KT },
+};
+
+#define BLIS_NUM_PROFILE_PARAMS \
+        ( sizeof( bli_cntx_profile_params ) / sizeof( profparam_t ) )
+
+static char bli_cntx_profile_dt_chars[ BLIS_NUM_FP_TYPES ] =
+{
+	's', 'c', 'd', 'z'
+};
+
+// -----------------------------------------------------------------------------
+
+static dim_t bli_cntx_profile_lcm( dim_t x, dim_t y )
+{
+	dim_t a = x, b = y;
+
+	while ( b != 0 ) { dim_t t = a % b; a = b; b = t; }
+
+	return ( a == 0 ? 0 : ( x / a ) * y );
+}
+
+// Return the register blocksize of which the given cache blocksize must be
+// a whole multiple (see bli_gks_register_cntx()).
+static dim_t bli_cntx_profile_mult( num_t dt, bszid_t bs_id, cntx_t* cntx )
+{
+	const dim_t mr = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+	const dim_t nr = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	const dim_t kr = bli_cntx_get_blksz_def_dt( dt, BLIS_KR, cntx );
+
+	if ( bs_id == BLIS_KC ) return kr;
+
+#ifndef BLIS_RELAX_MCNR_NCMR_CONSTRAINTS
+	return bli_cntx_profile_lcm( mr, nr );
+#else
+	return ( bs_id == BLIS_MC ? mr : nr );
+#endif
+}
+
+static profparam_t* bli_cntx_profile_find_param( const char* name )
+{
+	for ( dim_t i = 0; i < BLIS_NUM_PROFILE_PARAMS; ++i )
+	{
+		if ( strcmp( name, bli_cntx_profile_params[ i ].name ) == 0 )
+			return &bli_cntx_profile_params[ i ];
+	}
+
+	return NULL;
+}
+
+// -----------------------------------------------------------------------------
+
+err_t bli_cntx_profile_set
+     (
+       const char* name,
+       num_t       dt,
+       dim_t       val,
+       cntx_t*     cntx
+     )
+{
+	profparam_t* param = bli_cntx_profile_find_param( name );
+
+	if ( param == NULL || ( !bli_is_real( dt ) && !bli_is_complex( dt ) ) ) return BLIS_FAILURE;
+
+	if ( param->kind == BLIS_PROFILE_BLKSZ )
+	{
+		bszid_t  bs_id = ( bszid_t )param->id;
+		blksz_t* b     = bli_cntx_get_blksz( bs_id, cntx );
+		dim_t    mult  = bli_cntx_profile_mult( dt, bs_id, cntx );
+
+		if ( mult <= 0 ) return BLIS_FAILURE;
+
+		// Round down to a whole multiple of the register blocksize(s).
+		val = ( val / mult ) * mult;
+
+		if ( val < mult ) return BLIS_FAILURE;
+
+		// Preserve the configuration's edge-case extension (the difference
+		// between the maximum and default blocksizes), which is itself a
+		// whole multiple of the register blocksize(s).
+		dim_t ext = bli_blksz_get_max( dt, b ) - bli_blksz_get_def( dt, b );
+
+		bli_blksz_set_def( val,       dt, b );
+		bli_blksz_set_max( val + ext, dt, b );
+	}
+	else
+	{
+		threshid_t th_id = ( threshid_t )param->id;
+		blksz_t*   b     = bli_cntx_get_l3_sup_thresh( th_id, cntx );
+
+		if ( val < 0 ) return BLIS_FAILURE;
+
+		bli_blksz_set_def( val, dt, b );
+		bli_blksz_set_max( val, dt, b );
+	}
+
+	return BLIS_SUCCESS;
+}
+
+dim_t bli_cntx_profile_get
+     (
+       const char* name,
+       num_t       dt,
+       cntx_t*     cntx
+     )
+{
+	profparam_t* param = bli_cntx_profile_find_param( name );
+
+	if ( param == NULL || ( !bli_is_real( dt ) && !bli_is_complex( dt ) ) ) return -1;
+
+	if ( param->kind == BLIS_PROFILE_BLKSZ )
+		return bli_cntx_get_blksz_def_dt( dt, ( bszid_t )param->id, cntx );
+	else
+		return bli_cntx_get_l3_sup_thresh_dt( dt, ( threshid_t )param->id, cntx );
+}
+
+// -----------------------------------------------------------------------------
+
+err_t bli_cntx_profile_load
+     (
+       const char* filename,
+       arch_t      id,
+       cntx_t*     cntx
+     )
+{
+	FILE* file = fopen( filename, "r" );
+
+	if ( file == NULL ) return BLIS_FAILURE;
+
+	char* arch_str = bli_arch_string( id );
+	bool  active   = TRUE;
+	char  line[ 256 ];
+
+	while ( fgets( line, sizeof( line ), file ) != NULL )
+	{
+		char  key[ 32 ];
+		char  arg[ 32 ];
+		long  val;
+		int   n_read;
+		char* comment = strchr( line, '#' );
+
+		if ( comment != NULL ) *comment = '\0';
+
+		n_read = sscanf( line, "%31s %31s %ld", key, arg, &val );
+
+		if ( n_read == 2 && strcmp( key, "arch" ) == 0 )
+		{
+			active = ( strcmp( arg, arch_str ) == 0 );
+			continue;
+		}
+
+		if ( n_read != 3 || !active || strlen( arg ) != 1 ) continue;
+
+		// Map the datatype character to a num_t.
+		num_t dt;
+		for ( dt = BLIS_DT_LO; dt <= BLIS_DT_HI; ++dt )
+			if ( bli_cntx_profile_dt_chars[ dt ] == arg[ 0 ] ) break;
+
+		if ( dt > BLIS_DT_HI ) continue;
+
+		// Apply the value; entries with unknown keys or invalid values
+		// are skipped.
+		bli_cntx_profile_set( key, dt, ( dim_t )val, cntx );
+	}
+
+	fclose( file );
+
+	return BLIS_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+
+err_t bli_cntx_profile_write
+     (
+       const char* filename,
+       arch_t      id,
+       cntx_t*     cntx
+     )
+{
+	FILE* file = fopen( filename, "w" );
+
+	if ( file == NULL ) return BLIS_FAILURE;
+
+	fprintf( file, "# BLIS context profile\n" );
+	fprintf( file, "arch %s\n", bli_arch_string( id ) );
+
+	for ( dim_t i = 0; i < BLIS_NUM_PROFILE_PARAMS; ++i )
+	{
+		profparam_t* param = &bli_cntx_profile_params[ i ];
+
+		for ( num_t dt = BLIS_DT_LO; dt <= BLIS_DT_HI; ++dt )
+		{
+			fprintf( file, "%s %c %ld\n", param->name,
+			         bli_cntx_profile_dt_chars[ dt ],
+			         ( long )bli_cntx_profile_get( param->name, dt, cntx ) );
+		}
+	}
+
+	fclose( file );
+
+	return BLIS_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_cntx_profile_apply_env
+     (
+       arch_t  id,
+       cntx_t* cntx
+     )
+{
+	const char* filename = getenv( BLIS_CNTX_PROFILE_ENV );
+
+	// A profile that cannot be opened is silently ignored so that a stale
+	// environment setting does not prevent initialization.
+	if ( filename != NULL && filename[ 0 ] != '\0' )
+		bli_cntx_profile_load( filename, id, cntx );
+}
+
@@ -0,0 +1,70 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_CNTX_PROFILE_H
+#define BLIS_CNTX_PROFILE_H
+
+// A context profile is a plain-text file that overrides the cache
+// blocksizes and small/unpacked (sup) thresholds that a configuration's
+// bli_cntx_init_<config>() function registers, allowing values tuned for a
+// particular machine (e.g. via test/other/test_autotune.c) to be applied
+// without rebuilding. Each non-comment line is either
+//
+//   arch <name>
+//
+// which restricts the entries that follow to the named architecture (as
+// returned by bli_arch_string()), or
+//
+//   <param> <dt> <value>
+//
+// where <param> is one of mc, kc, nc, mt, nt, kt, and <dt> is one of s, d,
+// c, z. Entries that precede any arch line apply to all architectures.
+// Cache blocksizes are rounded down to a valid multiple of the register
+// blocksizes, and entries that are malformed or out of range are ignored.
+// Text following a '#' is treated as a comment.
+
+// The environment variable that names a profile to apply to each native
+// context as it is registered with the gks.
+#define BLIS_CNTX_PROFILE_ENV "BLIS_CNTX_PROFILE"
+
+BLIS_EXPORT_BLIS err_t bli_cntx_profile_set( const char* name, num_t dt, dim_t val, cntx_t* cntx );
+BLIS_EXPORT_BLIS dim_t bli_cntx_profile_get( const char* name, num_t dt, cntx_t* cntx );
+
+BLIS_EXPORT_BLIS err_t bli_cntx_profile_load( const char* filename, arch_t id, cntx_t* cntx );
+BLIS_EXPORT_BLIS err_t bli_cntx_profile_write( const char* filename, arch_t id, cntx_t* cntx );
+
+void bli_cntx_profile_apply_env( arch_t id, cntx_t* cntx );
+
+#endif
+
@@ -39,6 +39,10 @@
 // induced methods.
 static cntx_t** gks[ BLIS_NUM_ARCHS ];
 
+// The array of function pointers holding the registered context initialization
+// functions for native execution.
+static void_fp  cntx_nat_init[ BLIS_NUM_ARCHS ];
+
 // The array of function pointers holding the registered context initialization
 // functions for induced methods.
 static void_fp  cntx_ind_init[ BLIS_NUM_ARCHS ];
@@ -52,6 +56,11 @@ typedef void (*nat_cntx_init_ft)( cntx_t* cntx );
 typedef void (*ref_cntx_init_ft)( cntx_t* cntx );
 typedef void (*ind_cntx_init_ft)( ind_t method, num_t dt, cntx_t* cntx );
 
+// A mutex to allow synchronous access to the gks when it needs to be updated
+// with a new entry corresponding to a context for an ind_t value, or with the
+// native context of an architecture other than the one detected at runtime.
+static bli_pthread_mutex_t gks_mutex = BLIS_PTHREAD_MUTEX_INITIALIZER;
+
 // -----------------------------------------------------------------------------
 
 void bli_gks_init( void )
@@ -193,6 +202,14 @@ void bli_gks_init( void )
 		                                              bli_cntx_init_generic_ref,
 		                                              bli_cntx_init_generic_ind );
 #endif
+
+		// Registration only records the initialization functions. Of the
+		// native contexts, only the one for the architecture that will
+		// actually be used is initialized here; in builds with many
+		// sub-configurations (e.g. x86_64), initializing every context would
+		// needlessly add to the startup latency of every process. Contexts for
+		// other architectures are initialized if and when they are looked up.
+		bli_gks_init_nat_cntx( bli_arch_query_id() );
 	}
 }
 
@@ -261,6 +278,7 @@ void bli_gks_init_index( void )
 	// zero/NULL. This is done so that later on we know which ones were
 	// allocated.
 	memset( gks,           0, gks_size );
+	memset( cntx_nat_init, 0, fpa_size );
 	memset( cntx_ref_init, 0, fpa_size );
 	memset( cntx_ind_init, 0, fpa_size );
 }
@@ -299,6 +317,16 @@ cntx_t* bli_gks_lookup_ind_cntx
 		bli_check_error_code( e_val );
 	}
 
+	// The native context for the architecture detected at runtime was
+	// initialized by bli_gks_init(). Any other architecture's native context
+	// is initialized on its first lookup.
+	if ( id != bli_arch_query_id() && gks[ id ] != NULL )
+	{
+		bli_pthread_mutex_lock( &gks_mutex );
+		bli_gks_init_nat_cntx( id );
+		bli_pthread_mutex_unlock( &gks_mutex );
+	}
+
 	// Index into the array of context pointers for the given architecture id,
 	// and then index into the subarray for the given induced method.
 	cntx_t** restrict gks_id     = gks[ id ];
@@ -347,12 +375,14 @@ void bli_gks_register_cntx
 	// associated with id), and one to a function that initializes a
 	// context for use with induced methods (again, with function pointers
 	// to the architecture). The latter two functions are automatically
-	// generated by the framework. Unlike with native contexts, we don't
-	// actually store the induced contexts until that induced method is
-	// called, and we don't ever store reference contexts. For this reason, we
-	// can get away with only storing the pointers to the initialization
-	// functions for those latter two types of contexts, which we can then
-	// call at a later time when those contexts are needed.
+	// generated by the framework. No context is initialized here: the native
+	// context is initialized by bli_gks_init_nat_cntx() (for the detected
+	// architecture, during bli_gks_init(); for any other, when it is first
+	// looked up), induced contexts are initialized when that induced method
+	// is first called, and reference contexts are never stored. For this
+	// reason, we only need to store the pointers to the initialization
+	// functions here, which we can then call at a later time when those
+	// contexts are needed.
 
 	// Sanity check: verify that the arch_t id is valid.
 	if ( bli_error_checking_is_enabled() )
@@ -361,22 +391,19 @@ void bli_gks_register_cntx
 		bli_check_error_code( e_val );
 	}
 
-	nat_cntx_init_ft f = nat_fp;
-
 	// First, store the function pointers to the context initialization
-	// functions for reference kernels and induced method execution. The
-	// former will be used whenever we need to obtain reference kernels and
-	// latter will be used later on if the user calls a level-3 function
-	// with induced execution enabled. 
+	// functions for native execution, reference kernels, and induced method
+	// execution.
+	cntx_nat_init[ id ] = nat_fp;
 	cntx_ref_init[ id ] = ref_fp;
 	cntx_ind_init[ id ] = ind_fp;
 
 	// If the the context array pointer isn't NULL, then it means the given
 	// architecture id has already registered (and the underlying memory
-	// allocations and context initializations have already been performed).
-	// This is really just a safety feature to prevent memory leaks; this
-	// early return should never occur, because the caller should never try
-	// to register with an architecture id that has already been registered.
+	// allocations have already been performed). This is really just a safety
+	// feature to prevent memory leaks; this early return should never occur,
+	// because the caller should never try to register with an architecture
+	// id that has already been registered.
 	if ( gks[ id ] != NULL ) return;
 
 	#ifdef BLIS_ENABLE_MEM_TRACING
@@ -386,28 +413,55 @@ void bli_gks_register_cntx
 	// At this point, we know the pointer to the array of cntx_t* is NULL and
 	// needs to be allocated. Allocate the memory and initialize it to
 	// zeros/NULL, storing the address of the alloacted memory at the element
-	// for the current architecture id.
+	// for the current architecture id. A non-NULL gks[ id ] marks the
+	// architecture as registered (see bli_arch_set_id()).
 	gks[ id ] = bli_calloc_intl( sizeof( cntx_t* ) * BLIS_NUM_IND_METHODS, &r_val );
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_gks_init_nat_cntx
+     (
+       arch_t id
+     )
+{
+	err_t r_val;
 
-	// Alias the allocated array for readability.
+	// This function allocates and initializes the native context for a
+	// registered architecture, if that has not already been done. It is
+	// called by bli_gks_init() for the architecture detected at runtime, and
+	// (with gks_mutex held) by bli_gks_lookup_ind_cntx() for any other.
+
+	// Alias the array of context pointers for readability. If the
+	// architecture was not registered, or its native context was already
+	// initialized, there is nothing to do.
 	cntx_t** restrict gks_id = gks[ id ];
 
+	if ( gks_id == NULL || gks_id[ BLIS_NAT ] != NULL ) return;
+
+	nat_cntx_init_ft f = cntx_nat_init[ id ];
+
 	#ifdef BLIS_ENABLE_MEM_TRACING
-	printf( "bli_gks_register_cntx(): " );
+	printf( "bli_gks_init_nat_cntx(): " );
 	#endif
 
-	// Allocate memory for a single context and store the address at
-	// the element in the gks[ id ] array that is reserved for native
-	// execution.
-	gks_id[ BLIS_NAT ] = bli_calloc_intl( sizeof( cntx_t ), &r_val );
-
-	// Alias the allocated context address for readability.
-	cntx_t* restrict gks_id_nat = gks_id[ BLIS_NAT ];
+	// Allocate memory for a single context.
+	cntx_t* restrict gks_id_nat = bli_calloc_intl( sizeof( cntx_t ), &r_val );
 
-	// Call the context initialization function on the element of the newly
-	// allocated array corresponding to native execution.
+	// Call the context initialization function on the newly allocated
+	// context.
 	f( gks_id_nat );
 
+	// If requested via the BLIS_BLKSZ_FROM_CACHE environment variable,
+	// replace the cache blocksizes with values derived from the cache
+	// geometry of the running machine.
+	bli_cache_blkszs_apply_env( gks_id_nat );
+
+	// Apply any blocksize and threshold overrides from the context profile
+	// named by the BLIS_CNTX_PROFILE environment variable, if set. This is
+	// done before the checks below so that the overrides are validated too.
+	bli_cntx_profile_apply_env( id, gks_id_nat );
+
 	// Verify that cache blocksizes are whole multiples of register blocksizes.
 	// Specifically, verify that:
 	//   - MC is a whole multiple of MR.
@@ -439,6 +493,11 @@ void bli_gks_register_cntx
 	e_val = bli_check_valid_mc_mod_mult( mc, nr ); bli_check_error_code( e_val );
 	e_val = bli_check_valid_nc_mod_mult( nc, mr ); bli_check_error_code( e_val );
 #endif
+
+	// Only now store the address of the context at the element in the
+	// gks[ id ] array that is reserved for native execution, so that the
+	// context is never observed partially initialized.
+	gks_id[ BLIS_NAT ] = gks_id_nat;
 }
 
 // -----------------------------------------------------------------------------
@@ -483,10 +542,6 @@ cntx_t* bli_gks_query_cntx_noinit( void )
 
 // -----------------------------------------------------------------------------
 
-// A mutex to allow synchronous access to the gks when it needs to be updated
-// with a new entry corresponding to a context for an ind_t value.
-static bli_pthread_mutex_t gks_mutex = BLIS_PTHREAD_MUTEX_INITIALIZER;
-
 cntx_t* bli_gks_query_ind_cntx
      (
        ind_t ind,
@@ -44,6 +44,7 @@ cntx_t* bli_gks_lookup_nat_cntx( arch_t id );
 cntx_t* bli_gks_lookup_ind_cntx( arch_t id, ind_t ind );
 cntx_t** bli_gks_lookup_id( arch_t id );
 void    bli_gks_register_cntx( arch_t id, void_fp nat_fp, void_fp ref_fp, void_fp ind_fp );
+void    bli_gks_init_nat_cntx( arch_t id );
 
 BLIS_EXPORT_BLIS cntx_t* bli_gks_query_cntx( void );
 BLIS_EXPORT_BLIS cntx_t* bli_gks_query_nat_cntx( void );
@@ -156,6 +156,22 @@ gint_t bli_info_get_enable_sandbox( void )
 	return 0;
 #endif
 }
+gint_t bli_info_get_enable_profiling( void )
+{
+#ifdef BLIS_ENABLE_PROFILING
+	return 1;
+#else
+	return 0;
+#endif
+}
+gint_t bli_info_get_enable_tracing( void )
+{
+#ifdef BLIS_ENABLE_TRACING
+	return 1;
+#else
+	return 0;
+#endif
+}
 
 
 
@@ -174,6 +190,10 @@ char* bli_info_get_trsm_l_ukr_impl_string( ind_t method, num_t dt )
 { bli_init_once(); return bli_gks_l3_ukr_impl_string( BLIS_TRSM_L_UKR,     method, dt ); }
 char* bli_info_get_trsm_u_ukr_impl_string( ind_t method, num_t dt )
 { bli_init_once(); return bli_gks_l3_ukr_impl_string( BLIS_TRSM_U_UKR,     method, dt ); }
+char* bli_info_get_gemmt_l_ukr_impl_string( ind_t method, num_t dt )
+{ bli_init_once(); return bli_gks_l3_ukr_impl_string( BLIS_GEMMT_L_UKR,    method, dt ); }
+char* bli_info_get_gemmt_u_ukr_impl_string( ind_t method, num_t dt )
+{ bli_init_once(); return bli_gks_l3_ukr_impl_string( BLIS_GEMMT_U_UKR,    method, dt ); }
 
 
 
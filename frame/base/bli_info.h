@@ -74,6 +74,8 @@ BLIS_EXPORT_BLIS gint_t bli_info_get_thread_part_jrir_slab( void );
 BLIS_EXPORT_BLIS gint_t bli_info_get_thread_part_jrir_rr( void );
 BLIS_EXPORT_BLIS gint_t bli_info_get_enable_memkind( void );
 BLIS_EXPORT_BLIS gint_t bli_info_get_enable_sandbox( void );
+BLIS_EXPORT_BLIS gint_t bli_info_get_enable_profiling( void );
+BLIS_EXPORT_BLIS gint_t bli_info_get_enable_tracing( void );
 
 
 // -- Kernel implementation-related --------------------------------------------
@@ -86,6 +88,8 @@ BLIS_EXPORT_BLIS char* bli_info_get_gemmtrsm_l_ukr_impl_string( ind_t method, nu
 BLIS_EXPORT_BLIS char* bli_info_get_gemmtrsm_u_ukr_impl_string( ind_t method, num_t dt );
 BLIS_EXPORT_BLIS char* bli_info_get_trsm_l_ukr_impl_string( ind_t method, num_t dt );
 BLIS_EXPORT_BLIS char* bli_info_get_trsm_u_ukr_impl_string( ind_t method, num_t dt );
+BLIS_EXPORT_BLIS char* bli_info_get_gemmt_l_ukr_impl_string( ind_t method, num_t dt );
+BLIS_EXPORT_BLIS char* bli_info_get_gemmt_u_ukr_impl_string( ind_t method, num_t dt );
 
 
 // -- BLIS implementation query (level-3) --------------------------------------
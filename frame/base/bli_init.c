@@ -89,7 +89,11 @@ void bli_init_apis( void )
 	bli_ind_init();
 	bli_thread_init();
 	bli_pack_init();
+	bli_gemm_strassen_init();
+	bli_gemm_stream_init();
+	bli_gemm_bf16_init();
 	bli_memsys_init();
+	bli_capture_init();
 
 	// Reset the control variable that will allow finalization.
 	// NOTE: We must initialize a fresh pthread_once_t object and THEN copy the
@@ -104,6 +108,8 @@ void bli_init_apis( void )
 void bli_finalize_apis( void )
 {
 	// Finalize various sub-APIs.
+	bli_capture_finalize();
+	bli_trace_finalize();
 	bli_memsys_finalize();
 	bli_pack_finalize();
 	bli_thread_finalize();
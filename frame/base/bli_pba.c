@@ -103,6 +103,9 @@ void bli_pba_acquire_m
 	dim_t   pi;
 	err_t   r_val;
 
+	BLIS_PROF_START( t_prof );
+	BLIS_TRACE_START( t_trace );
+
 	// If the internal memory pools for packing block allocator are disabled,
 	// we spoof the buffer type as BLIS_BUFFER_FOR_GEN_USE to induce the
 	// immediate usage of bli_pba_malloc().
@@ -192,6 +195,9 @@ void bli_pba_acquire_m
 		bli_mem_set_pool( pool, mem );
 		bli_mem_set_size( block_size, mem );
 	}
+
+	BLIS_PROF_STOP( BLIS_PROF_PBA, t_prof );
+	BLIS_TRACE_STOP( BLIS_TRACE_PBA, t_trace, req_size, 0, 0, 0, 0 );
 }
 
 
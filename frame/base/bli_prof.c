@@ -0,0 +1,121 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The process-wide aggregate of all flushed per-thread records, along with
+// the mutex that serializes updates to it.
+static prof_t              prof_global;
+static bli_pthread_mutex_t prof_global_mutex = BLIS_PTHREAD_MUTEX_INITIALIZER;
+
+// The calling thread's record for the level-3 operation in progress.
+static BLIS_THREAD_LOCAL prof_t prof_tl;
+
+static const char* prof_strings[ BLIS_NUM_PROF_IDS ] =
+{
+	"packm",
+	"ker",
+	"barrier",
+	"pba",
+	"sup",
+	"large",
+};
+
+// -----------------------------------------------------------------------------
+
+void bli_prof_clear( prof_t* prof )
+{
+	for ( dim_t i = 0; i < BLIS_NUM_PROF_IDS; ++i )
+	{
+		prof->time[ i ]  = 0.0;
+		prof->count[ i ] = 0;
+	}
+}
+
+void bli_prof_accum( prof_t* src, prof_t* dst )
+{
+	for ( dim_t i = 0; i < BLIS_NUM_PROF_IDS; ++i )
+	{
+		dst->time[ i ]  += src->time[ i ];
+		dst->count[ i ] += src->count[ i ];
+	}
+}
+
+void bli_prof_query( prof_t* prof )
+{
+	bli_pthread_mutex_lock( &prof_global_mutex );
+	*prof = prof_global;
+	bli_pthread_mutex_unlock( &prof_global_mutex );
+}
+
+void bli_prof_reset( void )
+{
+	bli_pthread_mutex_lock( &prof_global_mutex );
+	bli_prof_clear( &prof_global );
+	bli_pthread_mutex_unlock( &prof_global_mutex );
+}
+
+const char* bli_prof_string( profid_t id )
+{
+	return prof_strings[ id ];
+}
+
+// -----------------------------------------------------------------------------
+
+void bli_prof_record( profid_t id, double dt )
+{
+	prof_tl.time[ id ]  += dt;
+	prof_tl.count[ id ] += 1;
+}
+
+void bli_prof_thread_begin( void )
+{
+	bli_prof_clear( &prof_tl );
+}
+
+void bli_prof_thread_end( dim_t tid, rntm_t* rntm )
+{
+	prof_t* prof   = bli_rntm_prof( rntm );
+	dim_t   prof_n = bli_rntm_prof_n( rntm );
+
+	// Each thread owns its own element of the rntm_t's array, so no
+	// synchronization is needed there.
+	if ( prof != NULL && tid < prof_n )
+		bli_prof_accum( &prof_tl, &prof[ tid ] );
+
+	bli_pthread_mutex_lock( &prof_global_mutex );
+	bli_prof_accum( &prof_tl, &prof_global );
+	bli_pthread_mutex_unlock( &prof_global_mutex );
+}
+
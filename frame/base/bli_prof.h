@@ -0,0 +1,102 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_PROF_H
+#define BLIS_PROF_H
+
+// -- Profiling instrumentation ------------------------------------------------
+
+// When BLIS is configured with --enable-profiling, the framework accumulates
+// per-thread time and call counts for a handful of execution phases (see the
+// profid_t enum in bli_type_defs.h). Each thread records into a thread-local
+// prof_t; at the end of a level-3 operation the thread decorator flushes the
+// record into the rntm_t's prof array (if one was attached via
+// bli_rntm_set_prof()) and into a process-wide aggregate. When profiling is
+// disabled, the instrumentation macros below expand to nothing.
+
+#ifdef BLIS_ENABLE_PROFILING
+
+#define BLIS_PROF_START( t0 ) \
+\
+	const double t0 = bli_clock()
+
+#define BLIS_PROF_STOP( id, t0 ) \
+\
+	bli_prof_record( id, bli_clock() - t0 )
+
+#define BLIS_PROF_THREAD_BEGIN() \
+\
+	bli_prof_thread_begin()
+
+#define BLIS_PROF_THREAD_END( tid, rntm ) \
+\
+	bli_prof_thread_end( tid, rntm )
+
+#else
+
+#define BLIS_PROF_START( t0 )
+#define BLIS_PROF_STOP( id, t0 )          ( ( void )0 )
+#define BLIS_PROF_THREAD_BEGIN()          ( ( void )0 )
+#define BLIS_PROF_THREAD_END( tid, rntm ) ( ( void )0 )
+
+#endif
+
+// -- prof_t query -------------------------------------------------------------
+
+BLIS_INLINE double bli_prof_time( profid_t id, prof_t* prof )
+{
+	return prof->time[ id ];
+}
+
+BLIS_INLINE uint64_t bli_prof_count( profid_t id, prof_t* prof )
+{
+	return prof->count[ id ];
+}
+
+// -- Function prototypes ------------------------------------------------------
+
+BLIS_EXPORT_BLIS void bli_prof_clear( prof_t* prof );
+BLIS_EXPORT_BLIS void bli_prof_accum( prof_t* src, prof_t* dst );
+
+BLIS_EXPORT_BLIS void bli_prof_query( prof_t* prof );
+BLIS_EXPORT_BLIS void bli_prof_reset( void );
+
+BLIS_EXPORT_BLIS const char* bli_prof_string( profid_t id );
+
+void bli_prof_record( profid_t id, double dt );
+void bli_prof_thread_begin( void );
+void bli_prof_thread_end( dim_t tid, rntm_t* rntm );
+
+#endif
+
@@ -59,19 +59,116 @@ void bli_rntm_init_from_global( rntm_t* rntm )
 
 // -----------------------------------------------------------------------------
 
+// Reduce the number of threads so that each thread's share of the problem
+// is large enough to amortize the packing and synchronization that come
+// with it. A positive nt_min_work field is a minimum number of m*n*k
+// multiply-adds per thread. If the field is BLIS_NT_MIN_WORK_BLKSZ and the
+// blocksizes are known, each thread must instead receive at least an
+// mc x ( BLIS_THREAD_MIN_NR_PANELS * nr ) region of C, so that one packed
+// block of A is reused across several micropanels of B within every
+// rank-kc update. Any other value (including the default of zero) leaves
+// the number of threads unchanged.
+static dim_t bli_rntm_nt_for_work
+     (
+       dim_t   nt,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       dim_t   mc,
+       dim_t   nr,
+       rntm_t* rntm
+     )
+{
+	const dim_t  min_work = bli_rntm_nt_min_work( rntm );
+	      double nt_cap;
+
+	if ( 0 < min_work )
+	{
+		nt_cap = ( double )m * ( double )n * ( double )k / ( double )min_work;
+	}
+	else if ( min_work == BLIS_NT_MIN_WORK_BLKSZ && 0 < mc && 0 < nr )
+	{
+		nt_cap = ( double )m * ( double )n /
+		         ( ( double )mc * ( double )nr * BLIS_THREAD_MIN_NR_PANELS );
+	}
+	else
+	{
+		return nt;
+	}
+
+	if ( nt_cap < ( double )nt ) nt = bli_max( ( dim_t )nt_cap, 1 );
+
+	return nt;
+}
+
+// Split the ways of parallelism in the n dimension, nways_n, between the jc
+// and jr loops, and cap the ways in each loop so that no thread is left
+// without a micropanel to compute. Parallelism in the jr loop is preferred
+// beyond ceil( n / nc ) ways in the jc loop, since each jc group packs its
+// own copy of every block of A, while jr threads share them (unless max_jr
+// is 1, i.e., the configuration disables parallelism in the jr loop).
+static void bli_rntm_ways_for_blkszs
+     (
+       dim_t  m,
+       dim_t  n,
+       dim_t  mr,
+       dim_t  nr,
+       dim_t  nc,
+       dim_t  nways_n,
+       dim_t  max_jr,
+       dim_t* jc,
+       dim_t* ic,
+       dim_t* jr
+     )
+{
+	*jr = 1;
+
+	for ( dim_t w = max_jr; w > 1; w-- )
+	{
+		if ( nways_n % w == 0 ) { *jr = w; break; }
+	}
+
+	*jc = nways_n / *jr;
+
+	if ( 0 < nc && 0 < nr )
+	{
+		const dim_t n_jc = bli_max( ( n + nc - 1 ) / nc, 1 );
+
+		if ( 1 < max_jr && n_jc < *jc )
+		{
+			for ( *jc = n_jc; nways_n % *jc != 0; ) *jc -= 1;
+
+			*jr = nways_n / *jc;
+		}
+
+		*jc = bli_min( *jc, bli_max( ( n + nr - 1 ) / nr, 1 ) );
+
+		const dim_t n_per_jc = bli_min( ( n + *jc - 1 ) / *jc, nc );
+
+		*jr = bli_min( *jr, bli_max( ( n_per_jc + nr - 1 ) / nr, 1 ) );
+	}
+
+	if ( 0 < mr )
+	{
+		*ic = bli_min( *ic, bli_max( ( m + mr - 1 ) / mr, 1 ) );
+	}
+}
+
 void bli_rntm_set_ways_for_op
      (
        opid_t  l3_op,
        side_t  side,
+       num_t   dt,
        dim_t   m,
        dim_t   n,
        dim_t   k,
+       cntx_t* cntx,
        rntm_t* rntm
      )
 {
 	// Set the number of ways for each loop, if needed, depending on what
 	// kind of information is already stored in the rntm_t object.
-	bli_rntm_set_ways_from_rntm( m, n, k, rntm );
+	bli_rntm_set_ways_from_rntm( dt, m, n, k, cntx, rntm );
 
 #if 0
 printf( "bli_rntm_set_ways_for_op()\n" );
@@ -155,9 +252,11 @@ bli_rntm_print( rntm );
 
 void bli_rntm_set_ways_from_rntm
      (
+       num_t   dt,
        dim_t   m,
        dim_t   n,
        dim_t   k,
+       cntx_t* cntx,
        rntm_t* rntm
      )
 {
@@ -224,6 +323,25 @@ void bli_rntm_set_ways_from_rntm
 		// we attempt to automatically generate a thread factorization that
 		// will work given the problem size.
 
+		// Query the cache and register blocksizes only if the blocksize
+		// model was requested (and a context is available); otherwise the
+		// factorization depends on m, n, and k alone.
+		const bool use_blkszs = ( cntx != NULL &&
+		                          bli_rntm_nt_min_work( rntm ) == BLIS_NT_MIN_WORK_BLKSZ );
+		dim_t mr = 0, nr = 0, mc = 0, nc = 0;
+
+		if ( use_blkszs )
+		{
+			mr = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+			nr = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+			mc = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx );
+			nc = bli_cntx_get_blksz_def_dt( dt, BLIS_NC, cntx );
+		}
+
+		// Avoid spreading small problems so thinly across many threads
+		// that synchronization and packing overhead dominate.
+		nt = bli_rntm_nt_for_work( nt, m, n, k, mc, nr, rntm );
+
 #ifdef BLIS_DISABLE_AUTO_PRIME_NUM_THREADS
 		// If use of prime numbers is disallowed for automatic thread
 		// factorizations, we first check if the number of threads requested
@@ -243,14 +361,30 @@ void bli_rntm_set_ways_from_rntm
 
 		//printf( "jc ic = %d %d\n", (int)jc, (int)ic );
 
-		for ( ir = BLIS_THREAD_MAX_IR ; ir > 1 ; ir-- )
+		if ( use_blkszs )
 		{
-			if ( ic % ir == 0 ) { ic /= ir; break; }
-		}
+			bli_rntm_ways_for_blkszs( m, n, mr, nr, nc, jc, BLIS_THREAD_MAX_JR,
+			                          &jc, &ic, &jr );
 
-		for ( jr = BLIS_THREAD_MAX_JR ; jr > 1 ; jr-- )
+			for ( ir = BLIS_THREAD_MAX_IR ; ir > 1 ; ir-- )
+			{
+				if ( ic % ir == 0 ) { ic /= ir; break; }
+			}
+
+			// The caps above may have left fewer ways than threads.
+			nt = jc * pc * ic * jr * ir;
+		}
+		else
 		{
-			if ( jc % jr == 0 ) { jc /= jr; break; }
+			for ( ir = BLIS_THREAD_MAX_IR ; ir > 1 ; ir-- )
+			{
+				if ( ic % ir == 0 ) { ic /= ir; break; }
+			}
+
+			for ( jr = BLIS_THREAD_MAX_JR ; jr > 1 ; jr-- )
+			{
+				if ( jc % jr == 0 ) { jc /= jr; break; }
+			}
 		}
 	}
 	else // if ( ways_set == FALSE && nt_set == FALSE )
@@ -280,9 +414,11 @@ void bli_rntm_set_ways_from_rntm
 
 void bli_rntm_set_ways_from_rntm_sup
      (
+       num_t   dt,
        dim_t   m,
        dim_t   n,
        dim_t   k,
+       cntx_t* cntx,
        rntm_t* rntm
      )
 {
@@ -349,6 +485,22 @@ void bli_rntm_set_ways_from_rntm_sup
 		// we attempt to automatically generate a thread factorization that
 		// will work given the problem size.
 
+		// Avoid spreading small problems across too many threads, as on the
+		// conventional path but in terms of the sup blocksizes when the
+		// blocksize model was requested. (Only the number of threads matters
+		// here; bli_l3_sup_int() refactors it across the jc and ic loops in
+		// units of micropanels.)
+		dim_t nr = 0, mc = 0;
+
+		if ( cntx != NULL &&
+		     bli_rntm_nt_min_work( rntm ) == BLIS_NT_MIN_WORK_BLKSZ )
+		{
+			nr = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_NR, cntx );
+			mc = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MC, cntx );
+		}
+
+		nt = bli_rntm_nt_for_work( nt, m, n, k, mc, nr, rntm );
+
 #ifdef BLIS_DISABLE_AUTO_PRIME_NUM_THREADS
 		// If use of prime numbers is disallowed for automatic thread
 		// factorizations, we first check if the number of threads requested
@@ -50,6 +50,12 @@ typedef struct rntm_s
 	bool      pack_a;
 	bool      pack_b;
 	bool      l3_sup;
+	dim_t     strassen_levels;
+	prof_t*   prof;
+	dim_t     prof_n;
+	dim_t     nt_min_work;
+	bool      stream_c;
+	bool      pack_b_bf16;
 
 	pool_t*   sba_pool;
 	pba_t*    pba;
@@ -115,6 +121,36 @@ BLIS_INLINE bool bli_rntm_l3_sup( rntm_t* rntm )
 	return rntm->l3_sup;
 }
 
+BLIS_INLINE dim_t bli_rntm_strassen_levels( rntm_t* rntm )
+{
+	return rntm->strassen_levels;
+}
+
+BLIS_INLINE prof_t* bli_rntm_prof( rntm_t* rntm )
+{
+	return rntm->prof;
+}
+
+BLIS_INLINE dim_t bli_rntm_prof_n( rntm_t* rntm )
+{
+	return rntm->prof_n;
+}
+
+BLIS_INLINE dim_t bli_rntm_nt_min_work( rntm_t* rntm )
+{
+	return rntm->nt_min_work;
+}
+
+BLIS_INLINE bool bli_rntm_stream_c( rntm_t* rntm )
+{
+	return rntm->stream_c;
+}
+
+BLIS_INLINE bool bli_rntm_pack_b_bf16( rntm_t* rntm )
+{
+	return rntm->pack_b_bf16;
+}
+
 //
 // -- rntm_t query (internal use only) -----------------------------------------
 //
@@ -279,6 +315,54 @@ BLIS_INLINE void bli_rntm_disable_l3_sup( rntm_t* rntm )
 	bli_rntm_set_l3_sup( FALSE, rntm );
 }
 
+BLIS_INLINE void bli_rntm_set_strassen_levels( dim_t levels, rntm_t* rntm )
+{
+	// Set the number of levels of Strassen to apply to gemm (at most
+	// BLIS_STRASSEN_MAX_LEVELS are used). A value of zero selects the
+	// conventional gemm algorithm.
+	rntm->strassen_levels = levels;
+}
+
+BLIS_INLINE void bli_rntm_set_prof( prof_t* prof, dim_t prof_n, rntm_t* rntm )
+{
+	// Attach an array of prof_n prof_t records to the rntm_t. When BLIS is
+	// configured with profiling enabled, each thread with id tid < prof_n
+	// accumulates its phase times and counts into prof[ tid ] at the end
+	// of a level-3 operation. The caller owns (and should zero) the array.
+	rntm->prof   = prof;
+	rntm->prof_n = prof_n;
+}
+
+BLIS_INLINE void bli_rntm_set_nt_min_work( dim_t work, rntm_t* rntm )
+{
+	// Set the minimum amount of work, measured as m*n*k divided by the
+	// number of threads, that each thread should receive when the number
+	// of threads is factored automatically for a level-3 operation. The
+	// number of threads is reduced as needed to honor this minimum. A
+	// value of zero (the default) imposes no minimum, and a value of
+	// BLIS_NT_MIN_WORK_BLKSZ selects a minimum derived from the cache
+	// blocksizes, which also caps the ways of each loop accordingly (see
+	// bli_rntm.c).
+	rntm->nt_min_work = work;
+}
+
+BLIS_INLINE void bli_rntm_set_stream_c( bool stream_c, rntm_t* rntm )
+{
+	// Request that gemm write C with non-temporal (streaming) stores. This
+	// is honored only when beta is zero, C is larger than the last-level
+	// cache, and the context provides a streaming-store microkernel.
+	rntm->stream_c = stream_c;
+}
+
+BLIS_INLINE void bli_rntm_set_pack_b_bf16( bool pack_b_bf16, rntm_t* rntm )
+{
+	// Request that sgemm pack B in bfloat16 (accumulating in float). This
+	// halves the memory traffic of the packed B panels at the cost of
+	// rounding the elements of one operand to 8 significant bits. It is
+	// honored only when the context provides a matching microkernel.
+	rntm->pack_b_bf16 = pack_b_bf16;
+}
+
 //
 // -- rntm_t modification (internal use only) ----------------------------------
 //
@@ -295,6 +379,26 @@ BLIS_INLINE void bli_rntm_clear_l3_sup( rntm_t* rntm )
 {
 	bli_rntm_set_l3_sup( TRUE, rntm );
 }
+BLIS_INLINE void bli_rntm_clear_strassen_levels( rntm_t* rntm )
+{
+	bli_rntm_set_strassen_levels( 0, rntm );
+}
+BLIS_INLINE void bli_rntm_clear_prof( rntm_t* rntm )
+{
+	bli_rntm_set_prof( NULL, 0, rntm );
+}
+BLIS_INLINE void bli_rntm_clear_nt_min_work( rntm_t* rntm )
+{
+	bli_rntm_set_nt_min_work( 0, rntm );
+}
+BLIS_INLINE void bli_rntm_clear_stream_c( rntm_t* rntm )
+{
+	bli_rntm_set_stream_c( FALSE, rntm );
+}
+BLIS_INLINE void bli_rntm_clear_pack_b_bf16( rntm_t* rntm )
+{
+	bli_rntm_set_pack_b_bf16( FALSE, rntm );
+}
 
 //
 // -- rntm_t initialization ----------------------------------------------------
@@ -312,6 +416,12 @@ BLIS_INLINE void bli_rntm_clear_l3_sup( rntm_t* rntm )
           .pack_a      = FALSE, \
           .pack_b      = FALSE, \
           .l3_sup      = TRUE, \
+          .strassen_levels = 0, \
+          .prof        = NULL, \
+          .prof_n      = 0, \
+          .nt_min_work = 0, \
+          .stream_c    = FALSE, \
+          .pack_b_bf16 = FALSE, \
           .sba_pool    = NULL, \
           .pba         = NULL, \
         }  \
@@ -325,6 +435,11 @@ BLIS_INLINE void bli_rntm_init( rntm_t* rntm )
 	bli_rntm_clear_pack_a( rntm );
 	bli_rntm_clear_pack_b( rntm );
 	bli_rntm_clear_l3_sup( rntm );
+	bli_rntm_clear_strassen_levels( rntm );
+	bli_rntm_clear_prof( rntm );
+	bli_rntm_clear_nt_min_work( rntm );
+	bli_rntm_clear_stream_c( rntm );
+	bli_rntm_clear_pack_b_bf16( rntm );
 
 	bli_rntm_clear_sba_pool( rntm );
 	bli_rntm_clear_pba( rntm );
@@ -358,25 +473,31 @@ BLIS_EXPORT_BLIS void bli_rntm_set_ways_for_op
      (
        opid_t  l3_op,
        side_t  side,
+       num_t   dt,
        dim_t   m,
        dim_t   n,
        dim_t   k,
+       cntx_t* cntx,
        rntm_t* rntm
      );
 
 void bli_rntm_set_ways_from_rntm
      (
+       num_t   dt,
        dim_t   m,
        dim_t   n,
        dim_t   k,
+       cntx_t* cntx,
        rntm_t* rntm
      );
 
 void bli_rntm_set_ways_from_rntm_sup
      (
+       num_t   dt,
        dim_t   m,
        dim_t   n,
        dim_t   k,
+       cntx_t* cntx,
        rntm_t* rntm
      );
 
@@ -0,0 +1,324 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// A single timeline event, stored as a Chrome trace "complete" event.
+typedef struct trace_event_s
+{
+	traceid_t id;
+	double    t_begin;
+	double    t_end;
+	dim_t     args[ BLIS_NUM_TRACE_ARGS ];
+
+} trace_event_t;
+
+// A per-thread ring buffer of events. Once a thread has checked out a ring
+// (see bli_trace_thread_begin()), only that thread writes to it. When the
+// ring is full, the oldest events are overwritten.
+typedef struct trace_ring_s
+{
+	trace_event_t* events;
+	dim_t          n_events;
+	uint64_t       head;
+	bool           in_use;
+
+} trace_ring_t;
+
+// The set of rings allocated so far, along with the mutex that serializes
+// ring checkout, growth of the set, and dumping.
+static trace_ring_t**      trace_rings   = NULL;
+static dim_t               trace_n_rings = 0;
+static bli_pthread_mutex_t trace_mutex   = BLIS_PTHREAD_MUTEX_INITIALIZER;
+
+// The ring checked out by the calling thread, if any.
+static BLIS_THREAD_LOCAL trace_ring_t* trace_ring_tl = NULL;
+
+static const char* trace_names[ BLIS_NUM_TRACE_IDS ] =
+{
+	"none",
+	"jc loop",
+	"pc loop",
+	"ic loop",
+	"macrokernel",
+	"packm a",
+	"packm b",
+	"barrier",
+	"pba acquire",
+	"sup",
+	"large",
+};
+
+// The names of the arguments recorded with each event type. A NULL entry
+// marks an unused argument.
+static const char* trace_arg_names[ BLIS_NUM_TRACE_IDS ][ BLIS_NUM_TRACE_ARGS ] =
+{
+	{ NULL, NULL, NULL, NULL, NULL },
+	{ "m", "n", "k", "row_off", "col_off" },
+	{ "m", "n", "k", "row_off", "col_off" },
+	{ "m", "n", "k", "row_off", "col_off" },
+	{ "m", "n", "k", "row_off", "col_off" },
+	{ "m", "n", "bytes", NULL, NULL },
+	{ "m", "n", "bytes", NULL, NULL },
+	{ NULL, NULL, NULL, NULL, NULL },
+	{ "bytes", NULL, NULL, NULL, NULL },
+	{ "m", "n", "k", NULL, NULL },
+	{ "m", "n", "k", NULL, NULL },
+};
+
+// -----------------------------------------------------------------------------
+
+void bli_trace_thread_begin( dim_t tid )
+{
+	trace_ring_t* ring = NULL;
+	err_t         r_val;
+
+	bli_pthread_mutex_lock( &trace_mutex );
+
+	// Prefer the ring whose index matches the thread id so that, for a
+	// single application thread, the timeline rows line up with the BLIS
+	// thread ids. Otherwise, take the first ring not currently in use.
+	if ( tid < trace_n_rings && !trace_rings[ tid ]->in_use )
+		ring = trace_rings[ tid ];
+
+	for ( dim_t i = 0; ring == NULL && i < trace_n_rings; ++i )
+		if ( !trace_rings[ i ]->in_use ) ring = trace_rings[ i ];
+
+	// If every ring is in use, allocate a new one and append it to the set.
+	if ( ring == NULL )
+	{
+		trace_ring_t** rings_new
+		=
+		bli_malloc_intl( ( trace_n_rings + 1 ) * sizeof( trace_ring_t* ),
+		                 &r_val );
+
+		for ( dim_t i = 0; i < trace_n_rings; ++i )
+			rings_new[ i ] = trace_rings[ i ];
+
+		ring = bli_malloc_intl( sizeof( trace_ring_t ), &r_val );
+
+		ring->n_events = bli_env_get_var( "BLIS_TRACE_BUF_EVENTS",
+		                                  BLIS_TRACE_BUF_EVENTS_DEF );
+		if ( ring->n_events < 1 ) ring->n_events = BLIS_TRACE_BUF_EVENTS_DEF;
+
+		ring->events = bli_malloc_intl( ring->n_events * sizeof( trace_event_t ),
+		                                &r_val );
+		ring->head   = 0;
+		ring->in_use = FALSE;
+
+		rings_new[ trace_n_rings ] = ring;
+
+		bli_free_intl( trace_rings );
+
+		trace_rings    = rings_new;
+		trace_n_rings += 1;
+	}
+
+	ring->in_use = TRUE;
+
+	bli_pthread_mutex_unlock( &trace_mutex );
+
+	trace_ring_tl = ring;
+}
+
+void bli_trace_thread_end( void )
+{
+	trace_ring_t* ring = trace_ring_tl;
+
+	if ( ring == NULL ) return;
+
+	bli_pthread_mutex_lock( &trace_mutex );
+	ring->in_use = FALSE;
+	bli_pthread_mutex_unlock( &trace_mutex );
+
+	trace_ring_tl = NULL;
+}
+
+void bli_trace_record
+     (
+       traceid_t id,
+       double    t_begin,
+       double    t_end,
+       dim_t     a0,
+       dim_t     a1,
+       dim_t     a2,
+       dim_t     a3,
+       dim_t     a4
+     )
+{
+	trace_ring_t* ring = trace_ring_tl;
+
+	// Ignore events recorded outside of a thread decorator as well as
+	// events that do not map to a timeline entry.
+	if ( ring == NULL || id == BLIS_TRACE_NONE ) return;
+
+	trace_event_t* e = &ring->events[ ring->head % ring->n_events ];
+
+	e->id        = id;
+	e->t_begin   = t_begin;
+	e->t_end     = t_end;
+	e->args[ 0 ] = a0;
+	e->args[ 1 ] = a1;
+	e->args[ 2 ] = a2;
+	e->args[ 3 ] = a3;
+	e->args[ 4 ] = a4;
+
+	ring->head += 1;
+}
+
+// -----------------------------------------------------------------------------
+
+traceid_t bli_trace_l3_node_id( cntl_t* cntl )
+{
+	// The macrokernel is the node whose sub-node is the leaf of the tree.
+	// The partitioning nodes above it are identified by their blocksize.
+	// Packing nodes are not reported here since bli_l3_packm() records
+	// them directly.
+	if ( bli_cntl_is_leaf( bli_cntl_sub_node( cntl ) ) ) return BLIS_TRACE_KER;
+
+	switch ( bli_cntl_bszid( cntl ) )
+	{
+		case BLIS_NC: return BLIS_TRACE_JC;
+		case BLIS_KC: return BLIS_TRACE_PC;
+		case BLIS_MC: return BLIS_TRACE_IC;
+		default:      return BLIS_TRACE_NONE;
+	}
+}
+
+traceid_t bli_trace_packm_id( packbuf_t pack_buf_type )
+{
+	if ( pack_buf_type == BLIS_BUFFER_FOR_A_BLOCK ) return BLIS_TRACE_PACKM_A;
+	else                                            return BLIS_TRACE_PACKM_B;
+}
+
+// -----------------------------------------------------------------------------
+
+err_t bli_trace_dump( const char* filename )
+{
+	FILE* file = fopen( filename, "w" );
+
+	if ( file == NULL ) return BLIS_FAILURE;
+
+	bli_pthread_mutex_lock( &trace_mutex );
+
+	fprintf( file, "{\"traceEvents\":[\n" );
+
+	bool first = TRUE;
+
+	for ( dim_t r = 0; r < trace_n_rings; ++r )
+	{
+		trace_ring_t* ring = trace_rings[ r ];
+
+		// Emit a metadata event that names the timeline row.
+		fprintf( file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+		               "\"tid\":%ld,\"args\":{\"name\":\"blis thread %ld\"}}",
+		         first ? "" : ",\n", ( long )r, ( long )r );
+		first = FALSE;
+
+		// If the ring has wrapped, only the most recent n_events events
+		// are still present.
+		uint64_t i_begin = 0;
+		if ( ring->head > ( uint64_t )ring->n_events )
+			i_begin = ring->head - ring->n_events;
+
+		for ( uint64_t i = i_begin; i < ring->head; ++i )
+		{
+			trace_event_t* e = &ring->events[ i % ring->n_events ];
+
+			fprintf( file, ",\n{\"name\":\"%s\",\"cat\":\"blis\",\"ph\":\"X\","
+			               "\"pid\":0,\"tid\":%ld,\"ts\":%.3f,\"dur\":%.3f,"
+			               "\"args\":{",
+			         trace_names[ e->id ], ( long )r,
+			         e->t_begin * 1.0e6,
+			         ( e->t_end - e->t_begin ) * 1.0e6 );
+
+			for ( dim_t j = 0, n_args = 0; j < BLIS_NUM_TRACE_ARGS; ++j )
+			{
+				const char* arg_name = trace_arg_names[ e->id ][ j ];
+
+				if ( arg_name == NULL ) continue;
+
+				fprintf( file, "%s\"%s\":%ld", n_args++ == 0 ? "" : ",",
+				         arg_name, ( long )e->args[ j ] );
+			}
+
+			fprintf( file, "}}" );
+		}
+	}
+
+	fprintf( file, "\n],\"displayTimeUnit\":\"ms\"}\n" );
+
+	bli_pthread_mutex_unlock( &trace_mutex );
+
+	fclose( file );
+
+	return BLIS_SUCCESS;
+}
+
+void bli_trace_reset( void )
+{
+	bli_pthread_mutex_lock( &trace_mutex );
+
+	for ( dim_t r = 0; r < trace_n_rings; ++r )
+		trace_rings[ r ]->head = 0;
+
+	bli_pthread_mutex_unlock( &trace_mutex );
+}
+
+void bli_trace_finalize( void )
+{
+#ifdef BLIS_ENABLE_TRACING
+	// If requested, write the timeline collected so far before releasing
+	// the ring buffers.
+	char* filename = getenv( "BLIS_TRACE_FILE" );
+
+	if ( filename != NULL ) bli_trace_dump( filename );
+
+	bli_pthread_mutex_lock( &trace_mutex );
+
+	for ( dim_t r = 0; r < trace_n_rings; ++r )
+	{
+		bli_free_intl( trace_rings[ r ]->events );
+		bli_free_intl( trace_rings[ r ] );
+	}
+
+	bli_free_intl( trace_rings );
+
+	trace_rings   = NULL;
+	trace_n_rings = 0;
+
+	bli_pthread_mutex_unlock( &trace_mutex );
+#endif
+}
+
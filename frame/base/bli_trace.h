@@ -0,0 +1,126 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BLIS_TRACE_H
+#define BLIS_TRACE_H
+
+// -- Timeline tracing ---------------------------------------------------------
+
+// When BLIS is configured with --enable-tracing, each thread participating
+// in a level-3 operation records timestamped events (loop partitions, the
+// macrokernel, packing, barriers, and pba checkouts) into a per-thread ring
+// buffer. Ring buffers are checked out by the thread decorators at the start
+// of an operation and are written only by their owning thread, so recording
+// an event requires no synchronization. The collected events may be written
+// as Chrome trace JSON (viewable in chrome://tracing or Perfetto) via
+// bli_trace_dump(), or automatically at bli_finalize() time to the file
+// named by the BLIS_TRACE_FILE environment variable. When tracing is
+// disabled, the instrumentation macros below expand to nothing.
+
+typedef enum
+{
+	BLIS_TRACE_NONE = 0,
+	BLIS_TRACE_JC,
+	BLIS_TRACE_PC,
+	BLIS_TRACE_IC,
+	BLIS_TRACE_KER,
+	BLIS_TRACE_PACKM_A,
+	BLIS_TRACE_PACKM_B,
+	BLIS_TRACE_BARRIER,
+	BLIS_TRACE_PBA,
+	BLIS_TRACE_SUP,
+	BLIS_TRACE_LARGE
+} traceid_t;
+
+#define BLIS_NUM_TRACE_IDS      11
+#define BLIS_NUM_TRACE_ARGS     5
+
+// The default number of events retained by each thread's ring buffer. This
+// may be overridden at runtime via the BLIS_TRACE_BUF_EVENTS environment
+// variable.
+#define BLIS_TRACE_BUF_EVENTS_DEF  65536
+
+#ifdef BLIS_ENABLE_TRACING
+
+#define BLIS_TRACE_START( t0 ) \
+\
+	const double t0 = bli_clock()
+
+#define BLIS_TRACE_STOP( id, t0, a0, a1, a2, a3, a4 ) \
+\
+	bli_trace_record( id, t0, bli_clock(), a0, a1, a2, a3, a4 )
+
+#define BLIS_TRACE_THREAD_BEGIN( tid ) \
+\
+	bli_trace_thread_begin( tid )
+
+#define BLIS_TRACE_THREAD_END() \
+\
+	bli_trace_thread_end()
+
+#else
+
+#define BLIS_TRACE_START( t0 )
+#define BLIS_TRACE_STOP( id, t0, a0, a1, a2, a3, a4 ) ( ( void )0 )
+#define BLIS_TRACE_THREAD_BEGIN( tid )                ( ( void )0 )
+#define BLIS_TRACE_THREAD_END()                       ( ( void )0 )
+
+#endif
+
+// -- Function prototypes ------------------------------------------------------
+
+BLIS_EXPORT_BLIS err_t bli_trace_dump( const char* filename );
+BLIS_EXPORT_BLIS void  bli_trace_reset( void );
+
+void      bli_trace_finalize( void );
+
+void      bli_trace_record
+     (
+       traceid_t id,
+       double    t_begin,
+       double    t_end,
+       dim_t     a0,
+       dim_t     a1,
+       dim_t     a2,
+       dim_t     a3,
+       dim_t     a4
+     );
+void      bli_trace_thread_begin( dim_t tid );
+void      bli_trace_thread_end( void );
+
+traceid_t bli_trace_l3_node_id( cntl_t* cntl );
+traceid_t bli_trace_packm_id( packbuf_t pack_buf_type );
+
+#endif
+
@@ -37,7 +37,11 @@
 
 
 //
-// Define BLAS-to-BLIS interfaces.
+// Define BLAS-to-BLIS interfaces. The work is done by bli_?gemm_blas(),
+// which accepts column-major operands (from the BLAS interface) or row-major
+// operands (from the CBLAS interface). Row-major operands are passed to BLIS
+// with their native strides rather than recast as a transposed column-major
+// problem.
 //
 
 #ifdef BLIS_BLAS3_CALLS_TAPI
@@ -45,8 +49,9 @@
 #undef  GENTFUNC
 #define GENTFUNC( ftype, ch, blasname, blisname ) \
 \
-void PASTEF77(ch,blasname) \
+void PASTEMAC2(ch,blasname,_blas) \
      ( \
+       bool            row_major, \
        const f77_char* transa, \
        const f77_char* transb, \
        const f77_int*  m, \
@@ -69,20 +74,41 @@ void PASTEF77(ch,blasname) \
 	/* Initialize BLIS. */ \
 	bli_init_auto(); \
 \
-	/* Perform BLAS parameter checking. */ \
-	PASTEBLACHK(blasname) \
-	( \
-	  MKSTR(ch), \
-	  MKSTR(blasname), \
-	  transa, \
-	  transb, \
-	  m, \
-	  n, \
-	  k, \
-	  lda, \
-	  ldb, \
-	  ldc  \
-	); \
+	/* Perform BLAS parameter checking. A row-major problem is checked as
+	   the column-major problem C^T := B^T A^T to which it is equivalent,
+	   which is also how the parameters are numbered in any error report. */ \
+	if ( row_major ) \
+	{ \
+		PASTEBLACHK(blasname) \
+		( \
+		  MKSTR(ch), \
+		  MKSTR(blasname), \
+		  transb, \
+		  transa, \
+		  n, \
+		  m, \
+		  k, \
+		  ldb, \
+		  lda, \
+		  ldc  \
+		); \
+	} \
+	else \
+	{ \
+		PASTEBLACHK(blasname) \
+		( \
+		  MKSTR(ch), \
+		  MKSTR(blasname), \
+		  transa, \
+		  transb, \
+		  m, \
+		  n, \
+		  k, \
+		  lda, \
+		  ldb, \
+		  ldc  \
+		); \
+	} \
 \
 	/* Map BLAS chars to their corresponding BLIS enumerated type value. */ \
 	bli_param_map_netlib_to_blis_trans( *transa, &blis_transa ); \
@@ -94,12 +120,64 @@ void PASTEF77(ch,blasname) \
 	bli_convert_blas_dim1( *k, k0 ); \
 \
 	/* Set the row and column strides of the matrix operands. */ \
-	rs_a = 1; \
-	cs_a = *lda; \
-	rs_b = 1; \
-	cs_b = *ldb; \
-	rs_c = 1; \
-	cs_c = *ldc; \
+	if ( row_major ) \
+	{ \
+		rs_a = *lda; cs_a = 1; \
+		rs_b = *ldb; cs_b = 1; \
+		rs_c = *ldc; cs_c = 1; \
+	} \
+	else \
+	{ \
+		rs_a = 1; cs_a = *lda; \
+		rs_b = 1; cs_b = *ldb; \
+		rs_c = 1; cs_c = *ldc; \
+	} \
+\
+	/* Perform the operation as the level-1v or level-2 operation that it
+	   degenerates into if one of m, n, or k is unit. */ \
+	if ( !bli_capture_is_enabled() && \
+	     PASTEMAC(ch,gemm_redirect) \
+	     ( \
+	       blis_transa, \
+	       blis_transb, \
+	       m0, \
+	       n0, \
+	       k0, \
+	       (ftype*)alpha, \
+	       (ftype*)a, rs_a, cs_a, \
+	       (ftype*)b, rs_b, cs_b, \
+	       (ftype*)beta, \
+	       (ftype*)c, rs_c, cs_c, \
+	       NULL, \
+	       NULL  \
+	     ) == BLIS_SUCCESS ) \
+	{ \
+		/* Finalize BLIS. */ \
+		bli_finalize_auto(); \
+\
+		return; \
+	} \
+\
+	/* Invoke the kernels directly if the problem is small enough. */ \
+	if ( PASTEMAC(ch,gemm_fast) \
+	     ( \
+	       blis_transa, \
+	       blis_transb, \
+	       m0, \
+	       n0, \
+	       k0, \
+	       (ftype*)alpha, \
+	       (ftype*)a, rs_a, cs_a, \
+	       (ftype*)b, rs_b, cs_b, \
+	       (ftype*)beta, \
+	       (ftype*)c, rs_c, cs_c  \
+	     ) == BLIS_SUCCESS ) \
+	{ \
+		/* Finalize BLIS. */ \
+		bli_finalize_auto(); \
+\
+		return; \
+	} \
 \
 	/* Call BLIS interface. */ \
 	PASTEMAC2(ch,blisname,BLIS_TAPI_EX_SUF) \
@@ -127,8 +205,9 @@ void PASTEF77(ch,blasname) \
 #undef  GENTFUNC
 #define GENTFUNC( ftype, ch, blasname, blisname ) \
 \
-void PASTEF77(ch,blasname) \
+void PASTEMAC2(ch,blasname,_blas) \
      ( \
+       bool            row_major, \
        const f77_char* transa, \
        const f77_char* transb, \
        const f77_int*  m, \
@@ -148,20 +227,41 @@ void PASTEF77(ch,blasname) \
 	/* Initialize BLIS. */ \
 	bli_init_auto(); \
 \
-	/* Perform BLAS parameter checking. */ \
-	PASTEBLACHK(blasname) \
-	( \
-	  MKSTR(ch), \
-	  MKSTR(blasname), \
-	  transa, \
-	  transb, \
-	  m, \
-	  n, \
-	  k, \
-	  lda, \
-	  ldb, \
-	  ldc  \
-	); \
+	/* Perform BLAS parameter checking. A row-major problem is checked as
+	   the column-major problem C^T := B^T A^T to which it is equivalent,
+	   which is also how the parameters are numbered in any error report. */ \
+	if ( row_major ) \
+	{ \
+		PASTEBLACHK(blasname) \
+		( \
+		  MKSTR(ch), \
+		  MKSTR(blasname), \
+		  transb, \
+		  transa, \
+		  n, \
+		  m, \
+		  k, \
+		  ldb, \
+		  lda, \
+		  ldc  \
+		); \
+	} \
+	else \
+	{ \
+		PASTEBLACHK(blasname) \
+		( \
+		  MKSTR(ch), \
+		  MKSTR(blasname), \
+		  transa, \
+		  transb, \
+		  m, \
+		  n, \
+		  k, \
+		  lda, \
+		  ldb, \
+		  ldc  \
+		); \
+	} \
 \
 	/* Map BLAS chars to their corresponding BLIS enumerated type value. */ \
 	bli_param_map_netlib_to_blis_trans( *transa, &blis_transa ); \
@@ -173,12 +273,58 @@ void PASTEF77(ch,blasname) \
 	bli_convert_blas_dim1( *k, k0 ); \
 \
 	/* Set the row and column strides of the matrix operands. */ \
-	const inc_t rs_a = 1; \
-	const inc_t cs_a = *lda; \
-	const inc_t rs_b = 1; \
-	const inc_t cs_b = *ldb; \
-	const inc_t rs_c = 1; \
-	const inc_t cs_c = *ldc; \
+	const inc_t rs_a = ( row_major ? *lda : 1    ); \
+	const inc_t cs_a = ( row_major ? 1    : *lda ); \
+	const inc_t rs_b = ( row_major ? *ldb : 1    ); \
+	const inc_t cs_b = ( row_major ? 1    : *ldb ); \
+	const inc_t rs_c = ( row_major ? *ldc : 1    ); \
+	const inc_t cs_c = ( row_major ? 1    : *ldc ); \
+\
+	/* Perform the operation as the level-1v or level-2 operation that it
+	   degenerates into if one of m, n, or k is unit. */ \
+	if ( !bli_capture_is_enabled() && \
+	     PASTEMAC(ch,gemm_redirect) \
+	     ( \
+	       blis_transa, \
+	       blis_transb, \
+	       m0, \
+	       n0, \
+	       k0, \
+	       (ftype*)alpha, \
+	       (ftype*)a, rs_a, cs_a, \
+	       (ftype*)b, rs_b, cs_b, \
+	       (ftype*)beta, \
+	       (ftype*)c, rs_c, cs_c, \
+	       NULL, \
+	       NULL  \
+	     ) == BLIS_SUCCESS ) \
+	{ \
+		/* Finalize BLIS. */ \
+		bli_finalize_auto(); \
+\
+		return; \
+	} \
+\
+	/* Invoke the kernels directly if the problem is small enough. */ \
+	if ( PASTEMAC(ch,gemm_fast) \
+	     ( \
+	       blis_transa, \
+	       blis_transb, \
+	       m0, \
+	       n0, \
+	       k0, \
+	       (ftype*)alpha, \
+	       (ftype*)a, rs_a, cs_a, \
+	       (ftype*)b, rs_b, cs_b, \
+	       (ftype*)beta, \
+	       (ftype*)c, rs_c, cs_c  \
+	     ) == BLIS_SUCCESS ) \
+	{ \
+		/* Finalize BLIS. */ \
+		bli_finalize_auto(); \
+\
+		return; \
+	} \
 \
 	const num_t dt     = PASTEMAC(ch,type); \
 \
@@ -225,3 +371,41 @@ void PASTEF77(ch,blasname) \
 INSERT_GENTFUNC_BLAS( gemm, gemm )
 #endif
 
+
+#undef  GENTFUNC
+#define GENTFUNC( ftype, ch, blasname, blisname ) \
+\
+void PASTEF77(ch,blasname) \
+     ( \
+       const f77_char* transa, \
+       const f77_char* transb, \
+       const f77_int*  m, \
+       const f77_int*  n, \
+       const f77_int*  k, \
+       const ftype*    alpha, \
+       const ftype*    a, const f77_int* lda, \
+       const ftype*    b, const f77_int* ldb, \
+       const ftype*    beta, \
+             ftype*    c, const f77_int* ldc  \
+     ) \
+{ \
+	PASTEMAC2(ch,blasname,_blas) \
+	( \
+	  FALSE, \
+	  transa, \
+	  transb, \
+	  m, \
+	  n, \
+	  k, \
+	  alpha, \
+	  a, lda, \
+	  b, ldb, \
+	  beta, \
+	  c, ldc  \
+	); \
+}
+
+#ifdef BLIS_ENABLE_BLAS
+INSERT_GENTFUNC_BLAS( gemm, gemm )
+#endif
+
@@ -36,13 +36,18 @@
 
 
 //
-// Define BLAS-to-BLIS interfaces.
+// Define BLAS-to-BLIS interfaces. The work is done by bli_?gemv_blas(),
+// which accepts a column-major matrix (from the BLAS interface) or a
+// row-major matrix (from the CBLAS interface). A row-major matrix is passed
+// to BLIS with its native strides rather than recast as the transpose of a
+// column-major matrix.
 //
 #undef  GENTFUNC
 #define GENTFUNC( ftype, ch, blasname, blisname ) \
 \
-void PASTEF77(ch,blasname) \
+void PASTEMAC2(ch,blasname,_blas) \
      ( \
+       bool            row_major, \
        const f77_char* transa, \
        const f77_int*  m, \
        const f77_int*  n, \
@@ -65,14 +70,16 @@ void PASTEF77(ch,blasname) \
 	/* Initialize BLIS. */ \
 	bli_init_auto(); \
 \
-	/* Perform BLAS parameter checking. */ \
+	/* Perform BLAS parameter checking. A row-major problem is checked as
+	   the column-major problem with A^T to which it is equivalent, which is
+	   also how the parameters are numbered in any error report. */ \
 	PASTEBLACHK(blasname) \
 	( \
 	  MKSTR(ch), \
 	  MKSTR(blasname), \
 	  transa, \
-	  m, \
-	  n, \
+	  ( row_major ? n : m ), \
+	  ( row_major ? m : n ), \
 	  lda, \
 	  incx, \
 	  incy  \
@@ -113,8 +120,43 @@ void PASTEF77(ch,blasname) \
 	bli_convert_blas_incv( m_y, (ftype*)y, *incy, y0, incy0 ); \
 \
 	/* Set the row and column strides of A. */ \
-	rs_a = 1; \
-	cs_a = *lda; \
+	rs_a = ( row_major ? *lda : 1    ); \
+	cs_a = ( row_major ? 1    : *lda ); \
+\
+	/* Record the shape of the call if workload capture is enabled. */ \
+	bli_capture_l2 \
+	( \
+	  BLIS_CAPTURE_GEMV, \
+	  PASTEMAC(ch,type), \
+	  blis_transa, \
+	  BLIS_DENSE, \
+	  BLIS_NONUNIT_DIAG, \
+	  m0, \
+	  n0, \
+	  rs_a, \
+	  cs_a, \
+	  incx0, \
+	  incy0  \
+	); \
+\
+	/* Invoke the kernels directly if the problem is small enough. */ \
+	if ( PASTEMAC(ch,gemv_fast) \
+	     ( \
+	       blis_transa, \
+	       m0, \
+	       n0, \
+	       (ftype*)alpha, \
+	       (ftype*)a, rs_a, cs_a, \
+	       x0, incx0, \
+	       (ftype*)beta, \
+	       y0, incy0  \
+	     ) == BLIS_SUCCESS ) \
+	{ \
+		/* Finalize BLIS. */ \
+		bli_finalize_auto(); \
+\
+		return; \
+	} \
 \
 	/* Call BLIS interface. */ \
 	PASTEMAC2(ch,blisname,BLIS_TAPI_EX_SUF) \
@@ -140,3 +182,37 @@ void PASTEF77(ch,blasname) \
 INSERT_GENTFUNC_BLAS( gemv, gemv )
 #endif
 
+
+#undef  GENTFUNC
+#define GENTFUNC( ftype, ch, blasname, blisname ) \
+\
+void PASTEF77(ch,blasname) \
+     ( \
+       const f77_char* transa, \
+       const f77_int*  m, \
+       const f77_int*  n, \
+       const ftype*    alpha, \
+       const ftype*    a, const f77_int* lda, \
+       const ftype*    x, const f77_int* incx, \
+       const ftype*    beta, \
+             ftype*    y, const f77_int* incy  \
+     ) \
+{ \
+	PASTEMAC2(ch,blasname,_blas) \
+	( \
+	  FALSE, \
+	  transa, \
+	  m, \
+	  n, \
+	  alpha, \
+	  a, lda, \
+	  x, incx, \
+	  beta, \
+	  y, incy  \
+	); \
+}
+
+#ifdef BLIS_ENABLE_BLAS
+INSERT_GENTFUNC_BLAS( gemv, gemv )
+#endif
+
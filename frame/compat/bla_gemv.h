@@ -55,3 +55,23 @@ BLIS_EXPORT_BLAS void PASTEF77(ch,blasname) \
 INSERT_GENTPROT_BLAS( gemv )
 #endif
 
+#undef  GENTPROT
+#define GENTPROT( ftype, ch, blasname ) \
+\
+void PASTEMAC2(ch,blasname,_blas) \
+     ( \
+       bool            row_major, \
+       const f77_char* transa, \
+       const f77_int*  m, \
+       const f77_int*  n, \
+       const ftype*    alpha, \
+       const ftype*    a, const f77_int* lda, \
+       const ftype*    x, const f77_int* incx, \
+       const ftype*    beta, \
+             ftype*    y, const f77_int* incy  \
+     );
+
+#ifdef BLIS_ENABLE_BLAS
+INSERT_GENTPROT_BLAS( gemv )
+#endif
+
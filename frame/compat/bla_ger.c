@@ -86,6 +86,22 @@ void PASTEF772(ch,blasname,chc) \
 	/* Set the row and column strides of A. */ \
 	rs_a = 1; \
 	cs_a = *lda; \
+\
+	/* Record the shape of the call if workload capture is enabled. */ \
+	bli_capture_l2 \
+	( \
+	  BLIS_CAPTURE_GER, \
+	  PASTEMAC(ch,type), \
+	  BLIS_NO_TRANSPOSE, \
+	  BLIS_DENSE, \
+	  BLIS_NONUNIT_DIAG, \
+	  m0, \
+	  n0, \
+	  rs_a, \
+	  cs_a, \
+	  incx0, \
+	  incy0  \
+	); \
 \
 	/* Call BLIS interface. */ \
 	PASTEMAC2(ch,blisname,BLIS_TAPI_EX_SUF) \
@@ -89,6 +89,22 @@ void PASTEF77(ch,blasname) \
 	/* Set the row and column strides of A. */ \
 	rs_a = 1; \
 	cs_a = *lda; \
+\
+	/* Record the shape of the call if workload capture is enabled. */ \
+	bli_capture_l2 \
+	( \
+	  BLIS_CAPTURE_HEMV, \
+	  PASTEMAC(ch,type), \
+	  BLIS_NO_TRANSPOSE, \
+	  blis_uploa, \
+	  BLIS_NONUNIT_DIAG, \
+	  m0, \
+	  m0, \
+	  rs_a, \
+	  cs_a, \
+	  incx0, \
+	  incy0  \
+	); \
 \
 	/* Call BLIS interface. */ \
 	PASTEMAC2(ch,blisname,BLIS_TAPI_EX_SUF) \
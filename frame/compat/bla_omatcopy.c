@@ -0,0 +1,123 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+
+//
+// Define BLAS-to-BLIS interfaces.
+//
+#undef  GENTFUNC
+#define GENTFUNC( ftype, ch, blasname, blisname ) \
+\
+void PASTEF77(ch,blasname) \
+     ( \
+       const f77_char* order, \
+       const f77_char* trans, \
+       const f77_int*  rows, \
+       const f77_int*  cols, \
+       const ftype*    alpha, \
+       const ftype*    a, const f77_int* lda, \
+             ftype*    b, const f77_int* ldb  \
+     ) \
+{ \
+	trans_t blis_transa; \
+	dim_t   m0_a, n0_a; \
+	dim_t   m0_b, n0_b; \
+	inc_t   rs_a, cs_a; \
+	inc_t   rs_b, cs_b; \
+\
+	/* Initialize BLIS. */ \
+	bli_init_auto(); \
+\
+	/* Perform BLAS parameter checking. */ \
+	PASTEBLACHK(blasname) \
+	( \
+	  MKSTR(ch), \
+	  MKSTR(blasname), \
+	  order, \
+	  trans, \
+	  rows, \
+	  cols, \
+	  lda, \
+	  ldb  \
+	); \
+\
+	/* Map BLAS chars to their corresponding BLIS enumerated type value.
+	   'R' requests conjugation without transposition. */ \
+	if ( PASTEF770(lsame)( trans, "R", (ftnlen)1, (ftnlen)1 ) ) \
+		blis_transa = BLIS_CONJ_NO_TRANSPOSE; \
+	else \
+		bli_param_map_netlib_to_blis_trans( *trans, &blis_transa ); \
+\
+	/* Typecast BLAS integers to BLIS integers. */ \
+	bli_convert_blas_dim1( *rows, m0_a ); \
+	bli_convert_blas_dim1( *cols, n0_a ); \
+\
+	/* B holds transa( A ). */ \
+	bli_set_dims_with_trans( blis_transa, m0_a, n0_a, &m0_b, &n0_b ); \
+\
+	/* Set the row and column strides of the matrix operands. */ \
+	if ( PASTEF770(lsame)( order, "R", (ftnlen)1, (ftnlen)1 ) ) \
+	{ \
+		rs_a = *lda; cs_a = 1; \
+		rs_b = *ldb; cs_b = 1; \
+	} \
+	else \
+	{ \
+		rs_a = 1; cs_a = *lda; \
+		rs_b = 1; cs_b = *ldb; \
+	} \
+\
+	/* Call BLIS interface. */ \
+	PASTEMAC2(ch,blisname,BLIS_TAPI_EX_SUF) \
+	( \
+	  blis_transa, \
+	  m0_b, \
+	  n0_b, \
+	  (ftype*)alpha, \
+	  (ftype*)a, rs_a, cs_a, \
+	          b, rs_b, cs_b, \
+	  NULL, \
+	  NULL  \
+	); \
+\
+	/* Finalize BLIS. */ \
+	bli_finalize_auto(); \
+}
+
+#ifdef BLIS_ENABLE_BLAS
+INSERT_GENTFUNC_BLAS( omatcopy, omatcopy )
+#endif
+
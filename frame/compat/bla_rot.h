@@ -32,11 +32,23 @@
 
 */
 
-#ifdef BLIS_ENABLE_BLAS
 
-BLIS_EXPORT_BLAS int PASTEF77(s,rot)(const bla_integer *n, bla_real *sx, const bla_integer *incx, bla_real *sy, const bla_integer *incy, const bla_real *c__, const bla_real *s);
-BLIS_EXPORT_BLAS int PASTEF77(d,rot)(const bla_integer *n, bla_double *dx, const bla_integer *incx, bla_double *dy, const bla_integer *incy, const bla_double *c__, const bla_double *s);
-BLIS_EXPORT_BLAS int PASTEF77(cs,rot)(const bla_integer *n, bla_scomplex *cx, const bla_integer *incx, bla_scomplex *cy, const bla_integer *incy, const bla_real *c__, const bla_real *s);
-BLIS_EXPORT_BLAS int PASTEF77(zd,rot)(const bla_integer *n, bla_dcomplex *zx, const bla_integer *incx, bla_dcomplex *zy, const bla_integer *incy, const bla_double *c__, const bla_double *s);
+//
+// Prototype BLAS-to-BLIS interfaces.
+//
+#undef  GENTPROTR2
+#define GENTPROTR2( ftype_x, ftype_r, chx, chr, blasname ) \
+\
+BLIS_EXPORT_BLAS void PASTEF772(chx,chr,blasname) \
+     ( \
+       const f77_int* n, \
+       ftype_x* x, const f77_int* incx, \
+       ftype_x* y, const f77_int* incy, \
+       const ftype_r* c, \
+       const ftype_r* s  \
+     );
 
+#ifdef BLIS_ENABLE_BLAS
+INSERT_GENTPROTR2_BLAS( rot )
 #endif
+
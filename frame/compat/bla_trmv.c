@@ -94,6 +94,22 @@ void PASTEF77(ch,blasname) \
 \
 	/* Acquire a pointer to the global scalar constant BLIS_ONE. */ \
 	one_p = PASTEMAC(ch,1); \
+\
+	/* Record the shape of the call if workload capture is enabled. */ \
+	bli_capture_l2 \
+	( \
+	  BLIS_CAPTURE_TRMV, \
+	  PASTEMAC(ch,type), \
+	  blis_transa, \
+	  blis_uploa, \
+	  blis_diaga, \
+	  m0, \
+	  m0, \
+	  rs_a, \
+	  cs_a, \
+	  incx0, \
+	  0  \
+	); \
 \
 	/* Call BLIS interface. */ \
 	PASTEMAC2(ch,blisname,BLIS_TAPI_EX_SUF) \
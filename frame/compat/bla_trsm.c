@@ -99,6 +99,26 @@ void PASTEF77(ch,blasname) \
 	cs_a = *lda; \
 	rs_b = 1; \
 	cs_b = *ldb; \
+\
+	/* Invoke the kernels directly if the problem is small enough. */ \
+	if ( PASTEMAC(ch,trsm_fast) \
+	     ( \
+	       blis_side, \
+	       blis_uploa, \
+	       blis_transa, \
+	       blis_diaga, \
+	       m0, \
+	       n0, \
+	       (ftype*)alpha, \
+	       (ftype*)a, rs_a, cs_a, \
+	       (ftype*)b, rs_b, cs_b  \
+	     ) == BLIS_SUCCESS ) \
+	{ \
+		/* Finalize BLIS. */ \
+		bli_finalize_auto(); \
+\
+		return; \
+	} \
 \
 	/* Call BLIS interface. */ \
 	PASTEMAC2(ch,blisname,BLIS_TAPI_EX_SUF) \
@@ -177,6 +197,26 @@ void PASTEF77(ch,blasname) \
 	const inc_t cs_a = *lda; \
 	const inc_t rs_b = 1; \
 	const inc_t cs_b = *ldb; \
+\
+	/* Invoke the kernels directly if the problem is small enough. */ \
+	if ( PASTEMAC(ch,trsm_fast) \
+	     ( \
+	       blis_side, \
+	       blis_uploa, \
+	       blis_transa, \
+	       blis_diaga, \
+	       m0, \
+	       n0, \
+	       (ftype*)alpha, \
+	       (ftype*)a, rs_a, cs_a, \
+	       (ftype*)b, rs_b, cs_b  \
+	     ) == BLIS_SUCCESS ) \
+	{ \
+		/* Finalize BLIS. */ \
+		bli_finalize_auto(); \
+\
+		return; \
+	} \
 \
 	const num_t   dt     = PASTEMAC(ch,type); \
 \
@@ -166,6 +166,15 @@
 #include "bla_tpmv.h"
 #include "bla_tpsv.h"
 
+#include "bla_hpmv_check.h"
+#include "bla_hpr_check.h"
+#include "bla_hpr2_check.h"
+#include "bla_spmv_check.h"
+#include "bla_spr_check.h"
+#include "bla_spr2_check.h"
+#include "bla_tpmv_check.h"
+#include "bla_tpsv_check.h"
+
 // banded
 
 #include "bla_gbmv.h"
@@ -174,6 +183,12 @@
 #include "bla_tbmv.h"
 #include "bla_tbsv.h"
 
+#include "bla_gbmv_check.h"
+#include "bla_hbmv_check.h"
+#include "bla_sbmv_check.h"
+#include "bla_tbmv_check.h"
+#include "bla_tbsv_check.h"
+
 
 // -- Level-3 BLAS prototypes --
 
@@ -199,6 +214,22 @@
 #include "bla_trsm_check.h"
 #include "bla_gemmt_check.h"
 
+
+// -- BLAS extension prototypes --
+
+#include "bla_amin.h"
+#include "bla_omatcopy.h"
+#include "bla_imatcopy.h"
+
+#include "bla_omatcopy_check.h"
+#include "bla_imatcopy_check.h"
+
+
+// -- Fast paths for small problems --
+
+#include "bli_blas_fast.h"
+
+
 // -- Fortran-compatible APIs to BLIS functions --
 
 #include "b77_thread.h"
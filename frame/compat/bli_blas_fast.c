@@ -0,0 +1,456 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+#ifdef BLIS_ENABLE_BLAS
+
+// The gemm and trsm fast paths call the gemmsup kernels, and so they are
+// only available when small/unpacked matrix handling is enabled.
+#ifdef BLIS_DISABLE_SUP_HANDLING
+static const bool sup_enabled = FALSE;
+#else
+static const bool sup_enabled = TRUE;
+#endif
+
+//
+// Define a helper that computes C := beta * C + alpha * A * B with the
+// gemmsup kernels, where m <= MC and k <= KC (after the transposition
+// below), so that a single pass through the jr loop of the unthreaded,
+// unpacked bli_gemmsup_ref_var2m() suffices.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static err_t PASTEMAC(ch,opname) \
+     ( \
+       conj_t  conja, \
+       conj_t  conjb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c, \
+       cntx_t* cntx  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	stor3_t stor_id = bli_stor3_from_strides( rs_c, cs_c, \
+	                                          rs_a, cs_a, \
+	                                          rs_b, cs_b  ); \
+\
+	if ( stor_id == BLIS_XXX ) return BLIS_FAILURE; \
+\
+	/* If the kernel for this storage combination prefers the storage of C
+	   transposed, transpose the operation, as bli_gemmsup_int() does. */ \
+	const bool is_rrr_rrc_rcr_crr = ( stor_id == BLIS_RRR || \
+	                                  stor_id == BLIS_RRC || \
+	                                  stor_id == BLIS_RCR || \
+	                                  stor_id == BLIS_CRR ); \
+	const bool row_pref   = bli_cntx_l3_sup_ker_prefers_rows_dt( dt, stor_id, cntx ); \
+	const bool is_primary = ( row_pref ? is_rrr_rrc_rcr_crr \
+	                                   : !is_rrr_rrc_rcr_crr ); \
+\
+	if ( !is_primary ) \
+	{ \
+		ctype*       a_t   = a; \
+		const inc_t  rs_t  = rs_a; \
+		const inc_t  cs_t  = cs_a; \
+		const conj_t conjt = conja; \
+\
+		a = b;    rs_a = cs_b;  cs_a = rs_b;  conja = conjb; \
+		b = a_t;  rs_b = cs_t;  cs_b = rs_t;  conjb = conjt; \
+\
+		bli_swap_dims( &m, &n ); \
+		bli_swap_incs( &rs_c, &cs_c ); \
+\
+		stor_id = bli_stor3_trans( stor_id ); \
+	} \
+\
+	const dim_t MR  = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t NR  = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_NR, cntx ); \
+	const dim_t NRM = bli_cntx_get_l3_sup_blksz_max_dt( dt, BLIS_NR, cntx ); \
+	const dim_t MC  = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MC, cntx ); \
+	const dim_t KC  = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_KC, cntx ); \
+	const dim_t NRE = NRM - NR; \
+\
+	if ( m > MC || k > KC ) return BLIS_FAILURE; \
+\
+	PASTECH(ch,gemmsup_ker_ft) \
+	            gemmsup_ker = bli_cntx_get_l3_sup_ker_dt( dt, stor_id, cntx ); \
+\
+	/* The millikernel steps through micropanels of (unpacked) A using the
+	   panel stride embedded in the auxinfo_t object. */ \
+	auxinfo_t   aux; \
+	bli_auxinfo_set_ps_a( MR * rs_a, &aux ); \
+\
+	/* Compute the number of primary and leftover components of the JR loop,
+	   allowing the last iteration to contain up to NRE extra columns. */ \
+	dim_t jr_iter = ( n + NR - 1 ) / NR; \
+	dim_t jr_left =   n % NR; \
+\
+	if ( NRE != 0 && 1 < jr_iter && jr_left != 0 && jr_left <= NRE ) \
+	{ \
+		jr_iter--; jr_left += NR; \
+	} \
+\
+	for ( dim_t j = 0; j < jr_iter; j += 1 ) \
+	{ \
+		const dim_t nr_cur = ( bli_is_not_edge_f( j, jr_iter, jr_left ) ? NR : jr_left ); \
+\
+		gemmsup_ker \
+		( \
+		  conja, \
+		  conjb, \
+		  m, \
+		  nr_cur, \
+		  k, \
+		  alpha, \
+		  a,                 rs_a, cs_a, \
+		  b + j * NR * cs_b, rs_b, cs_b, \
+		  beta, \
+		  c + j * NR * cs_c, rs_c, cs_c, \
+		  &aux, \
+		  cntx  \
+		); \
+	} \
+\
+	return BLIS_SUCCESS; \
+}
+
+INSERT_GENTFUNC_BASIC0( gemmsup_direct )
+
+
+//
+// Define the fast paths for small BLAS calls.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+err_t PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       trans_t transb, \
+       dim_t   m, \
+       dim_t   n, \
+       dim_t   k, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b, \
+       ctype*  beta, \
+       ctype*  c, inc_t rs_c, inc_t cs_c  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	if ( !sup_enabled ) return BLIS_FAILURE; \
+\
+	/* Leave empty and larger problems to the conventional implementation,
+	   as well as those for which alpha is zero (which only scale C). Calls
+	   also take the conventional path while workload capture is enabled so
+	   that they are recorded by the object API. */ \
+	if ( bli_zero_dim3( m, n, k ) ) return BLIS_FAILURE; \
+	if ( m > BLIS_BLAS_FAST_DIM_MAX || \
+	     n > BLIS_BLAS_FAST_DIM_MAX || \
+	     k > BLIS_BLAS_FAST_DIM_MAX ) return BLIS_FAILURE; \
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) return BLIS_FAILURE; \
+	if ( bli_capture_is_enabled() ) return BLIS_FAILURE; \
+\
+	cntx_t* cntx = bli_gks_query_cntx(); \
+\
+	/* Since we replicate the default gemmsup handler, defer to the object
+	   API if the context registers a different one. */ \
+	if ( bli_cntx_get_l3_sup_handler( BLIS_GEMM, cntx ) != \
+	     ( void* )bli_gemmsup_ref ) return BLIS_FAILURE; \
+\
+	/* Apply the sup thresholds exactly as bli_gemmsup() would, taking into
+	   account the transposition induced by the gemm ukernel's storage
+	   preference. */ \
+	const bool ukr_likes_c = \
+	  ( bli_cntx_l3_vir_ukr_prefers_rows_dt( dt, BLIS_GEMM_UKR, cntx ) && \
+	    bli_is_row_stored( rs_c, cs_c ) ) || \
+	  ( bli_cntx_l3_vir_ukr_prefers_cols_dt( dt, BLIS_GEMM_UKR, cntx ) && \
+	    bli_is_col_stored( rs_c, cs_c ) ); \
+\
+	if ( ukr_likes_c ) \
+	{ \
+		if ( !bli_cntx_l3_sup_thresh_is_met( dt, m, n, k, cntx ) ) \
+			return BLIS_FAILURE; \
+	} \
+	else \
+	{ \
+		if ( !bli_cntx_l3_sup_thresh_is_met( dt, n, m, k, cntx ) ) \
+			return BLIS_FAILURE; \
+	} \
+\
+	/* Absorb any transpositions of A and B into their strides. */ \
+	if ( bli_does_trans( transa ) ) bli_swap_incs( &rs_a, &cs_a ); \
+	if ( bli_does_trans( transb ) ) bli_swap_incs( &rs_b, &cs_b ); \
+\
+	return \
+	PASTEMAC(ch,gemmsup_direct) \
+	( \
+	  bli_extract_conj( transa ), \
+	  bli_extract_conj( transb ), \
+	  m, \
+	  n, \
+	  k, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  b, rs_b, cs_b, \
+	  beta, \
+	  c, rs_c, cs_c, \
+	  cntx  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC0( gemm_fast )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, ftname, rvarname, cvarname ) \
+\
+err_t PASTEMAC(ch,opname) \
+     ( \
+       trans_t transa, \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  x, inc_t incx, \
+       ctype*  beta, \
+       ctype*  y, inc_t incy  \
+     ) \
+{ \
+	/* Leave empty and larger problems to the conventional implementation,
+	   as well as those for which alpha is zero (which only scale y). */ \
+	if ( bli_zero_dim2( m, n ) ) return BLIS_FAILURE; \
+	if ( m > BLIS_BLAS_FAST_DIM_MAX || \
+	     n > BLIS_BLAS_FAST_DIM_MAX ) return BLIS_FAILURE; \
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) return BLIS_FAILURE; \
+\
+	cntx_t* cntx = bli_gks_query_cntx(); \
+\
+	/* Choose the underlying implementation as the typed API does. */ \
+	PASTECH2(ch,ftname,_unb_ft) f; \
+\
+	if ( bli_does_notrans( transa ) ) \
+	{ \
+		if ( bli_is_row_stored( rs_a, cs_a ) ) f = PASTEMAC(ch,rvarname); \
+		else /* column or general stored */    f = PASTEMAC(ch,cvarname); \
+	} \
+	else /* if ( bli_does_trans( transa ) ) */ \
+	{ \
+		if ( bli_is_row_stored( rs_a, cs_a ) ) f = PASTEMAC(ch,cvarname); \
+		else /* column or general stored */    f = PASTEMAC(ch,rvarname); \
+	} \
+\
+	f \
+	( \
+	  transa, \
+	  BLIS_NO_CONJUGATE, \
+	  m, \
+	  n, \
+	  alpha, \
+	  a, rs_a, cs_a, \
+	  x, incx, \
+	  beta, \
+	  y, incy, \
+	  cntx \
+	); \
+\
+	return BLIS_SUCCESS; \
+}
+
+INSERT_GENTFUNC_BASIC3( gemv_fast, gemv, gemv_unf_var1, gemv_unf_var2 )
+
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+err_t PASTEMAC(ch,opname) \
+     ( \
+       side_t  side, \
+       uplo_t  uploa, \
+       trans_t transa, \
+       diag_t  diaga, \
+       dim_t   m, \
+       dim_t   n, \
+       ctype*  alpha, \
+       ctype*  a, inc_t rs_a, inc_t cs_a, \
+       ctype*  b, inc_t rs_b, inc_t cs_b  \
+     ) \
+{ \
+	const num_t dt = PASTEMAC(ch,type); \
+\
+	if ( !sup_enabled ) return BLIS_FAILURE; \
+\
+	/* Leave empty and larger problems to the conventional implementation,
+	   as well as those for which alpha is zero (which only zero B). Calls
+	   also take the conventional path while workload capture is enabled so
+	   that they are recorded by the object API. */ \
+	if ( bli_zero_dim2( m, n ) ) return BLIS_FAILURE; \
+	if ( m > BLIS_BLAS_FAST_DIM_MAX || \
+	     n > BLIS_BLAS_FAST_DIM_MAX ) return BLIS_FAILURE; \
+	if ( PASTEMAC(ch,eq0)( *alpha ) ) return BLIS_FAILURE; \
+	if ( bli_capture_is_enabled() ) return BLIS_FAILURE; \
+	if ( bli_is_gen_stored( rs_a, cs_a ) || \
+	     bli_is_gen_stored( rs_b, cs_b ) ) return BLIS_FAILURE; \
+\
+	cntx_t* cntx = bli_gks_query_cntx(); \
+\
+	const dim_t MR = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t MC = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MC, cntx ); \
+	const dim_t KC = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_KC, cntx ); \
+\
+	/* Ensure that none of the gemmsup updates below can be refused before
+	   B is modified. This also excludes datatypes for which the context
+	   provides no sup blocksizes. */ \
+	if ( bli_max( m, n ) > bli_min( MC, KC ) ) return BLIS_FAILURE; \
+\
+	/* Reduce the operation to solving A * X = B for X, overwriting B, where
+	   A is lower or upper triangular and not transposed. When A is on the
+	   right, we solve transa( A )^T * X^T = B^T instead. */ \
+	dim_t m_a, n_b; \
+\
+	if ( bli_is_left( side ) ) \
+	{ \
+		m_a = m; n_b = n; \
+	} \
+	else \
+	{ \
+		m_a = n; n_b = m; \
+		bli_swap_incs( &rs_b, &cs_b ); \
+		transa = bli_trans_toggled( transa ); \
+	} \
+\
+	if ( bli_does_trans( transa ) ) \
+	{ \
+		bli_swap_incs( &rs_a, &cs_a ); \
+		bli_toggle_uplo( &uploa ); \
+	} \
+\
+	const conj_t conja = bli_extract_conj( transa ); \
+\
+	/* B := alpha * B */ \
+	if ( !PASTEMAC(ch,eq1)( *alpha ) ) \
+	{ \
+		for ( dim_t j = 0; j < n_b; ++j ) \
+		for ( dim_t i = 0; i < m_a; ++i ) \
+			PASTEMAC(ch,scals)( *alpha, *( b + i*rs_b + j*cs_b ) ); \
+	} \
+\
+	/* Partition A and B into blocks of MR rows, proceeding from the top for
+	   lower triangular A and from the bottom for upper triangular A. Each
+	   block of B is first updated with the previously computed blocks of X
+	   using the gemmsup kernels and then solved against the diagonal block
+	   of A by substitution. */ \
+	const bool is_lower = bli_is_lower( uploa ); \
+\
+	for ( dim_t iter = 0; iter < m_a; iter += MR ) \
+	{ \
+		const dim_t ib = bli_min( MR, m_a - iter ); \
+		const dim_t i0 = ( is_lower ? iter : m_a - iter - ib ); \
+\
+		/* The rows of X already computed. */ \
+		const dim_t k0 = ( is_lower ? 0  : i0 + ib ); \
+		const dim_t k  = ( is_lower ? i0 : m_a - i0 - ib ); \
+\
+		ctype* a11 = a + i0*rs_a + i0*cs_a; \
+		ctype* b1  = b + i0*rs_b; \
+\
+		/* B1 := B1 - A10 * X0  (or B1 - A12 * X2) */ \
+		if ( k > 0 ) \
+			PASTEMAC(ch,gemmsup_direct) \
+			( \
+			  conja, \
+			  BLIS_NO_CONJUGATE, \
+			  ib, \
+			  n_b, \
+			  k, \
+			  PASTEMAC(ch,m1), \
+			  a + i0*rs_a + k0*cs_a, rs_a, cs_a, \
+			  b + k0*rs_b,           rs_b, cs_b, \
+			  PASTEMAC(ch,1), \
+			  b1,                    rs_b, cs_b, \
+			  cntx  \
+			); \
+\
+		/* B1 := inv( A11 ) * B1, one row at a time so that each diagonal
+		   element is inverted only once. */ \
+		for ( dim_t ii = 0; ii < ib; ++ii ) \
+		{ \
+			const dim_t i  = ( is_lower ? ii : ib - ii - 1 ); \
+			const dim_t p0 = ( is_lower ? 0  : i + 1 ); \
+			const dim_t p1 = ( is_lower ? i  : ib ); \
+			ctype       alpha11_inv; \
+			ctype       alpha_ip; \
+			ctype       rho; \
+\
+			PASTEMAC(ch,set1s)( alpha11_inv ); \
+			if ( bli_is_nonunit_diag( diaga ) ) \
+			{ \
+				PASTEMAC(ch,copycjs)( conja, *( a11 + i*rs_a + i*cs_a ), alpha11_inv ); \
+				PASTEMAC(ch,inverts)( alpha11_inv ); \
+			} \
+\
+			for ( dim_t j = 0; j < n_b; ++j ) \
+			{ \
+				ctype* beta11 = b1 + i*rs_b + j*cs_b; \
+\
+				PASTEMAC(ch,set0s)( rho ); \
+				for ( dim_t p = p0; p < p1; ++p ) \
+				{ \
+					PASTEMAC(ch,copycjs)( conja, *( a11 + i*rs_a + p*cs_a ), alpha_ip ); \
+					PASTEMAC(ch,axpys)( alpha_ip, *( b1 + p*rs_b + j*cs_b ), rho ); \
+				} \
+				PASTEMAC(ch,subs)( rho, *beta11 ); \
+				PASTEMAC(ch,scals)( alpha11_inv, *beta11 ); \
+			} \
+		} \
+	} \
+\
+	return BLIS_SUCCESS; \
+}
+
+INSERT_GENTFUNC_BASIC0( trsm_fast )
+
+#endif
@@ -14,7 +14,8 @@
  * Enumerated and derived types
  */
 enum CBLAS_ORDER {CblasRowMajor=101, CblasColMajor=102};
-enum CBLAS_TRANSPOSE {CblasNoTrans=111, CblasTrans=112, CblasConjTrans=113};
+enum CBLAS_TRANSPOSE {CblasNoTrans=111, CblasTrans=112, CblasConjTrans=113,
+                       CblasConjNoTrans=114};
 enum CBLAS_UPLO {CblasUpper=121, CblasLower=122};
 enum CBLAS_DIAG {CblasNonUnit=131, CblasUnit=132};
 enum CBLAS_SIDE {CblasLeft=141, CblasRight=142};
@@ -593,6 +594,36 @@ void BLIS_EXPORT_BLAS cblas_zher2k(enum CBLAS_ORDER Order, enum CBLAS_UPLO Uplo,
                   const void *B, f77_int ldb, double beta,
                   void *C, f77_int ldc);
 
+/*
+ * ===========================================================================
+ * Prototypes for BLAS extensions
+ * ===========================================================================
+ */
+void BLIS_EXPORT_BLAS cblas_somatcopy(enum CBLAS_ORDER Order, enum CBLAS_TRANSPOSE Trans,
+                 f77_int rows, f77_int cols, float alpha, const float *A,
+                 f77_int lda, float *B, f77_int ldb);
+void BLIS_EXPORT_BLAS cblas_domatcopy(enum CBLAS_ORDER Order, enum CBLAS_TRANSPOSE Trans,
+                 f77_int rows, f77_int cols, double alpha, const double *A,
+                 f77_int lda, double *B, f77_int ldb);
+void BLIS_EXPORT_BLAS cblas_comatcopy(enum CBLAS_ORDER Order, enum CBLAS_TRANSPOSE Trans,
+                 f77_int rows, f77_int cols, const void *alpha, const void *A,
+                 f77_int lda, void *B, f77_int ldb);
+void BLIS_EXPORT_BLAS cblas_zomatcopy(enum CBLAS_ORDER Order, enum CBLAS_TRANSPOSE Trans,
+                 f77_int rows, f77_int cols, const void *alpha, const void *A,
+                 f77_int lda, void *B, f77_int ldb);
+void BLIS_EXPORT_BLAS cblas_simatcopy(enum CBLAS_ORDER Order, enum CBLAS_TRANSPOSE Trans,
+                 f77_int rows, f77_int cols, float alpha, float *A,
+                 f77_int lda, f77_int ldb);
+void BLIS_EXPORT_BLAS cblas_dimatcopy(enum CBLAS_ORDER Order, enum CBLAS_TRANSPOSE Trans,
+                 f77_int rows, f77_int cols, double alpha, double *A,
+                 f77_int lda, f77_int ldb);
+void BLIS_EXPORT_BLAS cblas_cimatcopy(enum CBLAS_ORDER Order, enum CBLAS_TRANSPOSE Trans,
+                 f77_int rows, f77_int cols, const void *alpha, void *A,
+                 f77_int lda, f77_int ldb);
+void BLIS_EXPORT_BLAS cblas_zimatcopy(enum CBLAS_ORDER Order, enum CBLAS_TRANSPOSE Trans,
+                 f77_int rows, f77_int cols, const void *alpha, void *A,
+                 f77_int lda, f77_int ldb);
+
 void BLIS_EXPORT_BLAS cblas_xerbla(f77_int p, const char *rout, const char *form, ...);
 
 #ifdef __cplusplus
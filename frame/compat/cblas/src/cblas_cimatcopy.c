@@ -0,0 +1,110 @@
+#include "blis.h"
+#ifdef BLIS_ENABLE_CBLAS
+/*
+   cblas_cimatcopy.c
+   Based off of cblas_cgemmt.c.
+*/
+
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2020, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "cblas.h"
+#include "cblas_f77.h"
+void cblas_cimatcopy(enum CBLAS_ORDER Order, enum CBLAS_TRANSPOSE Trans,
+                     f77_int rows, f77_int cols, const void *alpha,
+                     void *A, f77_int lda, f77_int ldb)
+{
+   char OR, TR;
+#ifdef F77_CHAR
+   F77_CHAR F77_OR, F77_TR;
+#else
+   #define F77_OR &OR
+   #define F77_TR &TR
+#endif
+
+#ifdef F77_INT
+   F77_INT F77_rows=rows, F77_cols=cols, F77_lda=lda, F77_ldb=ldb;
+#else
+   #define F77_rows rows
+   #define F77_cols cols
+   #define F77_lda lda
+   #define F77_ldb ldb
+#endif
+
+   extern int CBLAS_CallFromC;
+   extern int RowMajorStrg;
+   RowMajorStrg = 0;
+   CBLAS_CallFromC = 1;
+
+   /* The BLAS-level interface accepts the storage order directly, so both
+      orders are passed through rather than swapped here. */
+   if ( Order == CblasColMajor ) OR='C';
+   else if ( Order == CblasRowMajor )
+   {
+      RowMajorStrg = 1;
+      OR='R';
+   }
+   else
+   {
+      cblas_xerbla(1, "cblas_cimatcopy", "Illegal Order setting, %d\n", Order);
+      CBLAS_CallFromC = 0;
+      RowMajorStrg = 0;
+      return;
+   }
+
+   if(Trans == CblasTrans) TR='T';
+   else if ( Trans == CblasConjTrans )   TR='C';
+   else if ( Trans == CblasConjNoTrans ) TR='R';
+   else if ( Trans == CblasNoTrans )     TR='N';
+   else
+   {
+      cblas_xerbla(2, "cblas_cimatcopy", "Illegal Trans setting, %d\n", Trans);
+      CBLAS_CallFromC = 0;
+      RowMajorStrg = 0;
+      return;
+   }
+
+   #ifdef F77_CHAR
+      F77_OR = C2F_CHAR(&OR);
+      F77_TR = C2F_CHAR(&TR);
+   #endif
+
+   F77_cimatcopy(F77_OR, F77_TR, &F77_rows, &F77_cols, alpha, A, &F77_lda,
+                 &F77_ldb);
+
+   CBLAS_CallFromC = 0;
+   RowMajorStrg = 0;
+   return;
+}
+#endif
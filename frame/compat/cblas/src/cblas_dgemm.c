@@ -76,9 +76,9 @@ void cblas_dgemm(enum CBLAS_ORDER Order, enum CBLAS_TRANSPOSE TransA,
    } else if (Order == CblasRowMajor)
    {
       RowMajorStrg = 1;
-      if(TransA == CblasTrans) TB='T';
-      else if ( TransA == CblasConjTrans ) TB='C';
-      else if ( TransA == CblasNoTrans )   TB='N';
+      if(TransA == CblasTrans) TA='T';
+      else if ( TransA == CblasConjTrans ) TA='C';
+      else if ( TransA == CblasNoTrans )   TA='N';
       else 
       {
          cblas_xerbla(2, "cblas_dgemm","Illegal TransA setting, %d\n", TransA);
@@ -86,9 +86,9 @@ void cblas_dgemm(enum CBLAS_ORDER Order, enum CBLAS_TRANSPOSE TransA,
          RowMajorStrg = 0;
          return;
       }
-      if(TransB == CblasTrans) TA='T';
-      else if ( TransB == CblasConjTrans ) TA='C';
-      else if ( TransB == CblasNoTrans )   TA='N';
+      if(TransB == CblasTrans) TB='T';
+      else if ( TransB == CblasConjTrans ) TB='C';
+      else if ( TransB == CblasNoTrans )   TB='N';
       else 
       {
          cblas_xerbla(2, "cblas_dgemm","Illegal TransB setting, %d\n", TransB);
@@ -101,8 +101,10 @@ void cblas_dgemm(enum CBLAS_ORDER Order, enum CBLAS_TRANSPOSE TransA,
          F77_TB = C2F_CHAR(&TB);
       #endif
 
-      F77_dgemm(F77_TA, F77_TB, &F77_N, &F77_M, &F77_K, &alpha, B,
-                  &F77_ldb, A, &F77_lda, &beta, C, &F77_ldc);
+      /* Pass the operands to BLIS with their row-major strides rather than
+         as the transposed column-major problem C^T := B^T A^T. */
+      bli_dgemm_blas(TRUE, F77_TA, F77_TB, &F77_M, &F77_N, &F77_K, &alpha, A,
+                  &F77_lda, B, &F77_ldb, &beta, C, &F77_ldc);
    } 
    else  cblas_xerbla(1, "cblas_dgemm", "Illegal Order setting, %d\n", Order);
    CBLAS_CallFromC = 0;
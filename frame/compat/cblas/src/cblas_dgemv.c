@@ -57,9 +57,9 @@ void cblas_dgemv(enum CBLAS_ORDER order,
    else if (order == CblasRowMajor)
    {
       RowMajorStrg = 1;
-      if (TransA == CblasNoTrans) TA = 'T';
-      else if (TransA == CblasTrans) TA = 'N';
-      else if (TransA == CblasConjTrans) TA = 'N';
+      if (TransA == CblasNoTrans) TA = 'N';
+      else if (TransA == CblasTrans) TA = 'T';
+      else if (TransA == CblasConjTrans) TA = 'C';
       else 
       {
          cblas_xerbla(2, "cblas_dgemv","Illegal TransA setting, %d\n", TransA);
@@ -70,7 +70,9 @@ void cblas_dgemv(enum CBLAS_ORDER order,
       #ifdef F77_CHAR
          F77_TA = C2F_CHAR(&TA);
       #endif
-      F77_dgemv(F77_TA, &F77_N, &F77_M, &alpha, A, &F77_lda, X,
+      /* Pass A to BLIS with its row-major strides rather than as the
+         transpose of a column-major matrix. */
+      bli_dgemv_blas(TRUE, F77_TA, &F77_M, &F77_N, &alpha, A, &F77_lda, X,
                 &F77_incX, &beta, Y, &F77_incY);
    }
    else cblas_xerbla(1, "cblas_dgemv", "Illegal Order setting, %d\n", order);
@@ -204,5 +204,13 @@
 #define F77_dgemmt dgemmt_
 #define F77_cgemmt cgemmt_
 #define F77_zgemmt zgemmt_
+#define F77_somatcopy somatcopy_
+#define F77_domatcopy domatcopy_
+#define F77_comatcopy comatcopy_
+#define F77_zomatcopy zomatcopy_
+#define F77_simatcopy simatcopy_
+#define F77_dimatcopy dimatcopy_
+#define F77_cimatcopy cimatcopy_
+#define F77_zimatcopy zimatcopy_
 
 #endif /*  CBLAS_F77_H */
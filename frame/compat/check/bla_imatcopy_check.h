@@ -34,9 +34,53 @@
 
 #ifdef BLIS_ENABLE_BLAS
 
-BLIS_EXPORT_BLAS int PASTEF77(c,gbmv)(const bla_character *trans, const bla_integer *m, const bla_integer *n, const bla_integer *kl, const bla_integer *ku, const bla_scomplex *alpha, const bla_scomplex *a, const bla_integer *lda, const bla_scomplex *x, const bla_integer *incx, const bla_scomplex *beta, bla_scomplex *y, const bla_integer *incy);
-BLIS_EXPORT_BLAS int PASTEF77(d,gbmv)(const bla_character *trans, const bla_integer *m, const bla_integer *n, const bla_integer *kl, const bla_integer *ku, const bla_double *alpha, const bla_double *a, const bla_integer *lda, const bla_double *x, const bla_integer *incx, const bla_double *beta, bla_double *y, const bla_integer *incy);
-BLIS_EXPORT_BLAS int PASTEF77(s,gbmv)(const bla_character *trans, const bla_integer *m, const bla_integer *n, const bla_integer *kl, const bla_integer *ku, const bla_real *alpha, const bla_real *a, const bla_integer *lda, const bla_real *x, const bla_integer * incx, const bla_real *beta, bla_real *y, const bla_integer *incy);
-BLIS_EXPORT_BLAS int PASTEF77(z,gbmv)(const bla_character *trans, const bla_integer *m, const bla_integer *n, const bla_integer *kl, const bla_integer *ku, const bla_dcomplex *alpha, const bla_dcomplex *a, const bla_integer *lda, const bla_dcomplex *x, const bla_integer *incx, const bla_dcomplex *beta, bla_dcomplex * y, const bla_integer *incy);
+#define bla_imatcopy_check( dt_str, op_str, order, trans, rows, cols, lda, ldb ) \
+{ \
+	f77_int info = 0; \
+	f77_int colmaj, rowmaj; \
+	f77_int nota, ta, conja, conjnota; \
+	f77_int lda_min, ldb_min; \
+\
+	colmaj   = PASTEF770(lsame)( order, "C", (ftnlen)1, (ftnlen)1 ); \
+	rowmaj   = PASTEF770(lsame)( order, "R", (ftnlen)1, (ftnlen)1 ); \
+\
+	nota     = PASTEF770(lsame)( trans, "N", (ftnlen)1, (ftnlen)1 ); \
+	ta       = PASTEF770(lsame)( trans, "T", (ftnlen)1, (ftnlen)1 ); \
+	conja    = PASTEF770(lsame)( trans, "C", (ftnlen)1, (ftnlen)1 ); \
+	conjnota = PASTEF770(lsame)( trans, "R", (ftnlen)1, (ftnlen)1 ); \
+\
+	if ( rowmaj ) { lda_min = *cols; } \
+	else          { lda_min = *rows; } \
+	if ( rowmaj == ( nota || conjnota ) ) { ldb_min = *cols; } \
+	else                                  { ldb_min = *rows; } \
+\
+	if	( !colmaj && !rowmaj ) \
+		info = 1; \
+	else if ( !nota && !ta && !conja && !conjnota ) \
+		info = 2; \
+	else if ( *rows < 0 ) \
+		info = 3; \
+	else if ( *cols < 0 ) \
+		info = 4; \
+	else if ( *lda < bli_max( 1, lda_min ) ) \
+		info = 7; \
+	else if ( *ldb < bli_max( 1, ldb_min ) ) \
+		info = 8; \
+\
+	if ( info != 0 ) \
+	{ \
+		/* The operation name is longer than those of the reference
+		   BLAS, so BLIS_MAX_BLAS_FUNC_STR_LENGTH is too short here. */ \
+		char func_str[ 16 ]; \
+\
+		sprintf( func_str, "%s%s", dt_str, op_str ); \
+\
+		bli_string_mkupper( func_str ); \
+\
+		PASTEF770(xerbla)( func_str, &info, (ftnlen)9 ); \
+\
+		return; \
+	} \
+}
 
 #endif
@@ -0,0 +1,86 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifdef BLIS_ENABLE_BLAS
+
+#define bla_omatcopy_check( dt_str, op_str, order, trans, rows, cols, lda, ldb ) \
+{ \
+	f77_int info = 0; \
+	f77_int colmaj, rowmaj; \
+	f77_int nota, ta, conja, conjnota; \
+	f77_int lda_min, ldb_min; \
+\
+	colmaj   = PASTEF770(lsame)( order, "C", (ftnlen)1, (ftnlen)1 ); \
+	rowmaj   = PASTEF770(lsame)( order, "R", (ftnlen)1, (ftnlen)1 ); \
+\
+	nota     = PASTEF770(lsame)( trans, "N", (ftnlen)1, (ftnlen)1 ); \
+	ta       = PASTEF770(lsame)( trans, "T", (ftnlen)1, (ftnlen)1 ); \
+	conja    = PASTEF770(lsame)( trans, "C", (ftnlen)1, (ftnlen)1 ); \
+	conjnota = PASTEF770(lsame)( trans, "R", (ftnlen)1, (ftnlen)1 ); \
+\
+	if ( rowmaj ) { lda_min = *cols; } \
+	else          { lda_min = *rows; } \
+	if ( rowmaj == ( nota || conjnota ) ) { ldb_min = *cols; } \
+	else                                  { ldb_min = *rows; } \
+\
+	if	( !colmaj && !rowmaj ) \
+		info = 1; \
+	else if ( !nota && !ta && !conja && !conjnota ) \
+		info = 2; \
+	else if ( *rows < 0 ) \
+		info = 3; \
+	else if ( *cols < 0 ) \
+		info = 4; \
+	else if ( *lda < bli_max( 1, lda_min ) ) \
+		info = 7; \
+	else if ( *ldb < bli_max( 1, ldb_min ) ) \
+		info = 9; \
+\
+	if ( info != 0 ) \
+	{ \
+		/* The operation name is longer than those of the reference
+		   BLAS, so BLIS_MAX_BLAS_FUNC_STR_LENGTH is too short here. */ \
+		char func_str[ 16 ]; \
+\
+		sprintf( func_str, "%s%s", dt_str, op_str ); \
+\
+		bli_string_mkupper( func_str ); \
+\
+		PASTEF770(xerbla)( func_str, &info, (ftnlen)9 ); \
+\
+		return; \
+	} \
+}
+
+#endif
@@ -183,6 +183,13 @@
   #define BLIS_BLAS3_CALLS_OAPI
 #endif
 
+// The BLAS routines gemm, gemv, and trsm bypass the BLIS APIs and invoke
+// kernels directly (without threading) when none of the problem dimensions
+// exceed this value. Setting it to 0 disables this fast path.
+#ifndef BLIS_BLAS_FAST_DIM_MAX
+  #define BLIS_BLAS_FAST_DIM_MAX 32
+#endif
+
 
 // -- CBLAS COMPATIBILITY LAYER ------------------------------------------------
 
@@ -63,6 +63,17 @@
 #define BLIS_THREAD_MAX_JR      4
 #endif
 
+// This BLIS_THREAD_MIN_NR_PANELS macro sets the smallest region of C that
+// is worth giving to a thread when the number of threads is reduced for
+// small problems under the blocksize model (BLIS_NT_MIN_WORK_BLKSZ): an
+// MC x ( BLIS_THREAD_MIN_NR_PANELS * NR ) block, i.e., one packed block of
+// A multiplied against that many micropanels of B per rank-KC update. The
+// default has not been tuned; test/other/test_nt_calib.c estimates it. See
+// bli_rntm.c to see how this macro is used.
+#ifndef BLIS_THREAD_MIN_NR_PANELS
+#define BLIS_THREAD_MIN_NR_PANELS 16
+#endif
+
 #if 0
 // -- Skinny/small possibly-unpacked (sup code path) values --
 
@@ -83,6 +94,22 @@
 #endif
 #endif
 
+// -- Banded and packed level-2 values --
+
+// The minimum number of matrix elements that the banded and packed level-2
+// operations (gbmv, hpmv, tpmv, hpr, etc.) give to each thread. Smaller
+// problems are run on proportionally fewer threads.
+#ifndef BLIS_THREAD_L2_MIN_ELEMS
+#define BLIS_THREAD_L2_MIN_ELEMS  65536
+#endif
+
+// Vectors shorter than this (as found within narrow bands) are processed
+// inline by the banded and packed level-2 operations rather than by a
+// level-1v kernel.
+#ifndef BLIS_BANDPACK_KER_MIN_LEN
+#define BLIS_BANDPACK_KER_MIN_LEN 16
+#endif
+
 
 // -- Memory allocation --------------------------------------------------------
 
@@ -198,6 +225,14 @@
 #define BLIS_STACK_BUF_ALIGN_SIZE        BLIS_SIMD_ALIGN_SIZE
 #endif
 
+// The size in bytes of each row and column of the square tiles into which
+// the matrix transpose operations (omatcopy and imatcopy) are blocked. A
+// source tile and a destination tile should fit in the L2 cache together.
+// NOTE: imatcopy keeps one full tile on the stack.
+#ifndef BLIS_TRANSM_TILE_SIZE
+#define BLIS_TRANSM_TILE_SIZE 512
+#endif
+
 // Alignment size used when allocating memory via BLIS_MALLOC_USER.
 // To disable heap alignment, set this to 1.
 #ifndef BLIS_HEAP_ADDR_ALIGN_SIZE
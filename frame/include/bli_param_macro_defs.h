@@ -1051,6 +1051,12 @@ BLIS_INLINE bool bli_is_1m_packed( pack_t schema )
 	         bli_is_1e_packed( schema ) );
 }
 
+BLIS_INLINE bool bli_is_bf16_packed( pack_t schema )
+{
+	return ( bool )
+	       ( ( schema & BLIS_PACK_FORMAT_BITS ) == BLIS_BITVAL_BF16 );
+}
+
 BLIS_INLINE bool bli_is_nat_packed( pack_t schema )
 {
 	return ( bool )
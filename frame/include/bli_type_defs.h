@@ -412,6 +412,7 @@ typedef void  (*free_ft)  ( void*  p    );
 #define   BLIS_BITVAL_RPI                   ( 0x7  << BLIS_PACK_FORMAT_SHIFT )
 #define   BLIS_BITVAL_1E                    ( 0x8  << BLIS_PACK_FORMAT_SHIFT )
 #define   BLIS_BITVAL_1R                    ( 0x9  << BLIS_PACK_FORMAT_SHIFT )
+#define   BLIS_BITVAL_BF16                  ( 0xA  << BLIS_PACK_FORMAT_SHIFT )
 #define   BLIS_BITVAL_PACKED_UNSPEC         ( BLIS_PACK_BIT                                                            )
 #define   BLIS_BITVAL_PACKED_ROWS           ( BLIS_PACK_BIT                                                            )
 #define   BLIS_BITVAL_PACKED_COLUMNS        ( BLIS_PACK_BIT                                         | BLIS_PACK_RC_BIT )
@@ -435,6 +436,8 @@ typedef void  (*free_ft)  ( void*  p    );
 #define   BLIS_BITVAL_PACKED_COL_PANELS_1E  ( BLIS_PACK_BIT | BLIS_BITVAL_1E  | BLIS_PACK_PANEL_BIT | BLIS_PACK_RC_BIT )
 #define   BLIS_BITVAL_PACKED_ROW_PANELS_1R  ( BLIS_PACK_BIT | BLIS_BITVAL_1R  | BLIS_PACK_PANEL_BIT                    )
 #define   BLIS_BITVAL_PACKED_COL_PANELS_1R  ( BLIS_PACK_BIT | BLIS_BITVAL_1R  | BLIS_PACK_PANEL_BIT | BLIS_PACK_RC_BIT )
+#define   BLIS_BITVAL_PACKED_ROW_PANELS_BF16 ( BLIS_PACK_BIT | BLIS_BITVAL_BF16 | BLIS_PACK_PANEL_BIT                    )
+#define   BLIS_BITVAL_PACKED_COL_PANELS_BF16 ( BLIS_PACK_BIT | BLIS_BITVAL_BF16 | BLIS_PACK_PANEL_BIT | BLIS_PACK_RC_BIT )
 #define BLIS_BITVAL_PACK_FWD_IF_UPPER         0x0
 #define BLIS_BITVAL_PACK_REV_IF_UPPER         BLIS_PACK_REV_IF_UPPER_BIT
 #define BLIS_BITVAL_PACK_FWD_IF_LOWER         0x0
@@ -559,14 +562,16 @@ typedef enum
 	BLIS_PACKED_ROW_PANELS_1E  = BLIS_BITVAL_PACKED_ROW_PANELS_1E,
 	BLIS_PACKED_COL_PANELS_1E  = BLIS_BITVAL_PACKED_COL_PANELS_1E,
 	BLIS_PACKED_ROW_PANELS_1R  = BLIS_BITVAL_PACKED_ROW_PANELS_1R,
-	BLIS_PACKED_COL_PANELS_1R  = BLIS_BITVAL_PACKED_COL_PANELS_1R
+	BLIS_PACKED_COL_PANELS_1R  = BLIS_BITVAL_PACKED_COL_PANELS_1R,
+	BLIS_PACKED_ROW_PANELS_BF16 = BLIS_BITVAL_PACKED_ROW_PANELS_BF16,
+	BLIS_PACKED_COL_PANELS_BF16 = BLIS_BITVAL_PACKED_COL_PANELS_BF16
 } pack_t;
 
 // We combine row and column packing into one "type", and we start
 // with BLIS_PACKED_ROW_PANELS, _COLUMN_PANELS. We also count the
 // schema pair for "4ms" (4m separated), because its bit value has
 // been reserved, even though we don't use it.
-#define BLIS_NUM_PACK_SCHEMA_TYPES 10
+#define BLIS_NUM_PACK_SCHEMA_TYPES 11
 
 
 // -- Pack order type --
@@ -689,21 +694,27 @@ typedef enum
 {
 	BLIS_ADDV_KER  = 0,
 	BLIS_AMAXV_KER,
+	BLIS_AMINV_KER,
+	BLIS_ASUMV_KER,
 	BLIS_AXPBYV_KER,
 	BLIS_AXPYV_KER,
 	BLIS_COPYV_KER,
 	BLIS_DOTV_KER,
 	BLIS_DOTXV_KER,
 	BLIS_INVERTV_KER,
+	BLIS_NORMFV_KER,
+	BLIS_ROTMV_KER,
+	BLIS_ROTV_KER,
 	BLIS_SCALV_KER,
 	BLIS_SCAL2V_KER,
 	BLIS_SETV_KER,
 	BLIS_SUBV_KER,
+	BLIS_SUMSQV_KER,
 	BLIS_SWAPV_KER,
 	BLIS_XPBYV_KER
 } l1vkr_t;
 
-#define BLIS_NUM_LEVEL1V_KERS 14
+#define BLIS_NUM_LEVEL1V_KERS 20
 
 
 typedef enum
@@ -798,10 +809,16 @@ typedef enum
 	BLIS_GEMMTRSM_L_UKR,
 	BLIS_GEMMTRSM_U_UKR,
 	BLIS_TRSM_L_UKR,
-	BLIS_TRSM_U_UKR
+	BLIS_TRSM_U_UKR,
+	BLIS_GEMMT_L_UKR,
+	BLIS_GEMMT_U_UKR,
+	BLIS_GEMM_EDGE_UKR,
+	BLIS_SPMM_CSR_UKR,
+	BLIS_GEMM_NT_UKR,
+	BLIS_GEMM_BF16B_UKR
 } l3ukr_t;
 
-#define BLIS_NUM_LEVEL3_UKRS 5
+#define BLIS_NUM_LEVEL3_UKRS 11
 
 
 typedef enum
@@ -1525,6 +1542,8 @@ typedef struct cntx_s
 	func_t    packm_kers[ BLIS_NUM_PACKM_KERS ];
 	func_t    unpackm_kers[ BLIS_NUM_UNPACKM_KERS ];
 
+	func_t    transm_ker;
+
 	ind_t     method;
 	pack_t    schema_a_block;
 	pack_t    schema_b_panel;
@@ -1533,8 +1552,39 @@ typedef struct cntx_s
 } cntx_t;
 
 
+// -- Profiling types --
+
+// These identify the execution phases for which time and call counts are
+// accumulated when BLIS is configured with --enable-profiling. Note that
+// the times are inclusive; for example, barrier and pba time spent within
+// bli_l3_packm() is also reflected in the packm total.
+
+typedef enum
+{
+	BLIS_PROF_PACKM = 0,
+	BLIS_PROF_KER,
+	BLIS_PROF_BARRIER,
+	BLIS_PROF_PBA,
+	BLIS_PROF_SUP,
+	BLIS_PROF_LARGE
+} profid_t;
+
+#define BLIS_NUM_PROF_IDS 6
+
+typedef struct prof_s
+{
+	double    time[ BLIS_NUM_PROF_IDS ];
+	uint64_t  count[ BLIS_NUM_PROF_IDS ];
+
+} prof_t;
+
+
 // -- Runtime type --
 
+// The value of the nt_min_work field that selects the blocksize-based
+// minimum amount of work per thread (see bli_rntm.c).
+#define BLIS_NT_MIN_WORK_BLKSZ -1
+
 // NOTE: The order of these fields must be kept consistent with the definition
 // of the BLIS_RNTM_INITIALIZER macro in bli_rntm.h.
 
@@ -1548,6 +1598,12 @@ typedef struct rntm_s
 	bool      pack_a; // enable/disable packing of left-hand matrix A.
 	bool      pack_b; // enable/disable packing of right-hand matrix B.
 	bool      l3_sup; // enable/disable small matrix handling in level-3 ops.
+	dim_t     strassen_levels; // levels of Strassen recursion for gemm.
+	prof_t*   prof;   // per-thread profiling records, or NULL.
+	dim_t     prof_n; // number of elements in the prof array.
+	dim_t     nt_min_work; // minimum m*n*k per thread; 0: none; -1: blocksize model.
+	bool      stream_c; // enable/disable non-temporal stores to C in gemm.
+	bool      pack_b_bf16; // enable/disable packing B as bfloat16 in sgemm.
 
 	// "Internal" fields: these should not be exposed to the end-user.
 
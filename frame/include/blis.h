@@ -110,6 +110,8 @@ extern "C" {
 #include "bli_cntx.h"
 #include "bli_rntm.h"
 #include "bli_gks.h"
+#include "bli_cntx_profile.h"
+#include "bli_cache.h"
 #include "bli_ind.h"
 #include "bli_pba.h"
 #include "bli_pool.h"
@@ -124,6 +126,9 @@ extern "C" {
 #include "bli_auxinfo.h"
 #include "bli_param_map.h"
 #include "bli_clock.h"
+#include "bli_prof.h"
+#include "bli_trace.h"
+#include "bli_capture.h"
 #include "bli_check.h"
 #include "bli_error.h"
 #include "bli_f2c.h"
@@ -110,6 +110,13 @@ void* bli_l3_thread_entry( void* data_void )
 	// Create the root node of the current thread's thrinfo_t structure.
 	bli_l3_thrinfo_create_root( tid, gl_comm, rntm_p, cntl_use, &thread );
 
+	// Reset the thread's profiling record, check out a trace ring buffer,
+	// and time the operation.
+	BLIS_PROF_THREAD_BEGIN();
+	BLIS_PROF_START( t_prof );
+	BLIS_TRACE_THREAD_BEGIN( tid );
+	BLIS_TRACE_START( t_trace );
+
 	func
 	(
 	  alpha,
@@ -123,6 +130,15 @@ void* bli_l3_thread_entry( void* data_void )
 	  thread
 	);
 
+	// Flush the thread's profiling record to the rntm_t and to the
+	// process-wide aggregate, and release the trace ring buffer.
+	BLIS_PROF_STOP( BLIS_PROF_LARGE, t_prof );
+	BLIS_PROF_THREAD_END( tid, rntm_p );
+	BLIS_TRACE_STOP( BLIS_TRACE_LARGE, t_trace,
+	                 bli_obj_length( &c_t ), bli_obj_width( &c_t ),
+	                 bli_obj_width_after_trans( &a_t ), 0, 0 );
+	BLIS_TRACE_THREAD_END();
+
 	// Free the thread's local control tree.
 	bli_l3_cntl_free( rntm_p, cntl_use, thread );
 
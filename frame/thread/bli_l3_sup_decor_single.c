@@ -110,6 +110,13 @@ err_t bli_l3_sup_thread_decorator
 		( void )tid;
 #endif
 
+		// Reset the thread's profiling record, check out a trace ring buffer,
+		// and time the operation.
+		BLIS_PROF_THREAD_BEGIN();
+		BLIS_PROF_START( t_prof );
+		BLIS_TRACE_THREAD_BEGIN( tid );
+		BLIS_TRACE_START( t_trace );
+
 		func
 		(
 		  alpha,
@@ -122,6 +129,15 @@ err_t bli_l3_sup_thread_decorator
 		  thread
 		);
 
+		// Flush the thread's profiling record to the rntm_t and to the
+		// process-wide aggregate, and release the trace ring buffer.
+		BLIS_PROF_STOP( BLIS_PROF_SUP, t_prof );
+		BLIS_PROF_THREAD_END( tid, rntm_p );
+		BLIS_TRACE_STOP( BLIS_TRACE_SUP, t_trace,
+		                 bli_obj_length( c ), bli_obj_width( c ),
+		                 bli_obj_width_after_trans( a ), 0, 0 );
+		BLIS_TRACE_THREAD_END();
+
 #ifndef SKIP_THRINFO_TREE
 		// Free the current thread's thrinfo_t structure.
 		bli_l3_sup_thrinfo_free( rntm_p, thread );
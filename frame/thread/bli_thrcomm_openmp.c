@@ -104,7 +104,13 @@ void bli_thrcomm_barrier( dim_t t_id, thrcomm_t* comm )
 		while ( *listener == my_sense ) {}
 	}
 #endif
+	BLIS_PROF_START( t_prof );
+	BLIS_TRACE_START( t_trace );
+
 	bli_thrcomm_barrier_atomic( t_id, comm );
+
+	BLIS_PROF_STOP( BLIS_PROF_BARRIER, t_prof );
+	BLIS_TRACE_STOP( BLIS_TRACE_BARRIER, t_trace, 0, 0, 0, 0, 0 );
 }
 
 #else
@@ -189,7 +195,13 @@ void bli_thrcomm_tree_barrier_free( barrier_t* barrier )
 
 void bli_thrcomm_barrier( dim_t t_id, thrcomm_t* comm )
 {
+	BLIS_PROF_START( t_prof );
+	BLIS_TRACE_START( t_trace );
+
 	bli_thrcomm_tree_barrier( comm->barriers[t_id] );
+
+	BLIS_PROF_STOP( BLIS_PROF_BARRIER, t_prof );
+	BLIS_TRACE_STOP( BLIS_TRACE_BARRIER, t_trace, 0, 0, 0, 0, 0 );
 }
 
 void bli_thrcomm_tree_barrier( barrier_t* barack )
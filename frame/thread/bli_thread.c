@@ -1554,6 +1554,14 @@ dim_t bli_thread_get_num_threads( void )
 	return bli_rntm_num_threads( &global_rntm );
 }
 
+dim_t bli_thread_get_nt_min_work( void )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	return bli_rntm_nt_min_work( &global_rntm );
+}
+
 // ----------------------------------------------------------------------------
 
 void bli_thread_set_ways( dim_t jc, dim_t pc, dim_t ic, dim_t jr, dim_t ir )
@@ -1584,6 +1592,20 @@ void bli_thread_set_num_threads( dim_t n_threads )
 	bli_pthread_mutex_unlock( &global_rntm_mutex );
 }
 
+void bli_thread_set_nt_min_work( dim_t work )
+{
+	// We must ensure that global_rntm has been initialized.
+	bli_init_once();
+
+	// Acquire the mutex protecting global_rntm.
+	bli_pthread_mutex_lock( &global_rntm_mutex );
+
+	bli_rntm_set_nt_min_work( work, &global_rntm );
+
+	// Release the mutex protecting global_rntm.
+	bli_pthread_mutex_unlock( &global_rntm_mutex );
+}
+
 // ----------------------------------------------------------------------------
 
 void bli_thread_init_rntm_from_env
@@ -1598,6 +1620,7 @@ void bli_thread_init_rntm_from_env
 	bool  auto_factor = FALSE;
 	dim_t nt;
 	dim_t jc, pc, ic, jr, ir;
+	dim_t nt_min_work = 0;
 
 #ifdef BLIS_ENABLE_MULTITHREADING
 
@@ -1641,6 +1664,11 @@ void bli_thread_init_rntm_from_env
 	// thread factorization (later, in bli_rntm.c).
 	if ( nt != -1 ) auto_factor = TRUE;
 
+	// Read the minimum amount of work (m*n*k) that each thread should
+	// receive when the number of threads is factored automatically. (A
+	// value of BLIS_NT_MIN_WORK_BLKSZ selects the blocksize model instead.)
+	nt_min_work = bli_env_get_var( "BLIS_NT_MIN_WORK", 0 );
+
 #else
 
 	// When multithreading is disabled, always set the rntm_t ways
@@ -1654,6 +1682,7 @@ void bli_thread_init_rntm_from_env
 	bli_rntm_set_auto_factor_only( auto_factor, rntm );
 	bli_rntm_set_num_threads_only( nt, rntm );
 	bli_rntm_set_ways_only( jc, pc, ic, jr, ir, rntm );
+	bli_rntm_set_nt_min_work( nt_min_work, rntm );
 
 #if 0
 	printf( "bli_thread_init_rntm_from_env()\n" );
@@ -57,6 +57,10 @@
 // for the sup code path.
 #include "bli_l3_sup_decor.h"
 
+// Include the generic thread launcher, which operations outside of level-3
+// use to spawn threads without a control tree or thrinfo_t tree.
+#include "bli_thread_launch.h"
+
 // Initialization-related prototypes.
 void bli_thread_init( void );
 void bli_thread_finalize( void );
@@ -201,9 +205,11 @@ BLIS_EXPORT_BLIS dim_t bli_thread_get_ic_nt( void );
 BLIS_EXPORT_BLIS dim_t bli_thread_get_jr_nt( void );
 BLIS_EXPORT_BLIS dim_t bli_thread_get_ir_nt( void );
 BLIS_EXPORT_BLIS dim_t bli_thread_get_num_threads( void );
+BLIS_EXPORT_BLIS dim_t bli_thread_get_nt_min_work( void );
 
 BLIS_EXPORT_BLIS void  bli_thread_set_ways( dim_t jc, dim_t pc, dim_t ic, dim_t jr, dim_t ir );
 BLIS_EXPORT_BLIS void  bli_thread_set_num_threads( dim_t value );
+BLIS_EXPORT_BLIS void  bli_thread_set_nt_min_work( dim_t work );
 
 void  bli_thread_init_rntm_from_env( rntm_t* rntm );
 
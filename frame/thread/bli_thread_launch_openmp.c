@@ -0,0 +1,87 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#ifdef BLIS_ENABLE_OPENMP
+
+void bli_thread_launch
+     (
+       dim_t         n_threads,
+       thread_func_t func,
+       const void*   params
+     )
+{
+	thrcomm_t gl_comm;
+
+	bli_thrcomm_init( n_threads, &gl_comm );
+
+	_Pragma( "omp parallel num_threads(n_threads)" )
+	{
+		const dim_t tid            = omp_get_thread_num();
+		const dim_t n_threads_real = omp_get_num_threads();
+
+		// If OpenMP did not create the requested number of threads (as
+		// happens, for example, when the caller is already executing within
+		// a parallel region and nesting is disabled), continue only if a
+		// single thread was created, and let it do all of the work. See
+		// bli_l3_thread_decorator_thread_check() for details.
+		if ( n_threads_real == n_threads )
+		{
+			func( &gl_comm, tid, params );
+		}
+		else if ( n_threads_real == 1 )
+		{
+			thrcomm_t gl_comm_1;
+
+			bli_thrcomm_init( 1, &gl_comm_1 );
+
+			func( &gl_comm_1, 0, params );
+
+			bli_thrcomm_cleanup( &gl_comm_1 );
+		}
+		else
+		{
+			bli_print_msg( "A different number of threads was "
+			               "created than was requested.",
+			               __FILE__, __LINE__ );
+			bli_abort();
+		}
+	}
+
+	bli_thrcomm_cleanup( &gl_comm );
+}
+
+#endif
+
@@ -0,0 +1,104 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#ifdef BLIS_ENABLE_PTHREADS
+
+// A data structure to assist in passing arguments to additional threads.
+typedef struct thread_launch_data
+{
+	thread_func_t func;
+	thrcomm_t*    gl_comm;
+	dim_t         tid;
+	const void*   params;
+} thread_launch_data_t;
+
+// Entry point for additional threads
+static void* bli_thread_launch_entry( void* data_void )
+{
+	thread_launch_data_t* data = data_void;
+
+	data->func( data->gl_comm, data->tid, data->params );
+
+	return NULL;
+}
+
+void bli_thread_launch
+     (
+       dim_t         n_threads,
+       thread_func_t func,
+       const void*   params
+     )
+{
+	err_t     r_val;
+	thrcomm_t gl_comm;
+
+	bli_thrcomm_init( n_threads, &gl_comm );
+
+	// Allocate an array of pthread objects and auxiliary data structs to pass
+	// to the thread entry functions.
+	bli_pthread_t*        pthreads = bli_malloc_intl( sizeof( bli_pthread_t ) * n_threads, &r_val );
+	thread_launch_data_t* datas    = bli_malloc_intl( sizeof( thread_launch_data_t ) * n_threads, &r_val );
+
+	// NOTE: We must iterate backwards so that the chief thread (thread id 0)
+	// can spawn all other threads before proceeding with its own computation.
+	for ( dim_t tid = n_threads - 1; 0 <= tid; tid-- )
+	{
+		datas[tid].func    = func;
+		datas[tid].gl_comm = &gl_comm;
+		datas[tid].tid     = tid;
+		datas[tid].params  = params;
+
+		// Spawn additional threads for ids greater than 1.
+		if ( tid != 0 )
+			bli_pthread_create( &pthreads[tid], NULL, &bli_thread_launch_entry, &datas[tid] );
+		else
+			bli_thread_launch_entry( ( void* )&datas[0] );
+	}
+
+	// Thread 0 waits for additional threads to finish.
+	for ( dim_t tid = 1; tid < n_threads; tid++ )
+	{
+		bli_pthread_join( pthreads[tid], NULL );
+	}
+
+	bli_free_intl( pthreads );
+	bli_free_intl( datas );
+
+	bli_thrcomm_cleanup( &gl_comm );
+}
+
+#endif
+
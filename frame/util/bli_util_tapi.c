@@ -64,7 +64,7 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 	} \
 \
 	/* Obtain a valid context from the gks if necessary. */ \
-	/*if ( cntx == NULL ) cntx = bli_gks_query_cntx();*/ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
 \
 	/* Invoke the helper variant, which loops over the appropriate kernel
 	   to implement the current operation. */ \
@@ -355,7 +355,7 @@ void PASTEMAC2(ch,opname,EX_SUF) \
 	if ( bli_zero_dim1( n ) ) return; \
 \
 	/* Obtain a valid context from the gks if necessary. */ \
-	/*if ( cntx == NULL ) cntx = bli_gks_query_cntx();*/ \
+	if ( cntx == NULL ) cntx = bli_gks_query_cntx(); \
 \
 	/* Invoke the helper variant, which loops over the appropriate kernel
 	   to implement the current operation. */ \
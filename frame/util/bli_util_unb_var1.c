@@ -52,33 +52,17 @@ void PASTEMAC(ch,varname) \
        rntm_t*  rntm  \
      ) \
 { \
-	ctype*   chi1; \
-	ctype_r  chi1_r; \
-	ctype_r  chi1_i; \
-	ctype_r  absum; \
-	dim_t    i; \
-\
-	/* Initialize the absolute sum accumulator to zero. */ \
-	PASTEMAC(chr,set0s)( absum ); \
-\
-	for ( i = 0; i < n; ++i ) \
-	{ \
-		chi1 = x + (i  )*incx; \
+	/* Query the context for the kernel function pointer. */ \
+	const num_t              dt      = PASTEMAC(ch,type); \
+	PASTECH(ch,asumv_ker_ft) asumv_p = bli_cntx_get_l1v_ker_dt( dt, BLIS_ASUMV_KER, cntx ); \
 \
-		/* Get the real and imaginary components of chi1. */ \
-		PASTEMAC2(ch,chr,gets)( *chi1, chi1_r, chi1_i ); \
-\
-		/* Replace chi1_r and chi1_i with their absolute values. */ \
-		chi1_r = bli_fabs( chi1_r ); \
-		chi1_i = bli_fabs( chi1_i ); \
-\
-		/* Accumulate the real and imaginary components into absum. */ \
-		PASTEMAC(chr,adds)( chi1_r, absum ); \
-		PASTEMAC(chr,adds)( chi1_i, absum ); \
-	} \
-\
-	/* Store the final value of absum to the output variable. */ \
-	PASTEMAC(chr,copys)( absum, *asum ); \
+	asumv_p \
+	( \
+	  n, \
+	  x, incx, \
+	  asum, \
+	  cntx  \
+	); \
 }
 
 INSERT_GENTFUNCR_BASIC0( asumv_unb_var1 )
@@ -266,7 +250,7 @@ INSERT_GENTFUNCR_BASIC0( norm1v_unb_var1 )
 
 
 #undef  GENTFUNCR
-#define GENTFUNCR( ctype, ctype_r, ch, chr, varname, kername ) \
+#define GENTFUNCR( ctype, ctype_r, ch, chr, varname ) \
 \
 void PASTEMAC(ch,varname) \
      ( \
@@ -277,170 +261,22 @@ void PASTEMAC(ch,varname) \
        rntm_t*  rntm  \
      ) \
 { \
-	ctype_r* zero       = PASTEMAC(chr,0); \
-	ctype_r* one        = PASTEMAC(chr,1); \
-	ctype_r  scale; \
-	ctype_r  sumsq; \
-	ctype_r  sqrt_sumsq; \
+	/* Query the context for the kernel function pointer. The kernel
+	   takes care not to overflow unnecessarily when the sum of the
+	   squares of x would overflow (see GitHub issue #332). */ \
+	const num_t               dt       = PASTEMAC(ch,type); \
+	PASTECH(ch,normfv_ker_ft) normfv_p = bli_cntx_get_l1v_ker_dt( dt, BLIS_NORMFV_KER, cntx ); \
 \
-	/* Initialize scale and sumsq to begin the summation. */ \
-	PASTEMAC(chr,copys)( *zero, scale ); \
-	PASTEMAC(chr,copys)( *one,  sumsq ); \
-\
-	/* Compute the sum of the squares of the vector. */ \
-	PASTEMAC(ch,kername) \
+	normfv_p \
 	( \
 	  n, \
 	  x, incx, \
-	  &scale, \
-	  &sumsq, \
-	  cntx, \
-	  rntm  \
+	  norm, \
+	  cntx  \
 	); \
-\
-	/* Compute: norm = scale * sqrt( sumsq ) */ \
-	PASTEMAC(chr,sqrt2s)( sumsq, sqrt_sumsq ); \
-	PASTEMAC(chr,scals)( scale, sqrt_sumsq ); \
-\
-	/* Store the final value to the output variable. */ \
-	PASTEMAC(chr,copys)( sqrt_sumsq, *norm ); \
 }
 
-//INSERT_GENTFUNCR_BASIC( normfv_unb_var1, sumsqv_unb_var1 )
-GENTFUNCR( scomplex, float,  c, s, normfv_unb_var1, sumsqv_unb_var1 )
-GENTFUNCR( dcomplex, double, z, d, normfv_unb_var1, sumsqv_unb_var1 )
-
-#undef  GENTFUNCR
-// We've disabled the dotv-based implementation because that method of
-// computing the sum of the squares of x inherently does not check for
-// overflow. Instead, we use the fallback method based on sumsqv, which
-// takes care to not overflow unnecessarily (ie: takes care for the
-// sqrt( sum of the squares of x ) to not overflow if the sum of the
-// squares of x would normally overflow. See GitHub issue #332 for
-// discussion.
-#if 0 //defined(FE_OVERFLOW) && !defined(__APPLE__)
-#define GENTFUNCR( ctype, ctype_r, ch, chr, varname, kername ) \
-\
-void PASTEMAC(ch,varname) \
-     ( \
-       dim_t    n, \
-       ctype*   x, inc_t incx, \
-       ctype_r* norm, \
-       cntx_t*  cntx, \
-       rntm_t*  rntm  \
-     ) \
-{ \
-	ctype_r* zero       = PASTEMAC(chr,0); \
-	ctype_r* one        = PASTEMAC(chr,1); \
-	ctype_r  scale; \
-	ctype_r  sumsq; \
-	ctype_r  sqrt_sumsq; \
-\
-	/* Initialize scale and sumsq to begin the summation. */ \
-	PASTEMAC(chr,copys)( *zero, scale ); \
-	PASTEMAC(chr,copys)( *one,  sumsq ); \
-\
-	/* An optimization: first try to use dotv to compute the sum of
-	   the squares of the vector. If no floating-point exceptions
-	   (specifically, overflow and invalid exceptions) were produced,
-	   then we accept the computed value and returne early. The cost
-	   of this optimization is the "sunk" cost of the initial dotv
-	   when sumsqv must be used instead. However, we expect that the
-	   vast majority of use cases will not produce exceptions, and
-	   therefore only one pass through the data, via dotv, will be
-	   required. */ \
-	if ( TRUE ) \
-	{ \
-		int      f_exp_raised;\
-		ctype    sumsqc; \
-\
-		feclearexcept( FE_ALL_EXCEPT );\
-\
-		PASTEMAC2(ch,dotv,BLIS_TAPI_EX_SUF) \
-		( \
-		  BLIS_NO_CONJUGATE, \
-		  BLIS_NO_CONJUGATE, \
-		  n,\
-		  x, incx, \
-		  x, incx, \
-		  &sumsqc, \
-		  cntx, \
-		  rntm  \
-		); \
-\
-		PASTEMAC2(ch,chr,copys)( sumsqc, sumsq ); \
-\
-		f_exp_raised = fetestexcept( FE_OVERFLOW | FE_INVALID );\
-\
-		if ( !f_exp_raised ) \
-		{ \
-		    PASTEMAC(chr,sqrt2s)( sumsq, *norm ); \
-		    return; \
-		} \
-	} \
-\
-	/* Compute the sum of the squares of the vector. */ \
-	PASTEMAC(ch,kername) \
-	( \
-	  n, \
-	  x, incx, \
-	  &scale, \
-	  &sumsq, \
-	  cntx, \
-	  rntm  \
-	); \
-\
-	/* Compute: norm = scale * sqrt( sumsq ) */ \
-	PASTEMAC(chr,sqrt2s)( sumsq, sqrt_sumsq ); \
-	PASTEMAC(chr,scals)( scale, sqrt_sumsq ); \
-\
-	/* Store the final value to the output variable. */ \
-	PASTEMAC(chr,copys)( sqrt_sumsq, *norm ); \
-}
-#else
-#define GENTFUNCR( ctype, ctype_r, ch, chr, varname, kername ) \
-\
-void PASTEMAC(ch,varname) \
-     ( \
-       dim_t    n, \
-       ctype*   x, inc_t incx, \
-       ctype_r* norm, \
-       cntx_t*  cntx, \
-       rntm_t*  rntm  \
-     ) \
-{ \
-	ctype_r* zero       = PASTEMAC(chr,0); \
-	ctype_r* one        = PASTEMAC(chr,1); \
-	ctype_r  scale; \
-	ctype_r  sumsq; \
-	ctype_r  sqrt_sumsq; \
-\
-	/* Initialize scale and sumsq to begin the summation. */ \
-	PASTEMAC(chr,copys)( *zero, scale ); \
-	PASTEMAC(chr,copys)( *one,  sumsq ); \
-\
-	/* Compute the sum of the squares of the vector. */ \
-\
-	PASTEMAC(ch,kername) \
-	( \
-	  n, \
-	  x, incx, \
-	  &scale, \
-	  &sumsq, \
-	  cntx, \
-	  rntm  \
-	); \
-\
-	/* Compute: norm = scale * sqrt( sumsq ) */ \
-	PASTEMAC(chr,sqrt2s)( sumsq, sqrt_sumsq ); \
-	PASTEMAC(chr,scals)( scale, sqrt_sumsq ); \
-\
-	/* Store the final value to the output variable. */ \
-	PASTEMAC(chr,copys)( sqrt_sumsq, *norm ); \
-}
-#endif
-GENTFUNCR( float,   float,  s, s, normfv_unb_var1, sumsqv_unb_var1 )
-GENTFUNCR( double,  double, d, d, normfv_unb_var1, sumsqv_unb_var1 )
+INSERT_GENTFUNCR_BASIC0( normfv_unb_var1 )
 
 
 #undef  GENTFUNCR
@@ -1059,79 +895,18 @@ void PASTEMAC(ch,varname) \
        rntm_t*  rntm  \
      ) \
 { \
-	const ctype_r zero_r = *PASTEMAC(chr,0); \
-	const ctype_r one_r  = *PASTEMAC(chr,1); \
-\
-	ctype*        chi1; \
-	ctype_r       chi1_r; \
-	ctype_r       chi1_i; \
-	ctype_r       scale_r; \
-	ctype_r       sumsq_r; \
-	ctype_r       abs_chi1_r; \
-	dim_t         i; \
-\
-	/* NOTE: This function attempts to mimic the algorithm for computing
-	   the Frobenius norm in netlib LAPACK's ?lassq(). */ \
-\
-	/* Copy scale and sumsq to local variables. */ \
-	PASTEMAC(chr,copys)( *scale, scale_r ); \
-	PASTEMAC(chr,copys)( *sumsq, sumsq_r ); \
-\
-	chi1 = x; \
-\
-	for ( i = 0; i < n; ++i ) \
-	{ \
-		/* Get the real and imaginary components of chi1. */ \
-		PASTEMAC2(ch,chr,gets)( *chi1, chi1_r, chi1_i ); \
-\
-		abs_chi1_r = bli_fabs( chi1_r ); \
-\
-		/* Accumulate real component into sumsq, adjusting scale if
-		   needed. */ \
-		if ( abs_chi1_r > zero_r || bli_isnan( abs_chi1_r) ) \
-		{ \
-			if ( scale_r < abs_chi1_r ) \
-			{ \
-				sumsq_r = one_r + \
-				          sumsq_r * ( scale_r / abs_chi1_r ) * \
-				                    ( scale_r / abs_chi1_r );  \
-\
-				PASTEMAC(chr,copys)( abs_chi1_r, scale_r ); \
-			} \
-			else \
-			{ \
-				sumsq_r = sumsq_r + ( abs_chi1_r / scale_r ) * \
-				                    ( abs_chi1_r / scale_r );  \
-			} \
-		} \
-\
-		abs_chi1_r = bli_fabs( chi1_i ); \
-\
-		/* Accumulate imaginary component into sumsq, adjusting scale if
-		   needed. */ \
-		if ( abs_chi1_r > zero_r || bli_isnan( abs_chi1_r) ) \
-		{ \
-			if ( scale_r < abs_chi1_r ) \
-			{ \
-				sumsq_r = one_r + \
-				          sumsq_r * ( scale_r / abs_chi1_r ) * \
-				                    ( scale_r / abs_chi1_r );  \
-\
-				PASTEMAC(chr,copys)( abs_chi1_r, scale_r ); \
-			} \
-			else \
-			{ \
-				sumsq_r = sumsq_r + ( abs_chi1_r / scale_r ) * \
-				                    ( abs_chi1_r / scale_r );  \
-			} \
-		} \
-\
-		chi1 += incx; \
-	} \
+	/* Query the context for the kernel function pointer. */ \
+	const num_t               dt       = PASTEMAC(ch,type); \
+	PASTECH(ch,sumsqv_ker_ft) sumsqv_p = bli_cntx_get_l1v_ker_dt( dt, BLIS_SUMSQV_KER, cntx ); \
 \
-	/* Store final values of scale and sumsq to output variables. */ \
-	PASTEMAC(chr,copys)( scale_r, *scale ); \
-	PASTEMAC(chr,copys)( sumsq_r, *sumsq ); \
+	sumsqv_p \
+	( \
+	  n, \
+	  x, incx, \
+	  scale, \
+	  sumsq, \
+	  cntx  \
+	); \
 }
 
 INSERT_GENTFUNCR_BASIC0( sumsqv_unb_var1 )
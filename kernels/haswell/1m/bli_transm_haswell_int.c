@@ -0,0 +1,220 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "immintrin.h"
+#include "blis.h"
+
+// Matrix transpose kernels: B := alpha * A^T, where A is an m x n tile
+// stored by columns and B is an n x m tile stored by columns. The tile is
+// swept in 8x8 (s) or 4x4 (d) blocks: each block is loaded one column of A
+// per register, transposed in registers with unpack/shuffle/permute
+// instructions, scaled, and stored one column of B per register. Rows and
+// columns left over at the edges are handled with scalar code. The caller
+// (the transm variant) chooses tiles that fit in the L2 cache.
+
+static inline void bli_stransm_haswell_int_edge
+     (
+       dim_t              m,
+       dim_t              n,
+       float              alpha,
+       float*    restrict a, inc_t lda,
+       float*    restrict b, inc_t ldb
+     )
+{
+	for ( dim_t j = 0; j < n; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+		b[ j + i*ldb ] = alpha * a[ i + j*lda ];
+}
+
+void bli_stransm_haswell_int_8x8
+     (
+       conj_t              conja,
+       dim_t               m,
+       dim_t               n,
+       float*     restrict alpha,
+       float*     restrict a, inc_t lda,
+       float*     restrict b, inc_t ldb,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t  m8     = m - m % 8;
+	const dim_t  n8     = n - n % 8;
+
+	const __m256 alphav = _mm256_broadcast_ss( alpha );
+
+	for ( dim_t j = 0; j < n8; j += 8 )
+	{
+		float* restrict aj = a + j*lda;
+		float* restrict bj = b + j;
+
+		for ( dim_t i = 0; i < m8; i += 8 )
+		{
+			float* restrict aij = aj + i;
+			float* restrict bji = bj + i*ldb;
+
+			// Load eight columns of A.
+			__m256 r0 = _mm256_loadu_ps( aij + 0*lda );
+			__m256 r1 = _mm256_loadu_ps( aij + 1*lda );
+			__m256 r2 = _mm256_loadu_ps( aij + 2*lda );
+			__m256 r3 = _mm256_loadu_ps( aij + 3*lda );
+			__m256 r4 = _mm256_loadu_ps( aij + 4*lda );
+			__m256 r5 = _mm256_loadu_ps( aij + 5*lda );
+			__m256 r6 = _mm256_loadu_ps( aij + 6*lda );
+			__m256 r7 = _mm256_loadu_ps( aij + 7*lda );
+
+			// Interleave pairs of columns.
+			__m256 t0 = _mm256_unpacklo_ps( r0, r1 );
+			__m256 t1 = _mm256_unpackhi_ps( r0, r1 );
+			__m256 t2 = _mm256_unpacklo_ps( r2, r3 );
+			__m256 t3 = _mm256_unpackhi_ps( r2, r3 );
+			__m256 t4 = _mm256_unpacklo_ps( r4, r5 );
+			__m256 t5 = _mm256_unpackhi_ps( r4, r5 );
+			__m256 t6 = _mm256_unpacklo_ps( r6, r7 );
+			__m256 t7 = _mm256_unpackhi_ps( r6, r7 );
+
+			// Gather four-element pieces of rows (i,i+4), (i+1,i+5), ...
+			r0 = _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+			r1 = _mm256_shuffle_ps( t0, t2, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+			r2 = _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+			r3 = _mm256_shuffle_ps( t1, t3, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+			r4 = _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+			r5 = _mm256_shuffle_ps( t4, t6, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+			r6 = _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 1, 0, 1, 0 ) );
+			r7 = _mm256_shuffle_ps( t5, t7, _MM_SHUFFLE( 3, 2, 3, 2 ) );
+
+			// Join the halves of each row of A, which are columns of B.
+			t0 = _mm256_permute2f128_ps( r0, r4, 0x20 );
+			t1 = _mm256_permute2f128_ps( r1, r5, 0x20 );
+			t2 = _mm256_permute2f128_ps( r2, r6, 0x20 );
+			t3 = _mm256_permute2f128_ps( r3, r7, 0x20 );
+			t4 = _mm256_permute2f128_ps( r0, r4, 0x31 );
+			t5 = _mm256_permute2f128_ps( r1, r5, 0x31 );
+			t6 = _mm256_permute2f128_ps( r2, r6, 0x31 );
+			t7 = _mm256_permute2f128_ps( r3, r7, 0x31 );
+
+			_mm256_storeu_ps( bji + 0*ldb, _mm256_mul_ps( alphav, t0 ) );
+			_mm256_storeu_ps( bji + 1*ldb, _mm256_mul_ps( alphav, t1 ) );
+			_mm256_storeu_ps( bji + 2*ldb, _mm256_mul_ps( alphav, t2 ) );
+			_mm256_storeu_ps( bji + 3*ldb, _mm256_mul_ps( alphav, t3 ) );
+			_mm256_storeu_ps( bji + 4*ldb, _mm256_mul_ps( alphav, t4 ) );
+			_mm256_storeu_ps( bji + 5*ldb, _mm256_mul_ps( alphav, t5 ) );
+			_mm256_storeu_ps( bji + 6*ldb, _mm256_mul_ps( alphav, t6 ) );
+			_mm256_storeu_ps( bji + 7*ldb, _mm256_mul_ps( alphav, t7 ) );
+		}
+
+		if ( m8 < m )
+			bli_stransm_haswell_int_edge( m - m8, 8, *alpha,
+			                              aj + m8, lda, bj + m8*ldb, ldb );
+	}
+
+	if ( n8 < n )
+		bli_stransm_haswell_int_edge( m, n - n8, *alpha,
+		                              a + n8*lda, lda, b + n8, ldb );
+}
+
+static inline void bli_dtransm_haswell_int_edge
+     (
+       dim_t              m,
+       dim_t              n,
+       double             alpha,
+       double*   restrict a, inc_t lda,
+       double*   restrict b, inc_t ldb
+     )
+{
+	for ( dim_t j = 0; j < n; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+		b[ j + i*ldb ] = alpha * a[ i + j*lda ];
+}
+
+void bli_dtransm_haswell_int_4x4
+     (
+       conj_t              conja,
+       dim_t               m,
+       dim_t               n,
+       double*    restrict alpha,
+       double*    restrict a, inc_t lda,
+       double*    restrict b, inc_t ldb,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t   m4     = m - m % 4;
+	const dim_t   n4     = n - n % 4;
+
+	const __m256d alphav = _mm256_broadcast_sd( alpha );
+
+	for ( dim_t j = 0; j < n4; j += 4 )
+	{
+		double* restrict aj = a + j*lda;
+		double* restrict bj = b + j;
+
+		for ( dim_t i = 0; i < m4; i += 4 )
+		{
+			double* restrict aij = aj + i;
+			double* restrict bji = bj + i*ldb;
+
+			// Load four columns of A.
+			__m256d r0 = _mm256_loadu_pd( aij + 0*lda );
+			__m256d r1 = _mm256_loadu_pd( aij + 1*lda );
+			__m256d r2 = _mm256_loadu_pd( aij + 2*lda );
+			__m256d r3 = _mm256_loadu_pd( aij + 3*lda );
+
+			// Interleave pairs of columns.
+			__m256d t0 = _mm256_unpacklo_pd( r0, r1 );
+			__m256d t1 = _mm256_unpackhi_pd( r0, r1 );
+			__m256d t2 = _mm256_unpacklo_pd( r2, r3 );
+			__m256d t3 = _mm256_unpackhi_pd( r2, r3 );
+
+			// Join the halves of each row of A, which are columns of B.
+			r0 = _mm256_permute2f128_pd( t0, t2, 0x20 );
+			r1 = _mm256_permute2f128_pd( t1, t3, 0x20 );
+			r2 = _mm256_permute2f128_pd( t0, t2, 0x31 );
+			r3 = _mm256_permute2f128_pd( t1, t3, 0x31 );
+
+			_mm256_storeu_pd( bji + 0*ldb, _mm256_mul_pd( alphav, r0 ) );
+			_mm256_storeu_pd( bji + 1*ldb, _mm256_mul_pd( alphav, r1 ) );
+			_mm256_storeu_pd( bji + 2*ldb, _mm256_mul_pd( alphav, r2 ) );
+			_mm256_storeu_pd( bji + 3*ldb, _mm256_mul_pd( alphav, r3 ) );
+		}
+
+		if ( m4 < m )
+			bli_dtransm_haswell_int_edge( m - m4, 4, *alpha,
+			                              aj + m4, lda, bj + m4*ldb, ldb );
+	}
+
+	if ( n4 < n )
+		bli_dtransm_haswell_int_edge( m, n - n4, *alpha,
+		                              a + n4*lda, lda, b + n4, ldb );
+}
+
@@ -0,0 +1,181 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2016 - 2019, Advanced Micro Devices, Inc.
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#include "immintrin.h"
+#include "blis.h"
+
+// A gemm microkernel for the haswell 6x16 (s) register blocking that reads
+// micropanels of B packed in bfloat16 (schema BLIS_PACKED_COL_PANELS_BF16)
+// and accumulates in float. Each row of a B micropanel holds 16 bfloat16
+// elements (32 bytes), half of what the float microkernel loads. Widening
+// to float only requires moving each element into the upper half of a
+// 32-bit lane, which is done with one byte shuffle per eight elements from
+// a 128-bit broadcast load; this keeps the conversion off of the ports
+// that execute the FMAs.
+
+void bli_sgemm_bf16b_haswell_int_6x16
+     (
+       dim_t               k,
+       float*     restrict alpha,
+       float*     restrict a,
+       float*     restrict b,
+       float*     restrict beta,
+       float*     restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t mr = 6;
+	const dim_t nr = 16;
+
+	const uint16_t* restrict bp = ( const uint16_t* )b;
+
+	// Zero the low 16 bits of each 32-bit lane and fill the high 16 bits
+	// with elements 0-3 (low 128-bit lane) or 4-7 (high 128-bit lane) of
+	// the eight bfloat16 elements broadcast to both 128-bit lanes.
+	const __m256i widen = _mm256_setr_epi8
+	(
+	  -1, -1,  0,  1, -1, -1,  2,  3, -1, -1,  4,  5, -1, -1,  6,  7,
+	  -1, -1,  8,  9, -1, -1, 10, 11, -1, -1, 12, 13, -1, -1, 14, 15
+	);
+
+	__m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+	__m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+	__m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+	__m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+	__m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+	__m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+
+	if ( cs_c == 1 )
+	{
+		for ( dim_t i = 0; i < mr; ++i )
+			_mm_prefetch( ( char* )( c + i*rs_c ), _MM_HINT_T0 );
+	}
+
+	for ( dim_t l = 0; l < k; ++l )
+	{
+		_mm_prefetch( ( char* )( a + 8*mr ), _MM_HINT_T0 );
+
+		const __m256i bl = _mm256_broadcastsi128_si256( _mm_loadu_si128( ( __m128i* )( bp + 0 ) ) );
+		const __m256i bh = _mm256_broadcastsi128_si256( _mm_loadu_si128( ( __m128i* )( bp + 8 ) ) );
+		const __m256  b0 = _mm256_castsi256_ps( _mm256_shuffle_epi8( bl, widen ) );
+		const __m256  b1 = _mm256_castsi256_ps( _mm256_shuffle_epi8( bh, widen ) );
+		__m256        ai;
+
+		ai  = _mm256_broadcast_ss( a + 0 );
+		c00 = _mm256_fmadd_ps( ai, b0, c00 );
+		c01 = _mm256_fmadd_ps( ai, b1, c01 );
+		ai  = _mm256_broadcast_ss( a + 1 );
+		c10 = _mm256_fmadd_ps( ai, b0, c10 );
+		c11 = _mm256_fmadd_ps( ai, b1, c11 );
+		ai  = _mm256_broadcast_ss( a + 2 );
+		c20 = _mm256_fmadd_ps( ai, b0, c20 );
+		c21 = _mm256_fmadd_ps( ai, b1, c21 );
+		ai  = _mm256_broadcast_ss( a + 3 );
+		c30 = _mm256_fmadd_ps( ai, b0, c30 );
+		c31 = _mm256_fmadd_ps( ai, b1, c31 );
+		ai  = _mm256_broadcast_ss( a + 4 );
+		c40 = _mm256_fmadd_ps( ai, b0, c40 );
+		c41 = _mm256_fmadd_ps( ai, b1, c41 );
+		ai  = _mm256_broadcast_ss( a + 5 );
+		c50 = _mm256_fmadd_ps( ai, b0, c50 );
+		c51 = _mm256_fmadd_ps( ai, b1, c51 );
+
+		a  += mr;
+		bp += nr;
+	}
+
+	// Scale the accumulated product by alpha and store it to a row-stored
+	// temporary tile.
+	float ab[ 6 * 16 ] __attribute__((aligned(32)));
+
+	const __m256 alphav = _mm256_broadcast_ss( alpha );
+
+	_mm256_store_ps( ab +  0, _mm256_mul_ps( alphav, c00 ) );
+	_mm256_store_ps( ab +  8, _mm256_mul_ps( alphav, c01 ) );
+	_mm256_store_ps( ab + 16, _mm256_mul_ps( alphav, c10 ) );
+	_mm256_store_ps( ab + 24, _mm256_mul_ps( alphav, c11 ) );
+	_mm256_store_ps( ab + 32, _mm256_mul_ps( alphav, c20 ) );
+	_mm256_store_ps( ab + 40, _mm256_mul_ps( alphav, c21 ) );
+	_mm256_store_ps( ab + 48, _mm256_mul_ps( alphav, c30 ) );
+	_mm256_store_ps( ab + 56, _mm256_mul_ps( alphav, c31 ) );
+	_mm256_store_ps( ab + 64, _mm256_mul_ps( alphav, c40 ) );
+	_mm256_store_ps( ab + 72, _mm256_mul_ps( alphav, c41 ) );
+	_mm256_store_ps( ab + 80, _mm256_mul_ps( alphav, c50 ) );
+	_mm256_store_ps( ab + 88, _mm256_mul_ps( alphav, c51 ) );
+
+	// Update C, taking care not to read C when beta is zero so that any
+	// infs or NaNs it contains are not propagated.
+	if ( cs_c == 1 )
+	{
+		if ( bli_seq0( *beta ) )
+		{
+			for ( dim_t i = 0; i < mr; ++i )
+			{
+				_mm256_storeu_ps( c + i*rs_c + 0, _mm256_load_ps( ab + i*nr + 0 ) );
+				_mm256_storeu_ps( c + i*rs_c + 8, _mm256_load_ps( ab + i*nr + 8 ) );
+			}
+		}
+		else
+		{
+			const __m256 betav = _mm256_broadcast_ss( beta );
+
+			for ( dim_t i = 0; i < mr; ++i )
+			{
+				float* restrict ci = c + i*rs_c;
+
+				_mm256_storeu_ps( ci + 0, _mm256_fmadd_ps( betav, _mm256_loadu_ps( ci + 0 ),
+				                                           _mm256_load_ps( ab + i*nr + 0 ) ) );
+				_mm256_storeu_ps( ci + 8, _mm256_fmadd_ps( betav, _mm256_loadu_ps( ci + 8 ),
+				                                           _mm256_load_ps( ab + i*nr + 8 ) ) );
+			}
+		}
+	}
+	else
+	{
+		if ( bli_seq0( *beta ) )
+		{
+			for ( dim_t j = 0; j < nr; ++j )
+			for ( dim_t i = 0; i < mr; ++i )
+				c[ i*rs_c + j*cs_c ] = ab[ i*nr + j ];
+		}
+		else
+		{
+			for ( dim_t j = 0; j < nr; ++j )
+			for ( dim_t i = 0; i < mr; ++i )
+				c[ i*rs_c + j*cs_c ] = *beta * c[ i*rs_c + j*cs_c ] + ab[ i*nr + j ];
+		}
+	}
+}
+
@@ -0,0 +1,252 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2016 - 2019, Advanced Micro Devices, Inc.
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#include "immintrin.h"
+#include "blis.h"
+
+// Masked-edge gemm microkernels for the haswell 6x16 (s) and 6x8 (d)
+// register blockings. These are invoked by the gemm macrokernel for edge
+// tiles where m < MR and/or n < NR. The k-loop consumes the same micropanel
+// formats as the corresponding full-tile assembly kernels, but rather than
+// writing an MR x NR tile to a temporary buffer that is then copied into C,
+// only the m x n submatrix of C is updated. When C is row-stored this is
+// done with masked loads/stores; otherwise the elements are updated one at
+// a time. Rows at or beyond m are never touched.
+
+static inline __m256i bli_gemm_edge_haswell_mask_epi64( dim_t j0, dim_t n )
+{
+	// Enable lane j when j0 + j < n.
+	const __m256i idx = _mm256_set_epi64x( 3, 2, 1, 0 );
+
+	return _mm256_cmpgt_epi64( _mm256_set1_epi64x( n - j0 ), idx );
+}
+
+static inline __m256i bli_gemm_edge_haswell_mask_epi32( dim_t j0, dim_t n )
+{
+	// Enable lane j when j0 + j < n.
+	const __m256i idx = _mm256_set_epi32( 7, 6, 5, 4, 3, 2, 1, 0 );
+
+	return _mm256_cmpgt_epi32( _mm256_set1_epi32( ( int )( n - j0 ) ), idx );
+}
+
+void bli_dgemm_edge_haswell_int_6x8
+     (
+       dim_t               m,
+       dim_t               n,
+       dim_t               k,
+       double*    restrict alpha,
+       double*    restrict a,
+       double*    restrict b,
+       double*    restrict beta,
+       double*    restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t mr     = 6;
+	const dim_t nr     = 8;
+
+	const inc_t packmr = bli_cntx_get_blksz_max_dt( BLIS_DOUBLE, BLIS_MR, cntx );
+	const inc_t packnr = bli_cntx_get_blksz_max_dt( BLIS_DOUBLE, BLIS_NR, cntx );
+
+	__m256d ab[ 6 ][ 2 ];
+
+	for ( dim_t i = 0; i < mr; ++i )
+	{
+		ab[ i ][ 0 ] = _mm256_setzero_pd();
+		ab[ i ][ 1 ] = _mm256_setzero_pd();
+	}
+
+	for ( dim_t l = 0; l < k; ++l )
+	{
+		__m256d b0 = _mm256_loadu_pd( b + 0 );
+		__m256d b1 = _mm256_loadu_pd( b + 4 );
+
+		for ( dim_t i = 0; i < mr; ++i )
+		{
+			__m256d ai = _mm256_broadcast_sd( a + i );
+
+			ab[ i ][ 0 ] = _mm256_fmadd_pd( ai, b0, ab[ i ][ 0 ] );
+			ab[ i ][ 1 ] = _mm256_fmadd_pd( ai, b1, ab[ i ][ 1 ] );
+		}
+
+		a += packmr;
+		b += packnr;
+	}
+
+	// Scale by alpha and spill the accumulators so that the rows can be
+	// indexed below without forcing them out of registers in the k loop.
+	const __m256d alphav = _mm256_broadcast_sd( alpha );
+
+	double abt[ 6 * 8 ] __attribute__((aligned(32)));
+
+	for ( dim_t i = 0; i < mr; ++i )
+	{
+		_mm256_store_pd( abt + i*nr + 0, _mm256_mul_pd( alphav, ab[ i ][ 0 ] ) );
+		_mm256_store_pd( abt + i*nr + 4, _mm256_mul_pd( alphav, ab[ i ][ 1 ] ) );
+	}
+
+	const bool beta0 = bli_deq0( *beta );
+
+	if ( cs_c == 1 )
+	{
+		const __m256d betav = _mm256_broadcast_sd( beta );
+		const __m256i m0    = bli_gemm_edge_haswell_mask_epi64( 0, n );
+		const __m256i m1    = bli_gemm_edge_haswell_mask_epi64( 4, n );
+
+		for ( dim_t i = 0; i < m; ++i )
+		{
+			double* restrict ci = c + i*rs_c;
+			__m256d          v0 = _mm256_load_pd( abt + i*nr + 0 );
+			__m256d          v1 = _mm256_load_pd( abt + i*nr + 4 );
+
+			if ( !beta0 )
+			{
+				v0 = _mm256_fmadd_pd( betav, _mm256_maskload_pd( ci + 0, m0 ), v0 );
+				v1 = _mm256_fmadd_pd( betav, _mm256_maskload_pd( ci + 4, m1 ), v1 );
+			}
+
+			_mm256_maskstore_pd( ci + 0, m0, v0 );
+			_mm256_maskstore_pd( ci + 4, m1, v1 );
+		}
+	}
+	else if ( beta0 )
+	{
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < m; ++i )
+			c[ i*rs_c + j*cs_c ] = abt[ i*nr + j ];
+	}
+	else
+	{
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < m; ++i )
+			c[ i*rs_c + j*cs_c ] = abt[ i*nr + j ] + (*beta) * c[ i*rs_c + j*cs_c ];
+	}
+}
+
+void bli_sgemm_edge_haswell_int_6x16
+     (
+       dim_t               m,
+       dim_t               n,
+       dim_t               k,
+       float*     restrict alpha,
+       float*     restrict a,
+       float*     restrict b,
+       float*     restrict beta,
+       float*     restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t mr     = 6;
+	const dim_t nr     = 16;
+
+	const inc_t packmr = bli_cntx_get_blksz_max_dt( BLIS_FLOAT, BLIS_MR, cntx );
+	const inc_t packnr = bli_cntx_get_blksz_max_dt( BLIS_FLOAT, BLIS_NR, cntx );
+
+	__m256 ab[ 6 ][ 2 ];
+
+	for ( dim_t i = 0; i < mr; ++i )
+	{
+		ab[ i ][ 0 ] = _mm256_setzero_ps();
+		ab[ i ][ 1 ] = _mm256_setzero_ps();
+	}
+
+	for ( dim_t l = 0; l < k; ++l )
+	{
+		__m256 b0 = _mm256_loadu_ps( b + 0 );
+		__m256 b1 = _mm256_loadu_ps( b + 8 );
+
+		for ( dim_t i = 0; i < mr; ++i )
+		{
+			__m256 ai = _mm256_broadcast_ss( a + i );
+
+			ab[ i ][ 0 ] = _mm256_fmadd_ps( ai, b0, ab[ i ][ 0 ] );
+			ab[ i ][ 1 ] = _mm256_fmadd_ps( ai, b1, ab[ i ][ 1 ] );
+		}
+
+		a += packmr;
+		b += packnr;
+	}
+
+	// Scale by alpha and spill the accumulators so that the rows can be
+	// indexed below without forcing them out of registers in the k loop.
+	const __m256 alphav = _mm256_broadcast_ss( alpha );
+
+	float abt[ 6 * 16 ] __attribute__((aligned(32)));
+
+	for ( dim_t i = 0; i < mr; ++i )
+	{
+		_mm256_store_ps( abt + i*nr + 0, _mm256_mul_ps( alphav, ab[ i ][ 0 ] ) );
+		_mm256_store_ps( abt + i*nr + 8, _mm256_mul_ps( alphav, ab[ i ][ 1 ] ) );
+	}
+
+	const bool beta0 = bli_seq0( *beta );
+
+	if ( cs_c == 1 )
+	{
+		const __m256  betav = _mm256_broadcast_ss( beta );
+		const __m256i m0    = bli_gemm_edge_haswell_mask_epi32( 0, n );
+		const __m256i m1    = bli_gemm_edge_haswell_mask_epi32( 8, n );
+
+		for ( dim_t i = 0; i < m; ++i )
+		{
+			float* restrict ci = c + i*rs_c;
+			__m256          v0 = _mm256_load_ps( abt + i*nr + 0 );
+			__m256          v1 = _mm256_load_ps( abt + i*nr + 8 );
+
+			if ( !beta0 )
+			{
+				v0 = _mm256_fmadd_ps( betav, _mm256_maskload_ps( ci + 0, m0 ), v0 );
+				v1 = _mm256_fmadd_ps( betav, _mm256_maskload_ps( ci + 8, m1 ), v1 );
+			}
+
+			_mm256_maskstore_ps( ci + 0, m0, v0 );
+			_mm256_maskstore_ps( ci + 8, m1, v1 );
+		}
+	}
+	else if ( beta0 )
+	{
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < m; ++i )
+			c[ i*rs_c + j*cs_c ] = abt[ i*nr + j ];
+	}
+	else
+	{
+		for ( dim_t j = 0; j < n; ++j )
+		for ( dim_t i = 0; i < m; ++i )
+			c[ i*rs_c + j*cs_c ] = abt[ i*nr + j ] + (*beta) * c[ i*rs_c + j*cs_c ];
+	}
+}
+
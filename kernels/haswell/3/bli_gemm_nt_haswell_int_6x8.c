@@ -0,0 +1,119 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2016 - 2019, Advanced Micro Devices, Inc.
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#include "immintrin.h"
+#include "blis.h"
+
+// Streaming-store gemm microkernels for the haswell 6x16 (s) and 6x8 (d)
+// register blockings. These are invoked by the gemm macrokernel for full
+// tiles when streaming stores to C have been requested and beta is zero.
+// The tile is computed by the assembly microkernel into an aligned
+// temporary buffer, from which each row (one 64-byte cache line) is written
+// to C with non-temporal stores. This avoids reading the cache lines of C
+// (read-for-ownership) and keeps them from displacing A and B in the cache
+// hierarchy. If beta is nonzero, or if the rows of C are not contiguous and
+// 64-byte aligned, the assembly microkernel updates C directly.
+//
+// NOTE: Non-temporal stores are weakly ordered. Rather than fencing after
+// every tile, the gemm macrokernel issues a single store fence after its
+// last tile (see bli_gemm_stream_fence()).
+
+void bli_dgemm_nt_haswell_int_6x8
+     (
+       dim_t               k,
+       double*    restrict alpha,
+       double*    restrict a,
+       double*    restrict b,
+       double*    restrict beta,
+       double*    restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t mr = 6;
+	const dim_t nr = 8;
+
+	if ( !bli_deq0( *beta ) || cs_c != 1 ||
+	     ( ( uintptr_t )c % 64 ) != 0 ||
+	     ( ( rs_c * sizeof( double ) ) % 64 ) != 0 )
+	{
+		bli_dgemm_haswell_asm_6x8( k, alpha, a, b, beta, c, rs_c, cs_c, data, cntx );
+		return;
+	}
+
+	double ct[ 6 * 8 ] __attribute__((aligned(64)));
+
+	bli_dgemm_haswell_asm_6x8( k, alpha, a, b, beta, ct, nr, 1, data, cntx );
+
+	for ( dim_t i = 0; i < mr; ++i )
+	{
+		_mm256_stream_pd( c + i*rs_c + 0, _mm256_load_pd( ct + i*nr + 0 ) );
+		_mm256_stream_pd( c + i*rs_c + 4, _mm256_load_pd( ct + i*nr + 4 ) );
+	}
+}
+
+void bli_sgemm_nt_haswell_int_6x16
+     (
+       dim_t               k,
+       float*     restrict alpha,
+       float*     restrict a,
+       float*     restrict b,
+       float*     restrict beta,
+       float*     restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t mr = 6;
+	const dim_t nr = 16;
+
+	if ( !bli_seq0( *beta ) || cs_c != 1 ||
+	     ( ( uintptr_t )c % 64 ) != 0 ||
+	     ( ( rs_c * sizeof( float ) ) % 64 ) != 0 )
+	{
+		bli_sgemm_haswell_asm_6x16( k, alpha, a, b, beta, c, rs_c, cs_c, data, cntx );
+		return;
+	}
+
+	float ct[ 6 * 16 ] __attribute__((aligned(64)));
+
+	bli_sgemm_haswell_asm_6x16( k, alpha, a, b, beta, ct, nr, 1, data, cntx );
+
+	for ( dim_t i = 0; i < mr; ++i )
+	{
+		_mm256_stream_ps( c + i*rs_c + 0, _mm256_load_ps( ct + i*nr + 0 ) );
+		_mm256_stream_ps( c + i*rs_c + 8, _mm256_load_ps( ct + i*nr + 8 ) );
+	}
+}
+
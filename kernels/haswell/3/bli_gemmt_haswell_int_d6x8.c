@@ -0,0 +1,288 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2016 - 2019, Advanced Micro Devices, Inc.
+   Copyright (C) 2018, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#include "immintrin.h"
+#include "blis.h"
+
+// Triangle-aware 6x8 gemm microkernels for tiles of C that intersect the
+// diagonal. The k loop consumes the same micropanel formats as
+// bli_dgemm_haswell_asm_6x8. A four-column half of the tile that lies
+// entirely within the unstored triangle is neither computed nor stored.
+// The elements of each row that lie on or below (gemmt_l) or on or above
+// (gemmt_u) the diagonal are then written to C straight from the
+// accumulators, using masked loads/stores when C is row-stored.
+
+#define MR 6
+#define NR 8
+
+static inline __m256i bli_dgemmt_haswell_mask
+     (
+       __m256i idx,
+       dim_t   j0,
+       dim_t   j1
+     )
+{
+	// Enable lane j when j0 <= j < j1.
+	__m256i lo = _mm256_cmpgt_epi64( _mm256_set1_epi64x( j0 ), idx );
+	__m256i hi = _mm256_cmpgt_epi64( _mm256_set1_epi64x( j1 ), idx );
+
+	return _mm256_andnot_si256( lo, hi );
+}
+
+// Accumulate row i of the rank-1 update at offset p of the micropanels into
+// the halves of the tile selected by do0 (columns 0-3) and do1 (columns 4-7).
+#define BLIS_DGEMMT_HASWELL_FMA_ROW( i, p ) \
+{ \
+	const __m256d ai = _mm256_broadcast_sd( a + (p)*MR + (i) ); \
+\
+	if ( do0 ) ab##i##_0 = _mm256_fmadd_pd( ai, b0, ab##i##_0 ); \
+	if ( do1 ) ab##i##_1 = _mm256_fmadd_pd( ai, b1, ab##i##_1 ); \
+}
+
+#define BLIS_DGEMMT_HASWELL_RANK1( p ) \
+{ \
+	__m256d b0 = _mm256_setzero_pd(); \
+	__m256d b1 = _mm256_setzero_pd(); \
+\
+	if ( do0 ) b0 = _mm256_loadu_pd( b + (p)*NR + 0 ); \
+	if ( do1 ) b1 = _mm256_loadu_pd( b + (p)*NR + 4 ); \
+\
+	BLIS_DGEMMT_HASWELL_FMA_ROW( 0, p ) \
+	BLIS_DGEMMT_HASWELL_FMA_ROW( 1, p ) \
+	BLIS_DGEMMT_HASWELL_FMA_ROW( 2, p ) \
+	BLIS_DGEMMT_HASWELL_FMA_ROW( 3, p ) \
+	BLIS_DGEMMT_HASWELL_FMA_ROW( 4, p ) \
+	BLIS_DGEMMT_HASWELL_FMA_ROW( 5, p ) \
+}
+
+// Update the elements of row i of C that lie in the stored triangle, i.e.
+// columns [j0,j1), from the accumulators of that row.
+#define BLIS_DGEMMT_HASWELL_UPDATE_ROW( i ) \
+if ( (i) < m ) \
+{ \
+	const dim_t j0 = ( lower ? 0 : bli_max( 0, diagoff + (i) ) ); \
+	const dim_t j1 = bli_min( NR, lower ? bli_min( n, diagoff + (i) + 1 ) : n ); \
+\
+	double* restrict ci = c + (i)*rs_c; \
+	__m256d          v0 = _mm256_mul_pd( alphav, ab##i##_0 ); \
+	__m256d          v1 = _mm256_mul_pd( alphav, ab##i##_1 ); \
+\
+	if ( j1 > j0 && cs_c == 1 ) \
+	{ \
+		const __m256i m0 = bli_dgemmt_haswell_mask( idx0, j0, j1 ); \
+		const __m256i m1 = bli_dgemmt_haswell_mask( idx1, j0, j1 ); \
+\
+		if ( do0 ) \
+		{ \
+			if ( !beta0 ) v0 = _mm256_fmadd_pd( betav, _mm256_maskload_pd( ci + 0, m0 ), v0 ); \
+			_mm256_maskstore_pd( ci + 0, m0, v0 ); \
+		} \
+		if ( do1 ) \
+		{ \
+			if ( !beta0 ) v1 = _mm256_fmadd_pd( betav, _mm256_maskload_pd( ci + 4, m1 ), v1 ); \
+			_mm256_maskstore_pd( ci + 4, m1, v1 ); \
+		} \
+	} \
+	else if ( j1 > j0 ) \
+	{ \
+		/* The elements of the row are not contiguous in C, so they are
+		   updated one at a time from a copy of the row. */ \
+		double t[ NR ] __attribute__((aligned(32))); \
+\
+		_mm256_store_pd( t + 0, v0 ); \
+		_mm256_store_pd( t + 4, v1 ); \
+\
+		if ( beta0 ) \
+			for ( dim_t j = j0; j < j1; ++j ) \
+				ci[ j*cs_c ] = t[ j ]; \
+		else \
+			for ( dim_t j = j0; j < j1; ++j ) \
+				ci[ j*cs_c ] = t[ j ] + (*beta) * ci[ j*cs_c ]; \
+	} \
+}
+
+// The body of the kernel. Callers pass constants for do0 and do1, so that
+// each combination is compiled with only the accumulators it needs. These
+// are named variables rather than an array so that they are kept in
+// registers through the k loop and the updates of C.
+static inline __attribute__((always_inline)) void bli_dgemmt_haswell_int_6x8_var
+     (
+       const bool       do0,
+       const bool       do1,
+       bool             lower,
+       doff_t           diagoff,
+       dim_t            m,
+       dim_t            n,
+       dim_t            k,
+       double* restrict alpha,
+       double* restrict a,
+       double* restrict b,
+       double* restrict beta,
+       double* restrict c, inc_t rs_c, inc_t cs_c,
+       cntx_t* restrict cntx
+     )
+{
+	// As in the assembly kernel, the micropanels of A and B are assumed to
+	// be packed with leading dimensions MR and NR.
+	__m256d ab0_0 = _mm256_setzero_pd(), ab0_1 = _mm256_setzero_pd();
+	__m256d ab1_0 = _mm256_setzero_pd(), ab1_1 = _mm256_setzero_pd();
+	__m256d ab2_0 = _mm256_setzero_pd(), ab2_1 = _mm256_setzero_pd();
+	__m256d ab3_0 = _mm256_setzero_pd(), ab3_1 = _mm256_setzero_pd();
+	__m256d ab4_0 = _mm256_setzero_pd(), ab4_1 = _mm256_setzero_pd();
+	__m256d ab5_0 = _mm256_setzero_pd(), ab5_1 = _mm256_setzero_pd();
+
+	const dim_t k_iter = k / 4;
+	const dim_t k_left = k % 4;
+
+	for ( dim_t l = 0; l < k_iter; ++l )
+	{
+		BLIS_DGEMMT_HASWELL_RANK1( 0 )
+		BLIS_DGEMMT_HASWELL_RANK1( 1 )
+		BLIS_DGEMMT_HASWELL_RANK1( 2 )
+		BLIS_DGEMMT_HASWELL_RANK1( 3 )
+
+		a += 4*MR;
+		b += 4*NR;
+	}
+
+	for ( dim_t l = 0; l < k_left; ++l )
+	{
+		BLIS_DGEMMT_HASWELL_RANK1( 0 )
+
+		a += MR;
+		b += NR;
+	}
+
+	const __m256d alphav = _mm256_broadcast_sd( alpha );
+	const __m256d betav  = _mm256_broadcast_sd( beta );
+	const bool    beta0  = bli_deq0( *beta );
+
+	const __m256i idx0   = _mm256_set_epi64x( 3, 2, 1, 0 );
+	const __m256i idx1   = _mm256_set_epi64x( 7, 6, 5, 4 );
+
+	// Update the stored elements of each row of C.
+	BLIS_DGEMMT_HASWELL_UPDATE_ROW( 0 )
+	BLIS_DGEMMT_HASWELL_UPDATE_ROW( 1 )
+	BLIS_DGEMMT_HASWELL_UPDATE_ROW( 2 )
+	BLIS_DGEMMT_HASWELL_UPDATE_ROW( 3 )
+	BLIS_DGEMMT_HASWELL_UPDATE_ROW( 4 )
+	BLIS_DGEMMT_HASWELL_UPDATE_ROW( 5 )
+}
+
+#undef BLIS_DGEMMT_HASWELL_FMA_ROW
+#undef BLIS_DGEMMT_HASWELL_RANK1
+#undef BLIS_DGEMMT_HASWELL_UPDATE_ROW
+
+static inline void bli_dgemmt_haswell_int_6x8
+     (
+       bool             lower,
+       doff_t           diagoff,
+       dim_t            m,
+       dim_t            n,
+       dim_t            k,
+       double* restrict alpha,
+       double* restrict a,
+       double* restrict b,
+       double* restrict beta,
+       double* restrict c, inc_t rs_c, inc_t cs_c,
+       cntx_t* restrict cntx
+     )
+{
+	// Determine which halves of the tile hold stored elements. Below the
+	// diagonal, the stored columns are [0,diagoff+m); above it, they are
+	// [diagoff,n). Since the tile intersects the diagonal, at least one
+	// half is needed.
+	bool do0, do1;
+
+	if ( lower ) { do0 = TRUE;                do1 = ( bli_min( n, diagoff + m ) > NR/2 ); }
+	else         { do0 = ( diagoff < NR/2 ); do1 = ( n > NR/2 ); }
+
+	if ( do0 && do1 )
+		bli_dgemmt_haswell_int_6x8_var( TRUE,  TRUE,  lower, diagoff, m, n, k,
+		                                alpha, a, b, beta, c, rs_c, cs_c, cntx );
+	else if ( do0 )
+		bli_dgemmt_haswell_int_6x8_var( TRUE,  FALSE, lower, diagoff, m, n, k,
+		                                alpha, a, b, beta, c, rs_c, cs_c, cntx );
+	else
+		bli_dgemmt_haswell_int_6x8_var( FALSE, TRUE,  lower, diagoff, m, n, k,
+		                                alpha, a, b, beta, c, rs_c, cs_c, cntx );
+}
+
+void bli_dgemmt_l_haswell_int_6x8
+     (
+       doff_t              diagoff,
+       dim_t               m,
+       dim_t               n,
+       dim_t               k,
+       double*    restrict alpha,
+       double*    restrict a,
+       double*    restrict b,
+       double*    restrict beta,
+       double*    restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	bli_dgemmt_haswell_int_6x8
+	(
+	  TRUE, diagoff, m, n, k,
+	  alpha, a, b, beta,
+	  c, rs_c, cs_c,
+	  cntx
+	);
+}
+
+void bli_dgemmt_u_haswell_int_6x8
+     (
+       doff_t              diagoff,
+       dim_t               m,
+       dim_t               n,
+       dim_t               k,
+       double*    restrict alpha,
+       double*    restrict a,
+       double*    restrict b,
+       double*    restrict beta,
+       double*    restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	bli_dgemmt_haswell_int_6x8
+	(
+	  FALSE, diagoff, m, n, k,
+	  alpha, a, b, beta,
+	  c, rs_c, cs_c,
+	  cntx
+	);
+}
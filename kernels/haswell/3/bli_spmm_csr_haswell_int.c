@@ -0,0 +1,319 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// Sparse (csr) times dense microkernels for packed micropanels of B that
+// are 16 (s) or 8 (d) elements wide, matching the NR of the haswell 6x16
+// and 6x8 gemm microkernels. Each row of the panel fits in two ymm
+// registers. Rows of A are processed four at a time: while all four rows
+// still have nonzeros left, their updates are interleaved so that eight
+// independent chains of FMAs are in flight, which hides the FMA latency
+// that a single row (two chains) would expose. The remaining nonzeros of
+// each row, and any leftover rows, are then handled one row at a time.
+//
+// The kernels always load full panel rows, so they rely on rs_b (the
+// packed panel width) being at least 16 (s) or 8 (d); columns at or beyond
+// n are computed but never stored.
+
+static inline void bli_dspmm_csr_haswell_int_rows
+     (
+       const dim_t         mr,
+       dim_t               n,
+       double*    restrict alpha,
+       double*    restrict a_val, inc_t* restrict a_ptr, dim_t* restrict a_ind,
+       double*    restrict b, inc_t rs_b,
+       double*    restrict beta,
+       double*    restrict c, inc_t rs_c, inc_t cs_c
+     )
+{
+	__m256d ab[ 4 ][ 2 ];
+	inc_t   p0[ 4 ];
+	inc_t   p1[ 4 ];
+	inc_t   kmin = a_ptr[ 1 ] - a_ptr[ 0 ];
+
+	for ( dim_t r = 0; r < mr; ++r )
+	{
+		ab[ r ][ 0 ] = _mm256_setzero_pd();
+		ab[ r ][ 1 ] = _mm256_setzero_pd();
+
+		p0[ r ] = a_ptr[ r ];
+		p1[ r ] = a_ptr[ r + 1 ];
+		kmin    = bli_min( kmin, p1[ r ] - p0[ r ] );
+	}
+
+	// Interleave the rows for as long as all of them have nonzeros left.
+	for ( inc_t t = 0; t < kmin; ++t )
+	{
+		for ( dim_t r = 0; r < mr; ++r )
+		{
+			const inc_t   p   = p0[ r ] + t;
+			const double* b_l = b + a_ind[ p ]*rs_b;
+			const __m256d a_p = _mm256_broadcast_sd( a_val + p );
+
+			ab[ r ][ 0 ] = _mm256_fmadd_pd( a_p, _mm256_loadu_pd( b_l + 0 ), ab[ r ][ 0 ] );
+			ab[ r ][ 1 ] = _mm256_fmadd_pd( a_p, _mm256_loadu_pd( b_l + 4 ), ab[ r ][ 1 ] );
+		}
+	}
+
+	// Finish off each row individually.
+	for ( dim_t r = 0; r < mr; ++r )
+	{
+		for ( inc_t p = p0[ r ] + kmin; p < p1[ r ]; ++p )
+		{
+			const double* b_l = b + a_ind[ p ]*rs_b;
+			const __m256d a_p = _mm256_broadcast_sd( a_val + p );
+
+			ab[ r ][ 0 ] = _mm256_fmadd_pd( a_p, _mm256_loadu_pd( b_l + 0 ), ab[ r ][ 0 ] );
+			ab[ r ][ 1 ] = _mm256_fmadd_pd( a_p, _mm256_loadu_pd( b_l + 4 ), ab[ r ][ 1 ] );
+		}
+	}
+
+	const __m256d alphav = _mm256_broadcast_sd( alpha );
+	const __m256d betav  = _mm256_broadcast_sd( beta );
+	const bool    beta0  = bli_deq0( *beta );
+
+	for ( dim_t r = 0; r < mr; ++r )
+	{
+		ab[ r ][ 0 ] = _mm256_mul_pd( alphav, ab[ r ][ 0 ] );
+		ab[ r ][ 1 ] = _mm256_mul_pd( alphav, ab[ r ][ 1 ] );
+	}
+
+	if ( cs_c == 1 && n == 8 )
+	{
+		// Row-stored C and a full panel: update each row with vector
+		// loads and stores.
+		for ( dim_t r = 0; r < mr; ++r )
+		{
+			double* restrict c_r = c + r*rs_c;
+
+			if ( !beta0 )
+			{
+				ab[ r ][ 0 ] = _mm256_fmadd_pd( betav, _mm256_loadu_pd( c_r + 0 ), ab[ r ][ 0 ] );
+				ab[ r ][ 1 ] = _mm256_fmadd_pd( betav, _mm256_loadu_pd( c_r + 4 ), ab[ r ][ 1 ] );
+			}
+
+			_mm256_storeu_pd( c_r + 0, ab[ r ][ 0 ] );
+			_mm256_storeu_pd( c_r + 4, ab[ r ][ 1 ] );
+		}
+	}
+	else
+	{
+		// Otherwise, spill the accumulators and update C one element at a
+		// time, walking down the columns of the mr x n block.
+		double abt[ 4 * 8 ] __attribute__((aligned(32)));
+
+		for ( dim_t r = 0; r < mr; ++r )
+		{
+			_mm256_store_pd( abt + r*8 + 0, ab[ r ][ 0 ] );
+			_mm256_store_pd( abt + r*8 + 4, ab[ r ][ 1 ] );
+		}
+
+		const dim_t n_use = bli_min( n, 8 );
+
+		if ( beta0 )
+		{
+			for ( dim_t j = 0; j < n_use; ++j )
+			for ( dim_t r = 0; r < mr; ++r )
+				c[ r*rs_c + j*cs_c ] = abt[ r*8 + j ];
+		}
+		else
+		{
+			for ( dim_t j = 0; j < n_use; ++j )
+			for ( dim_t r = 0; r < mr; ++r )
+				c[ r*rs_c + j*cs_c ] = (*beta) * c[ r*rs_c + j*cs_c ] + abt[ r*8 + j ];
+		}
+	}
+}
+
+void bli_dspmm_csr_haswell_int_8
+     (
+       dim_t               m,
+       dim_t               n,
+       double*    restrict alpha,
+       double*    restrict a_val, inc_t* restrict a_ptr, dim_t* restrict a_ind,
+       double*    restrict b, inc_t rs_b,
+       double*    restrict beta,
+       double*    restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	dim_t i = 0;
+
+	for ( ; i + 4 <= m; i += 4 )
+		bli_dspmm_csr_haswell_int_rows( 4, n, alpha, a_val, a_ptr + i, a_ind,
+		                                b, rs_b, beta, c + i*rs_c, rs_c, cs_c );
+
+	for ( ; i < m; ++i )
+		bli_dspmm_csr_haswell_int_rows( 1, n, alpha, a_val, a_ptr + i, a_ind,
+		                                b, rs_b, beta, c + i*rs_c, rs_c, cs_c );
+}
+
+
+static inline void bli_sspmm_csr_haswell_int_rows
+     (
+       const dim_t         mr,
+       dim_t               n,
+       float*     restrict alpha,
+       float*     restrict a_val, inc_t* restrict a_ptr, dim_t* restrict a_ind,
+       float*     restrict b, inc_t rs_b,
+       float*     restrict beta,
+       float*     restrict c, inc_t rs_c, inc_t cs_c
+     )
+{
+	__m256 ab[ 4 ][ 2 ];
+	inc_t  p0[ 4 ];
+	inc_t  p1[ 4 ];
+	inc_t  kmin = a_ptr[ 1 ] - a_ptr[ 0 ];
+
+	for ( dim_t r = 0; r < mr; ++r )
+	{
+		ab[ r ][ 0 ] = _mm256_setzero_ps();
+		ab[ r ][ 1 ] = _mm256_setzero_ps();
+
+		p0[ r ] = a_ptr[ r ];
+		p1[ r ] = a_ptr[ r + 1 ];
+		kmin    = bli_min( kmin, p1[ r ] - p0[ r ] );
+	}
+
+	// Interleave the rows for as long as all of them have nonzeros left.
+	for ( inc_t t = 0; t < kmin; ++t )
+	{
+		for ( dim_t r = 0; r < mr; ++r )
+		{
+			const inc_t  p   = p0[ r ] + t;
+			const float* b_l = b + a_ind[ p ]*rs_b;
+			const __m256 a_p = _mm256_broadcast_ss( a_val + p );
+
+			ab[ r ][ 0 ] = _mm256_fmadd_ps( a_p, _mm256_loadu_ps( b_l + 0 ), ab[ r ][ 0 ] );
+			ab[ r ][ 1 ] = _mm256_fmadd_ps( a_p, _mm256_loadu_ps( b_l + 8 ), ab[ r ][ 1 ] );
+		}
+	}
+
+	// Finish off each row individually.
+	for ( dim_t r = 0; r < mr; ++r )
+	{
+		for ( inc_t p = p0[ r ] + kmin; p < p1[ r ]; ++p )
+		{
+			const float* b_l = b + a_ind[ p ]*rs_b;
+			const __m256 a_p = _mm256_broadcast_ss( a_val + p );
+
+			ab[ r ][ 0 ] = _mm256_fmadd_ps( a_p, _mm256_loadu_ps( b_l + 0 ), ab[ r ][ 0 ] );
+			ab[ r ][ 1 ] = _mm256_fmadd_ps( a_p, _mm256_loadu_ps( b_l + 8 ), ab[ r ][ 1 ] );
+		}
+	}
+
+	const __m256 alphav = _mm256_broadcast_ss( alpha );
+	const __m256 betav  = _mm256_broadcast_ss( beta );
+	const bool   beta0  = bli_seq0( *beta );
+
+	for ( dim_t r = 0; r < mr; ++r )
+	{
+		ab[ r ][ 0 ] = _mm256_mul_ps( alphav, ab[ r ][ 0 ] );
+		ab[ r ][ 1 ] = _mm256_mul_ps( alphav, ab[ r ][ 1 ] );
+	}
+
+	if ( cs_c == 1 && n == 16 )
+	{
+		// Row-stored C and a full panel: update each row with vector
+		// loads and stores.
+		for ( dim_t r = 0; r < mr; ++r )
+		{
+			float* restrict c_r = c + r*rs_c;
+
+			if ( !beta0 )
+			{
+				ab[ r ][ 0 ] = _mm256_fmadd_ps( betav, _mm256_loadu_ps( c_r + 0 ), ab[ r ][ 0 ] );
+				ab[ r ][ 1 ] = _mm256_fmadd_ps( betav, _mm256_loadu_ps( c_r + 8 ), ab[ r ][ 1 ] );
+			}
+
+			_mm256_storeu_ps( c_r + 0, ab[ r ][ 0 ] );
+			_mm256_storeu_ps( c_r + 8, ab[ r ][ 1 ] );
+		}
+	}
+	else
+	{
+		// Otherwise, spill the accumulators and update C one element at a
+		// time, walking down the columns of the mr x n block.
+		float abt[ 4 * 16 ] __attribute__((aligned(32)));
+
+		for ( dim_t r = 0; r < mr; ++r )
+		{
+			_mm256_store_ps( abt + r*16 + 0, ab[ r ][ 0 ] );
+			_mm256_store_ps( abt + r*16 + 8, ab[ r ][ 1 ] );
+		}
+
+		const dim_t n_use = bli_min( n, 16 );
+
+		if ( beta0 )
+		{
+			for ( dim_t j = 0; j < n_use; ++j )
+			for ( dim_t r = 0; r < mr; ++r )
+				c[ r*rs_c + j*cs_c ] = abt[ r*16 + j ];
+		}
+		else
+		{
+			for ( dim_t j = 0; j < n_use; ++j )
+			for ( dim_t r = 0; r < mr; ++r )
+				c[ r*rs_c + j*cs_c ] = (*beta) * c[ r*rs_c + j*cs_c ] + abt[ r*16 + j ];
+		}
+	}
+}
+
+void bli_sspmm_csr_haswell_int_16
+     (
+       dim_t               m,
+       dim_t               n,
+       float*     restrict alpha,
+       float*     restrict a_val, inc_t* restrict a_ptr, dim_t* restrict a_ind,
+       float*     restrict b, inc_t rs_b,
+       float*     restrict beta,
+       float*     restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	dim_t i = 0;
+
+	for ( ; i + 4 <= m; i += 4 )
+		bli_sspmm_csr_haswell_int_rows( 4, n, alpha, a_val, a_ptr + i, a_ind,
+		                                b, rs_b, beta, c + i*rs_c, rs_c, cs_c );
+
+	for ( ; i < m; ++i )
+		bli_sspmm_csr_haswell_int_rows( 1, n, alpha, a_val, a_ptr + i, a_ind,
+		                                b, rs_b, beta, c + i*rs_c, rs_c, cs_c );
+}
+
@@ -48,6 +48,10 @@ PACKM_KER_PROT( scomplex, c, packm_haswell_asm_8xk )
 PACKM_KER_PROT( dcomplex, z, packm_haswell_asm_3xk )
 PACKM_KER_PROT( dcomplex, z, packm_haswell_asm_4xk )
 
+// transm (int 8x8/4x4)
+TRANSM_KER_PROT( float,    s, transm_haswell_int_8x8 )
+TRANSM_KER_PROT( double,   d, transm_haswell_int_4x4 )
+
 
 // -- level-3 ------------------------------------------------------------------
 
@@ -71,6 +75,25 @@ GEMMTRSM_UKR_PROT( double,   d, gemmtrsm_l_haswell_asm_6x8 )
 GEMMTRSM_UKR_PROT( float,    s, gemmtrsm_u_haswell_asm_6x16 )
 GEMMTRSM_UKR_PROT( double,   d, gemmtrsm_u_haswell_asm_6x8 )
 
+// gemmt_l/u (int d6x8)
+GEMMT_UKR_PROT( double,   d, gemmt_l_haswell_int_6x8 )
+GEMMT_UKR_PROT( double,   d, gemmt_u_haswell_int_6x8 )
+
+// gemm_edge (int 6x16/6x8)
+GEMM_EDGE_UKR_PROT( float,    s, gemm_edge_haswell_int_6x16 )
+GEMM_EDGE_UKR_PROT( double,   d, gemm_edge_haswell_int_6x8 )
+
+// gemm_nt (int 6x16/6x8)
+GEMM_UKR_PROT( float,    s, gemm_nt_haswell_int_6x16 )
+GEMM_UKR_PROT( double,   d, gemm_nt_haswell_int_6x8 )
+
+// gemm_bf16b (int 6x16)
+GEMM_UKR_PROT( float,    s, gemm_bf16b_haswell_int_6x16 )
+
+// spmm_csr (int 16/8)
+SPMM_CSR_UKR_PROT( float,    s, spmm_csr_haswell_int_16 )
+SPMM_CSR_UKR_PROT( double,   d, spmm_csr_haswell_int_8 )
+
 
 // gemm (asm d8x6)
 //GEMM_UKR_PROT( float,    s, gemm_haswell_asm_16x6 )
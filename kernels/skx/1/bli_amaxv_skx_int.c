@@ -0,0 +1,351 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// Search kernels (amaxv and aminv).
+//
+// All kernels share one search routine per precision. The routine finds the
+// first element of x whose "score" is largest, where the score is the
+// absolute value (|re| + |im| for complex elements, as in the reference
+// kernels) for amaxv and its negation for aminv. Negation turns the
+// smallest absolute value into the largest score without changing which
+// elements compare equal. As in the reference kernels, the index of the
+// first NaN is returned if x contains one.
+//
+// Lane indices are kept in 32-bit integers (single precision) or 64-bit
+// integers (double precision), so x is searched in blocks of at most
+// AMXV_BLOCK elements whose results are then combined.
+
+#define AMXV_BLOCK ( ( dim_t )1 << 30 )
+
+static float bli_sabs1_skx_int( float* x, dim_t i, inc_t incx, bool is_cmplx )
+{
+	if ( is_cmplx ) return fabsf( x[ 2*i*incx ] ) + fabsf( x[ 2*i*incx + 1 ] );
+	else            return fabsf( x[   i*incx ] );
+}
+
+static double bli_dabs1_skx_int( double* x, dim_t i, inc_t incx, bool is_cmplx )
+{
+	if ( is_cmplx ) return fabs( x[ 2*i*incx ] ) + fabs( x[ 2*i*incx + 1 ] );
+	else            return fabs( x[   i*incx ] );
+}
+
+// Return the absolute values of the first m <= 16 elements at x, in order.
+// The remaining lanes are zero. Complex elements are deinterleaved first.
+static __m512 bli_sabs16_skx_int( float* x, dim_t m, bool is_cmplx )
+{
+	if ( is_cmplx )
+	{
+		const __m512i   even = _mm512_setr_epi32(  0,  2,  4,  6,  8, 10, 12, 14,
+		                                          16, 18, 20, 22, 24, 26, 28, 30 );
+		const __m512i   odd  = _mm512_setr_epi32(  1,  3,  5,  7,  9, 11, 13, 15,
+		                                          17, 19, 21, 23, 25, 27, 29, 31 );
+		const dim_t     m2   = 2 * m;
+		const __mmask16 k0   = ( m2 >= 16 ? 0xFFFF : ( __mmask16 )( ( 1u << m2 ) - 1 ) );
+		const __mmask16 k1   = ( m2 >= 32 ? 0xFFFF :
+		                         m2 <= 16 ? 0      : ( __mmask16 )( ( 1u << ( m2 - 16 ) ) - 1 ) );
+
+		const __m512 x0 = _mm512_abs_ps( _mm512_maskz_loadu_ps( k0, x +  0 ) );
+		const __m512 x1 = _mm512_abs_ps( _mm512_maskz_loadu_ps( k1, x + 16 ) );
+
+		return _mm512_add_ps( _mm512_permutex2var_ps( x0, even, x1 ),
+		                      _mm512_permutex2var_ps( x0, odd,  x1 ) );
+	}
+	else
+	{
+		const __mmask16 k = ( m >= 16 ? 0xFFFF : ( __mmask16 )( ( 1u << m ) - 1 ) );
+
+		return _mm512_abs_ps( _mm512_maskz_loadu_ps( k, x ) );
+	}
+}
+
+// Return the absolute values of the first m <= 8 elements at x, in order.
+// The remaining lanes are zero. Complex elements are deinterleaved first.
+static __m512d bli_dabs8_skx_int( double* x, dim_t m, bool is_cmplx )
+{
+	if ( is_cmplx )
+	{
+		const __m512i  even = _mm512_setr_epi64( 0, 2, 4, 6,  8, 10, 12, 14 );
+		const __m512i  odd  = _mm512_setr_epi64( 1, 3, 5, 7,  9, 11, 13, 15 );
+		const dim_t    m2   = 2 * m;
+		const __mmask8 k0   = ( m2 >= 8  ? 0xFF : ( __mmask8 )( ( 1u << m2 ) - 1 ) );
+		const __mmask8 k1   = ( m2 >= 16 ? 0xFF :
+		                        m2 <= 8  ? 0    : ( __mmask8 )( ( 1u << ( m2 - 8 ) ) - 1 ) );
+
+		const __m512d x0 = _mm512_abs_pd( _mm512_maskz_loadu_pd( k0, x + 0 ) );
+		const __m512d x1 = _mm512_abs_pd( _mm512_maskz_loadu_pd( k1, x + 8 ) );
+
+		return _mm512_add_pd( _mm512_permutex2var_pd( x0, even, x1 ),
+		                      _mm512_permutex2var_pd( x0, odd,  x1 ) );
+	}
+	else
+	{
+		const __mmask8 k = ( m >= 8 ? 0xFF : ( __mmask8 )( ( 1u << m ) - 1 ) );
+
+		return _mm512_abs_pd( _mm512_maskz_loadu_pd( k, x ) );
+	}
+}
+
+// Search one block of x. Return the index of the winning element and store
+// its score to *score.
+static dim_t bli_samxv_skx_int_blk
+     (
+       dim_t   n,
+       float*  x, inc_t incx,
+       bool    is_cmplx,
+       bool    is_min,
+       float*  score
+     )
+{
+	const float flip   = ( is_min ? -1.0f : 1.0f );
+	const dim_t n_elem = ( is_cmplx ? 2 : 1 );
+	float       s_best = 0.0f;
+	dim_t       i_best = 0;
+	dim_t       i;
+
+	if ( incx == 1 )
+	{
+		const __m512  flipv = ( is_min ? _mm512_set1_ps( -0.0f ) : _mm512_setzero_ps() );
+		const __m512i inc   = _mm512_set1_epi32( 16 );
+		__m512i       idx   = _mm512_setr_epi32( 0, 1,  2,  3,  4,  5,  6,  7,
+		                                         8, 9, 10, 11, 12, 13, 14, 15 );
+		__m512i       ibest = idx;
+		__m512        best  = _mm512_set1_ps( -INFINITY );
+		__mmask16     nan   = 0;
+
+		// Every lane starts with the score -Inf and the index of its first
+		// element, which is correct even if all of its scores are -Inf.
+		for ( i = 0; i < n; i += 16 )
+		{
+			const dim_t     m = bli_min( n - i, 16 );
+			const __mmask16 k = ( m >= 16 ? 0xFFFF : ( __mmask16 )( ( 1u << m ) - 1 ) );
+
+			__m512    s  = _mm512_xor_ps( bli_sabs16_skx_int( x + i*n_elem, m, is_cmplx ), flipv );
+			__mmask16 gt = _mm512_mask_cmp_ps_mask( k, s, best, _CMP_GT_OQ );
+
+			nan   |= _mm512_mask_cmp_ps_mask( k, s, s, _CMP_UNORD_Q );
+			best   = _mm512_mask_mov_ps( best, gt, s );
+			ibest  = _mm512_mask_mov_epi32( ibest, gt, idx );
+			idx    = _mm512_add_epi32( idx, inc );
+		}
+
+		// NaN is rare; find the first one with scalar code.
+		if ( nan != 0 )
+		{
+			for ( i = 0; !isnan( bli_sabs1_skx_int( x, i, 1, is_cmplx ) ); ++i ) ;
+
+			*score = NAN;
+			return i;
+		}
+
+		// Among the lanes holding the largest score, the smallest index wins.
+		s_best = _mm512_reduce_max_ps( best );
+		i_best = _mm512_mask_reduce_min_epi32( _mm512_cmp_ps_mask( best, _mm512_set1_ps( s_best ),
+		                                                           _CMP_EQ_OQ ),
+		                                       ibest );
+	}
+	else
+	{
+		for ( i = 0; i < n; ++i )
+		{
+			const float s = flip * bli_sabs1_skx_int( x, i, incx, is_cmplx );
+
+			if ( isnan( s ) )
+			{
+				*score = s;
+				return i;
+			}
+
+			if ( i == 0 || s > s_best )
+			{
+				s_best = s;
+				i_best = i;
+			}
+		}
+	}
+
+	*score = s_best;
+	return i_best;
+}
+
+static dim_t bli_damxv_skx_int_blk
+     (
+       dim_t   n,
+       double* x, inc_t incx,
+       bool    is_cmplx,
+       bool    is_min,
+       double* score
+     )
+{
+	const double flip   = ( is_min ? -1.0 : 1.0 );
+	const dim_t  n_elem = ( is_cmplx ? 2 : 1 );
+	double       s_best = 0.0;
+	dim_t        i_best = 0;
+	dim_t        i;
+
+	if ( incx == 1 )
+	{
+		const __m512d flipv = ( is_min ? _mm512_set1_pd( -0.0 ) : _mm512_setzero_pd() );
+		const __m512i inc   = _mm512_set1_epi64( 8 );
+		__m512i       idx   = _mm512_setr_epi64( 0, 1, 2, 3, 4, 5, 6, 7 );
+		__m512i       ibest = idx;
+		__m512d       best  = _mm512_set1_pd( -INFINITY );
+		__mmask8      nan   = 0;
+
+		// Every lane starts with the score -Inf and the index of its first
+		// element, which is correct even if all of its scores are -Inf.
+		for ( i = 0; i < n; i += 8 )
+		{
+			const dim_t    m = bli_min( n - i, 8 );
+			const __mmask8 k = ( m >= 8 ? 0xFF : ( __mmask8 )( ( 1u << m ) - 1 ) );
+
+			__m512d  s  = _mm512_xor_pd( bli_dabs8_skx_int( x + i*n_elem, m, is_cmplx ), flipv );
+			__mmask8 gt = _mm512_mask_cmp_pd_mask( k, s, best, _CMP_GT_OQ );
+
+			nan   |= _mm512_mask_cmp_pd_mask( k, s, s, _CMP_UNORD_Q );
+			best   = _mm512_mask_mov_pd( best, gt, s );
+			ibest  = _mm512_mask_mov_epi64( ibest, gt, idx );
+			idx    = _mm512_add_epi64( idx, inc );
+		}
+
+		// NaN is rare; find the first one with scalar code.
+		if ( nan != 0 )
+		{
+			for ( i = 0; !isnan( bli_dabs1_skx_int( x, i, 1, is_cmplx ) ); ++i ) ;
+
+			*score = NAN;
+			return i;
+		}
+
+		// Among the lanes holding the largest score, the smallest index wins.
+		s_best = _mm512_reduce_max_pd( best );
+		i_best = _mm512_mask_reduce_min_epi64( _mm512_cmp_pd_mask( best, _mm512_set1_pd( s_best ),
+		                                                           _CMP_EQ_OQ ),
+		                                       ibest );
+	}
+	else
+	{
+		for ( i = 0; i < n; ++i )
+		{
+			const double s = flip * bli_dabs1_skx_int( x, i, incx, is_cmplx );
+
+			if ( isnan( s ) )
+			{
+				*score = s;
+				return i;
+			}
+
+			if ( i == 0 || s > s_best )
+			{
+				s_best = s;
+				i_best = i;
+			}
+		}
+	}
+
+	*score = s_best;
+	return i_best;
+}
+
+// Search x block by block. Blocks are visited in order, so the first block
+// that reports NaN holds the first NaN, and a later block only wins with a
+// strictly larger score.
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static dim_t PASTEMAC(ch,opname) \
+     ( \
+       dim_t   n, \
+       ctype*  x, inc_t incx, \
+       bool    is_cmplx, \
+       bool    is_min  \
+     ) \
+{ \
+	const dim_t n_elem = ( is_cmplx ? 2 : 1 ); \
+	ctype       s_best = 0; \
+	dim_t       i_best = 0; \
+\
+	for ( dim_t i = 0; i < n; i += AMXV_BLOCK ) \
+	{ \
+		const dim_t n_blk = bli_min( n - i, AMXV_BLOCK ); \
+		ctype       s; \
+		dim_t       j; \
+\
+		j = PASTEMAC2(ch,opname,_blk)( n_blk, x + i*incx*n_elem, incx, \
+		                               is_cmplx, is_min, &s ); \
+\
+		if ( isnan( s ) ) return i + j; \
+\
+		if ( i == 0 || s > s_best ) \
+		{ \
+			s_best = s; \
+			i_best = i + j; \
+		} \
+	} \
+\
+	return i_best; \
+}
+
+GENTFUNC( float,  s, amxv_skx_int )
+GENTFUNC( double, d, amxv_skx_int )
+
+// -----------------------------------------------------------------------------
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, is_cmplx, is_min ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t            n, \
+       ctype*  restrict x, inc_t incx, \
+       dim_t*  restrict index, \
+       cntx_t* restrict cntx  \
+     ) \
+{ \
+	/* An empty vector yields index zero, as in netlib BLAS's i?amax(). */ \
+	*index = PASTEMAC(chr,amxv_skx_int)( n, ( ctype_r* )x, incx, is_cmplx, is_min ); \
+}
+
+GENTFUNCR( float,    float,  s, s, amaxv_skx_int, FALSE, FALSE )
+GENTFUNCR( double,   double, d, d, amaxv_skx_int, FALSE, FALSE )
+GENTFUNCR( scomplex, float,  c, s, amaxv_skx_int, TRUE,  FALSE )
+GENTFUNCR( dcomplex, double, z, d, amaxv_skx_int, TRUE,  FALSE )
+
+GENTFUNCR( float,    float,  s, s, aminv_skx_int, FALSE, TRUE  )
+GENTFUNCR( double,   double, d, d, aminv_skx_int, FALSE, TRUE  )
+GENTFUNCR( scomplex, float,  c, s, aminv_skx_int, TRUE,  TRUE  )
+GENTFUNCR( dcomplex, double, z, d, aminv_skx_int, TRUE,  TRUE  )
+
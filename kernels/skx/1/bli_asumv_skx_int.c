@@ -0,0 +1,173 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// Sum of absolute values (asumv).
+//
+// The absolute value of a complex element is |re| + |im|, as in the BLAS
+// ?asum routines, so complex vectors are summed as real vectors of twice
+// the length when stored contiguously, and as two strided real vectors
+// otherwise.
+
+// Return the sum of the absolute values of the n-length real vector x.
+static float bli_sasum1_skx_int
+     (
+       dim_t            n,
+       float*  restrict x, inc_t incx
+     )
+{
+	float sum = 0.0f;
+	dim_t i   = 0;
+
+	if ( incx == 1 )
+	{
+		__m512 acc0 = _mm512_setzero_ps();
+		__m512 acc1 = _mm512_setzero_ps();
+		__m512 acc2 = _mm512_setzero_ps();
+		__m512 acc3 = _mm512_setzero_ps();
+
+		for ( ; i + 64 <= n; i += 64 )
+		{
+			acc0 = _mm512_add_ps( acc0, _mm512_abs_ps( _mm512_loadu_ps( x + i +  0 ) ) );
+			acc1 = _mm512_add_ps( acc1, _mm512_abs_ps( _mm512_loadu_ps( x + i + 16 ) ) );
+			acc2 = _mm512_add_ps( acc2, _mm512_abs_ps( _mm512_loadu_ps( x + i + 32 ) ) );
+			acc3 = _mm512_add_ps( acc3, _mm512_abs_ps( _mm512_loadu_ps( x + i + 48 ) ) );
+		}
+
+		for ( ; i < n; i += 16 )
+		{
+			const __mmask16 k = ( n - i >= 16 ? 0xFFFF
+			                                  : ( __mmask16 )( ( 1u << ( n - i ) ) - 1 ) );
+
+			acc0 = _mm512_add_ps( acc0, _mm512_abs_ps( _mm512_maskz_loadu_ps( k, x + i ) ) );
+		}
+
+		acc0 = _mm512_add_ps( _mm512_add_ps( acc0, acc1 ), _mm512_add_ps( acc2, acc3 ) );
+
+		sum = _mm512_reduce_add_ps( acc0 );
+	}
+	else
+	{
+		for ( ; i < n; ++i )
+		{
+			sum += fabsf( *x );
+
+			x += incx;
+		}
+	}
+
+	return sum;
+}
+
+// Return the sum of the absolute values of the n-length real vector x.
+static double bli_dasum1_skx_int
+     (
+       dim_t            n,
+       double* restrict x, inc_t incx
+     )
+{
+	double sum = 0.0;
+	dim_t  i   = 0;
+
+	if ( incx == 1 )
+	{
+		__m512d acc0 = _mm512_setzero_pd();
+		__m512d acc1 = _mm512_setzero_pd();
+		__m512d acc2 = _mm512_setzero_pd();
+		__m512d acc3 = _mm512_setzero_pd();
+
+		for ( ; i + 32 <= n; i += 32 )
+		{
+			acc0 = _mm512_add_pd( acc0, _mm512_abs_pd( _mm512_loadu_pd( x + i +  0 ) ) );
+			acc1 = _mm512_add_pd( acc1, _mm512_abs_pd( _mm512_loadu_pd( x + i +  8 ) ) );
+			acc2 = _mm512_add_pd( acc2, _mm512_abs_pd( _mm512_loadu_pd( x + i + 16 ) ) );
+			acc3 = _mm512_add_pd( acc3, _mm512_abs_pd( _mm512_loadu_pd( x + i + 24 ) ) );
+		}
+
+		for ( ; i < n; i += 8 )
+		{
+			const __mmask8 k = ( n - i >= 8 ? 0xFF
+			                                : ( __mmask8 )( ( 1u << ( n - i ) ) - 1 ) );
+
+			acc0 = _mm512_add_pd( acc0, _mm512_abs_pd( _mm512_maskz_loadu_pd( k, x + i ) ) );
+		}
+
+		acc0 = _mm512_add_pd( _mm512_add_pd( acc0, acc1 ), _mm512_add_pd( acc2, acc3 ) );
+
+		sum = _mm512_reduce_add_pd( acc0 );
+	}
+	else
+	{
+		for ( ; i < n; ++i )
+		{
+			sum += fabs( *x );
+
+			x += incx;
+		}
+	}
+
+	return sum;
+}
+
+// -----------------------------------------------------------------------------
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, is_cmplx ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t              n, \
+       ctype*    restrict x, inc_t incx, \
+       ctype_r*  restrict asum, \
+       cntx_t*   restrict cntx  \
+     ) \
+{ \
+	ctype_r* x_r = ( ctype_r* )x; \
+\
+	if      ( !is_cmplx ) \
+		*asum = PASTEMAC(chr,asum1_skx_int)( n, x_r, incx ); \
+	else if ( incx == 1 ) \
+		*asum = PASTEMAC(chr,asum1_skx_int)( 2*n, x_r, 1 ); \
+	else \
+		*asum = PASTEMAC(chr,asum1_skx_int)( n, x_r + 0, 2*incx ) + \
+		        PASTEMAC(chr,asum1_skx_int)( n, x_r + 1, 2*incx ); \
+}
+
+GENTFUNCR( float,    float,  s, s, asumv_skx_int, FALSE )
+GENTFUNCR( double,   double, d, d, asumv_skx_int, FALSE )
+GENTFUNCR( scomplex, float,  c, s, asumv_skx_int, TRUE  )
+GENTFUNCR( dcomplex, double, z, d, asumv_skx_int, TRUE  )
+
@@ -0,0 +1,345 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// Plane rotation kernels (rotv and rotmv).
+//
+// Both operations apply a 2x2 matrix H = [ h11 h12; h21 h22 ] to the pair
+// of rows formed by x and y:
+//
+//   x := h11 * x + h12 * y;
+//   y := h21 * x + h22 * y;
+//
+// where H = [ c s; -s c ] for rotv. Complex vectors are rotated by a real
+// H, so their real and imaginary parts are processed as real vectors of
+// twice the length when both are stored contiguously, and as two strided
+// real vectors otherwise.
+
+// Apply H to the n-length real vectors x and y.
+static void bli_srot2_skx_int
+     (
+       dim_t            n,
+       float*  restrict x, inc_t incx,
+       float*  restrict y, inc_t incy,
+       float*           h
+     )
+{
+	const float  h11 = h[0];
+	const float  h21 = h[1];
+	const float  h12 = h[2];
+	const float  h22 = h[3];
+	dim_t        i   = 0;
+
+	if ( incx == 1 && incy == 1 )
+	{
+		const __m512 h11v = _mm512_set1_ps( h11 );
+		const __m512 h21v = _mm512_set1_ps( h21 );
+		const __m512 h12v = _mm512_set1_ps( h12 );
+		const __m512 h22v = _mm512_set1_ps( h22 );
+
+		for ( ; i + 64 <= n; i += 64 )
+		{
+			__m512 x0 = _mm512_loadu_ps( x + i +  0 );
+			__m512 x1 = _mm512_loadu_ps( x + i + 16 );
+			__m512 x2 = _mm512_loadu_ps( x + i + 32 );
+			__m512 x3 = _mm512_loadu_ps( x + i + 48 );
+			__m512 y0 = _mm512_loadu_ps( y + i +  0 );
+			__m512 y1 = _mm512_loadu_ps( y + i + 16 );
+			__m512 y2 = _mm512_loadu_ps( y + i + 32 );
+			__m512 y3 = _mm512_loadu_ps( y + i + 48 );
+
+			_mm512_storeu_ps( x + i +  0, _mm512_fmadd_ps( h11v, x0, _mm512_mul_ps( h12v, y0 ) ) );
+			_mm512_storeu_ps( x + i + 16, _mm512_fmadd_ps( h11v, x1, _mm512_mul_ps( h12v, y1 ) ) );
+			_mm512_storeu_ps( x + i + 32, _mm512_fmadd_ps( h11v, x2, _mm512_mul_ps( h12v, y2 ) ) );
+			_mm512_storeu_ps( x + i + 48, _mm512_fmadd_ps( h11v, x3, _mm512_mul_ps( h12v, y3 ) ) );
+			_mm512_storeu_ps( y + i +  0, _mm512_fmadd_ps( h21v, x0, _mm512_mul_ps( h22v, y0 ) ) );
+			_mm512_storeu_ps( y + i + 16, _mm512_fmadd_ps( h21v, x1, _mm512_mul_ps( h22v, y1 ) ) );
+			_mm512_storeu_ps( y + i + 32, _mm512_fmadd_ps( h21v, x2, _mm512_mul_ps( h22v, y2 ) ) );
+			_mm512_storeu_ps( y + i + 48, _mm512_fmadd_ps( h21v, x3, _mm512_mul_ps( h22v, y3 ) ) );
+		}
+
+		for ( ; i + 16 <= n; i += 16 )
+		{
+			__m512 x0 = _mm512_loadu_ps( x + i );
+			__m512 y0 = _mm512_loadu_ps( y + i );
+
+			_mm512_storeu_ps( x + i, _mm512_fmadd_ps( h11v, x0, _mm512_mul_ps( h12v, y0 ) ) );
+			_mm512_storeu_ps( y + i, _mm512_fmadd_ps( h21v, x0, _mm512_mul_ps( h22v, y0 ) ) );
+		}
+
+		if ( i < n )
+		{
+			const __mmask16 m = ( __mmask16 )( ( 1u << ( n - i ) ) - 1 );
+
+			__m512 x0 = _mm512_maskz_loadu_ps( m, x + i );
+			__m512 y0 = _mm512_maskz_loadu_ps( m, y + i );
+
+			_mm512_mask_storeu_ps( x + i, m, _mm512_fmadd_ps( h11v, x0, _mm512_mul_ps( h12v, y0 ) ) );
+			_mm512_mask_storeu_ps( y + i, m, _mm512_fmadd_ps( h21v, x0, _mm512_mul_ps( h22v, y0 ) ) );
+		}
+	}
+	else
+	{
+		for ( ; i < n; ++i )
+		{
+			const float chi1 = *x;
+			const float psi1 = *y;
+
+			*x = h11 * chi1 + h12 * psi1;
+			*y = h21 * chi1 + h22 * psi1;
+
+			x += incx;
+			y += incy;
+		}
+	}
+}
+
+// Apply H to the n-length real vectors x and y.
+static void bli_drot2_skx_int
+     (
+       dim_t            n,
+       double* restrict x, inc_t incx,
+       double* restrict y, inc_t incy,
+       double*          h
+     )
+{
+	const double h11 = h[0];
+	const double h21 = h[1];
+	const double h12 = h[2];
+	const double h22 = h[3];
+	dim_t        i   = 0;
+
+	if ( incx == 1 && incy == 1 )
+	{
+		const __m512d h11v = _mm512_set1_pd( h11 );
+		const __m512d h21v = _mm512_set1_pd( h21 );
+		const __m512d h12v = _mm512_set1_pd( h12 );
+		const __m512d h22v = _mm512_set1_pd( h22 );
+
+		for ( ; i + 32 <= n; i += 32 )
+		{
+			__m512d x0 = _mm512_loadu_pd( x + i +  0 );
+			__m512d x1 = _mm512_loadu_pd( x + i +  8 );
+			__m512d x2 = _mm512_loadu_pd( x + i + 16 );
+			__m512d x3 = _mm512_loadu_pd( x + i + 24 );
+			__m512d y0 = _mm512_loadu_pd( y + i +  0 );
+			__m512d y1 = _mm512_loadu_pd( y + i +  8 );
+			__m512d y2 = _mm512_loadu_pd( y + i + 16 );
+			__m512d y3 = _mm512_loadu_pd( y + i + 24 );
+
+			_mm512_storeu_pd( x + i +  0, _mm512_fmadd_pd( h11v, x0, _mm512_mul_pd( h12v, y0 ) ) );
+			_mm512_storeu_pd( x + i +  8, _mm512_fmadd_pd( h11v, x1, _mm512_mul_pd( h12v, y1 ) ) );
+			_mm512_storeu_pd( x + i + 16, _mm512_fmadd_pd( h11v, x2, _mm512_mul_pd( h12v, y2 ) ) );
+			_mm512_storeu_pd( x + i + 24, _mm512_fmadd_pd( h11v, x3, _mm512_mul_pd( h12v, y3 ) ) );
+			_mm512_storeu_pd( y + i +  0, _mm512_fmadd_pd( h21v, x0, _mm512_mul_pd( h22v, y0 ) ) );
+			_mm512_storeu_pd( y + i +  8, _mm512_fmadd_pd( h21v, x1, _mm512_mul_pd( h22v, y1 ) ) );
+			_mm512_storeu_pd( y + i + 16, _mm512_fmadd_pd( h21v, x2, _mm512_mul_pd( h22v, y2 ) ) );
+			_mm512_storeu_pd( y + i + 24, _mm512_fmadd_pd( h21v, x3, _mm512_mul_pd( h22v, y3 ) ) );
+		}
+
+		for ( ; i + 8 <= n; i += 8 )
+		{
+			__m512d x0 = _mm512_loadu_pd( x + i );
+			__m512d y0 = _mm512_loadu_pd( y + i );
+
+			_mm512_storeu_pd( x + i, _mm512_fmadd_pd( h11v, x0, _mm512_mul_pd( h12v, y0 ) ) );
+			_mm512_storeu_pd( y + i, _mm512_fmadd_pd( h21v, x0, _mm512_mul_pd( h22v, y0 ) ) );
+		}
+
+		if ( i < n )
+		{
+			const __mmask8 m = ( __mmask8 )( ( 1u << ( n - i ) ) - 1 );
+
+			__m512d x0 = _mm512_maskz_loadu_pd( m, x + i );
+			__m512d y0 = _mm512_maskz_loadu_pd( m, y + i );
+
+			_mm512_mask_storeu_pd( x + i, m, _mm512_fmadd_pd( h11v, x0, _mm512_mul_pd( h12v, y0 ) ) );
+			_mm512_mask_storeu_pd( y + i, m, _mm512_fmadd_pd( h21v, x0, _mm512_mul_pd( h22v, y0 ) ) );
+		}
+	}
+	else
+	{
+		for ( ; i < n; ++i )
+		{
+			const double chi1 = *x;
+			const double psi1 = *y;
+
+			*x = h11 * chi1 + h12 * psi1;
+			*y = h21 * chi1 + h22 * psi1;
+
+			x += incx;
+			y += incy;
+		}
+	}
+}
+
+// Apply H to x and y, which hold n real or complex elements.
+static void bli_srot2_skx_int_cv
+     (
+       bool             is_cmplx,
+       dim_t            n,
+       float*  restrict x, inc_t incx,
+       float*  restrict y, inc_t incy,
+       float*           h
+     )
+{
+	if ( !is_cmplx )
+	{
+		bli_srot2_skx_int( n, x, incx, y, incy, h );
+	}
+	else if ( incx == 1 && incy == 1 )
+	{
+		bli_srot2_skx_int( 2 * n, x, 1, y, 1, h );
+	}
+	else
+	{
+		bli_srot2_skx_int( n, x,     2 * incx, y,     2 * incy, h );
+		bli_srot2_skx_int( n, x + 1, 2 * incx, y + 1, 2 * incy, h );
+	}
+}
+
+// Apply H to x and y, which hold n real or complex elements.
+static void bli_drot2_skx_int_cv
+     (
+       bool             is_cmplx,
+       dim_t            n,
+       double* restrict x, inc_t incx,
+       double* restrict y, inc_t incy,
+       double*          h
+     )
+{
+	if ( !is_cmplx )
+	{
+		bli_drot2_skx_int( n, x, incx, y, incy, h );
+	}
+	else if ( incx == 1 && incy == 1 )
+	{
+		bli_drot2_skx_int( 2 * n, x, 1, y, 1, h );
+	}
+	else
+	{
+		bli_drot2_skx_int( n, x,     2 * incx, y,     2 * incy, h );
+		bli_drot2_skx_int( n, x + 1, 2 * incx, y + 1, 2 * incy, h );
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, varname, is_cmplx ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       dim_t              n, \
+       ctype*    restrict x, inc_t incx, \
+       ctype*    restrict y, inc_t incy, \
+       ctype_r*  restrict c, \
+       ctype_r*  restrict s, \
+       cntx_t*   restrict cntx  \
+     ) \
+{ \
+	ctype_r h[4] = { *c, -(*s), *s, *c }; \
+\
+	bli_srot2_skx_int_cv( is_cmplx, n, ( ctype_r* )x, incx, \
+	                                   ( ctype_r* )y, incy, h ); \
+}
+
+GENTFUNCR( float,    float,  s, s, rotv_skx_int, FALSE )
+GENTFUNCR( scomplex, float,  c, s, rotv_skx_int, TRUE  )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, varname, is_cmplx ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       dim_t              n, \
+       ctype*    restrict x, inc_t incx, \
+       ctype*    restrict y, inc_t incy, \
+       ctype_r*  restrict h, \
+       cntx_t*   restrict cntx  \
+     ) \
+{ \
+	bli_srot2_skx_int_cv( is_cmplx, n, ( ctype_r* )x, incx, \
+	                                   ( ctype_r* )y, incy, h ); \
+}
+
+GENTFUNCR( float,    float,  s, s, rotmv_skx_int, FALSE )
+GENTFUNCR( scomplex, float,  c, s, rotmv_skx_int, TRUE  )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, varname, is_cmplx ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       dim_t              n, \
+       ctype*    restrict x, inc_t incx, \
+       ctype*    restrict y, inc_t incy, \
+       ctype_r*  restrict c, \
+       ctype_r*  restrict s, \
+       cntx_t*   restrict cntx  \
+     ) \
+{ \
+	ctype_r h[4] = { *c, -(*s), *s, *c }; \
+\
+	bli_drot2_skx_int_cv( is_cmplx, n, ( ctype_r* )x, incx, \
+	                                   ( ctype_r* )y, incy, h ); \
+}
+
+GENTFUNCR( double,   double, d, d, rotv_skx_int, FALSE )
+GENTFUNCR( dcomplex, double, z, d, rotv_skx_int, TRUE  )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, varname, is_cmplx ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       dim_t              n, \
+       ctype*    restrict x, inc_t incx, \
+       ctype*    restrict y, inc_t incy, \
+       ctype_r*  restrict h, \
+       cntx_t*   restrict cntx  \
+     ) \
+{ \
+	bli_drot2_skx_int_cv( is_cmplx, n, ( ctype_r* )x, incx, \
+	                                   ( ctype_r* )y, incy, h ); \
+}
+
+GENTFUNCR( double,   double, d, d, rotmv_skx_int, FALSE )
+GENTFUNCR( dcomplex, double, z, d, rotmv_skx_int, TRUE  )
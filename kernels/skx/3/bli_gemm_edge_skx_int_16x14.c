@@ -0,0 +1,273 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   AS IS AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE UNIVERSITY
+   OF TEXAS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+   PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+   OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// Masked-edge gemm microkernels for the skx 32x12 (s) and 16x14 (d)
+// register blockings. These are invoked by the gemm macrokernel for edge
+// tiles where m < MR and/or n < NR. The k loop consumes the same micropanel
+// formats as the corresponding full-tile assembly kernels and keeps the
+// whole tile in zmm registers. Each column j < n of the m x n submatrix of
+// C is then updated straight from its accumulators: with k-masked loads and
+// stores when C is column-stored, and with k-masked gathers and scatters
+// otherwise. Rows at or beyond m and columns at or beyond n are never
+// touched.
+
+// Enable lane i of a register that holds rows i0 through i0 + lanes - 1
+// when i0 + i < m.
+#define BLIS_EDGE_SKX_MASK( i0, m, lanes ) \
+	( ( m ) <= ( i0 ) ? 0 : \
+	  ( m ) - ( i0 ) >= ( lanes ) ? ( ( 1u << ( lanes ) ) - 1 ) : \
+	  ( ( 1u << ( ( m ) - ( i0 ) ) ) - 1 ) )
+
+void bli_dgemm_edge_skx_int_16x14
+     (
+       dim_t               m,
+       dim_t               n,
+       dim_t               k,
+       double*    restrict alpha,
+       double*    restrict a,
+       double*    restrict b,
+       double*    restrict beta,
+       double*    restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t nr     = 14;
+
+	const inc_t packmr = bli_cntx_get_blksz_max_dt( BLIS_DOUBLE, BLIS_MR, cntx );
+	const inc_t packnr = bli_cntx_get_blksz_max_dt( BLIS_DOUBLE, BLIS_NR, cntx );
+
+	__m512d ab[ 14 ][ 2 ];
+
+	for ( dim_t j = 0; j < nr; ++j )
+	{
+		ab[ j ][ 0 ] = _mm512_setzero_pd();
+		ab[ j ][ 1 ] = _mm512_setzero_pd();
+	}
+
+	for ( dim_t l = 0; l < k; ++l )
+	{
+		const __m512d a0 = _mm512_loadu_pd( a + 0 );
+		const __m512d a1 = _mm512_loadu_pd( a + 8 );
+
+		for ( dim_t j = 0; j < nr; ++j )
+		{
+			const __m512d bj = _mm512_set1_pd( b[ j ] );
+
+			ab[ j ][ 0 ] = _mm512_fmadd_pd( a0, bj, ab[ j ][ 0 ] );
+			ab[ j ][ 1 ] = _mm512_fmadd_pd( a1, bj, ab[ j ][ 1 ] );
+		}
+
+		a += packmr;
+		b += packnr;
+	}
+
+	const __m512d   alphav = _mm512_set1_pd( *alpha );
+	const __m512d   betav  = _mm512_set1_pd( *beta );
+	const bool      beta0  = bli_deq0( *beta );
+	const __mmask8  k0     = BLIS_EDGE_SKX_MASK( 0, m, 8 );
+	const __mmask8  k1     = BLIS_EDGE_SKX_MASK( 8, m, 8 );
+
+	if ( rs_c == 1 )
+	{
+		for ( dim_t j = 0; j < nr; ++j )
+		{
+			if ( j >= n ) break;
+
+			double* restrict cj = c + j*cs_c;
+			__m512d          v0 = _mm512_mul_pd( alphav, ab[ j ][ 0 ] );
+			__m512d          v1 = _mm512_mul_pd( alphav, ab[ j ][ 1 ] );
+
+			if ( !beta0 )
+			{
+				v0 = _mm512_fmadd_pd( betav, _mm512_maskz_loadu_pd( k0, cj + 0 ), v0 );
+				v1 = _mm512_fmadd_pd( betav, _mm512_maskz_loadu_pd( k1, cj + 8 ), v1 );
+			}
+
+			_mm512_mask_storeu_pd( cj + 0, k0, v0 );
+			_mm512_mask_storeu_pd( cj + 8, k1, v1 );
+		}
+	}
+	else
+	{
+		const __m512i idx0 = _mm512_mullo_epi64( _mm512_set1_epi64( rs_c ),
+		                       _mm512_set_epi64( 7, 6, 5, 4, 3, 2, 1, 0 ) );
+		const __m512i idx1 = _mm512_add_epi64( idx0, _mm512_set1_epi64( 8*rs_c ) );
+
+		for ( dim_t j = 0; j < nr; ++j )
+		{
+			if ( j >= n ) break;
+
+			double* restrict cj = c + j*cs_c;
+			__m512d          v0 = _mm512_mul_pd( alphav, ab[ j ][ 0 ] );
+			__m512d          v1 = _mm512_mul_pd( alphav, ab[ j ][ 1 ] );
+
+			if ( !beta0 )
+			{
+				const __m512d z = _mm512_setzero_pd();
+
+				v0 = _mm512_fmadd_pd( betav, _mm512_mask_i64gather_pd( z, k0, idx0, cj, 8 ), v0 );
+				v1 = _mm512_fmadd_pd( betav, _mm512_mask_i64gather_pd( z, k1, idx1, cj, 8 ), v1 );
+			}
+
+			_mm512_mask_i64scatter_pd( cj, k0, idx0, v0, 8 );
+			_mm512_mask_i64scatter_pd( cj, k1, idx1, v1, 8 );
+		}
+	}
+}
+
+void bli_sgemm_edge_skx_int_32x12
+     (
+       dim_t               m,
+       dim_t               n,
+       dim_t               k,
+       float*     restrict alpha,
+       float*     restrict a,
+       float*     restrict b,
+       float*     restrict beta,
+       float*     restrict c, inc_t rs_c, inc_t cs_c,
+       auxinfo_t* restrict data,
+       cntx_t*    restrict cntx
+     )
+{
+	const dim_t nr     = 12;
+
+	const inc_t packmr = bli_cntx_get_blksz_max_dt( BLIS_FLOAT, BLIS_MR, cntx );
+	const inc_t packnr = bli_cntx_get_blksz_max_dt( BLIS_FLOAT, BLIS_NR, cntx );
+
+	__m512 ab[ 12 ][ 2 ];
+
+	for ( dim_t j = 0; j < nr; ++j )
+	{
+		ab[ j ][ 0 ] = _mm512_setzero_ps();
+		ab[ j ][ 1 ] = _mm512_setzero_ps();
+	}
+
+	for ( dim_t l = 0; l < k; ++l )
+	{
+		const __m512 a0 = _mm512_loadu_ps( a + 0  );
+		const __m512 a1 = _mm512_loadu_ps( a + 16 );
+
+		for ( dim_t j = 0; j < nr; ++j )
+		{
+			const __m512 bj = _mm512_set1_ps( b[ j ] );
+
+			ab[ j ][ 0 ] = _mm512_fmadd_ps( a0, bj, ab[ j ][ 0 ] );
+			ab[ j ][ 1 ] = _mm512_fmadd_ps( a1, bj, ab[ j ][ 1 ] );
+		}
+
+		a += packmr;
+		b += packnr;
+	}
+
+	const __m512    alphav = _mm512_set1_ps( *alpha );
+	const __m512    betav  = _mm512_set1_ps( *beta );
+	const bool      beta0  = bli_seq0( *beta );
+	const __mmask16 k0     = BLIS_EDGE_SKX_MASK( 0,  m, 16 );
+	const __mmask16 k1     = BLIS_EDGE_SKX_MASK( 16, m, 16 );
+
+	if ( rs_c == 1 )
+	{
+		for ( dim_t j = 0; j < nr; ++j )
+		{
+			if ( j >= n ) break;
+
+			float* restrict cj = c + j*cs_c;
+			__m512          v0 = _mm512_mul_ps( alphav, ab[ j ][ 0 ] );
+			__m512          v1 = _mm512_mul_ps( alphav, ab[ j ][ 1 ] );
+
+			if ( !beta0 )
+			{
+				v0 = _mm512_fmadd_ps( betav, _mm512_maskz_loadu_ps( k0, cj + 0  ), v0 );
+				v1 = _mm512_fmadd_ps( betav, _mm512_maskz_loadu_ps( k1, cj + 16 ), v1 );
+			}
+
+			_mm512_mask_storeu_ps( cj + 0,  k0, v0 );
+			_mm512_mask_storeu_ps( cj + 16, k1, v1 );
+		}
+	}
+	else
+	{
+		// Each register of 16 rows is scattered as two halves of 8 so that
+		// the row offsets can be held as 64-bit indices.
+		const __m512i idx0 = _mm512_mullo_epi64( _mm512_set1_epi64( rs_c ),
+		                       _mm512_set_epi64( 7, 6, 5, 4, 3, 2, 1, 0 ) );
+		const __m512i idx8 = _mm512_set1_epi64( 8*rs_c );
+		const __m512i idx[ 4 ] =
+		{
+			idx0,
+			_mm512_add_epi64( idx0, idx8 ),
+			_mm512_add_epi64( idx0, _mm512_add_epi64( idx8, idx8 ) ),
+			_mm512_add_epi64( idx0, _mm512_mullo_epi64( idx8, _mm512_set1_epi64( 3 ) ) ),
+		};
+		const __mmask8  kh[ 4 ] =
+		{
+			( __mmask8 )( k0 & 0xff ), ( __mmask8 )( k0 >> 8 ),
+			( __mmask8 )( k1 & 0xff ), ( __mmask8 )( k1 >> 8 ),
+		};
+
+		for ( dim_t j = 0; j < nr; ++j )
+		{
+			if ( j >= n ) break;
+
+			float* restrict cj = c + j*cs_c;
+			__m256          v[ 4 ];
+			const __m512    v0 = _mm512_mul_ps( alphav, ab[ j ][ 0 ] );
+			const __m512    v1 = _mm512_mul_ps( alphav, ab[ j ][ 1 ] );
+
+			v[ 0 ] = _mm512_castps512_ps256( v0 );
+			v[ 1 ] = _mm512_extractf32x8_ps( v0, 1 );
+			v[ 2 ] = _mm512_castps512_ps256( v1 );
+			v[ 3 ] = _mm512_extractf32x8_ps( v1, 1 );
+
+			for ( dim_t h = 0; h < 4; ++h )
+			{
+				if ( !beta0 )
+				{
+					const __m256 ch = _mm512_mask_i64gather_ps( _mm256_setzero_ps(),
+					                                            kh[ h ], idx[ h ], cj, 4 );
+
+					v[ h ] = _mm256_fmadd_ps( _mm512_castps512_ps256( betav ), ch, v[ h ] );
+				}
+
+				_mm512_mask_i64scatter_ps( cj, kh[ h ], idx[ h ], v[ h ], 4 );
+			}
+		}
+	}
+}
+
+#undef BLIS_EDGE_SKX_MASK
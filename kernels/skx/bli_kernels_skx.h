@@ -38,4 +38,51 @@ GEMM_UKR_PROT( float ,   s, gemm_skx_asm_12x32_l2 )
 GEMM_UKR_PROT( double,   d, gemm_skx_asm_16x12_l2 )
 GEMM_UKR_PROT( double,   d, gemm_skx_asm_16x14 )
 
+GEMM_UKR_PROT( float ,   s, gemm_nt_skx_int_32x12 )
+GEMM_UKR_PROT( double,   d, gemm_nt_skx_int_16x14 )
+
+GEMM_EDGE_UKR_PROT( float ,   s, gemm_edge_skx_int_32x12 )
+GEMM_EDGE_UKR_PROT( double,   d, gemm_edge_skx_int_16x14 )
+
+// amaxv (intrinsics)
+AMAXV_KER_PROT( float,    s, amaxv_skx_int )
+AMAXV_KER_PROT( double,   d, amaxv_skx_int )
+AMAXV_KER_PROT( scomplex, c, amaxv_skx_int )
+AMAXV_KER_PROT( dcomplex, z, amaxv_skx_int )
+
+// aminv (intrinsics)
+AMINV_KER_PROT( float,    s, aminv_skx_int )
+AMINV_KER_PROT( double,   d, aminv_skx_int )
+AMINV_KER_PROT( scomplex, c, aminv_skx_int )
+AMINV_KER_PROT( dcomplex, z, aminv_skx_int )
+
+// asumv (intrinsics)
+ASUMV_KER_PROT( float,    float,  s, s, asumv_skx_int )
+ASUMV_KER_PROT( double,   double, d, d, asumv_skx_int )
+ASUMV_KER_PROT( scomplex, float,  c, s, asumv_skx_int )
+ASUMV_KER_PROT( dcomplex, double, z, d, asumv_skx_int )
+
+// normfv (intrinsics)
+NORMFV_KER_PROT( float,    float,  s, s, normfv_skx_int )
+NORMFV_KER_PROT( double,   double, d, d, normfv_skx_int )
+NORMFV_KER_PROT( scomplex, float,  c, s, normfv_skx_int )
+NORMFV_KER_PROT( dcomplex, double, z, d, normfv_skx_int )
+
+// sumsqv (intrinsics)
+SUMSQV_KER_PROT( float,    float,  s, s, sumsqv_skx_int )
+SUMSQV_KER_PROT( double,   double, d, d, sumsqv_skx_int )
+SUMSQV_KER_PROT( scomplex, float,  c, s, sumsqv_skx_int )
+SUMSQV_KER_PROT( dcomplex, double, z, d, sumsqv_skx_int )
+
+// rotmv (intrinsics)
+ROTMV_KER_PROT( float,    float,  s, s, rotmv_skx_int )
+ROTMV_KER_PROT( double,   double, d, d, rotmv_skx_int )
+ROTMV_KER_PROT( scomplex, float,  c, s, rotmv_skx_int )
+ROTMV_KER_PROT( dcomplex, double, z, d, rotmv_skx_int )
+
+// rotv (intrinsics)
+ROTV_KER_PROT( float,    float,  s, s, rotv_skx_int )
+ROTV_KER_PROT( double,   double, d, d, rotv_skx_int )
+ROTV_KER_PROT( scomplex, float,  c, s, rotv_skx_int )
+ROTV_KER_PROT( dcomplex, double, z, d, rotv_skx_int )
 
@@ -515,3 +515,390 @@ void PASTEMAC(ch,varname) \
 GENTFUNCR( scomplex, float,  c, s, amaxv_zen_int )
 GENTFUNCR( dcomplex, double, z, d, amaxv_zen_int )
 #endif
+
+// -----------------------------------------------------------------------------
+
+// The complex amaxv kernels and the aminv kernels share one search routine
+// per precision. The routine finds the first element of x whose "score" is
+// largest, where the score is the absolute value (|re| + |im| for complex
+// elements, as in the reference kernels) for amaxv and its negation for
+// aminv. Negation turns the smallest absolute value into the largest score
+// without changing which elements compare equal. As in the reference
+// kernels, the index of the first NaN is returned if x contains one.
+//
+// Lane indices are kept in 32-bit integers (single precision) or 64-bit
+// integers (double precision), so x is searched in blocks of at most
+// AMXV_BLOCK elements whose results are then combined.
+
+#define AMXV_BLOCK ( ( dim_t )1 << 30 )
+
+static float bli_sabs1_zen_int( float* x, dim_t i, inc_t incx, bool is_cmplx )
+{
+	if ( is_cmplx ) return fabsf( x[ 2*i*incx ] ) + fabsf( x[ 2*i*incx + 1 ] );
+	else            return fabsf( x[   i*incx ] );
+}
+
+static double bli_dabs1_zen_int( double* x, dim_t i, inc_t incx, bool is_cmplx )
+{
+	if ( is_cmplx ) return fabs( x[ 2*i*incx ] ) + fabs( x[ 2*i*incx + 1 ] );
+	else            return fabs( x[   i*incx ] );
+}
+
+// Return the absolute values of the 8 elements at x. For complex elements,
+// _mm256_hadd_ps() leaves them in the order 0 1 4 5 2 3 6 7.
+static __m256 bli_sabs8_zen_int( float* x, bool is_cmplx, __m256 sign )
+{
+	if ( is_cmplx )
+		return _mm256_hadd_ps( _mm256_andnot_ps( sign, _mm256_loadu_ps( x + 0 ) ),
+		                       _mm256_andnot_ps( sign, _mm256_loadu_ps( x + 8 ) ) );
+	else
+		return _mm256_andnot_ps( sign, _mm256_loadu_ps( x ) );
+}
+
+// Return the absolute values of the 4 elements at x. For complex elements,
+// _mm256_hadd_pd() leaves them in the order 0 2 1 3.
+static __m256d bli_dabs4_zen_int( double* x, bool is_cmplx, __m256d sign )
+{
+	if ( is_cmplx )
+		return _mm256_hadd_pd( _mm256_andnot_pd( sign, _mm256_loadu_pd( x + 0 ) ),
+		                       _mm256_andnot_pd( sign, _mm256_loadu_pd( x + 4 ) ) );
+	else
+		return _mm256_andnot_pd( sign, _mm256_loadu_pd( x ) );
+}
+
+// Search one block of x. Return the index of the winning element and store
+// its score to *score.
+//
+// The vector loop keeps four independent sets of lanes so that the chain of
+// dependent max operations does not limit throughput. For each lane, it
+// records the largest score seen and the iteration in which it first
+// appeared; the element index is recovered from the iteration, the set, and
+// the lane when the sets are combined.
+static dim_t bli_samxv_zen_int_blk
+     (
+       dim_t   n,
+       float*  x, inc_t incx,
+       bool    is_cmplx,
+       bool    is_min,
+       float*  score
+     )
+{
+	const float flip   = ( is_min ? -1.0f : 1.0f );
+	const dim_t n_elem = ( is_cmplx ? 2 : 1 );
+	const dim_t n_vec  = ( incx == 1 ? n - n % 32 : 0 );
+	float       s_best = 0.0f;
+	dim_t       i_best = 0;
+	dim_t       i      = 0;
+
+	if ( n_vec > 0 )
+	{
+		const __m256  sign   = _mm256_set1_ps( -0.0f );
+		const __m256  flipv  = ( is_min ? sign : _mm256_setzero_ps() );
+		const __m256i one    = _mm256_set1_epi32( 1 );
+		__m256i       it     = _mm256_setzero_si256();
+
+		__m256        best0  = _mm256_xor_ps( bli_sabs8_zen_int( x +  0*n_elem, is_cmplx, sign ), flipv );
+		__m256        best1  = _mm256_xor_ps( bli_sabs8_zen_int( x +  8*n_elem, is_cmplx, sign ), flipv );
+		__m256        best2  = _mm256_xor_ps( bli_sabs8_zen_int( x + 16*n_elem, is_cmplx, sign ), flipv );
+		__m256        best3  = _mm256_xor_ps( bli_sabs8_zen_int( x + 24*n_elem, is_cmplx, sign ), flipv );
+		__m256i       ibest0 = it;
+		__m256i       ibest1 = it;
+		__m256i       ibest2 = it;
+		__m256i       ibest3 = it;
+
+		// _CMP_UNORD_Q is true if either operand is NaN.
+		__m256        nan    = _mm256_or_ps( _mm256_cmp_ps( best0, best1, _CMP_UNORD_Q ),
+		                                     _mm256_cmp_ps( best2, best3, _CMP_UNORD_Q ) );
+
+		for ( i = 32; i < n_vec; i += 32 )
+		{
+			it = _mm256_add_epi32( it, one );
+
+			__m256 s0  = _mm256_xor_ps( bli_sabs8_zen_int( x + ( i +  0 )*n_elem, is_cmplx, sign ), flipv );
+			__m256 s1  = _mm256_xor_ps( bli_sabs8_zen_int( x + ( i +  8 )*n_elem, is_cmplx, sign ), flipv );
+			__m256 s2  = _mm256_xor_ps( bli_sabs8_zen_int( x + ( i + 16 )*n_elem, is_cmplx, sign ), flipv );
+			__m256 s3  = _mm256_xor_ps( bli_sabs8_zen_int( x + ( i + 24 )*n_elem, is_cmplx, sign ), flipv );
+
+			__m256 gt0 = _mm256_cmp_ps( s0, best0, _CMP_GT_OQ );
+			__m256 gt1 = _mm256_cmp_ps( s1, best1, _CMP_GT_OQ );
+			__m256 gt2 = _mm256_cmp_ps( s2, best2, _CMP_GT_OQ );
+			__m256 gt3 = _mm256_cmp_ps( s3, best3, _CMP_GT_OQ );
+
+			nan    = _mm256_or_ps( nan, _mm256_or_ps( _mm256_cmp_ps( s0, s1, _CMP_UNORD_Q ),
+			                                          _mm256_cmp_ps( s2, s3, _CMP_UNORD_Q ) ) );
+
+			best0  = _mm256_max_ps( best0, s0 );
+			best1  = _mm256_max_ps( best1, s1 );
+			best2  = _mm256_max_ps( best2, s2 );
+			best3  = _mm256_max_ps( best3, s3 );
+
+			ibest0 = _mm256_castps_si256( _mm256_blendv_ps( _mm256_castsi256_ps( ibest0 ), _mm256_castsi256_ps( it ), gt0 ) );
+			ibest1 = _mm256_castps_si256( _mm256_blendv_ps( _mm256_castsi256_ps( ibest1 ), _mm256_castsi256_ps( it ), gt1 ) );
+			ibest2 = _mm256_castps_si256( _mm256_blendv_ps( _mm256_castsi256_ps( ibest2 ), _mm256_castsi256_ps( it ), gt2 ) );
+			ibest3 = _mm256_castps_si256( _mm256_blendv_ps( _mm256_castsi256_ps( ibest3 ), _mm256_castsi256_ps( it ), gt3 ) );
+		}
+
+		const bool has_nan = ( _mm256_movemask_ps( nan ) != 0 );
+
+		float   s_lane[ 32 ];
+		int32_t i_lane[ 32 ];
+
+		_mm256_storeu_ps( s_lane +  0, best0 );
+		_mm256_storeu_ps( s_lane +  8, best1 );
+		_mm256_storeu_ps( s_lane + 16, best2 );
+		_mm256_storeu_ps( s_lane + 24, best3 );
+		_mm256_storeu_si256( ( __m256i* )( i_lane +  0 ), ibest0 );
+		_mm256_storeu_si256( ( __m256i* )( i_lane +  8 ), ibest1 );
+		_mm256_storeu_si256( ( __m256i* )( i_lane + 16 ), ibest2 );
+		_mm256_storeu_si256( ( __m256i* )( i_lane + 24 ), ibest3 );
+
+		_mm256_zeroupper();
+
+		// NaN is rare; find the first one with scalar code.
+		if ( has_nan )
+		{
+			for ( i = 0; !isnan( bli_sabs1_zen_int( x, i, 1, is_cmplx ) ); ++i ) ;
+
+			*score = NAN;
+			return i;
+		}
+
+		// Each lane holds the first of its largest scores; among lanes with
+		// equal scores, the smallest index wins. Complex elements appear in
+		// the lanes in the order left by bli_sabs8_zen_int().
+		{
+			const dim_t perm_r[ 8 ] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+			const dim_t perm_c[ 8 ] = { 0, 1, 4, 5, 2, 3, 6, 7 };
+			const dim_t* perm       = ( is_cmplx ? perm_c : perm_r );
+
+			for ( dim_t k = 0; k < 32; ++k )
+			{
+				const dim_t j = i_lane[ k ] * 32 + ( k / 8 ) * 8 + perm[ k % 8 ];
+
+				if ( k == 0 || s_lane[ k ] > s_best || ( s_lane[ k ] == s_best && j < i_best ) )
+				{
+					s_best = s_lane[ k ];
+					i_best = j;
+				}
+			}
+		}
+	}
+
+	for ( ; i < n; ++i )
+	{
+		const float s = flip * bli_sabs1_zen_int( x, i, incx, is_cmplx );
+
+		if ( isnan( s ) )
+		{
+			*score = s;
+			return i;
+		}
+
+		if ( i == 0 || s > s_best )
+		{
+			s_best = s;
+			i_best = i;
+		}
+	}
+
+	*score = s_best;
+	return i_best;
+}
+
+static dim_t bli_damxv_zen_int_blk
+     (
+       dim_t   n,
+       double* x, inc_t incx,
+       bool    is_cmplx,
+       bool    is_min,
+       double* score
+     )
+{
+	const double flip   = ( is_min ? -1.0 : 1.0 );
+	const dim_t  n_elem = ( is_cmplx ? 2 : 1 );
+	const dim_t  n_vec  = ( incx == 1 ? n - n % 16 : 0 );
+	double       s_best = 0.0;
+	dim_t        i_best = 0;
+	dim_t        i      = 0;
+
+	if ( n_vec > 0 )
+	{
+		const __m256d sign   = _mm256_set1_pd( -0.0 );
+		const __m256d flipv  = ( is_min ? sign : _mm256_setzero_pd() );
+		const __m256i one    = _mm256_set1_epi64x( 1 );
+		__m256i       it     = _mm256_setzero_si256();
+
+		__m256d       best0  = _mm256_xor_pd( bli_dabs4_zen_int( x +  0*n_elem, is_cmplx, sign ), flipv );
+		__m256d       best1  = _mm256_xor_pd( bli_dabs4_zen_int( x +  4*n_elem, is_cmplx, sign ), flipv );
+		__m256d       best2  = _mm256_xor_pd( bli_dabs4_zen_int( x +  8*n_elem, is_cmplx, sign ), flipv );
+		__m256d       best3  = _mm256_xor_pd( bli_dabs4_zen_int( x + 12*n_elem, is_cmplx, sign ), flipv );
+		__m256i       ibest0 = it;
+		__m256i       ibest1 = it;
+		__m256i       ibest2 = it;
+		__m256i       ibest3 = it;
+
+		// _CMP_UNORD_Q is true if either operand is NaN.
+		__m256d       nan    = _mm256_or_pd( _mm256_cmp_pd( best0, best1, _CMP_UNORD_Q ),
+		                                     _mm256_cmp_pd( best2, best3, _CMP_UNORD_Q ) );
+
+		for ( i = 16; i < n_vec; i += 16 )
+		{
+			it = _mm256_add_epi64( it, one );
+
+			__m256d s0  = _mm256_xor_pd( bli_dabs4_zen_int( x + ( i +  0 )*n_elem, is_cmplx, sign ), flipv );
+			__m256d s1  = _mm256_xor_pd( bli_dabs4_zen_int( x + ( i +  4 )*n_elem, is_cmplx, sign ), flipv );
+			__m256d s2  = _mm256_xor_pd( bli_dabs4_zen_int( x + ( i +  8 )*n_elem, is_cmplx, sign ), flipv );
+			__m256d s3  = _mm256_xor_pd( bli_dabs4_zen_int( x + ( i + 12 )*n_elem, is_cmplx, sign ), flipv );
+
+			__m256d gt0 = _mm256_cmp_pd( s0, best0, _CMP_GT_OQ );
+			__m256d gt1 = _mm256_cmp_pd( s1, best1, _CMP_GT_OQ );
+			__m256d gt2 = _mm256_cmp_pd( s2, best2, _CMP_GT_OQ );
+			__m256d gt3 = _mm256_cmp_pd( s3, best3, _CMP_GT_OQ );
+
+			nan    = _mm256_or_pd( nan, _mm256_or_pd( _mm256_cmp_pd( s0, s1, _CMP_UNORD_Q ),
+			                                          _mm256_cmp_pd( s2, s3, _CMP_UNORD_Q ) ) );
+
+			best0  = _mm256_max_pd( best0, s0 );
+			best1  = _mm256_max_pd( best1, s1 );
+			best2  = _mm256_max_pd( best2, s2 );
+			best3  = _mm256_max_pd( best3, s3 );
+
+			ibest0 = _mm256_castpd_si256( _mm256_blendv_pd( _mm256_castsi256_pd( ibest0 ), _mm256_castsi256_pd( it ), gt0 ) );
+			ibest1 = _mm256_castpd_si256( _mm256_blendv_pd( _mm256_castsi256_pd( ibest1 ), _mm256_castsi256_pd( it ), gt1 ) );
+			ibest2 = _mm256_castpd_si256( _mm256_blendv_pd( _mm256_castsi256_pd( ibest2 ), _mm256_castsi256_pd( it ), gt2 ) );
+			ibest3 = _mm256_castpd_si256( _mm256_blendv_pd( _mm256_castsi256_pd( ibest3 ), _mm256_castsi256_pd( it ), gt3 ) );
+		}
+
+		const bool has_nan = ( _mm256_movemask_pd( nan ) != 0 );
+
+		double  s_lane[ 16 ];
+		int64_t i_lane[ 16 ];
+
+		_mm256_storeu_pd( s_lane +  0, best0 );
+		_mm256_storeu_pd( s_lane +  4, best1 );
+		_mm256_storeu_pd( s_lane +  8, best2 );
+		_mm256_storeu_pd( s_lane + 12, best3 );
+		_mm256_storeu_si256( ( __m256i* )( i_lane +  0 ), ibest0 );
+		_mm256_storeu_si256( ( __m256i* )( i_lane +  4 ), ibest1 );
+		_mm256_storeu_si256( ( __m256i* )( i_lane +  8 ), ibest2 );
+		_mm256_storeu_si256( ( __m256i* )( i_lane + 12 ), ibest3 );
+
+		_mm256_zeroupper();
+
+		// NaN is rare; find the first one with scalar code.
+		if ( has_nan )
+		{
+			for ( i = 0; !isnan( bli_dabs1_zen_int( x, i, 1, is_cmplx ) ); ++i ) ;
+
+			*score = NAN;
+			return i;
+		}
+
+		// Each lane holds the first of its largest scores; among lanes with
+		// equal scores, the smallest index wins. Complex elements appear in
+		// the lanes in the order left by bli_dabs4_zen_int().
+		{
+			const dim_t perm_r[ 4 ] = { 0, 1, 2, 3 };
+			const dim_t perm_c[ 4 ] = { 0, 2, 1, 3 };
+			const dim_t* perm       = ( is_cmplx ? perm_c : perm_r );
+
+			for ( dim_t k = 0; k < 16; ++k )
+			{
+				const dim_t j = i_lane[ k ] * 16 + ( k / 4 ) * 4 + perm[ k % 4 ];
+
+				if ( k == 0 || s_lane[ k ] > s_best || ( s_lane[ k ] == s_best && j < i_best ) )
+				{
+					s_best = s_lane[ k ];
+					i_best = j;
+				}
+			}
+		}
+	}
+
+	for ( ; i < n; ++i )
+	{
+		const double s = flip * bli_dabs1_zen_int( x, i, incx, is_cmplx );
+
+		if ( isnan( s ) )
+		{
+			*score = s;
+			return i;
+		}
+
+		if ( i == 0 || s > s_best )
+		{
+			s_best = s;
+			i_best = i;
+		}
+	}
+
+	*score = s_best;
+	return i_best;
+}
+
+// Search x block by block. Blocks are visited in order, so the first block
+// that reports NaN holds the first NaN, and a later block only wins with a
+// strictly larger score.
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname ) \
+\
+static dim_t PASTEMAC(ch,opname) \
+     ( \
+       dim_t   n, \
+       ctype*  x, inc_t incx, \
+       bool    is_cmplx, \
+       bool    is_min  \
+     ) \
+{ \
+	const dim_t n_elem = ( is_cmplx ? 2 : 1 ); \
+	ctype       s_best = 0; \
+	dim_t       i_best = 0; \
+\
+	for ( dim_t i = 0; i < n; i += AMXV_BLOCK ) \
+	{ \
+		const dim_t n_blk = bli_min( n - i, AMXV_BLOCK ); \
+		ctype       s; \
+		dim_t       j; \
+\
+		j = PASTEMAC2(ch,opname,_blk)( n_blk, x + i*incx*n_elem, incx, \
+		                               is_cmplx, is_min, &s ); \
+\
+		if ( isnan( s ) ) return i + j; \
+\
+		if ( i == 0 || s > s_best ) \
+		{ \
+			s_best = s; \
+			i_best = i + j; \
+		} \
+	} \
+\
+	return i_best; \
+}
+
+GENTFUNC( float,  s, amxv_zen_int )
+GENTFUNC( double, d, amxv_zen_int )
+
+// -----------------------------------------------------------------------------
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, is_cmplx, is_min ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t            n, \
+       ctype*  restrict x, inc_t incx, \
+       dim_t*  restrict index, \
+       cntx_t* restrict cntx  \
+     ) \
+{ \
+	/* An empty vector yields index zero, as in netlib BLAS's i?amax(). */ \
+	*index = PASTEMAC(chr,amxv_zen_int)( n, ( ctype_r* )x, incx, is_cmplx, is_min ); \
+}
+
+GENTFUNCR( scomplex, float,  c, s, amaxv_zen_int, TRUE,  FALSE )
+GENTFUNCR( dcomplex, double, z, d, amaxv_zen_int, TRUE,  FALSE )
+
+GENTFUNCR( float,    float,  s, s, aminv_zen_int, FALSE, TRUE  )
+GENTFUNCR( double,   double, d, d, aminv_zen_int, FALSE, TRUE  )
+GENTFUNCR( scomplex, float,  c, s, aminv_zen_int, TRUE,  TRUE  )
+GENTFUNCR( dcomplex, double, z, d, aminv_zen_int, TRUE,  TRUE  )
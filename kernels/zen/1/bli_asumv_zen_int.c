@@ -0,0 +1,190 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// Sum of absolute values (asumv).
+//
+// The absolute value of a complex element is |re| + |im|, as in the BLAS
+// ?asum routines, so complex vectors are summed as real vectors of twice
+// the length when stored contiguously, and as two strided real vectors
+// otherwise.
+
+// Return the sum of the absolute values of the n-length real vector x.
+static float bli_sasum1_zen_int
+     (
+       dim_t            n,
+       float*  restrict x, inc_t incx
+     )
+{
+	float sum = 0.0f;
+	dim_t i   = 0;
+
+	if ( incx == 1 )
+	{
+		const __m256 sign = _mm256_set1_ps( -0.0f );
+		__m256       acc0 = _mm256_setzero_ps();
+		__m256       acc1 = _mm256_setzero_ps();
+		__m256       acc2 = _mm256_setzero_ps();
+		__m256       acc3 = _mm256_setzero_ps();
+
+		for ( ; i + 32 <= n; i += 32 )
+		{
+			acc0 = _mm256_add_ps( acc0, _mm256_andnot_ps( sign, _mm256_loadu_ps( x + i +  0 ) ) );
+			acc1 = _mm256_add_ps( acc1, _mm256_andnot_ps( sign, _mm256_loadu_ps( x + i +  8 ) ) );
+			acc2 = _mm256_add_ps( acc2, _mm256_andnot_ps( sign, _mm256_loadu_ps( x + i + 16 ) ) );
+			acc3 = _mm256_add_ps( acc3, _mm256_andnot_ps( sign, _mm256_loadu_ps( x + i + 24 ) ) );
+		}
+
+		for ( ; i + 8 <= n; i += 8 )
+		{
+			acc0 = _mm256_add_ps( acc0, _mm256_andnot_ps( sign, _mm256_loadu_ps( x + i ) ) );
+		}
+
+		acc0 = _mm256_add_ps( _mm256_add_ps( acc0, acc1 ), _mm256_add_ps( acc2, acc3 ) );
+
+		__m128 acc = _mm_add_ps( _mm256_castps256_ps128( acc0 ), _mm256_extractf128_ps( acc0, 1 ) );
+		acc = _mm_add_ps( acc, _mm_movehl_ps( acc, acc ) );
+		acc = _mm_add_ss( acc, _mm_movehdup_ps( acc ) );
+
+		sum = _mm_cvtss_f32( acc );
+
+		_mm256_zeroupper();
+
+		for ( ; i < n; ++i )
+		{
+			sum += fabsf( x[i] );
+		}
+	}
+	else
+	{
+		for ( ; i < n; ++i )
+		{
+			sum += fabsf( *x );
+
+			x += incx;
+		}
+	}
+
+	return sum;
+}
+
+// Return the sum of the absolute values of the n-length real vector x.
+static double bli_dasum1_zen_int
+     (
+       dim_t            n,
+       double* restrict x, inc_t incx
+     )
+{
+	double sum = 0.0;
+	dim_t  i   = 0;
+
+	if ( incx == 1 )
+	{
+		const __m256d sign = _mm256_set1_pd( -0.0 );
+		__m256d       acc0 = _mm256_setzero_pd();
+		__m256d       acc1 = _mm256_setzero_pd();
+		__m256d       acc2 = _mm256_setzero_pd();
+		__m256d       acc3 = _mm256_setzero_pd();
+
+		for ( ; i + 16 <= n; i += 16 )
+		{
+			acc0 = _mm256_add_pd( acc0, _mm256_andnot_pd( sign, _mm256_loadu_pd( x + i +  0 ) ) );
+			acc1 = _mm256_add_pd( acc1, _mm256_andnot_pd( sign, _mm256_loadu_pd( x + i +  4 ) ) );
+			acc2 = _mm256_add_pd( acc2, _mm256_andnot_pd( sign, _mm256_loadu_pd( x + i +  8 ) ) );
+			acc3 = _mm256_add_pd( acc3, _mm256_andnot_pd( sign, _mm256_loadu_pd( x + i + 12 ) ) );
+		}
+
+		for ( ; i + 4 <= n; i += 4 )
+		{
+			acc0 = _mm256_add_pd( acc0, _mm256_andnot_pd( sign, _mm256_loadu_pd( x + i ) ) );
+		}
+
+		acc0 = _mm256_add_pd( _mm256_add_pd( acc0, acc1 ), _mm256_add_pd( acc2, acc3 ) );
+
+		__m128d acc = _mm_add_pd( _mm256_castpd256_pd128( acc0 ), _mm256_extractf128_pd( acc0, 1 ) );
+		acc = _mm_add_sd( acc, _mm_unpackhi_pd( acc, acc ) );
+
+		sum = _mm_cvtsd_f64( acc );
+
+		_mm256_zeroupper();
+
+		for ( ; i < n; ++i )
+		{
+			sum += fabs( x[i] );
+		}
+	}
+	else
+	{
+		for ( ; i < n; ++i )
+		{
+			sum += fabs( *x );
+
+			x += incx;
+		}
+	}
+
+	return sum;
+}
+
+// -----------------------------------------------------------------------------
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, is_cmplx ) \
+\
+void PASTEMAC(ch,opname) \
+     ( \
+       dim_t              n, \
+       ctype*    restrict x, inc_t incx, \
+       ctype_r*  restrict asum, \
+       cntx_t*   restrict cntx  \
+     ) \
+{ \
+	ctype_r* x_r = ( ctype_r* )x; \
+\
+	if      ( !is_cmplx ) \
+		*asum = PASTEMAC(chr,asum1_zen_int)( n, x_r, incx ); \
+	else if ( incx == 1 ) \
+		*asum = PASTEMAC(chr,asum1_zen_int)( 2*n, x_r, 1 ); \
+	else \
+		*asum = PASTEMAC(chr,asum1_zen_int)( n, x_r + 0, 2*incx ) + \
+		        PASTEMAC(chr,asum1_zen_int)( n, x_r + 1, 2*incx ); \
+}
+
+GENTFUNCR( float,    float,  s, s, asumv_zen_int, FALSE )
+GENTFUNCR( double,   double, d, d, asumv_zen_int, FALSE )
+GENTFUNCR( scomplex, float,  c, s, asumv_zen_int, TRUE  )
+GENTFUNCR( dcomplex, double, z, d, asumv_zen_int, TRUE  )
+
@@ -0,0 +1,469 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "immintrin.h"
+#include "blis.h"
+
+// Overflow-safe 2-norm kernels (normfv and sumsqv).
+//
+// The squares are summed without scaling in vector registers while the
+// largest absolute value is tracked alongside them, so that the common
+// case needs a single pass over x:
+//
+// - For single precision, the squares are converted to and summed in
+//   double precision, where they can neither overflow nor underflow.
+// - For double precision, the unscaled sum is accepted if it is finite and
+//   the largest absolute value is at least BLIS_DSUMSQ_TSML (so that any
+//   squares that underflowed are negligible). Otherwise, the squares of x
+//   are summed again after scaling x by 1/amax.
+//
+// Complex vectors are handled as real vectors of twice the length when
+// stored contiguously, and as their real and imaginary parts otherwise.
+// NaN and Inf propagate as they do in the reference (?lassq-based)
+// kernels.
+
+#define BLIS_DSUMSQ_TSML 0x1p-400
+
+typedef union
+{
+	__m256d v;
+	double  d[4] __attribute__((aligned(64)));
+} v4df_t;
+
+typedef union
+{
+	__m256  v;
+	float   f[8] __attribute__((aligned(64)));
+} v8sf_t;
+
+// Update the pair (scale, sumsq), which represents scale^2 * sumsq, with
+// another pair (s1, q1), without overflowing unnecessarily.
+static void bli_sumsq_zen_int_update
+     (
+       double           s1,
+       double           q1,
+       double* restrict scale,
+       double* restrict sumsq
+     )
+{
+	if ( *scale < s1 )
+	{
+		const double r = *scale / s1;
+
+		*sumsq = q1 + *sumsq * r * r;
+		*scale = s1;
+	}
+	else
+	{
+		const double r = s1 / *scale;
+
+		*sumsq = *sumsq + q1 * r * r;
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+// Accumulate the largest absolute value of the n elements of x into amax
+// and the sum of the squares of f * x into ssq.
+static void bli_dsumsq_zen_int_acc
+     (
+       dim_t            n,
+       double* restrict x, inc_t incx,
+       double           f,
+       double* restrict amax,
+       double* restrict ssq
+     )
+{
+	double amax_l = *amax;
+	double ssq_l  = *ssq;
+	dim_t  i      = 0;
+
+	if ( incx == 1 )
+	{
+		const __m256d signv = _mm256_set1_pd( -0.0 );
+		const __m256d fv    = _mm256_set1_pd( f );
+
+		__m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+		__m256d s2 = _mm256_setzero_pd(), s3 = _mm256_setzero_pd();
+		__m256d m0 = _mm256_setzero_pd(), m1 = _mm256_setzero_pd();
+		__m256d m2 = _mm256_setzero_pd(), m3 = _mm256_setzero_pd();
+
+		for ( ; i + 16 <= n; i += 16 )
+		{
+			__m256d x0 = _mm256_loadu_pd( x + i +  0 );
+			__m256d x1 = _mm256_loadu_pd( x + i +  4 );
+			__m256d x2 = _mm256_loadu_pd( x + i +  8 );
+			__m256d x3 = _mm256_loadu_pd( x + i + 12 );
+
+			m0 = _mm256_max_pd( m0, _mm256_andnot_pd( signv, x0 ) );
+			m1 = _mm256_max_pd( m1, _mm256_andnot_pd( signv, x1 ) );
+			m2 = _mm256_max_pd( m2, _mm256_andnot_pd( signv, x2 ) );
+			m3 = _mm256_max_pd( m3, _mm256_andnot_pd( signv, x3 ) );
+
+			x0 = _mm256_mul_pd( x0, fv );
+			x1 = _mm256_mul_pd( x1, fv );
+			x2 = _mm256_mul_pd( x2, fv );
+			x3 = _mm256_mul_pd( x3, fv );
+
+			s0 = _mm256_fmadd_pd( x0, x0, s0 );
+			s1 = _mm256_fmadd_pd( x1, x1, s1 );
+			s2 = _mm256_fmadd_pd( x2, x2, s2 );
+			s3 = _mm256_fmadd_pd( x3, x3, s3 );
+		}
+
+		for ( ; i + 4 <= n; i += 4 )
+		{
+			__m256d x0 = _mm256_loadu_pd( x + i );
+
+			m0 = _mm256_max_pd( m0, _mm256_andnot_pd( signv, x0 ) );
+			x0 = _mm256_mul_pd( x0, fv );
+			s0 = _mm256_fmadd_pd( x0, x0, s0 );
+		}
+
+		v4df_t sv, mv;
+
+		sv.v = _mm256_add_pd( _mm256_add_pd( s0, s1 ), _mm256_add_pd( s2, s3 ) );
+		mv.v = _mm256_max_pd( _mm256_max_pd( m0, m1 ), _mm256_max_pd( m2, m3 ) );
+
+		ssq_l += ( sv.d[0] + sv.d[1] ) + ( sv.d[2] + sv.d[3] );
+
+		for ( dim_t k = 0; k < 4; ++k )
+			if ( amax_l < mv.d[k] ) amax_l = mv.d[k];
+	}
+
+	for ( ; i < n; ++i )
+	{
+		const double chi1     = x[ i*incx ];
+		const double abs_chi1 = bli_fabs( chi1 );
+		const double chi1_f   = f * chi1;
+
+		if ( amax_l < abs_chi1 ) amax_l = abs_chi1;
+
+		ssq_l += chi1_f * chi1_f;
+	}
+
+	*amax = amax_l;
+	*ssq  = ssq_l;
+}
+
+static void bli_dsumsq_zen_int_vec
+     (
+       bool             is_cmplx,
+       dim_t            n,
+       double* restrict x, inc_t incx,
+       double           f,
+       double* restrict amax,
+       double* restrict ssq
+     )
+{
+	if ( !is_cmplx )
+	{
+		bli_dsumsq_zen_int_acc( n, x, incx, f, amax, ssq );
+	}
+	else if ( incx == 1 )
+	{
+		bli_dsumsq_zen_int_acc( 2*n, x, 1, f, amax, ssq );
+	}
+	else
+	{
+		bli_dsumsq_zen_int_acc( n, x,     2*incx, f, amax, ssq );
+		bli_dsumsq_zen_int_acc( n, x + 1, 2*incx, f, amax, ssq );
+	}
+}
+
+// Compute scale and ssq such that scale^2 * ssq is the sum of the squares
+// of the elements of x. Return FALSE (leaving scale and ssq unset) if x is
+// zero.
+static bool bli_dsumsq_zen_int
+     (
+       bool             is_cmplx,
+       dim_t            n,
+       double* restrict x, inc_t incx,
+       double* restrict scale,
+       double* restrict ssq
+     )
+{
+	double amax = 0.0;
+	double s    = 0.0;
+
+	bli_dsumsq_zen_int_vec( is_cmplx, n, x, incx, 1.0, &amax, &s );
+
+	if ( bli_isnan( s ) )          { *scale = 1.0;  *ssq = s;   return TRUE; }
+	if ( amax == 0.0 )             {                            return FALSE; }
+	if ( bli_isinf( amax ) )       { *scale = amax; *ssq = 1.0; return TRUE; }
+
+	if ( s <= DBL_MAX && amax >= BLIS_DSUMSQ_TSML )
+	{
+		*scale = 1.0;
+		*ssq   = s;
+		return TRUE;
+	}
+
+	// The unscaled sum overflowed, or some squares may have underflowed,
+	// so sum the squares again after scaling x by 1/amax. (If amax is
+	// subnormal, 1/amax may overflow; any large power of two will do.)
+	double f = 1.0 / amax;
+	if ( !( f <= DBL_MAX ) ) f = 0x1p1022;
+
+	amax = 0.0;
+	s    = 0.0;
+
+	bli_dsumsq_zen_int_vec( is_cmplx, n, x, incx, f, &amax, &s );
+
+	*scale = 1.0 / f;
+	*ssq   = s;
+	return TRUE;
+}
+
+// -----------------------------------------------------------------------------
+
+// Accumulate the largest absolute value of the n elements of x into amax
+// and the sum of their squares, computed in double precision, into ssq.
+static void bli_ssumsq_zen_int_acc
+     (
+       dim_t            n,
+       float*  restrict x, inc_t incx,
+       double* restrict amax,
+       double* restrict ssq
+     )
+{
+	float  amax_l = *amax;
+	double ssq_l  = *ssq;
+	dim_t  i      = 0;
+
+	if ( incx == 1 )
+	{
+		const __m256 signv = _mm256_set1_ps( -0.0f );
+
+		__m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+		__m256d s2 = _mm256_setzero_pd(), s3 = _mm256_setzero_pd();
+		__m256  m0 = _mm256_setzero_ps(), m1 = _mm256_setzero_ps();
+
+		for ( ; i + 16 <= n; i += 16 )
+		{
+			__m256 x0 = _mm256_loadu_ps( x + i + 0 );
+			__m256 x1 = _mm256_loadu_ps( x + i + 8 );
+
+			m0 = _mm256_max_ps( m0, _mm256_andnot_ps( signv, x0 ) );
+			m1 = _mm256_max_ps( m1, _mm256_andnot_ps( signv, x1 ) );
+
+			__m256d d0 = _mm256_cvtps_pd( _mm256_castps256_ps128( x0 ) );
+			__m256d d1 = _mm256_cvtps_pd( _mm256_extractf128_ps( x0, 1 ) );
+			__m256d d2 = _mm256_cvtps_pd( _mm256_castps256_ps128( x1 ) );
+			__m256d d3 = _mm256_cvtps_pd( _mm256_extractf128_ps( x1, 1 ) );
+
+			s0 = _mm256_fmadd_pd( d0, d0, s0 );
+			s1 = _mm256_fmadd_pd( d1, d1, s1 );
+			s2 = _mm256_fmadd_pd( d2, d2, s2 );
+			s3 = _mm256_fmadd_pd( d3, d3, s3 );
+		}
+
+		for ( ; i + 8 <= n; i += 8 )
+		{
+			__m256 x0 = _mm256_loadu_ps( x + i );
+
+			m0 = _mm256_max_ps( m0, _mm256_andnot_ps( signv, x0 ) );
+
+			__m256d d0 = _mm256_cvtps_pd( _mm256_castps256_ps128( x0 ) );
+			__m256d d1 = _mm256_cvtps_pd( _mm256_extractf128_ps( x0, 1 ) );
+
+			s0 = _mm256_fmadd_pd( d0, d0, s0 );
+			s1 = _mm256_fmadd_pd( d1, d1, s1 );
+		}
+
+		v4df_t sv;
+		v8sf_t mv;
+
+		sv.v = _mm256_add_pd( _mm256_add_pd( s0, s1 ), _mm256_add_pd( s2, s3 ) );
+		mv.v = _mm256_max_ps( m0, m1 );
+
+		ssq_l += ( sv.d[0] + sv.d[1] ) + ( sv.d[2] + sv.d[3] );
+
+		for ( dim_t k = 0; k < 8; ++k )
+			if ( amax_l < mv.f[k] ) amax_l = mv.f[k];
+	}
+
+	for ( ; i < n; ++i )
+	{
+		const double chi1     = x[ i*incx ];
+		const float  abs_chi1 = bli_fabs( x[ i*incx ] );
+
+		if ( amax_l < abs_chi1 ) amax_l = abs_chi1;
+
+		ssq_l += chi1 * chi1;
+	}
+
+	*amax = amax_l;
+	*ssq  = ssq_l;
+}
+
+// Compute amax and ssq, the largest absolute value and the sum of the
+// squares (in double precision) of the elements of x. Return FALSE if x
+// is zero.
+static bool bli_ssumsq_zen_int
+     (
+       bool             is_cmplx,
+       dim_t            n,
+       float*  restrict x, inc_t incx,
+       double* restrict amax,
+       double* restrict ssq
+     )
+{
+	*amax = 0.0;
+	*ssq  = 0.0;
+
+	if ( !is_cmplx )
+	{
+		bli_ssumsq_zen_int_acc( n, x, incx, amax, ssq );
+	}
+	else if ( incx == 1 )
+	{
+		bli_ssumsq_zen_int_acc( 2*n, x, 1, amax, ssq );
+	}
+	else
+	{
+		bli_ssumsq_zen_int_acc( n, x,     2*incx, amax, ssq );
+		bli_ssumsq_zen_int_acc( n, x + 1, 2*incx, amax, ssq );
+	}
+
+	return ( bool )( *amax != 0.0 || bli_isnan( *ssq ) );
+}
+
+// -----------------------------------------------------------------------------
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, varname, is_cmplx ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       dim_t              n, \
+       ctype*    restrict x, inc_t incx, \
+       ctype_r*  restrict scale, \
+       ctype_r*  restrict sumsq, \
+       cntx_t*   restrict cntx  \
+     ) \
+{ \
+	double amax, s; \
+\
+	if ( !bli_ssumsq_zen_int( is_cmplx, n, ( float* )x, incx, &amax, &s ) ) return; \
+\
+	/* Represent the sum of the squares as amax^2 * q1, which fits in
+	   single precision. */ \
+	double s1 = amax; \
+	double q1; \
+\
+	if      ( bli_isnan( s ) )    { s1 = 1.0; q1 = s; } \
+	else if ( bli_isinf( amax ) ) {           q1 = 1.0; } \
+	else                          {           q1 = ( s / amax ) / amax; } \
+\
+	double scale_l = *scale; \
+	double sumsq_l = *sumsq; \
+\
+	bli_sumsq_zen_int_update( s1, q1, &scale_l, &sumsq_l ); \
+\
+	*scale = scale_l; \
+	*sumsq = sumsq_l; \
+}
+
+GENTFUNCR( float,    float,  s, s, sumsqv_zen_int, FALSE )
+GENTFUNCR( scomplex, float,  c, s, sumsqv_zen_int, TRUE  )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, varname, is_cmplx ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       dim_t              n, \
+       ctype*    restrict x, inc_t incx, \
+       ctype_r*  restrict scale, \
+       ctype_r*  restrict sumsq, \
+       cntx_t*   restrict cntx  \
+     ) \
+{ \
+	double s1, q1; \
+\
+	if ( bli_dsumsq_zen_int( is_cmplx, n, ( double* )x, incx, &s1, &q1 ) ) \
+		bli_sumsq_zen_int_update( s1, q1, scale, sumsq ); \
+}
+
+GENTFUNCR( double,   double, d, d, sumsqv_zen_int, FALSE )
+GENTFUNCR( dcomplex, double, z, d, sumsqv_zen_int, TRUE  )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, varname, is_cmplx ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       dim_t              n, \
+       ctype*    restrict x, inc_t incx, \
+       ctype_r*  restrict norm, \
+       cntx_t*   restrict cntx  \
+     ) \
+{ \
+	double amax, s; \
+\
+	if ( bli_ssumsq_zen_int( is_cmplx, n, ( float* )x, incx, &amax, &s ) ) \
+		*norm = sqrt( s ); \
+	else \
+		*norm = 0.0F; \
+}
+
+GENTFUNCR( float,    float,  s, s, normfv_zen_int, FALSE )
+GENTFUNCR( scomplex, float,  c, s, normfv_zen_int, TRUE  )
+
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, varname, is_cmplx ) \
+\
+void PASTEMAC(ch,varname) \
+     ( \
+       dim_t              n, \
+       ctype*    restrict x, inc_t incx, \
+       ctype_r*  restrict norm, \
+       cntx_t*   restrict cntx  \
+     ) \
+{ \
+	double s1, q1; \
+\
+	if ( bli_dsumsq_zen_int( is_cmplx, n, ( double* )x, incx, &s1, &q1 ) ) \
+		*norm = s1 * sqrt( q1 ); \
+	else \
+		*norm = 0.0; \
+}
+
+GENTFUNCR( double,   double, d, d, normfv_zen_int, FALSE )
+GENTFUNCR( dcomplex, double, z, d, normfv_zen_int, TRUE  )
+
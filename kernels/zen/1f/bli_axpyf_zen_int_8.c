@@ -470,3 +470,258 @@ void bli_daxpyf_zen_int_8
 	}
 }
 
+
+// -----------------------------------------------------------------------------
+
+// The complex kernels below form each product a * chi as
+//
+//   a * re(chi) + swap(a) * im(chi),
+//
+// accumulating the two halves separately over the fused columns and
+// combining them once per vector of y. The combination alone depends on
+// conja, so conjugating A costs nothing extra.
+
+void bli_caxpyf_zen_int_8
+     (
+       conj_t             conja,
+       conj_t             conjx,
+       dim_t              m,
+       dim_t              b_n,
+       scomplex* restrict alpha,
+       scomplex* restrict a, inc_t inca, inc_t lda,
+       scomplex* restrict x, inc_t incx,
+       scomplex* restrict y, inc_t incy,
+       cntx_t*   restrict cntx
+     )
+{
+	const dim_t fuse_fac       = 8;
+	const dim_t n_elem_per_reg = 4;
+
+	dim_t       i;
+
+	// If either dimension is zero, or if alpha is zero, return early.
+	if ( bli_zero_dim2( m, b_n ) || PASTEMAC(c,eq0)( *alpha ) ) return;
+
+	// If b_n is not equal to the fusing factor, or if the columns of A or
+	// y are not contiguous, then perform the entire operation as a loop
+	// over axpyv.
+	if ( b_n != fuse_fac || inca != 1 || incy != 1 )
+	{
+		caxpyv_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_SCOMPLEX, BLIS_AXPYV_KER, cntx );
+
+		for ( i = 0; i < b_n; ++i )
+		{
+			scomplex* a1   = a + (0  )*inca + (i  )*lda;
+			scomplex* chi1 = x + (i  )*incx;
+			scomplex* y1   = y + (0  )*incy;
+			scomplex  alpha_chi1;
+
+			PASTEMAC(c,copycjs)( conjx, *chi1, alpha_chi1 );
+			PASTEMAC(c,scals)( *alpha, alpha_chi1 );
+
+			f
+			(
+			  conja,
+			  m,
+			  &alpha_chi1,
+			  a1, inca,
+			  y1, incy,
+			  cntx
+			);
+		}
+
+		return;
+	}
+
+	// At this point, we know that b_n is exactly equal to the fusing factor
+	// and that A and y are unit-stride.
+
+	scomplex chi[ 8 ];
+
+	for ( dim_t j = 0; j < fuse_fac; ++j )
+	{
+		PASTEMAC(c,copycjs)( conjx, *( x + j*incx ), chi[ j ] );
+		PASTEMAC(c,scals)( *alpha, chi[ j ] );
+	}
+
+	const bool   is_conja = bli_is_conj( conja );
+	const __m256 signv    = _mm256_setr_ps( 1.0f, -1.0f, 1.0f, -1.0f,
+	                                        1.0f, -1.0f, 1.0f, -1.0f );
+
+	for ( i = 0; i + 2*n_elem_per_reg <= m; i += 2*n_elem_per_reg )
+	{
+		__m256 acc_r0 = _mm256_setzero_ps();
+		__m256 acc_r1 = _mm256_setzero_ps();
+		__m256 acc_i0 = _mm256_setzero_ps();
+		__m256 acc_i1 = _mm256_setzero_ps();
+
+		for ( dim_t j = 0; j < fuse_fac; ++j )
+		{
+			float* restrict aj    = ( float* )( a + i + j*lda );
+			__m256          a0v   = _mm256_loadu_ps( aj + 0 );
+			__m256          a1v   = _mm256_loadu_ps( aj + 8 );
+			__m256          chi_r = _mm256_broadcast_ss( &chi[ j ].real );
+			__m256          chi_i = _mm256_broadcast_ss( &chi[ j ].imag );
+
+			acc_r0 = _mm256_fmadd_ps( a0v, chi_r, acc_r0 );
+			acc_r1 = _mm256_fmadd_ps( a1v, chi_r, acc_r1 );
+			acc_i0 = _mm256_fmadd_ps( _mm256_permute_ps( a0v, 0xB1 ), chi_i, acc_i0 );
+			acc_i1 = _mm256_fmadd_ps( _mm256_permute_ps( a1v, 0xB1 ), chi_i, acc_i1 );
+		}
+
+		// a * chi        = ( ar*cr - ai*ci, ai*cr + ar*ci )
+		// conj(a) * chi  = ( ar*cr + ai*ci, ar*ci - ai*cr )
+		if ( is_conja )
+		{
+			acc_r0 = _mm256_fmadd_ps( acc_r0, signv, acc_i0 );
+			acc_r1 = _mm256_fmadd_ps( acc_r1, signv, acc_i1 );
+		}
+		else
+		{
+			acc_r0 = _mm256_addsub_ps( acc_r0, acc_i0 );
+			acc_r1 = _mm256_addsub_ps( acc_r1, acc_i1 );
+		}
+
+		float* restrict yi = ( float* )( y + i );
+
+		_mm256_storeu_ps( yi + 0, _mm256_add_ps( _mm256_loadu_ps( yi + 0 ), acc_r0 ) );
+		_mm256_storeu_ps( yi + 8, _mm256_add_ps( _mm256_loadu_ps( yi + 8 ), acc_r1 ) );
+	}
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( ; i < m; ++i )
+	{
+		if ( is_conja )
+		{
+			for ( dim_t j = 0; j < fuse_fac; ++j )
+				PASTEMAC(c,axpyjs)( chi[ j ], a[ i + j*lda ], y[ i ] );
+		}
+		else
+		{
+			for ( dim_t j = 0; j < fuse_fac; ++j )
+				PASTEMAC(c,axpys)( chi[ j ], a[ i + j*lda ], y[ i ] );
+		}
+	}
+}
+
+void bli_zaxpyf_zen_int_8
+     (
+       conj_t             conja,
+       conj_t             conjx,
+       dim_t              m,
+       dim_t              b_n,
+       dcomplex* restrict alpha,
+       dcomplex* restrict a, inc_t inca, inc_t lda,
+       dcomplex* restrict x, inc_t incx,
+       dcomplex* restrict y, inc_t incy,
+       cntx_t*   restrict cntx
+     )
+{
+	const dim_t fuse_fac       = 8;
+	const dim_t n_elem_per_reg = 2;
+
+	dim_t       i;
+
+	// If either dimension is zero, or if alpha is zero, return early.
+	if ( bli_zero_dim2( m, b_n ) || PASTEMAC(z,eq0)( *alpha ) ) return;
+
+	// If b_n is not equal to the fusing factor, or if the columns of A or
+	// y are not contiguous, then perform the entire operation as a loop
+	// over axpyv.
+	if ( b_n != fuse_fac || inca != 1 || incy != 1 )
+	{
+		zaxpyv_ker_ft f = bli_cntx_get_l1v_ker_dt( BLIS_DCOMPLEX, BLIS_AXPYV_KER, cntx );
+
+		for ( i = 0; i < b_n; ++i )
+		{
+			dcomplex* a1   = a + (0  )*inca + (i  )*lda;
+			dcomplex* chi1 = x + (i  )*incx;
+			dcomplex* y1   = y + (0  )*incy;
+			dcomplex  alpha_chi1;
+
+			PASTEMAC(z,copycjs)( conjx, *chi1, alpha_chi1 );
+			PASTEMAC(z,scals)( *alpha, alpha_chi1 );
+
+			f
+			(
+			  conja,
+			  m,
+			  &alpha_chi1,
+			  a1, inca,
+			  y1, incy,
+			  cntx
+			);
+		}
+
+		return;
+	}
+
+	// At this point, we know that b_n is exactly equal to the fusing factor
+	// and that A and y are unit-stride.
+
+	dcomplex chi[ 8 ];
+
+	for ( dim_t j = 0; j < fuse_fac; ++j )
+	{
+		PASTEMAC(z,copycjs)( conjx, *( x + j*incx ), chi[ j ] );
+		PASTEMAC(z,scals)( *alpha, chi[ j ] );
+	}
+
+	const bool    is_conja = bli_is_conj( conja );
+	const __m256d signv    = _mm256_setr_pd( 1.0, -1.0, 1.0, -1.0 );
+
+	for ( i = 0; i + 2*n_elem_per_reg <= m; i += 2*n_elem_per_reg )
+	{
+		__m256d acc_r0 = _mm256_setzero_pd();
+		__m256d acc_r1 = _mm256_setzero_pd();
+		__m256d acc_i0 = _mm256_setzero_pd();
+		__m256d acc_i1 = _mm256_setzero_pd();
+
+		for ( dim_t j = 0; j < fuse_fac; ++j )
+		{
+			double* restrict aj    = ( double* )( a + i + j*lda );
+			__m256d          a0v   = _mm256_loadu_pd( aj + 0 );
+			__m256d          a1v   = _mm256_loadu_pd( aj + 4 );
+			__m256d          chi_r = _mm256_broadcast_sd( &chi[ j ].real );
+			__m256d          chi_i = _mm256_broadcast_sd( &chi[ j ].imag );
+
+			acc_r0 = _mm256_fmadd_pd( a0v, chi_r, acc_r0 );
+			acc_r1 = _mm256_fmadd_pd( a1v, chi_r, acc_r1 );
+			acc_i0 = _mm256_fmadd_pd( _mm256_permute_pd( a0v, 0x5 ), chi_i, acc_i0 );
+			acc_i1 = _mm256_fmadd_pd( _mm256_permute_pd( a1v, 0x5 ), chi_i, acc_i1 );
+		}
+
+		// a * chi        = ( ar*cr - ai*ci, ai*cr + ar*ci )
+		// conj(a) * chi  = ( ar*cr + ai*ci, ar*ci - ai*cr )
+		if ( is_conja )
+		{
+			acc_r0 = _mm256_fmadd_pd( acc_r0, signv, acc_i0 );
+			acc_r1 = _mm256_fmadd_pd( acc_r1, signv, acc_i1 );
+		}
+		else
+		{
+			acc_r0 = _mm256_addsub_pd( acc_r0, acc_i0 );
+			acc_r1 = _mm256_addsub_pd( acc_r1, acc_i1 );
+		}
+
+		double* restrict yi = ( double* )( y + i );
+
+		_mm256_storeu_pd( yi + 0, _mm256_add_pd( _mm256_loadu_pd( yi + 0 ), acc_r0 ) );
+		_mm256_storeu_pd( yi + 4, _mm256_add_pd( _mm256_loadu_pd( yi + 4 ), acc_r1 ) );
+	}
+
+	// If there are leftover iterations, perform them with scalar code.
+	for ( ; i < m; ++i )
+	{
+		if ( is_conja )
+		{
+			for ( dim_t j = 0; j < fuse_fac; ++j )
+				PASTEMAC(z,axpyjs)( chi[ j ], a[ i + j*lda ], y[ i ] );
+		}
+		else
+		{
+			for ( dim_t j = 0; j < fuse_fac; ++j )
+				PASTEMAC(z,axpys)( chi[ j ], a[ i + j*lda ], y[ i ] );
+		}
+	}
+}
@@ -45,6 +45,20 @@ PACKM_KER_PROT(double, d, packm_6xk_nn_zen)
 // amaxv (intrinsics)
 AMAXV_KER_PROT( float,    s, amaxv_zen_int )
 AMAXV_KER_PROT( double,   d, amaxv_zen_int )
+AMAXV_KER_PROT( scomplex, c, amaxv_zen_int )
+AMAXV_KER_PROT( dcomplex, z, amaxv_zen_int )
+
+// aminv (intrinsics)
+AMINV_KER_PROT( float,    s, aminv_zen_int )
+AMINV_KER_PROT( double,   d, aminv_zen_int )
+AMINV_KER_PROT( scomplex, c, aminv_zen_int )
+AMINV_KER_PROT( dcomplex, z, aminv_zen_int )
+
+// asumv (intrinsics)
+ASUMV_KER_PROT( float,    float,  s, s, asumv_zen_int )
+ASUMV_KER_PROT( double,   double, d, d, asumv_zen_int )
+ASUMV_KER_PROT( scomplex, float,  c, s, asumv_zen_int )
+ASUMV_KER_PROT( dcomplex, double, z, d, asumv_zen_int )
 
 // axpyv (intrinsics)
 AXPYV_KER_PROT( float,    s, axpyv_zen_int )
@@ -86,11 +100,37 @@ COPYV_KER_PROT( double,   d, copyv_zen_int )
 SETV_KER_PROT(float,    s, setv_zen_int)
 SETV_KER_PROT(double,   d, setv_zen_int)
 
+// normfv (intrinsics)
+NORMFV_KER_PROT( float,    float,  s, s, normfv_zen_int )
+NORMFV_KER_PROT( double,   double, d, d, normfv_zen_int )
+NORMFV_KER_PROT( scomplex, float,  c, s, normfv_zen_int )
+NORMFV_KER_PROT( dcomplex, double, z, d, normfv_zen_int )
+
+// sumsqv (intrinsics)
+SUMSQV_KER_PROT( float,    float,  s, s, sumsqv_zen_int )
+SUMSQV_KER_PROT( double,   double, d, d, sumsqv_zen_int )
+SUMSQV_KER_PROT( scomplex, float,  c, s, sumsqv_zen_int )
+SUMSQV_KER_PROT( dcomplex, double, z, d, sumsqv_zen_int )
+
+// rotmv (intrinsics)
+ROTMV_KER_PROT( float,    float,  s, s, rotmv_zen_int )
+ROTMV_KER_PROT( double,   double, d, d, rotmv_zen_int )
+ROTMV_KER_PROT( scomplex, float,  c, s, rotmv_zen_int )
+ROTMV_KER_PROT( dcomplex, double, z, d, rotmv_zen_int )
+
+// rotv (intrinsics)
+ROTV_KER_PROT( float,    float,  s, s, rotv_zen_int )
+ROTV_KER_PROT( double,   double, d, d, rotv_zen_int )
+ROTV_KER_PROT( scomplex, float,  c, s, rotv_zen_int )
+ROTV_KER_PROT( dcomplex, double, z, d, rotv_zen_int )
+
 // -- level-1f --
 
 // axpyf (intrinsics)
 AXPYF_KER_PROT( float,    s, axpyf_zen_int_8 )
 AXPYF_KER_PROT( double,   d, axpyf_zen_int_8 )
+AXPYF_KER_PROT( scomplex, c, axpyf_zen_int_8 )
+AXPYF_KER_PROT( dcomplex, z, axpyf_zen_int_8 )
 
 // dotxf (intrinsics)
 DOTXF_KER_PROT( float,    s, dotxf_zen_int_8 )
@@ -0,0 +1,83 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+       dim_t              n, \
+       ctype*    restrict x, inc_t incx, \
+       ctype_r*  restrict norm, \
+       cntx_t*   restrict cntx  \
+     ) \
+{ \
+	ctype_r* zero       = PASTEMAC(chr,0); \
+	ctype_r* one        = PASTEMAC(chr,1); \
+	ctype_r  scale; \
+	ctype_r  sumsq; \
+	ctype_r  sqrt_sumsq; \
+\
+	/* Initialize scale and sumsq to begin the summation. */ \
+	PASTEMAC(chr,copys)( *zero, scale ); \
+	PASTEMAC(chr,copys)( *one,  sumsq ); \
+\
+	/* Query the context for the kernel function pointer. */ \
+	const num_t               dt       = PASTEMAC(ch,type); \
+	PASTECH(ch,sumsqv_ker_ft) sumsqv_p = bli_cntx_get_l1v_ker_dt( dt, BLIS_SUMSQV_KER, cntx ); \
+\
+	/* Compute the sum of the squares of the vector. We use sumsqv rather
+	   than dotv because the latter does not guard against overflow (see
+	   GitHub issue #332). */ \
+	sumsqv_p \
+	( \
+	  n, \
+	  x, incx, \
+	  &scale, \
+	  &sumsq, \
+	  cntx  \
+	); \
+\
+	/* Compute: norm = scale * sqrt( sumsq ) */ \
+	PASTEMAC(chr,sqrt2s)( sumsq, sqrt_sumsq ); \
+	PASTEMAC(chr,scals)( scale, sqrt_sumsq ); \
+\
+	/* Store the final value to the output variable. */ \
+	PASTEMAC(chr,copys)( sqrt_sumsq, *norm ); \
+}
+
+INSERT_GENTFUNCR_BASIC2( normfv, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
@@ -0,0 +1,101 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// The modified rotation H = [ h11 h12; h21 h22 ] is given by columns in h.
+// The framework expands the compact forms of H used by the BLAS before
+// calling the kernel. As with rotv, complex vectors are processed as
+// interleaved real vectors.
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+       dim_t              n, \
+       ctype*    restrict x, inc_t incx, \
+       ctype*    restrict y, inc_t incy, \
+       ctype_r*  restrict h, \
+       cntx_t*   restrict cntx  \
+     ) \
+{ \
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	const num_t       dt     = PASTEMAC(ch,type); \
+	const dim_t       n_elem = ( bli_is_complex( dt ) ? 2 : 1 ); \
+\
+	const ctype_r     h11    = h[0]; \
+	const ctype_r     h21    = h[1]; \
+	const ctype_r     h12    = h[2]; \
+	const ctype_r     h22    = h[3]; \
+\
+	ctype_r* restrict xr     = ( ctype_r* )x; \
+	ctype_r* restrict yr     = ( ctype_r* )y; \
+\
+	if ( incx == 1 && incy == 1 ) \
+	{ \
+		const dim_t n_r = n * n_elem; \
+\
+		PRAGMA_SIMD \
+		for ( dim_t i = 0; i < n_r; ++i ) \
+		{ \
+			const ctype_r chi1 = xr[i]; \
+			const ctype_r psi1 = yr[i]; \
+\
+			xr[i] = h11 * chi1 + h12 * psi1; \
+			yr[i] = h21 * chi1 + h22 * psi1; \
+		} \
+	} \
+	else \
+	{ \
+		for ( dim_t i = 0; i < n; ++i ) \
+		{ \
+			for ( dim_t k = 0; k < n_elem; ++k ) \
+			{ \
+				const ctype_r chi1 = xr[k]; \
+				const ctype_r psi1 = yr[k]; \
+\
+				xr[k] = h11 * chi1 + h12 * psi1; \
+				yr[k] = h21 * chi1 + h22 * psi1; \
+			} \
+\
+			xr += incx * n_elem; \
+			yr += incy * n_elem; \
+		} \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC2( rotmv, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
@@ -0,0 +1,99 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// Complex vectors are rotated by real c and s, which act independently on
+// the real and imaginary parts of each element. Thus, the real and
+// imaginary parts are processed as interleaved real vectors.
+
+#undef  GENTFUNCR
+#define GENTFUNCR( ctype, ctype_r, ch, chr, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+       dim_t              n, \
+       ctype*    restrict x, inc_t incx, \
+       ctype*    restrict y, inc_t incy, \
+       ctype_r*  restrict c, \
+       ctype_r*  restrict s, \
+       cntx_t*   restrict cntx  \
+     ) \
+{ \
+	if ( bli_zero_dim1( n ) ) return; \
+\
+	const num_t       dt     = PASTEMAC(ch,type); \
+	const dim_t       n_elem = ( bli_is_complex( dt ) ? 2 : 1 ); \
+\
+	const ctype_r     cv     = *c; \
+	const ctype_r     sv     = *s; \
+\
+	ctype_r* restrict xr     = ( ctype_r* )x; \
+	ctype_r* restrict yr     = ( ctype_r* )y; \
+\
+	if ( incx == 1 && incy == 1 ) \
+	{ \
+		const dim_t n_r = n * n_elem; \
+\
+		PRAGMA_SIMD \
+		for ( dim_t i = 0; i < n_r; ++i ) \
+		{ \
+			const ctype_r chi1 = xr[i]; \
+			const ctype_r psi1 = yr[i]; \
+\
+			xr[i] = cv * chi1 + sv * psi1; \
+			yr[i] = cv * psi1 - sv * chi1; \
+		} \
+	} \
+	else \
+	{ \
+		for ( dim_t i = 0; i < n; ++i ) \
+		{ \
+			for ( dim_t k = 0; k < n_elem; ++k ) \
+			{ \
+				const ctype_r chi1 = xr[k]; \
+				const ctype_r psi1 = yr[k]; \
+\
+				xr[k] = cv * chi1 + sv * psi1; \
+				yr[k] = cv * psi1 - sv * chi1; \
+			} \
+\
+			xr += incx * n_elem; \
+			yr += incy * n_elem; \
+		} \
+	} \
+}
+
+INSERT_GENTFUNCR_BASIC2( rotv, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
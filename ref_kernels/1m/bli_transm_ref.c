@@ -0,0 +1,93 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#include "blis.h"
+
+//
+// B := alpha * conja( A )^T, where A is an m x n matrix stored by columns
+// (with leading dimension lda) and B is an n x m matrix stored by columns
+// (with leading dimension ldb). The caller is expected to block the
+// operation so that both tiles remain in cache; the reference kernel
+// simply streams down the columns of A.
+//
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+       conj_t           conja, \
+       dim_t            m, \
+       dim_t            n, \
+       ctype*  restrict alpha, \
+       ctype*  restrict a, inc_t lda, \
+       ctype*  restrict b, inc_t ldb, \
+       cntx_t* restrict cntx  \
+     ) \
+{ \
+	if ( PASTEMAC(ch,eq1)( *alpha ) ) \
+	{ \
+		if ( bli_is_conj( conja ) ) \
+		{ \
+			for ( dim_t j = 0; j < n; ++j ) \
+			for ( dim_t i = 0; i < m; ++i ) \
+				PASTEMAC2(ch,ch,copyjs)( *(a + i + j*lda), *(b + j + i*ldb) ); \
+		} \
+		else \
+		{ \
+			for ( dim_t j = 0; j < n; ++j ) \
+			for ( dim_t i = 0; i < m; ++i ) \
+				PASTEMAC2(ch,ch,copys)( *(a + i + j*lda), *(b + j + i*ldb) ); \
+		} \
+	} \
+	else \
+	{ \
+		if ( bli_is_conj( conja ) ) \
+		{ \
+			for ( dim_t j = 0; j < n; ++j ) \
+			for ( dim_t i = 0; i < m; ++i ) \
+				PASTEMAC3(ch,ch,ch,scal2js)( *alpha, *(a + i + j*lda), *(b + j + i*ldb) ); \
+		} \
+		else \
+		{ \
+			for ( dim_t j = 0; j < n; ++j ) \
+			for ( dim_t i = 0; i < m; ++i ) \
+				PASTEMAC3(ch,ch,ch,scal2s)( *alpha, *(a + i + j*lda), *(b + j + i*ldb) ); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC2( transm, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
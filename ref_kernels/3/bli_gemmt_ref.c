@@ -0,0 +1,106 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// A reference implementation of the triangle-aware gemm microkernel used by
+// herk/syrk and gemmt for microtiles that intersect the diagonal of C. The
+// full microtile is computed via the (virtual) gemm microkernel into a local
+// buffer and only the elements in the stored triangle of the m x n submatrix
+// of C are then updated. An optimized implementation would instead mask the
+// updates to C directly from registers.
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, arch, suf, uplo ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+       doff_t              diagoff, \
+       dim_t               m, \
+       dim_t               n, \
+       dim_t               k, \
+       ctype*     restrict alpha, \
+       ctype*     restrict a, \
+       ctype*     restrict b, \
+       ctype*     restrict beta, \
+       ctype*     restrict c, inc_t rs_c, inc_t cs_c, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     ) \
+{ \
+	const num_t     dt       = PASTEMAC(ch,type); \
+\
+	const dim_t     mr       = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx ); \
+	const dim_t     nr       = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx ); \
+\
+	const bool      col_pref = bli_cntx_l3_vir_ukr_prefers_cols_dt( dt, BLIS_GEMM_UKR, cntx ); \
+\
+	ctype           ct[ BLIS_STACK_BUF_MAX_SIZE \
+	                    / sizeof( ctype ) ] \
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+	const inc_t     rs_ct    = ( col_pref ? 1 : nr ); \
+	const inc_t     cs_ct    = ( col_pref ? mr : 1 ); \
+\
+	ctype*          zero     = PASTEMAC(ch,0); \
+\
+	PASTECH(ch,gemm_ukr_ft) \
+	                gemm_ukr = bli_cntx_get_l3_vir_ukr_dt( dt, BLIS_GEMM_UKR, cntx ); \
+\
+	/* ct = alpha * a * b; */ \
+	gemm_ukr \
+	( \
+	  k, \
+	  alpha, \
+	  a, \
+	  b, \
+	  zero, \
+	  ct, rs_ct, cs_ct, \
+	  data, \
+	  cntx  \
+	); \
+\
+	/* c = beta * c + ct; (stored triangle only) */ \
+	PASTEMAC2(ch,xpbys_mxn_,uplo) \
+	( \
+	  diagoff, \
+	  m, n, \
+	  ct,   rs_ct, cs_ct, \
+	  beta, \
+	  c,    rs_c,  cs_c  \
+	); \
+}
+
+INSERT_GENTFUNC_BASIC3( gemmt_l, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX, l )
+INSERT_GENTFUNC_BASIC3( gemmt_u, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX, u )
+
@@ -0,0 +1,105 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// Reference sparse (csr) times dense microkernel. For each of the m rows
+// of A, the kernel gathers the rows of the packed micropanel of B selected
+// by the column indices of that row's nonzeros, and then updates the
+// corresponding row of the m x n submatrix of C:
+//
+//   C(i,0:n-1) := beta * C(i,0:n-1)
+//               + alpha * sum_p a_val[p] * B(a_ind[p],0:n-1),
+//
+// where p ranges over [ a_ptr[i], a_ptr[i+1] ) and B(l,j) = b[ l*rs_b + j ].
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, opname, arch, suf ) \
+\
+void PASTEMAC3(ch,opname,arch,suf) \
+     ( \
+       dim_t               m, \
+       dim_t               n, \
+       ctype*     restrict alpha, \
+       ctype*     restrict a_val, inc_t* restrict a_ptr, dim_t* restrict a_ind, \
+       ctype*     restrict b, inc_t rs_b, \
+       ctype*     restrict beta, \
+       ctype*     restrict c, inc_t rs_c, inc_t cs_c, \
+       auxinfo_t* restrict data, \
+       cntx_t*    restrict cntx  \
+     ) \
+{ \
+	ctype           ab[ BLIS_STACK_BUF_MAX_SIZE \
+	                    / sizeof( ctype ) ] \
+	                    __attribute__((aligned(BLIS_STACK_BUF_ALIGN_SIZE))); \
+\
+	const bool      beta0 = PASTEMAC(ch,eq0)( *beta ); \
+\
+	for ( dim_t i = 0; i < m; ++i ) \
+	{ \
+		ctype* restrict c_i = c + i*rs_c; \
+\
+		PRAGMA_SIMD \
+		for ( dim_t j = 0; j < n; ++j ) \
+		{ \
+			PASTEMAC(ch,set0s)( ab[ j ] ); \
+		} \
+\
+		for ( inc_t p = a_ptr[ i ]; p < a_ptr[ i + 1 ]; ++p ) \
+		{ \
+			ctype* restrict b_l = b + a_ind[ p ]*rs_b; \
+			ctype           a_p = a_val[ p ]; \
+\
+			PRAGMA_SIMD \
+			for ( dim_t j = 0; j < n; ++j ) \
+			{ \
+				PASTEMAC(ch,axpys)( a_p, b_l[ j ], ab[ j ] ); \
+			} \
+		} \
+\
+		if ( beta0 ) \
+		{ \
+			for ( dim_t j = 0; j < n; ++j ) \
+			PASTEMAC(ch,scal2s)( *alpha, ab[ j ], c_i[ j*cs_c ] ); \
+		} \
+		else \
+		{ \
+			for ( dim_t j = 0; j < n; ++j ) \
+			PASTEMAC(ch,axpbys)( *alpha, ab[ j ], *beta, c_i[ j*cs_c ] ); \
+		} \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC2( spmm_csr, BLIS_CNAME_INFIX, BLIS_REF_SUFFIX )
+
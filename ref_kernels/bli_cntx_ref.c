@@ -59,11 +59,25 @@
 #define trsm_l_ukr_name     GENARNAME(trsm_l)
 #undef  trsm_u_ukr_name
 #define trsm_u_ukr_name     GENARNAME(trsm_u)
+#undef  gemmt_l_ukr_name
+#define gemmt_l_ukr_name    GENARNAME(gemmt_l)
+#undef  gemmt_u_ukr_name
+#define gemmt_u_ukr_name    GENARNAME(gemmt_u)
 
 // Instantiate prototypes for above functions via the native micro-kernel API
 // template.
 #include "bli_l3_ukr.h"
 
+// -- prototype for the generic sparse (csr) times dense microkernel --
+
+#undef  spmm_csr_ukr_name
+#define spmm_csr_ukr_name   GENARNAME(spmm_csr)
+
+#undef  GENTPROT
+#define GENTPROT SPMM_CSR_UKR_PROT
+
+INSERT_GENTPROT_BASIC0( spmm_csr_ukr_name )
+
 // -- Level-3 virtual micro-kernel prototype redefinitions ---------------------
 
 // -- 3mh --
@@ -254,6 +268,9 @@
 #undef  packm_16xk_1er_ker_name
 #define packm_16xk_1er_ker_name GENARNAME(packm_16xk_1er)
 
+#undef  transm_ker_name
+#define transm_ker_name         GENARNAME(transm)
+
 // Instantiate prototypes for above functions via the level-1m kernel API
 // template.
 #include "bli_l1m_ker.h"
@@ -283,6 +300,10 @@
 #define addv_ker_name      GENARNAME(addv)
 #undef  amaxv_ker_name
 #define amaxv_ker_name     GENARNAME(amaxv)
+#undef  aminv_ker_name
+#define aminv_ker_name     GENARNAME(aminv)
+#undef  asumv_ker_name
+#define asumv_ker_name     GENARNAME(asumv)
 #undef  axpbyv_ker_name
 #define axpbyv_ker_name    GENARNAME(axpbyv)
 #undef  axpyv_ker_name
@@ -295,6 +316,12 @@
 #define dotxv_ker_name     GENARNAME(dotxv)
 #undef  invertv_ker_name
 #define invertv_ker_name   GENARNAME(invertv)
+#undef  normfv_ker_name
+#define normfv_ker_name    GENARNAME(normfv)
+#undef  rotmv_ker_name
+#define rotmv_ker_name     GENARNAME(rotmv)
+#undef  rotv_ker_name
+#define rotv_ker_name      GENARNAME(rotv)
 #undef  scalv_ker_name
 #define scalv_ker_name     GENARNAME(scalv)
 #undef  scal2v_ker_name
@@ -303,6 +330,8 @@
 #define setv_ker_name      GENARNAME(setv)
 #undef  subv_ker_name
 #define subv_ker_name      GENARNAME(subv)
+#undef  sumsqv_ker_name
+#define sumsqv_ker_name    GENARNAME(sumsqv)
 #undef  swapv_ker_name
 #define swapv_ker_name     GENARNAME(swapv)
 #undef  xpbyv_ker_name
@@ -405,6 +434,25 @@ void GENBARNAME(cntx_init)
 	gen_func_init( &funcs[ BLIS_GEMMTRSM_U_UKR ], gemmtrsm_u_ukr_name );
 	gen_func_init( &funcs[ BLIS_TRSM_L_UKR ],     trsm_l_ukr_name     );
 	gen_func_init( &funcs[ BLIS_TRSM_U_UKR ],     trsm_u_ukr_name     );
+	gen_func_init( &funcs[ BLIS_GEMMT_L_UKR ],    gemmt_l_ukr_name    );
+	gen_func_init( &funcs[ BLIS_GEMMT_U_UKR ],    gemmt_u_ukr_name    );
+
+	// There is no reference masked-edge gemm microkernel. Leaving the slot
+	// empty tells the macrokernel to handle edge cases via a temporary
+	// buffer and the regular gemm microkernel.
+	bli_func_init_null( &funcs[ BLIS_GEMM_EDGE_UKR ] );
+
+	gen_func_init( &funcs[ BLIS_SPMM_CSR_UKR ],   spmm_csr_ukr_name   );
+
+	// There is no reference streaming-store gemm microkernel. Leaving the
+	// slot empty tells the macrokernel to write C with the regular gemm
+	// microkernel even when streaming stores are requested.
+	bli_func_init_null( &funcs[ BLIS_GEMM_NT_UKR ] );
+
+	// Likewise, there is no reference gemm microkernel for bfloat16-packed
+	// B. Leaving the slot empty causes requests for such packing to be
+	// ignored.
+	bli_func_init_null( &funcs[ BLIS_GEMM_BF16B_UKR ] );
 
 
 	// -- Set level-3 native micro-kernels and preferences ---------------------
@@ -417,6 +465,25 @@ void GENBARNAME(cntx_init)
 	gen_func_init( &funcs[ BLIS_GEMMTRSM_U_UKR ], gemmtrsm_u_ukr_name );
 	gen_func_init( &funcs[ BLIS_TRSM_L_UKR ],     trsm_l_ukr_name     );
 	gen_func_init( &funcs[ BLIS_TRSM_U_UKR ],     trsm_u_ukr_name     );
+	gen_func_init( &funcs[ BLIS_GEMMT_L_UKR ],    gemmt_l_ukr_name    );
+	gen_func_init( &funcs[ BLIS_GEMMT_U_UKR ],    gemmt_u_ukr_name    );
+
+	// There is no reference masked-edge gemm microkernel. Leaving the slot
+	// empty tells the macrokernel to handle edge cases via a temporary
+	// buffer and the regular gemm microkernel.
+	bli_func_init_null( &funcs[ BLIS_GEMM_EDGE_UKR ] );
+
+	gen_func_init( &funcs[ BLIS_SPMM_CSR_UKR ],   spmm_csr_ukr_name   );
+
+	// There is no reference streaming-store gemm microkernel. Leaving the
+	// slot empty tells the macrokernel to write C with the regular gemm
+	// microkernel even when streaming stores are requested.
+	bli_func_init_null( &funcs[ BLIS_GEMM_NT_UKR ] );
+
+	// Likewise, there is no reference gemm microkernel for bfloat16-packed
+	// B. Leaving the slot empty causes requests for such packing to be
+	// ignored.
+	bli_func_init_null( &funcs[ BLIS_GEMM_BF16B_UKR ] );
 
 	//                                                  s      d      c      z
 	bli_mbool_init( &mbools[ BLIS_GEMM_UKR ],        TRUE,  TRUE,  TRUE,  TRUE );
@@ -424,6 +491,12 @@ void GENBARNAME(cntx_init)
 	bli_mbool_init( &mbools[ BLIS_GEMMTRSM_U_UKR ], FALSE, FALSE, FALSE, FALSE );
 	bli_mbool_init( &mbools[ BLIS_TRSM_L_UKR ],     FALSE, FALSE, FALSE, FALSE );
 	bli_mbool_init( &mbools[ BLIS_TRSM_U_UKR ],     FALSE, FALSE, FALSE, FALSE );
+	bli_mbool_init( &mbools[ BLIS_GEMMT_L_UKR ],     TRUE,  TRUE,  TRUE,  TRUE );
+	bli_mbool_init( &mbools[ BLIS_GEMMT_U_UKR ],     TRUE,  TRUE,  TRUE,  TRUE );
+	bli_mbool_init( &mbools[ BLIS_GEMM_EDGE_UKR ],   TRUE,  TRUE,  TRUE,  TRUE );
+	bli_mbool_init( &mbools[ BLIS_SPMM_CSR_UKR ],    TRUE,  TRUE,  TRUE,  TRUE );
+	bli_mbool_init( &mbools[ BLIS_GEMM_NT_UKR ],     TRUE,  TRUE,  TRUE,  TRUE );
+	bli_mbool_init( &mbools[ BLIS_GEMM_BF16B_UKR ],  TRUE,  TRUE,  TRUE,  TRUE );
 
 
 	// -- Set level-3 small/unpacked thresholds --------------------------------
@@ -466,6 +539,14 @@ void GENBARNAME(cntx_init)
 	vfuncs[ BLIS_GEMM ]  = bli_gemmsup_ref;
 	vfuncs[ BLIS_GEMMT ] = bli_gemmtsup_ref;
 
+	// Set the slots of the structured operations to default handlers that
+	// cast the computation in terms of the gemm sup handler.
+	vfuncs[ BLIS_HEMM ]  = bli_hemmsup_ref;
+	vfuncs[ BLIS_SYMM ]  = bli_symmsup_ref;
+	vfuncs[ BLIS_HERK ]  = bli_herksup_ref;
+	vfuncs[ BLIS_SYRK ]  = bli_syrksup_ref;
+	vfuncs[ BLIS_TRMM ]  = bli_trmmsup_ref;
+
 
 	// -- Set level-3 small/unpacked micro-kernels and preferences -------------
 
@@ -533,16 +614,22 @@ void GENBARNAME(cntx_init)
 
 	gen_func_init( &funcs[ BLIS_ADDV_KER ],    addv_ker_name    );
 	gen_func_init( &funcs[ BLIS_AMAXV_KER ],   amaxv_ker_name   );
+	gen_func_init( &funcs[ BLIS_AMINV_KER ],   aminv_ker_name   );
+	gen_func_init( &funcs[ BLIS_ASUMV_KER ],   asumv_ker_name   );
 	gen_func_init( &funcs[ BLIS_AXPBYV_KER ],  axpbyv_ker_name  );
 	gen_func_init( &funcs[ BLIS_AXPYV_KER ],   axpyv_ker_name   );
 	gen_func_init( &funcs[ BLIS_COPYV_KER ],   copyv_ker_name   );
 	gen_func_init( &funcs[ BLIS_DOTV_KER ],    dotv_ker_name    );
 	gen_func_init( &funcs[ BLIS_DOTXV_KER ],   dotxv_ker_name   );
 	gen_func_init( &funcs[ BLIS_INVERTV_KER ], invertv_ker_name );
+	gen_func_init( &funcs[ BLIS_NORMFV_KER ],  normfv_ker_name  );
+	gen_func_init( &funcs[ BLIS_ROTMV_KER ],   rotmv_ker_name   );
+	gen_func_init( &funcs[ BLIS_ROTV_KER ],    rotv_ker_name    );
 	gen_func_init( &funcs[ BLIS_SCALV_KER ],   scalv_ker_name   );
 	gen_func_init( &funcs[ BLIS_SCAL2V_KER ],  scal2v_ker_name  );
 	gen_func_init( &funcs[ BLIS_SETV_KER ],    setv_ker_name    );
 	gen_func_init( &funcs[ BLIS_SUBV_KER ],    subv_ker_name    );
+	gen_func_init( &funcs[ BLIS_SUMSQV_KER ],  sumsqv_ker_name  );
 	gen_func_init( &funcs[ BLIS_SWAPV_KER ],   swapv_ker_name   );
 	gen_func_init( &funcs[ BLIS_XPBYV_KER ],   xpbyv_ker_name   );
 
@@ -585,6 +672,10 @@ void GENBARNAME(cntx_init)
 	gen_func_init( &funcs[ BLIS_UNPACKM_14XK_KER ], unpackm_14xk_ker_name );
 	gen_func_init( &funcs[ BLIS_UNPACKM_16XK_KER ], unpackm_16xk_ker_name );
 
+	funcs = bli_cntx_transm_ker_buf( cntx );
+
+	gen_func_init( &funcs[ 0 ], transm_ker_name );
+
 
 	// -- Set miscellaneous fields ---------------------------------------------
 
@@ -623,6 +714,18 @@ void GENBAINAME(cntx_init)
 	bli_func_init_null( &funcs[ BLIS_TRSM_L_UKR ] );
 	bli_func_init_null( &funcs[ BLIS_TRSM_U_UKR ] );
 
+	// The reference gemmt microkernels are expressed in terms of the virtual
+	// gemm microkernel, and thus they serve every induced method.
+	gen_func_init_co( &funcs[ BLIS_GEMMT_L_UKR ], gemmt_l_ukr_name );
+	gen_func_init_co( &funcs[ BLIS_GEMMT_U_UKR ], gemmt_u_ukr_name );
+
+	// Native masked-edge, streaming-store, and bfloat16-packed B gemm
+	// microkernels do not understand the micropanel formats of the induced
+	// methods.
+	bli_func_init_null( &funcs[ BLIS_GEMM_EDGE_UKR ] );
+	bli_func_init_null( &funcs[ BLIS_GEMM_NT_UKR ] );
+	bli_func_init_null( &funcs[ BLIS_GEMM_BF16B_UKR ] );
+
 	if      ( method == BLIS_3MH )
 	{
 		gen_func_init_co( &funcs[ BLIS_GEMM_UKR ],       gemm3mh_ukr_name       );
@@ -678,6 +781,24 @@ void GENBAINAME(cntx_init)
 
 		bli_func_copy_dt( BLIS_FLOAT,  gemm_nat_ukrs, BLIS_FLOAT,  gemm_vir_ukrs );
 		bli_func_copy_dt( BLIS_DOUBLE, gemm_nat_ukrs, BLIS_DOUBLE, gemm_vir_ukrs );
+
+		func_t* edge_nat_ukrs = bli_cntx_get_l3_nat_ukrs( BLIS_GEMM_EDGE_UKR, cntx );
+		func_t* edge_vir_ukrs = bli_cntx_get_l3_vir_ukrs( BLIS_GEMM_EDGE_UKR, cntx );
+
+		bli_func_copy_dt( BLIS_FLOAT,  edge_nat_ukrs, BLIS_FLOAT,  edge_vir_ukrs );
+		bli_func_copy_dt( BLIS_DOUBLE, edge_nat_ukrs, BLIS_DOUBLE, edge_vir_ukrs );
+
+		func_t* nt_nat_ukrs = bli_cntx_get_l3_nat_ukrs( BLIS_GEMM_NT_UKR, cntx );
+		func_t* nt_vir_ukrs = bli_cntx_get_l3_vir_ukrs( BLIS_GEMM_NT_UKR, cntx );
+
+		bli_func_copy_dt( BLIS_FLOAT,  nt_nat_ukrs, BLIS_FLOAT,  nt_vir_ukrs );
+		bli_func_copy_dt( BLIS_DOUBLE, nt_nat_ukrs, BLIS_DOUBLE, nt_vir_ukrs );
+
+		func_t* bf16b_nat_ukrs = bli_cntx_get_l3_nat_ukrs( BLIS_GEMM_BF16B_UKR, cntx );
+		func_t* bf16b_vir_ukrs = bli_cntx_get_l3_vir_ukrs( BLIS_GEMM_BF16B_UKR, cntx );
+
+		bli_func_copy_dt( BLIS_FLOAT,  bf16b_nat_ukrs, BLIS_FLOAT,  bf16b_vir_ukrs );
+		bli_func_copy_dt( BLIS_DOUBLE, bf16b_nat_ukrs, BLIS_DOUBLE, bf16b_vir_ukrs );
 	}
 
 
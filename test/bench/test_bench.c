@@ -0,0 +1,757 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <unistd.h>
+#include <math.h>
+#include "blis.h"
+
+// A benchmark harness for the level-3 operations. It sweeps problem shapes
+// (square, tall-skinny, short-wide, small, and degenerate, in which one or
+// more of m, n, and k are unit), operations, datatypes, and thread counts,
+// times each case with warmup runs followed by repeated timed runs, and
+// reports the median and minimum times, a 95% confidence interval on the
+// mean, and the corresponding GFLOPS as CSV or JSON so that results from
+// different builds or machines may be compared mechanically.
+//
+// Usage: test_bench.x [options]
+//
+//   -o ops       comma-separated operations, or "all" (default: all)
+//                gemm,gemmt,hemm,herk,her2k,symm,syrk,syr2k,trmm,trmm3,trsm
+//   -d dts       datatypes, a subset of "sdcz" (default: sdcz)
+//   -s shapes    comma-separated shape classes, or "all" (default: all)
+//                square,tall,wide,small,degen
+//   -t threads   comma-separated thread counts (default: 1)
+//   -r reps      number of timed runs per case (default: 7)
+//   -w warmup    number of untimed warmup runs per case (default: 2)
+//   -f format    csv or json (default: csv)
+//   -i file      read cases from file instead of sweeping; each non-comment
+//                line has the form "op dt shape m n k threads"
+//   -O file      write results to file instead of stdout
+//   -G dir       write results to dir/<arch>.csv, creating a baseline for
+//                the running architecture
+//   -B dir       compare against the baseline in dir/<arch>.csv: rerun its
+//                cases, report each case's change in GFLOPS, and exit with
+//                a nonzero status if any case regressed (unless -a is given)
+//   -x tol       relative slowdown tolerated by -B before measurement
+//                noise is added (default: 0.10)
+//   -M desc      with -G, describe the machine in the baseline's header
+//   -a           with -B, report regressions without failing (advisory)
+
+#define MAX_CASES   4096
+#define MAX_THREADS 64
+#define MAX_NAME    16
+
+typedef struct
+{
+	opid_t op;
+	num_t  dt;
+	char   shape[ MAX_NAME ];
+	dim_t  m, n, k;
+	dim_t  nt;
+} bench_case_t;
+
+typedef struct
+{
+	double time_median;
+	double time_min;
+	double time_ci95;
+	double gflops;
+	double gflops_max;
+} bench_result_t;
+
+typedef struct
+{
+	bench_case_t   c;
+	bench_result_t res;
+} bench_base_t;
+
+static const struct { const char* name; opid_t op; } bench_ops[] =
+{
+	{ "gemm",  BLIS_GEMM  }, { "gemmt", BLIS_GEMMT }, { "hemm",  BLIS_HEMM  },
+	{ "herk",  BLIS_HERK  }, { "her2k", BLIS_HER2K }, { "symm",  BLIS_SYMM  },
+	{ "syrk",  BLIS_SYRK  }, { "syr2k", BLIS_SYR2K }, { "trmm",  BLIS_TRMM  },
+	{ "trmm3", BLIS_TRMM3 }, { "trsm",  BLIS_TRSM  },
+};
+#define N_OPS ( sizeof( bench_ops ) / sizeof( bench_ops[0] ) )
+
+static const char* bench_shapes[] = { "square", "tall", "wide", "small", "degen" };
+#define N_SHAPES ( sizeof( bench_shapes ) / sizeof( bench_shapes[0] ) )
+
+// The (m, n, k) triples generated for each shape class.
+static const dim_t shape_square[][3] = { { 256, 256, 256 }, { 512, 512, 512 },
+                                         { 1024, 1024, 1024 }, { 2000, 2000, 2000 } };
+static const dim_t shape_tall[][3]   = { { 1024, 64, 64 }, { 2048, 128, 128 },
+                                         { 2048, 32, 256 } };
+static const dim_t shape_wide[][3]   = { { 64, 1024, 64 }, { 128, 2048, 128 },
+                                         { 32, 2048, 256 } };
+static const dim_t shape_small[][3]  = { { 8, 8, 8 }, { 16, 16, 16 }, { 32, 32, 32 },
+                                         { 64, 64, 64 }, { 100, 100, 100 } };
+static const dim_t shape_degen[][3]  = { { 2000, 1, 2000 }, { 1, 2000, 2000 },
+                                         { 2000, 2000, 1 }, { 1, 1, 4000 },
+                                         { 4000, 1, 1 }, { 1, 4000, 1 } };
+
+// -----------------------------------------------------------------------------
+
+static const char* bench_op_name( opid_t op )
+{
+	for ( dim_t i = 0; i < N_OPS; ++i )
+		if ( bench_ops[ i ].op == op ) return bench_ops[ i ].name;
+	return "?";
+}
+
+static bool bench_op_lookup( const char* name, opid_t* op )
+{
+	for ( dim_t i = 0; i < N_OPS; ++i )
+		if ( strcmp( bench_ops[ i ].name, name ) == 0 )
+		{ *op = bench_ops[ i ].op; return TRUE; }
+	return FALSE;
+}
+
+static char bench_dt_char( num_t dt )
+{
+	return ( dt == BLIS_FLOAT    ? 's' :
+	         dt == BLIS_DOUBLE   ? 'd' :
+	         dt == BLIS_SCOMPLEX ? 'c' : 'z' );
+}
+
+static bool bench_dt_lookup( char ch, num_t* dt )
+{
+	switch ( ch )
+	{
+		case 's': *dt = BLIS_FLOAT;    return TRUE;
+		case 'd': *dt = BLIS_DOUBLE;   return TRUE;
+		case 'c': *dt = BLIS_SCOMPLEX; return TRUE;
+		case 'z': *dt = BLIS_DCOMPLEX; return TRUE;
+		default:                       return FALSE;
+	}
+}
+
+// Return TRUE if name appears in the comma-separated list (or the list is
+// "all").
+static bool bench_in_list( const char* name, const char* list )
+{
+	size_t len = strlen( name );
+
+	if ( strcmp( list, "all" ) == 0 ) return TRUE;
+
+	for ( const char* p = list; *p != '\0'; )
+	{
+		const char* q = strchr( p, ',' );
+		size_t      l = ( q != NULL ? ( size_t )( q - p ) : strlen( p ) );
+
+		if ( l == len && strncmp( p, name, len ) == 0 ) return TRUE;
+
+		if ( q == NULL ) break;
+		p = q + 1;
+	}
+
+	return FALSE;
+}
+
+// Normalize the dimensions of a case to those that the operation actually
+// uses: operations that update a square matrix C ignore n, and operations
+// with a square (structured) A ignore k.
+static void bench_normalize_dims( bench_case_t* c )
+{
+	switch ( c->op )
+	{
+		case BLIS_GEMMT:
+		case BLIS_HERK:
+		case BLIS_HER2K:
+		case BLIS_SYRK:
+		case BLIS_SYR2K: c->n = c->m; break;
+		case BLIS_HEMM:
+		case BLIS_SYMM:
+		case BLIS_TRMM:
+		case BLIS_TRMM3:
+		case BLIS_TRSM:  c->k = c->m; break;
+		default:                      break;
+	}
+}
+
+static double bench_flops( bench_case_t* c )
+{
+	double m = c->m, n = c->n, k = c->k;
+	double f;
+
+	switch ( c->op )
+	{
+		case BLIS_GEMM:  f = 2.0 * m * n * k; break;
+		case BLIS_GEMMT:
+		case BLIS_HERK:
+		case BLIS_SYRK:  f = 1.0 * m * m * k; break;
+		case BLIS_HER2K:
+		case BLIS_SYR2K: f = 2.0 * m * m * k; break;
+		case BLIS_HEMM:
+		case BLIS_SYMM:  f = 2.0 * m * m * n; break;
+		default:         f = 1.0 * m * m * n; break; // trmm, trmm3, trsm
+	}
+
+	if ( bli_is_complex( c->dt ) ) f *= 4.0;
+
+	return f;
+}
+
+static int bench_cmp_dbl( const void* a, const void* b )
+{
+	double x = *( const double* )a, y = *( const double* )b;
+	return ( x > y ) - ( x < y );
+}
+
+// -----------------------------------------------------------------------------
+
+static void bench_create_struc( num_t dt, dim_t m, struc_t struc, obj_t* x )
+{
+	bli_obj_create( dt, m, m, 0, 0, x );
+	bli_obj_set_struc( struc, x );
+	bli_obj_set_uplo( BLIS_LOWER, x );
+	bli_randm( x );
+
+	// Make triangular matrices diagonally dominant so that repeated solves
+	// remain well-conditioned.
+	if ( struc == BLIS_TRIANGULAR )
+	{
+		obj_t shift;
+
+		bli_obj_create_1x1( dt, &shift );
+		bli_setsc( ( double )m, 0.0, &shift );
+		bli_shiftd( &shift, x );
+		bli_obj_free( &shift );
+	}
+}
+
+static void bench_run_case
+     (
+       bench_case_t*   c,
+       int             n_warmup,
+       int             n_repeats,
+       bench_result_t* res
+     )
+{
+	num_t  dt = c->dt;
+	dim_t  m  = c->m, n = c->n, k = c->k;
+	obj_t  a, b, x, x_save;
+	obj_t* out;
+	bool   has_b = FALSE;
+	rntm_t rntm;
+	double times[ 1024 ];
+
+	n_repeats = bli_min( bli_max( n_repeats, 1 ), 1024 );
+
+	bli_rntm_init( &rntm );
+	if ( c->nt > 0 ) bli_rntm_set_num_threads( c->nt, &rntm );
+
+	// Create the operands. x is the output operand (C, or B for trmm and
+	// trsm), which is restored from x_save before each run.
+	switch ( c->op )
+	{
+		case BLIS_GEMM:
+		case BLIS_GEMMT:
+			bli_obj_create( dt, m, k, 0, 0, &a ); bli_randm( &a );
+			bli_obj_create( dt, k, n, 0, 0, &b ); bli_randm( &b );
+			bli_obj_create( dt, m, n, 0, 0, &x ); bli_randm( &x );
+			if ( c->op == BLIS_GEMMT ) bli_obj_set_uplo( BLIS_LOWER, &x );
+			has_b = TRUE;
+			break;
+		case BLIS_HERK:
+		case BLIS_SYRK:
+		case BLIS_HER2K:
+		case BLIS_SYR2K:
+			bli_obj_create( dt, m, k, 0, 0, &a ); bli_randm( &a );
+			bli_obj_create( dt, m, k, 0, 0, &b ); bli_randm( &b );
+			bli_obj_create( dt, m, m, 0, 0, &x ); bli_randm( &x );
+			bli_obj_set_struc( c->op == BLIS_HERK || c->op == BLIS_HER2K
+			                   ? BLIS_HERMITIAN : BLIS_SYMMETRIC, &x );
+			bli_obj_set_uplo( BLIS_LOWER, &x );
+			has_b = TRUE;
+			break;
+		case BLIS_HEMM:
+		case BLIS_SYMM:
+			bench_create_struc( dt, m, c->op == BLIS_HEMM ? BLIS_HERMITIAN
+			                                              : BLIS_SYMMETRIC, &a );
+			bli_obj_create( dt, m, n, 0, 0, &b ); bli_randm( &b );
+			bli_obj_create( dt, m, n, 0, 0, &x ); bli_randm( &x );
+			has_b = TRUE;
+			break;
+		case BLIS_TRMM3:
+			bench_create_struc( dt, m, BLIS_TRIANGULAR, &a );
+			bli_obj_create( dt, m, n, 0, 0, &b ); bli_randm( &b );
+			bli_obj_create( dt, m, n, 0, 0, &x ); bli_randm( &x );
+			has_b = TRUE;
+			break;
+		default: // trmm, trsm
+			bench_create_struc( dt, m, BLIS_TRIANGULAR, &a );
+			bli_obj_create( dt, m, n, 0, 0, &x ); bli_randm( &x );
+			break;
+	}
+
+	out = &x;
+
+	bli_obj_create( dt, bli_obj_length( out ), bli_obj_width( out ), 0, 0, &x_save );
+	bli_copym( out, &x_save );
+
+	for ( int r = -n_warmup; r < n_repeats; ++r )
+	{
+		bli_copym( &x_save, out );
+
+		double dtime = bli_clock();
+
+		switch ( c->op )
+		{
+			case BLIS_GEMM:  bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &x, NULL, &rntm ); break;
+			case BLIS_GEMMT: bli_gemmt_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &x, NULL, &rntm ); break;
+			case BLIS_HERK:  bli_herk_ex( &BLIS_ONE, &a, &BLIS_ONE, &x, NULL, &rntm ); break;
+			case BLIS_SYRK:  bli_syrk_ex( &BLIS_ONE, &a, &BLIS_ONE, &x, NULL, &rntm ); break;
+			case BLIS_HER2K: bli_her2k_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &x, NULL, &rntm ); break;
+			case BLIS_SYR2K: bli_syr2k_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &x, NULL, &rntm ); break;
+			case BLIS_HEMM:  bli_hemm_ex( BLIS_LEFT, &BLIS_ONE, &a, &b, &BLIS_ONE, &x, NULL, &rntm ); break;
+			case BLIS_SYMM:  bli_symm_ex( BLIS_LEFT, &BLIS_ONE, &a, &b, &BLIS_ONE, &x, NULL, &rntm ); break;
+			case BLIS_TRMM3: bli_trmm3_ex( BLIS_LEFT, &BLIS_ONE, &a, &b, &BLIS_ONE, &x, NULL, &rntm ); break;
+			case BLIS_TRMM:  bli_trmm_ex( BLIS_LEFT, &BLIS_ONE, &a, &x, NULL, &rntm ); break;
+			case BLIS_TRSM:  bli_trsm_ex( BLIS_LEFT, &BLIS_ONE, &a, &x, NULL, &rntm ); break;
+			default: break;
+		}
+
+		dtime = bli_clock() - dtime;
+
+		if ( r >= 0 ) times[ r ] = dtime;
+	}
+
+	bli_obj_free( &a );
+	if ( has_b ) bli_obj_free( &b );
+	bli_obj_free( &x );
+	bli_obj_free( &x_save );
+
+	// Compute the statistics.
+	double mean = 0.0, var = 0.0;
+
+	for ( int r = 0; r < n_repeats; ++r ) mean += times[ r ];
+	mean /= n_repeats;
+	for ( int r = 0; r < n_repeats; ++r ) var += ( times[ r ] - mean ) * ( times[ r ] - mean );
+	var = ( n_repeats > 1 ? var / ( n_repeats - 1 ) : 0.0 );
+
+	qsort( times, n_repeats, sizeof( double ), bench_cmp_dbl );
+
+	res->time_median = ( n_repeats % 2 == 1 ? times[ n_repeats / 2 ]
+	                   : 0.5 * ( times[ n_repeats / 2 - 1 ] + times[ n_repeats / 2 ] ) );
+	res->time_min    = times[ 0 ];
+	res->time_ci95   = 1.96 * sqrt( var / n_repeats );
+	res->gflops      = bench_flops( c ) / ( res->time_median * 1.0e9 );
+	res->gflops_max  = bench_flops( c ) / ( res->time_min    * 1.0e9 );
+}
+
+// -----------------------------------------------------------------------------
+
+static int bench_read_cases( const char* filename, bench_case_t* cases, int max_cases )
+{
+	FILE* file = fopen( filename, "r" );
+	char  line[ 256 ];
+	int   n_cases = 0;
+
+	if ( file == NULL ) return -1;
+
+	while ( fgets( line, sizeof( line ), file ) != NULL && n_cases < max_cases )
+	{
+		char          op_str[ MAX_NAME ], dt_str[ MAX_NAME ];
+		long          m, n, k, nt;
+		bench_case_t* c = &cases[ n_cases ];
+		char*         comment = strchr( line, '#' );
+
+		if ( comment != NULL ) *comment = '\0';
+
+		if ( sscanf( line, "%15s %15s %15s %ld %ld %ld %ld", op_str, dt_str,
+		             c->shape, &m, &n, &k, &nt ) != 7 ) continue;
+
+		if ( !bench_op_lookup( op_str, &c->op ) ||
+		     !bench_dt_lookup( dt_str[0], &c->dt ) ) continue;
+
+		c->m = m; c->n = n; c->k = k; c->nt = nt;
+		bench_normalize_dims( c );
+
+		n_cases += 1;
+	}
+
+	fclose( file );
+
+	return n_cases;
+}
+
+static int bench_gen_cases
+     (
+       const char*   ops,
+       const char*   dts,
+       const char*   shapes,
+       const char*   threads,
+       bench_case_t* cases,
+       int           max_cases
+     )
+{
+	int   n_cases = 0;
+	dim_t nts[ MAX_THREADS ];
+	int   n_nts = 0;
+
+	for ( const char* p = threads; *p != '\0' && n_nts < MAX_THREADS; )
+	{
+		nts[ n_nts++ ] = atoi( p );
+		p = strchr( p, ',' );
+		if ( p == NULL ) break;
+		p += 1;
+	}
+
+	for ( dim_t s = 0; s < N_SHAPES; ++s )
+	{
+		const dim_t ( *dims )[3];
+		dim_t       n_dims;
+
+		if ( !bench_in_list( bench_shapes[ s ], shapes ) ) continue;
+
+		switch ( s )
+		{
+			case 0:  dims = shape_square; n_dims = sizeof( shape_square ) / sizeof( dims[0] ); break;
+			case 1:  dims = shape_tall;   n_dims = sizeof( shape_tall   ) / sizeof( dims[0] ); break;
+			case 2:  dims = shape_wide;   n_dims = sizeof( shape_wide   ) / sizeof( dims[0] ); break;
+			case 3:  dims = shape_small;  n_dims = sizeof( shape_small  ) / sizeof( dims[0] ); break;
+			default: dims = shape_degen;  n_dims = sizeof( shape_degen  ) / sizeof( dims[0] ); break;
+		}
+
+		for ( dim_t o = 0; o < N_OPS; ++o )
+		{
+			if ( !bench_in_list( bench_ops[ o ].name, ops ) ) continue;
+
+			for ( const char* d = dts; *d != '\0'; ++d )
+			for ( dim_t i = 0; i < n_dims; ++i )
+			for ( int t = 0; t < n_nts; ++t )
+			{
+				bench_case_t c;
+
+				if ( !bench_dt_lookup( *d, &c.dt ) ) continue;
+
+				c.op = bench_ops[ o ].op;
+				c.m  = dims[ i ][ 0 ];
+				c.n  = dims[ i ][ 1 ];
+				c.k  = dims[ i ][ 2 ];
+				c.nt = nts[ t ];
+				strncpy( c.shape, bench_shapes[ s ], MAX_NAME - 1 );
+				c.shape[ MAX_NAME - 1 ] = '\0';
+				bench_normalize_dims( &c );
+
+				// Skip cases that normalize to one already generated.
+				bool dup = FALSE;
+				for ( int j = 0; j < n_cases && !dup; ++j )
+					dup = ( cases[ j ].op == c.op && cases[ j ].dt == c.dt &&
+					        cases[ j ].m  == c.m  && cases[ j ].n  == c.n  &&
+					        cases[ j ].k  == c.k  && cases[ j ].nt == c.nt );
+
+				if ( !dup && n_cases < max_cases ) cases[ n_cases++ ] = c;
+			}
+		}
+	}
+
+	return n_cases;
+}
+
+// -----------------------------------------------------------------------------
+
+// Read a baseline previously written in CSV format (see -G).
+static int bench_read_baseline( const char* filename, bench_base_t* base, int max_cases )
+{
+	FILE* file = fopen( filename, "r" );
+	char  line[ 512 ];
+	int   n_cases = 0;
+
+	if ( file == NULL ) return -1;
+
+	while ( fgets( line, sizeof( line ), file ) != NULL && n_cases < max_cases )
+	{
+		char            op_str[ MAX_NAME ], dt_ch;
+		long            m, n, k, nt;
+		bench_case_t*   c = &base[ n_cases ].c;
+		bench_result_t* r = &base[ n_cases ].res;
+
+		if ( line[0] == '#' ) continue;
+
+		if ( sscanf( line, "%15[^,],%c,%15[^,],%ld,%ld,%ld,%ld,%lf,%lf,%lf,%lf,%lf",
+		             op_str, &dt_ch, c->shape, &m, &n, &k, &nt,
+		             &r->time_median, &r->time_min, &r->time_ci95,
+		             &r->gflops, &r->gflops_max ) != 12 ) continue;
+
+		if ( !bench_op_lookup( op_str, &c->op ) ||
+		     !bench_dt_lookup( dt_ch, &c->dt ) ) continue;
+
+		c->m = m; c->n = n; c->k = k; c->nt = nt;
+
+		n_cases += 1;
+	}
+
+	fclose( file );
+
+	return n_cases;
+}
+
+// Rerun each case of a baseline and compare the best-observed GFLOPS rate
+// against the baseline's. A case is flagged when its rate drops by more
+// than tol plus the relative 95% confidence intervals of both
+// measurements; flagged cases are rerun once with three times as many
+// repetitions to rule out transient interference before being reported
+// as regressions. Returns the number of regressions.
+static int bench_compare
+     (
+       bench_base_t* base,
+       int           n_cases,
+       int           n_warmup,
+       int           n_repeats,
+       double        tol,
+       FILE*         out
+     )
+{
+	int n_regress = 0;
+
+	fprintf( out, "%-6s %2s %-6s %6s %6s %6s %3s %9s %9s %8s %8s  %s\n",
+	         "op", "dt", "shape", "m", "n", "k", "nt",
+	         "base_gf", "new_gf", "change", "thresh", "status" );
+
+	for ( int i = 0; i < n_cases; ++i )
+	{
+		bench_case_t*   c  = &base[ i ].c;
+		bench_result_t* rb = &base[ i ].res;
+		bench_result_t  rn;
+		const char*     status = "ok";
+
+		bench_run_case( c, n_warmup, n_repeats, &rn );
+
+		double noise  = rb->time_ci95 / rb->time_median +
+		                rn.time_ci95  / rn.time_median;
+		double thresh = tol + noise;
+		double change = rn.gflops_max / rb->gflops_max - 1.0;
+
+		if ( change < -thresh )
+		{
+			bench_result_t rr;
+
+			bench_run_case( c, n_warmup, 3 * n_repeats, &rr );
+
+			if ( rr.gflops_max > rn.gflops_max ) rn = rr;
+			change = rn.gflops_max / rb->gflops_max - 1.0;
+
+			if ( change < -thresh ) { status = "REGRESSED"; n_regress += 1; }
+		}
+		else if ( change > thresh )
+		{
+			status = "improved";
+		}
+
+		fprintf( out, "%-6s %2c %-6s %6ld %6ld %6ld %3ld %9.3f %9.3f %+7.1f%% %7.1f%%  %s\n",
+		         bench_op_name( c->op ), bench_dt_char( c->dt ), c->shape,
+		         ( long )c->m, ( long )c->n, ( long )c->k, ( long )c->nt,
+		         rb->gflops_max, rn.gflops_max, 100.0 * change, 100.0 * thresh,
+		         status );
+		fflush( out );
+	}
+
+	fprintf( out, "\n%d of %d cases regressed.\n", n_regress, n_cases );
+
+	return n_regress;
+}
+
+// -----------------------------------------------------------------------------
+
+int main( int argc, char** argv )
+{
+	const char*   ops       = "all";
+	const char*   dts       = "sdcz";
+	const char*   shapes    = "all";
+	const char*   threads   = "1";
+	const char*   in_file   = NULL;
+	const char*   out_file  = NULL;
+	const char*   gen_dir   = NULL;
+	const char*   base_dir  = NULL;
+	const char*   machine   = "unspecified";
+	bool          advisory  = FALSE;
+	double        tol       = 0.10;
+	char          path[ 1024 ];
+	bool          json      = FALSE;
+	int           n_repeats = 7;
+	int           n_warmup  = 2;
+	int           n_cases;
+	FILE*         out       = stdout;
+	getopt_t      state;
+	int           opt;
+
+	static bench_case_t cases[ MAX_CASES ];
+	static bench_base_t base[ MAX_CASES ];
+
+	bli_getopt_init_state( 0, &state );
+
+	while ( ( opt = bli_getopt( argc, argv, "o:d:s:t:r:w:f:i:O:G:B:x:M:a", &state ) ) != -1 )
+	{
+		switch ( ( char )opt )
+		{
+			case 'o': ops       = state.optarg;                         break;
+			case 'd': dts       = state.optarg;                         break;
+			case 's': shapes    = state.optarg;                         break;
+			case 't': threads   = state.optarg;                         break;
+			case 'r': n_repeats = atoi( state.optarg );                 break;
+			case 'w': n_warmup  = atoi( state.optarg );                 break;
+			case 'f': json      = ( strcmp( state.optarg, "json" ) == 0 ); break;
+			case 'i': in_file   = state.optarg;                         break;
+			case 'O': out_file  = state.optarg;                         break;
+			case 'G': gen_dir   = state.optarg;                         break;
+			case 'B': base_dir  = state.optarg;                         break;
+			case 'x': tol       = atof( state.optarg );                 break;
+			case 'M': machine   = state.optarg;                         break;
+			case 'a': advisory  = TRUE;                                 break;
+			default:
+				fprintf( stderr, "%s: unexpected option '%c'\n", argv[0], state.optopt );
+				return 1;
+		}
+	}
+
+	const char* arch    = bli_arch_string( bli_arch_query_id() );
+	const char* version = bli_info_get_version_str();
+	const char* thrmod  = bli_info_get_enable_openmp()   ? "openmp"   :
+	                      bli_info_get_enable_pthreads() ? "pthreads" : "none";
+
+	if ( base_dir != NULL )
+	{
+		snprintf( path, sizeof( path ), "%s/%s.csv", base_dir, arch );
+
+		n_cases = bench_read_baseline( path, base, MAX_CASES );
+
+		if ( n_cases <= 0 )
+		{
+			fprintf( stderr, "%s: no baseline for arch '%s' (%s)\n",
+			         argv[0], arch, path );
+			return 2;
+		}
+
+		printf( "Comparing against %s (arch=%s, tol=%.1f%%)\n\n",
+		        path, arch, 100.0 * tol );
+
+		int n_regress = bench_compare( base, n_cases, n_warmup, n_repeats,
+		                               tol, stdout );
+
+		if ( advisory && n_regress > 0 )
+		{
+			printf( "NOTE: the comparison is advisory (-a); "
+			        "regressions do not fail.\n" );
+			return 0;
+		}
+
+		return ( n_regress > 0 ? 1 : 0 );
+	}
+
+	if ( gen_dir != NULL )
+	{
+		snprintf( path, sizeof( path ), "%s/%s.csv", gen_dir, arch );
+		out_file = path;
+		json     = FALSE;
+	}
+
+	if ( in_file != NULL )
+		n_cases = bench_read_cases( in_file, cases, MAX_CASES );
+	else
+		n_cases = bench_gen_cases( ops, dts, shapes, threads, cases, MAX_CASES );
+
+	if ( n_cases < 0 )
+	{
+		fprintf( stderr, "%s: could not read %s\n", argv[0], in_file );
+		return 1;
+	}
+
+	if ( out_file != NULL && ( out = fopen( out_file, "w" ) ) == NULL )
+	{
+		fprintf( stderr, "%s: could not open %s\n", argv[0], out_file );
+		return 1;
+	}
+
+	if ( json )
+	{
+		fprintf( out, "{\n  \"version\": \"%s\",\n  \"arch\": \"%s\",\n"
+		              "  \"threading\": \"%s\",\n  \"reps\": %d,\n"
+		              "  \"warmup\": %d,\n  \"results\": [\n",
+		         version, arch, thrmod, n_repeats, n_warmup );
+	}
+	else
+	{
+		const char* nt_env   = getenv( "BLIS_NUM_THREADS" );
+		const char* bind_env = getenv( "OMP_PROC_BIND" );
+
+		fprintf( out, "# version=%s arch=%s threading=%s reps=%d warmup=%d\n",
+		         version, arch, thrmod, n_repeats, n_warmup );
+		fprintf( out, "# machine=%s\n", machine );
+		fprintf( out, "# BLIS_NUM_THREADS=%s OMP_PROC_BIND=%s\n",
+		         ( nt_env   != NULL ? nt_env   : "unset" ),
+		         ( bind_env != NULL ? bind_env : "unset" ) );
+		fprintf( out, "op,dt,shape,m,n,k,threads,time_median,time_min,"
+		              "time_ci95,gflops,gflops_max\n" );
+	}
+
+	for ( int i = 0; i < n_cases; ++i )
+	{
+		bench_case_t*  c = &cases[ i ];
+		bench_result_t res;
+
+		bench_run_case( c, n_warmup, n_repeats, &res );
+
+		if ( json )
+		{
+			fprintf( out, "    { \"op\": \"%s\", \"dt\": \"%c\", \"shape\": \"%s\", "
+			              "\"m\": %ld, \"n\": %ld, \"k\": %ld, \"threads\": %ld, "
+			              "\"time_median\": %.6e, \"time_min\": %.6e, "
+			              "\"time_ci95\": %.6e, \"gflops\": %.3f, "
+			              "\"gflops_max\": %.3f }%s\n",
+			         bench_op_name( c->op ), bench_dt_char( c->dt ), c->shape,
+			         ( long )c->m, ( long )c->n, ( long )c->k, ( long )c->nt,
+			         res.time_median, res.time_min, res.time_ci95,
+			         res.gflops, res.gflops_max, ( i < n_cases - 1 ? "," : "" ) );
+		}
+		else
+		{
+			fprintf( out, "%s,%c,%s,%ld,%ld,%ld,%ld,%.6e,%.6e,%.6e,%.3f,%.3f\n",
+			         bench_op_name( c->op ), bench_dt_char( c->dt ), c->shape,
+			         ( long )c->m, ( long )c->n, ( long )c->k, ( long )c->nt,
+			         res.time_median, res.time_min, res.time_ci95,
+			         res.gflops, res.gflops_max );
+		}
+
+		fflush( out );
+	}
+
+	if ( json ) fprintf( out, "  ]\n}\n" );
+
+	if ( out != stdout ) fclose( out );
+
+	return 0;
+}
+
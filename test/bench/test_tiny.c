@@ -0,0 +1,285 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+// A microbenchmark that measures the cost of a single call to the BLAS
+// routines gemm, gemv, and trsm for tiny problems, where the time spent
+// outside of the kernels dominates. For each operation, datatype, and size
+// n it reports the average time per call, in nanoseconds, of
+//
+//   - the BLAS compatibility routine (e.g. dgemm_), and
+//   - the equivalent typed BLIS API routine (e.g. bli_dgemm),
+//
+// operating on column-stored n x n matrices (and vectors of length n)
+// that are resident in the L1 cache. gemm and gemv update C := A*B + C and
+// y := A*x + y; trsm solves with an identity lower triangle so that the
+// right-hand sides stay unchanged from call to call.
+//
+// Usage: test_tiny.x [options]
+//
+//   -o ops       operations, a comma-separated subset of gemm,gemv,trsm
+//                (default: gemm,gemv,trsm)
+//   -d dts       datatypes, a subset of "sdcz" (default: sd)
+//   -s sizes     comma-separated problem sizes (default: 2,4,8,16,32)
+
+#define TINY_N_TRIALS  5
+#define TINY_MIN_TIME  5.0e-3
+#define TINY_MAX_SIZES 32
+
+typedef enum
+{
+	TINY_GEMM,
+	TINY_GEMV,
+	TINY_TRSM
+} tiny_op_t;
+
+static const char* tiny_op_names[] = { "gemm", "gemv", "trsm" };
+
+// -----------------------------------------------------------------------------
+
+#undef  GENTFUNC
+#define GENTFUNC( ctype, ch, varname ) \
+\
+static void PASTEMAC(ch,varname) \
+     ( \
+       tiny_op_t op, \
+       bool      use_blas, \
+       f77_int   n, \
+       ctype*    a, \
+       ctype*    b, \
+       ctype*    c  \
+     ) \
+{ \
+	ctype*  one = PASTEMAC(ch,1); \
+	f77_int inc = 1; \
+\
+	if ( use_blas ) \
+	{ \
+		if      ( op == TINY_GEMM ) \
+			PASTEF77(ch,gemm)( "N", "N", &n, &n, &n, one, a, &n, b, &n, \
+			                   one, c, &n ); \
+		else if ( op == TINY_GEMV ) \
+			PASTEF77(ch,gemv)( "N", &n, &n, one, a, &n, b, &inc, \
+			                   one, c, &inc ); \
+		else \
+			PASTEF77(ch,trsm)( "L", "L", "N", "N", &n, &n, one, a, &n, \
+			                   b, &n ); \
+	} \
+	else \
+	{ \
+		if      ( op == TINY_GEMM ) \
+			PASTEMAC(ch,gemm)( BLIS_NO_TRANSPOSE, BLIS_NO_TRANSPOSE, \
+			                   n, n, n, one, a, 1, n, b, 1, n, \
+			                   one, c, 1, n ); \
+		else if ( op == TINY_GEMV ) \
+			PASTEMAC(ch,gemv)( BLIS_NO_TRANSPOSE, BLIS_NO_CONJUGATE, \
+			                   n, n, one, a, 1, n, b, 1, \
+			                   one, c, 1 ); \
+		else \
+			PASTEMAC(ch,trsm)( BLIS_LEFT, BLIS_LOWER, BLIS_NO_TRANSPOSE, \
+			                   BLIS_NONUNIT_DIAG, n, n, one, a, 1, n, \
+			                   b, 1, n ); \
+	} \
+}
+
+INSERT_GENTFUNC_BASIC0( tiny_call )
+
+static void tiny_call
+     (
+       tiny_op_t op,
+       num_t     dt,
+       bool      use_blas,
+       f77_int   n,
+       void*     a,
+       void*     b,
+       void*     c
+     )
+{
+	switch ( dt )
+	{
+		case BLIS_FLOAT:    bli_stiny_call( op, use_blas, n, a, b, c ); break;
+		case BLIS_DOUBLE:   bli_dtiny_call( op, use_blas, n, a, b, c ); break;
+		case BLIS_SCOMPLEX: bli_ctiny_call( op, use_blas, n, a, b, c ); break;
+		case BLIS_DCOMPLEX: bli_ztiny_call( op, use_blas, n, a, b, c ); break;
+		default: break;
+	}
+}
+
+// Return the average time of a single call, taking the best of several
+// trials of a repetition count that yields a measurable interval.
+static double tiny_time
+     (
+       tiny_op_t op,
+       num_t     dt,
+       bool      use_blas,
+       f77_int   n,
+       void*     a,
+       void*     b,
+       void*     c
+     )
+{
+	double best  = 1.0e9;
+	dim_t  n_rep = 1;
+
+	for ( ;; )
+	{
+		double t = bli_clock();
+		for ( dim_t r = 0; r < n_rep; ++r ) tiny_call( op, dt, use_blas, n, a, b, c );
+		t = bli_clock() - t;
+		if ( t > TINY_MIN_TIME ) break;
+		n_rep *= 2;
+	}
+
+	for ( int trial = 0; trial < TINY_N_TRIALS; ++trial )
+	{
+		double t = bli_clock();
+		for ( dim_t r = 0; r < n_rep; ++r ) tiny_call( op, dt, use_blas, n, a, b, c );
+		t = bli_clock() - t;
+		best = bli_min( best, t / n_rep );
+	}
+
+	return best;
+}
+
+static void tiny_test( tiny_op_t op, num_t dt, dim_t n )
+{
+	obj_t a, b, c;
+
+	bli_obj_create( dt, n, n, 0, 0, &a );
+	bli_obj_create( dt, n, n, 0, 0, &b );
+	bli_obj_create( dt, n, n, 0, 0, &c );
+
+	if ( op == TINY_TRSM )
+	{
+		bli_setm( &BLIS_ZERO, &a );
+		bli_setd( &BLIS_ONE, &a );
+	}
+	else
+	{
+		bli_randm( &a );
+	}
+	bli_randm( &b );
+	bli_randm( &c );
+
+	void* buf_a = bli_obj_buffer( &a );
+	void* buf_b = bli_obj_buffer( &b );
+	void* buf_c = bli_obj_buffer( &c );
+
+	double t_blas = tiny_time( op, dt, TRUE,  n, buf_a, buf_b, buf_c );
+	double t_blis = tiny_time( op, dt, FALSE, n, buf_a, buf_b, buf_c );
+
+	printf( "%-5s %c %5ld %12.1f %12.1f\n",
+	        tiny_op_names[ op ], "scdz"[ dt ], ( long )n,
+	        1.0e9 * t_blas, 1.0e9 * t_blis );
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+}
+
+// -----------------------------------------------------------------------------
+
+int main( int argc, char** argv )
+{
+	const char* ops   = "gemm,gemv,trsm";
+	const char* dts   = "sd";
+	const char* sizes = "2,4,8,16,32";
+	dim_t       n_list[ TINY_MAX_SIZES ];
+	dim_t       n_sizes = 0;
+	getopt_t    state;
+	int         opt;
+
+	bli_init();
+
+	bli_getopt_init_state( 0, &state );
+
+	while ( ( opt = bli_getopt( argc, argv, "o:d:s:", &state ) ) != -1 )
+	{
+		switch ( ( char )opt )
+		{
+			case 'o': ops   = state.optarg; break;
+			case 'd': dts   = state.optarg; break;
+			case 's': sizes = state.optarg; break;
+			default:
+				fprintf( stderr, "%s: unexpected option '%c'\n", argv[0], state.optopt );
+				return 1;
+		}
+	}
+
+	for ( const char* p = sizes; *p != '\0' && n_sizes < TINY_MAX_SIZES; )
+	{
+		char* end;
+		long  n = strtol( p, &end, 10 );
+
+		if ( end == p || n < 1 )
+		{
+			fprintf( stderr, "%s: invalid size list '%s'\n", argv[0], sizes );
+			return 1;
+		}
+
+		n_list[ n_sizes++ ] = ( dim_t )n;
+		p = ( *end == ',' ? end + 1 : end );
+	}
+
+	printf( "arch %s, %ld thread(s)\n\n", bli_arch_string( bli_arch_query_id() ),
+	        ( long )bli_max( bli_thread_get_num_threads(), 1 ) );
+	printf( "%-5s %s %5s %12s %12s\n", "op", "dt", "n", "blas ns/call", "blis ns/call" );
+
+	for ( int op = TINY_GEMM; op <= TINY_TRSM; ++op )
+	{
+		if ( strstr( ops, tiny_op_names[ op ] ) == NULL ) continue;
+
+		for ( const char* d = dts; *d != '\0'; ++d )
+		{
+			num_t dt;
+
+			switch ( *d )
+			{
+				case 's': dt = BLIS_FLOAT;    break;
+				case 'd': dt = BLIS_DOUBLE;   break;
+				case 'c': dt = BLIS_SCOMPLEX; break;
+				case 'z': dt = BLIS_DCOMPLEX; break;
+				default:  continue;
+			}
+
+			for ( dim_t i = 0; i < n_sizes; ++i )
+				tiny_test( ( tiny_op_t )op, dt, n_list[ i ] );
+		}
+	}
+
+	bli_finalize();
+
+	return 0;
+}
@@ -0,0 +1,591 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+#include <x86intrin.h>
+#define UKR_HAVE_TSC
+#endif
+
+// A harness that measures how close each computational kernel registered
+// in the gks for the running architecture comes to the peak floating-point
+// throughput of the core. For every datatype it times
+//
+//   - the gemm microkernel,
+//   - the gemmtrsm_l and gemmtrsm_u microkernels,
+//   - each gemmsup kernel that the sup framework may dispatch to (i.e.,
+//     storage combinations whose C storage matches the kernel's preference),
+//   - the packm kernels for panels of MR and NR rows,
+//
+// with the operands resident in the L1 cache and (for kernels that take a
+// k dimension) in the L2 cache. The computational kernels are reported in
+// cycles per MR x NR rank-1 update and as a percentage of peak; those whose
+// L1 efficiency falls below a threshold are flagged. The packm kernels are
+// reported in cycles per packed column and flagged when packing one column
+// takes longer than the gemm microkernel takes to consume it.
+//
+// Usage: test_ukr.x [options]
+//
+//   -d dts       datatypes, a subset of "sdcz" (default: sdcz)
+//   -F ghz       core clock frequency in GHz used to convert time to cycles
+//                (default: the TSC frequency on x86, otherwise required)
+//   -p flops     peak double-precision flops per cycle per core (default:
+//                taken from a table indexed by the active configuration)
+//   -e eff       efficiency below which a kernel is flagged (default: 0.70)
+
+#define UKR_N_TRIALS   5
+#define UKR_MIN_TIME   2.0e-3
+
+typedef void (*ukr_gemm_vft)
+     (
+       dim_t k, void* alpha, void* a, void* b, void* beta,
+       void* c, inc_t rs_c, inc_t cs_c, auxinfo_t* data, cntx_t* cntx
+     );
+typedef void (*ukr_gemmtrsm_vft)
+     (
+       dim_t k, void* alpha, void* a1x, void* a11, void* bx1, void* b11,
+       void* c11, inc_t rs_c, inc_t cs_c, auxinfo_t* data, cntx_t* cntx
+     );
+typedef void (*ukr_gemmsup_vft)
+     (
+       conj_t conja, conj_t conjb, dim_t m, dim_t n, dim_t k, void* alpha,
+       void* a, inc_t rs_a, inc_t cs_a, void* b, inc_t rs_b, inc_t cs_b,
+       void* beta, void* c, inc_t rs_c, inc_t cs_c, auxinfo_t* data,
+       cntx_t* cntx
+     );
+typedef void (*ukr_packm_vft)
+     (
+       conj_t conja, pack_t schema, dim_t cdim, dim_t n, dim_t n_max,
+       void* kappa, void* a, inc_t inca, inc_t lda, void* p, inc_t ldp,
+       cntx_t* cntx
+     );
+
+typedef enum
+{
+	UKR_GEMM,
+	UKR_GEMMTRSM_L,
+	UKR_GEMMTRSM_U,
+	UKR_GEMMSUP,
+	UKR_PACKM
+} ukr_kind_t;
+
+// The arguments needed to invoke any of the kernels above.
+typedef struct
+{
+	ukr_kind_t kind;
+	void_fp    f;
+	dim_t      mr, nr, k;
+	void*      a;     inc_t rs_a, cs_a;
+	void*      b;     inc_t rs_b, cs_b;
+	void*      c;     inc_t rs_c, cs_c;
+	void*      a11;
+	void*      b11;
+	void*      alpha;
+	void*      beta;
+	pack_t     schema;
+	auxinfo_t  aux;
+	cntx_t*    cntx;
+} ukr_call_t;
+
+static double ukr_ghz     = 0.0;
+static double ukr_peak_dp = 0.0;
+static double ukr_eff     = 0.70;
+static int    ukr_n_low   = 0;
+
+// -----------------------------------------------------------------------------
+
+// Peak double-precision flops per cycle per core of the instruction set
+// targeted by each sub-configuration (single precision is twice this).
+// Zero means unknown; use -p.
+static double ukr_peak_for_arch( arch_t id )
+{
+	switch ( id )
+	{
+		case BLIS_ARCH_SKX:         return 32.0;
+		case BLIS_ARCH_KNL:         return 32.0;
+		case BLIS_ARCH_HASWELL:     return 16.0;
+		case BLIS_ARCH_ZEN2:        return 16.0;
+		case BLIS_ARCH_ZEN:         return  8.0;
+		case BLIS_ARCH_SANDYBRIDGE: return  8.0;
+		case BLIS_ARCH_EXCAVATOR:
+		case BLIS_ARCH_STEAMROLLER:
+		case BLIS_ARCH_PILEDRIVER:
+		case BLIS_ARCH_BULLDOZER:   return  8.0;
+		case BLIS_ARCH_PENRYN:      return  4.0;
+		case BLIS_ARCH_A64FX:       return 32.0;
+		case BLIS_ARCH_THUNDERX2:   return  8.0;
+		case BLIS_ARCH_CORTEXA57:   return  4.0;
+		case BLIS_ARCH_POWER9:      return  8.0;
+		default:                    return  0.0;
+	}
+}
+
+// Estimate the frequency of the time-stamp counter by comparing it against
+// bli_clock(). On most recent x86 processors the TSC ticks at the nominal
+// (non-turbo) frequency, so efficiencies above 100% indicate turbo.
+static double ukr_tsc_ghz( void )
+{
+#ifdef UKR_HAVE_TSC
+	double             t0 = bli_clock();
+	unsigned long long c0 = __rdtsc();
+	double             t1;
+
+	do { t1 = bli_clock(); } while ( t1 - t0 < 0.1 );
+
+	return ( double )( __rdtsc() - c0 ) / ( ( t1 - t0 ) * 1.0e9 );
+#else
+	return 0.0;
+#endif
+}
+
+// Fill a buffer of n elements with random values.
+static void ukr_randv( num_t dt, dim_t n, void* p )
+{
+	obj_t x;
+
+	bli_obj_create_without_buffer( dt, n, 1, &x );
+	bli_obj_attach_buffer( p, 1, n, 0, &x );
+	bli_randv( &x );
+}
+
+// Choose k such that the (packed or unpacked) A and B operands of an
+// mr x nr x k update occupy about half of the given cache level.
+static dim_t ukr_k_for_level( dim_t level, num_t dt, dim_t mr, dim_t nr )
+{
+	cacheinfo_t info;
+	dim_t       size = ( level == 1 ? 32 * 1024 : 256 * 1024 );
+
+	if ( bli_cache_query( level, &info ) ) size = info.size;
+
+	dim_t k = ( size / 2 ) / ( ( mr + nr ) * ( dim_t )bli_dt_size( dt ) );
+
+	return bli_max( ( k / 8 ) * 8, 8 );
+}
+
+// -----------------------------------------------------------------------------
+
+static void ukr_invoke( ukr_call_t* u )
+{
+	switch ( u->kind )
+	{
+		case UKR_GEMM:
+			( ( ukr_gemm_vft )u->f )
+			( u->k, u->alpha, u->a, u->b, u->beta,
+			  u->c, u->rs_c, u->cs_c, &u->aux, u->cntx );
+			break;
+		case UKR_GEMMTRSM_L:
+		case UKR_GEMMTRSM_U:
+			( ( ukr_gemmtrsm_vft )u->f )
+			( u->k, u->alpha, u->a, u->a11, u->b, u->b11,
+			  u->c, u->rs_c, u->cs_c, &u->aux, u->cntx );
+			break;
+		case UKR_GEMMSUP:
+			( ( ukr_gemmsup_vft )u->f )
+			( BLIS_NO_CONJUGATE, BLIS_NO_CONJUGATE, u->mr, u->nr, u->k,
+			  u->alpha, u->a, u->rs_a, u->cs_a, u->b, u->rs_b, u->cs_b,
+			  u->beta, u->c, u->rs_c, u->cs_c, &u->aux, u->cntx );
+			break;
+		case UKR_PACKM:
+			( ( ukr_packm_vft )u->f )
+			( BLIS_NO_CONJUGATE, u->schema, u->mr, u->k, u->k,
+			  u->alpha, u->a, u->rs_a, u->cs_a, u->b, u->rs_b, u->cntx );
+			break;
+	}
+}
+
+// Return the best observed time of a single invocation.
+static double ukr_time( ukr_call_t* u )
+{
+	double best  = 1.0e9;
+	dim_t  n_rep = 1;
+
+	// Warm up the caches and find a repetition count that yields a
+	// measurable interval.
+	for ( ;; )
+	{
+		double t = bli_clock();
+		for ( dim_t r = 0; r < n_rep; ++r ) ukr_invoke( u );
+		t = bli_clock() - t;
+		if ( t > UKR_MIN_TIME ) break;
+		n_rep *= 2;
+	}
+
+	for ( int trial = 0; trial < UKR_N_TRIALS; ++trial )
+	{
+		double t = bli_clock();
+		for ( dim_t r = 0; r < n_rep; ++r ) ukr_invoke( u );
+		t = bli_clock() - t;
+		best = bli_min( best, t / n_rep );
+	}
+
+	return best;
+}
+
+// Time a kernel that performs flops floating-point operations over k
+// rank-1 updates (or packs k columns) and print one line of the report.
+// Returns the number of cycles per update.
+static double ukr_report
+     (
+       const char* name,
+       num_t       dt,
+       const char* level,
+       double      flops,
+       ukr_call_t* u,
+       double      ref_cycles
+     )
+{
+	double time   = ukr_time( u );
+	double cycles = time * ukr_ghz * 1.0e9 / u->k;
+	char   dt_ch  = "scdz"[ dt ];
+	double peak   = ukr_peak_dp * ( bli_is_single_prec( dt ) ? 2.0 : 1.0 );
+	bool   low    = FALSE;
+
+	printf( "%-16s %c %3ld ", name, dt_ch, ( long )u->mr );
+	if ( u->nr > 0 ) printf( "%3ld ", ( long )u->nr );
+	else             printf( "%3s ", "-" );
+	printf( "%5ld  %-2s ", ( long )u->k, level );
+
+	if ( u->kind == UKR_PACKM )
+	{
+		// cycles per packed column, and the ratio to the time the gemm
+		// microkernel spends consuming one column.
+		low = ( ukr_ghz > 0.0 && 0.0 < ref_cycles && ref_cycles < cycles );
+
+		if ( ukr_ghz > 0.0 )
+			printf( "%9.2f %8s %7s  (%.2fx gemm)", cycles, "-", "-",
+			        ref_cycles > 0.0 ? cycles / ref_cycles : 0.0 );
+		else
+			printf( "%9s %8s %7s", "-", "-", "-" );
+	}
+	else
+	{
+		double gflops = flops / ( time * 1.0e9 );
+
+		if ( ukr_ghz > 0.0 && peak > 0.0 )
+		{
+			double eff = flops / ( time * ukr_ghz * 1.0e9 ) / peak;
+
+			low = ( level[1] == '1' && eff < ukr_eff );
+			printf( "%9.2f %8.2f %6.1f%%", cycles, gflops, 100.0 * eff );
+		}
+		else if ( ukr_ghz > 0.0 )
+			printf( "%9.2f %8.2f %7s", cycles, gflops, "-" );
+		else
+			printf( "%9s %8.2f %7s", "-", gflops, "-" );
+	}
+
+	printf( "%s\n", low ? "  LOW" : "" );
+
+	if ( low ) ukr_n_low += 1;
+
+	return cycles;
+}
+
+// -----------------------------------------------------------------------------
+
+static double ukr_test_gemm( num_t dt, cntx_t* cntx )
+{
+	const dim_t mr     = bli_cntx_get_blksz_def_dt( dt, BLIS_MR, cntx );
+	const dim_t nr     = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+	const dim_t packmr = bli_cntx_get_blksz_max_dt( dt, BLIS_MR, cntx );
+	const dim_t packnr = bli_cntx_get_blksz_max_dt( dt, BLIS_NR, cntx );
+	const siz_t dt_sz  = bli_dt_size( dt );
+	const bool  row_pref
+	      = bli_cntx_get_l3_nat_ukr_prefs_dt( dt, BLIS_GEMM_UKR, cntx );
+	const double fmul  = ( bli_is_complex( dt ) ? 8.0 : 2.0 );
+	double      l1_cycles = 0.0;
+	err_t       r_val;
+
+	const char* names[] = { "gemm", "gemmtrsm_l", "gemmtrsm_u" };
+	l3ukr_t     ids[]   = { BLIS_GEMM_UKR, BLIS_GEMMTRSM_L_UKR, BLIS_GEMMTRSM_U_UKR };
+	ukr_kind_t  kinds[] = { UKR_GEMM, UKR_GEMMTRSM_L, UKR_GEMMTRSM_U };
+
+	for ( dim_t level = 1; level <= 2; ++level )
+	{
+		const dim_t k   = ukr_k_for_level( level, dt, packmr, packnr );
+		const dim_t k_a = k + packmr;
+
+		// Allocate room for the packed panels plus the triangular blocks
+		// used by gemmtrsm, which follow the k x mr (resp. k x nr) panels.
+		void* a = bli_malloc_user( packmr * k_a * dt_sz, &r_val );
+		void* b = bli_malloc_user( packnr * k_a * dt_sz, &r_val );
+		void* c = bli_malloc_user( mr * nr * dt_sz, &r_val );
+
+		ukr_randv( dt, packmr * k, a );
+		ukr_randv( dt, packnr * k_a, b );
+		ukr_randv( dt, mr * nr, c );
+
+		// Make the triangular block the identity so that repeated solves
+		// neither overflow nor encounter denormals. (The identity is its
+		// own inverse, so this holds whether or not the diagonal is
+		// pre-inverted.)
+		{
+			obj_t a11;
+			bli_obj_create_without_buffer( dt, packmr, packmr, &a11 );
+			bli_obj_attach_buffer( ( char* )a + packmr * k * dt_sz,
+			                       1, packmr, 0, &a11 );
+			bli_setm( &BLIS_ZERO, &a11 );
+			bli_setd( &BLIS_ONE, &a11 );
+		}
+
+		for ( dim_t i = 0; i < 3; ++i )
+		{
+			ukr_call_t u = { 0 };
+			char       level_str[ 3 ] = { 'L', ( char )( '0' + level ), '\0' };
+
+			u.kind  = kinds[ i ];
+			u.f     = bli_cntx_get_l3_nat_ukr_dt( dt, ids[ i ], cntx );
+			u.mr    = mr;
+			u.nr    = nr;
+			u.k     = k;
+			u.a     = a;
+			u.b     = b;
+			u.a11   = ( char* )a + packmr * k * dt_sz;
+			u.b11   = ( char* )b + packnr * k * dt_sz;
+			u.c     = c;
+			u.rs_c  = ( row_pref ? nr : 1 );
+			u.cs_c  = ( row_pref ? 1 : mr );
+			u.alpha = bli_obj_buffer_for_1x1( dt, &BLIS_ONE );
+			u.beta  = bli_obj_buffer_for_1x1( dt, &BLIS_ONE );
+			u.cntx  = cntx;
+
+			bli_auxinfo_set_next_ab( a, b, &u.aux );
+			bli_auxinfo_set_is_a( 1, &u.aux );
+			bli_auxinfo_set_is_b( 1, &u.aux );
+			bli_auxinfo_set_schema_a( BLIS_PACKED_ROW_PANELS, &u.aux );
+			bli_auxinfo_set_schema_b( BLIS_PACKED_COL_PANELS, &u.aux );
+
+			if ( u.f == NULL ) continue;
+
+			double flops = fmul * mr * nr * k;
+			if ( i > 0 ) flops += 0.5 * fmul * mr * mr * nr;
+
+			double cycles = ukr_report( names[ i ], dt, level_str, flops, &u, 0.0 );
+
+			if ( i == 0 && level == 1 ) l1_cycles = cycles;
+		}
+
+		bli_free_user( a );
+		bli_free_user( b );
+		bli_free_user( c );
+	}
+
+	return l1_cycles;
+}
+
+static void ukr_test_gemmsup( num_t dt, cntx_t* cntx )
+{
+	const dim_t mr    = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_MR, cntx );
+	const dim_t nr    = bli_cntx_get_l3_sup_blksz_def_dt( dt, BLIS_NR, cntx );
+	const siz_t dt_sz = bli_dt_size( dt );
+	const double fmul = ( bli_is_complex( dt ) ? 8.0 : 2.0 );
+	err_t       r_val;
+
+	if ( mr <= 0 || nr <= 0 ) return;
+
+	for ( dim_t level = 1; level <= 2; ++level )
+	{
+		const dim_t k = ukr_k_for_level( level, dt, mr, nr );
+
+		void* a = bli_malloc_user( mr * k * dt_sz, &r_val );
+		void* b = bli_malloc_user( k * nr * dt_sz, &r_val );
+		void* c = bli_malloc_user( mr * nr * dt_sz, &r_val );
+
+		ukr_randv( dt, mr * k, a );
+		ukr_randv( dt, k * nr, b );
+		ukr_randv( dt, mr * nr, c );
+
+		for ( stor3_t s = BLIS_RRR; s <= BLIS_CCC; ++s )
+		{
+			const bool c_col = ( s & 4 ), a_col = ( s & 2 ), b_col = ( s & 1 );
+			const char* stor_str[] = { "rrr", "rrc", "rcr", "rcc",
+			                           "crr", "crc", "ccr", "ccc" };
+			ukr_call_t  u = { 0 };
+			char        name[ 32 ];
+			char        level_str[ 3 ] = { 'L', ( char )( '0' + level ), '\0' };
+
+			u.f = ( void_fp )bli_cntx_get_l3_sup_ker_dt( dt, s, cntx );
+			if ( u.f == NULL ) continue;
+
+			// Skip storage combinations the framework never dispatches to
+			// this kernel: the problem is transposed first whenever the
+			// storage of C is opposite the kernel's preference.
+			if ( bli_cntx_l3_sup_ker_prefers_rows_dt( dt, s, cntx ) == c_col )
+				continue;
+
+			u.kind  = UKR_GEMMSUP;
+			u.mr    = mr;
+			u.nr    = nr;
+			u.k     = k;
+			u.a     = a;
+			u.rs_a  = ( a_col ? 1 : k  );
+			u.cs_a  = ( a_col ? mr : 1 );
+			u.b     = b;
+			u.rs_b  = ( b_col ? 1 : nr );
+			u.cs_b  = ( b_col ? k : 1  );
+			u.c     = c;
+			u.rs_c  = ( c_col ? 1 : nr );
+			u.cs_c  = ( c_col ? mr : 1 );
+			u.alpha = bli_obj_buffer_for_1x1( dt, &BLIS_ONE );
+			u.beta  = bli_obj_buffer_for_1x1( dt, &BLIS_ONE );
+			u.cntx  = cntx;
+
+			bli_auxinfo_set_next_ab( a, b, &u.aux );
+			bli_auxinfo_set_ps_a( mr * u.rs_a, &u.aux );
+			bli_auxinfo_set_ps_b( nr * u.cs_b, &u.aux );
+
+			snprintf( name, sizeof( name ), "gemmsup_%s", stor_str[ s ] );
+
+			ukr_report( name, dt, level_str, fmul * mr * nr * k, &u, 0.0 );
+		}
+
+		bli_free_user( a );
+		bli_free_user( b );
+		bli_free_user( c );
+	}
+}
+
+static void ukr_test_packm( num_t dt, cntx_t* cntx, double gemm_cycles )
+{
+	const siz_t dt_sz = bli_dt_size( dt );
+	const bszid_t bs[] = { BLIS_MR, BLIS_NR };
+	err_t       r_val;
+
+	for ( dim_t i = 0; i < 2; ++i )
+	{
+		const dim_t cdim = bli_cntx_get_blksz_def_dt( dt, bs[ i ], cntx );
+		const dim_t ldp  = bli_cntx_get_blksz_max_dt( dt, bs[ i ], cntx );
+		const dim_t k    = ukr_k_for_level( 1, dt, cdim, ldp );
+		ukr_call_t  u    = { 0 };
+		char        name[ 32 ];
+
+		if ( cdim >= BLIS_NUM_PACKM_KERS ) continue;
+
+		u.f = bli_cntx_get_packm_ker_dt( dt, ( l1mkr_t )cdim, cntx );
+		if ( u.f == NULL ) continue;
+
+		// Pack A (MR) from a column-stored matrix, where each column of
+		// the panel is contiguous, and B (NR) from a column-stored matrix,
+		// where each row of the panel is contiguous.
+		void* a = bli_malloc_user( cdim * k * dt_sz, &r_val );
+		void* p = bli_malloc_user( ldp * k * dt_sz, &r_val );
+
+		ukr_randv( dt, cdim * k, a );
+
+		u.kind   = UKR_PACKM;
+		u.mr     = cdim;
+		u.nr     = 0;
+		u.k      = k;
+		u.a      = a;
+		u.rs_a   = ( i == 0 ? 1 : k );
+		u.cs_a   = ( i == 0 ? cdim : 1 );
+		u.b      = p;
+		u.rs_b   = ldp;
+		u.alpha  = bli_obj_buffer_for_1x1( dt, &BLIS_ONE );
+		u.schema = ( i == 0 ? BLIS_PACKED_ROW_PANELS : BLIS_PACKED_COL_PANELS );
+		u.cntx   = cntx;
+
+		snprintf( name, sizeof( name ), "packm_%ldxk_%c",
+		          ( long )cdim, ( i == 0 ? 'a' : 'b' ) );
+
+		ukr_report( name, dt, "L1", 0.0, &u, gemm_cycles );
+
+		bli_free_user( a );
+		bli_free_user( p );
+	}
+}
+
+// -----------------------------------------------------------------------------
+
+int main( int argc, char** argv )
+{
+	const char* dts = "sdcz";
+	getopt_t    state;
+	int         opt;
+
+	bli_init();
+
+	ukr_peak_dp = ukr_peak_for_arch( bli_arch_query_id() );
+	ukr_ghz     = ukr_tsc_ghz();
+
+	bli_getopt_init_state( 0, &state );
+
+	while ( ( opt = bli_getopt( argc, argv, "d:F:p:e:", &state ) ) != -1 )
+	{
+		switch ( ( char )opt )
+		{
+			case 'd': dts         = state.optarg;         break;
+			case 'F': ukr_ghz     = atof( state.optarg ); break;
+			case 'p': ukr_peak_dp = atof( state.optarg ); break;
+			case 'e': ukr_eff     = atof( state.optarg ); break;
+			default:
+				fprintf( stderr, "%s: unexpected option '%c'\n", argv[0], state.optopt );
+				return 1;
+		}
+	}
+
+	cntx_t* cntx = bli_gks_query_cntx();
+
+	printf( "arch %s, clock %.2f GHz, peak %.0f dp flops/cycle, threshold %.0f%%\n\n",
+	        bli_arch_string( bli_arch_query_id() ), ukr_ghz, ukr_peak_dp,
+	        100.0 * ukr_eff );
+	printf( "%-16s %s %3s %3s %5s  %-2s %9s %8s %7s\n",
+	        "kernel", "dt", "mr", "nr", "k", "in", "cyc/upd", "gflops", "peak" );
+
+	for ( const char* d = dts; *d != '\0'; ++d )
+	{
+		num_t dt;
+
+		switch ( *d )
+		{
+			case 's': dt = BLIS_FLOAT;    break;
+			case 'd': dt = BLIS_DOUBLE;   break;
+			case 'c': dt = BLIS_SCOMPLEX; break;
+			case 'z': dt = BLIS_DCOMPLEX; break;
+			default:  continue;
+		}
+
+		double gemm_cycles = ukr_test_gemm( dt, cntx );
+		ukr_test_gemmsup( dt, cntx );
+		ukr_test_packm( dt, cntx, gemm_cycles );
+	}
+
+	printf( "\n%d kernel(s) flagged.\n", ukr_n_low );
+
+	bli_finalize();
+
+	return 0;
+}
+
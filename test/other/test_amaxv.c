@@ -0,0 +1,320 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include <math.h>
+#include "blis.h"
+
+// Check amaxv, aminv, and asumv against a scalar reference for each
+// datatype at unit and non-unit stride, using vectors with many ties and
+// vectors that contain NaN or Inf, and then time the double-precision
+// operations against the scalar loops of the reference BLAS idamax and
+// dasum.
+//
+// Usage: test_amaxv.x [p_begin p_end p_inc]
+
+static const num_t dts[] = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+
+// Return |re| + |im| of element i (or |x_i| if real), computed in the
+// precision of dt so that ties are exact.
+static double abs1( num_t dt, void* x, dim_t i, inc_t incx )
+{
+	const dim_t n_elem = ( bli_is_complex( dt ) ? 2 : 1 );
+
+	if ( bli_is_single_prec( dt ) )
+	{
+		float* xp = ( float* )x + i * incx * n_elem;
+
+		return ( n_elem == 2 ? fabsf( xp[0] ) + fabsf( xp[1] ) : fabsf( xp[0] ) );
+	}
+	else
+	{
+		double* xp = ( double* )x + i * incx * n_elem;
+
+		return ( n_elem == 2 ? fabs( xp[0] ) + fabs( xp[1] ) : fabs( xp[0] ) );
+	}
+}
+
+// Return the index of the first NaN, if any, and otherwise of the first
+// element with the largest (is_min == FALSE) or smallest absolute value.
+static dim_t amxv_ref( num_t dt, dim_t n, void* x, inc_t incx, bool is_min )
+{
+	dim_t  i_best = 0;
+	double a_best = 0.0;
+
+	for ( dim_t i = 0; i < n; ++i )
+	{
+		const double a = abs1( dt, x, i, incx );
+
+		if ( isnan( a ) ) return i;
+
+		if ( i == 0 || ( is_min ? a < a_best : a > a_best ) )
+		{
+			a_best = a;
+			i_best = i;
+		}
+	}
+
+	return i_best;
+}
+
+static dim_t check_amxv( void )
+{
+	const dim_t ns[]   = { 0, 1, 2, 3, 7, 8, 9, 15, 16, 17, 31, 32, 33, 100, 1000, 1001 };
+	const inc_t incs[] = { 1, 3 };
+	dim_t       n_fail = 0;
+	dim_t       n_test = 0;
+
+	for ( dim_t di = 0; di < 4; ++di )
+	for ( dim_t ni = 0; ni < 16; ++ni )
+	for ( dim_t ii = 0; ii < 2; ++ii )
+	for ( dim_t sp = 0; sp < 5; ++sp )
+	{
+		const num_t dt     = dts[ di ];
+		const dim_t n      = ns[ ni ];
+		const inc_t incx   = incs[ ii ];
+		const dim_t n_elem = ( bli_is_complex( dt ) ? 2 : 1 );
+		const dim_t len    = n * incx * n_elem + 1;
+
+		void*  x = malloc( len * sizeof( double ) );
+		dim_t  i_max, i_min;
+		double asum, asum_ref = 0.0, asum_abs = 0.0;
+
+		for ( dim_t i = 0; i < len; ++i )
+		{
+			// sp 0 draws from a wide range; the others draw from a few
+			// values so that the largest and smallest are tied many times.
+			const double r = ( sp == 0 ? ( double )( rand() % 20001 - 10000 ) / 1000.0
+			                           : ( double )( rand() % 5 - 2 ) );
+
+			if ( bli_is_single_prec( dt ) ) ( ( float*  )x )[ i ] = ( float )r;
+			else                            ( ( double* )x )[ i ] = r;
+		}
+
+		// Plant NaN (sp 2, 3) or Inf (sp 4) in the last and middle elements.
+		if ( n > 0 && sp >= 2 )
+		{
+			const double v  = ( sp == 4 ? INFINITY : NAN );
+			const dim_t  j0 = ( n - 1 ) * incx * n_elem + ( sp == 3 ? n_elem - 1 : 0 );
+			const dim_t  j1 = ( n / 2 ) * incx * n_elem;
+
+			if ( bli_is_single_prec( dt ) ) { ( ( float*  )x )[ j0 ] = v; if ( sp != 3 ) ( ( float*  )x )[ j1 ] = v; }
+			else                            { ( ( double* )x )[ j0 ] = v; if ( sp != 3 ) ( ( double* )x )[ j1 ] = v; }
+		}
+
+		for ( dim_t i = 0; i < n; ++i )
+		{
+			asum_ref += abs1( dt, x, i, incx );
+			asum_abs += fabs( abs1( dt, x, i, incx ) );
+		}
+
+		if ( dt == BLIS_FLOAT )
+		{
+			float s;
+			bli_samaxv( n, x, incx, &i_max );
+			bli_saminv( n, x, incx, &i_min );
+			bli_sasumv( n, x, incx, &s ); asum = s;
+		}
+		else if ( dt == BLIS_DOUBLE )
+		{
+			bli_damaxv( n, x, incx, &i_max );
+			bli_daminv( n, x, incx, &i_min );
+			bli_dasumv( n, x, incx, &asum );
+		}
+		else if ( dt == BLIS_SCOMPLEX )
+		{
+			float s;
+			bli_camaxv( n, x, incx, &i_max );
+			bli_caminv( n, x, incx, &i_min );
+			bli_casumv( n, x, incx, &s ); asum = s;
+		}
+		else
+		{
+			bli_zamaxv( n, x, incx, &i_max );
+			bli_zaminv( n, x, incx, &i_min );
+			bli_zasumv( n, x, incx, &asum );
+		}
+
+		{
+			const double eps    = ( bli_is_single_prec( dt ) ? 1.0e-5 : 1.0e-13 );
+			const bool   ok_sum = ( isnan( asum_ref ) ? isnan( asum ) :
+			                        isinf( asum_ref ) ? asum == asum_ref :
+			                        fabs( asum - asum_ref ) <= eps * asum_abs );
+
+			if ( i_max != amxv_ref( dt, n, x, incx, FALSE ) ||
+			     i_min != amxv_ref( dt, n, x, incx, TRUE  ) || !ok_sum )
+			{
+				printf( "FAILED: dt %d n %d incx %d special %d: "
+				        "amaxv %d (%d) aminv %d (%d) asumv %g (%g)\n",
+				        ( int )dt, ( int )n, ( int )incx, ( int )sp,
+				        ( int )i_max, ( int )amxv_ref( dt, n, x, incx, FALSE ),
+				        ( int )i_min, ( int )amxv_ref( dt, n, x, incx, TRUE ),
+				        asum, asum_ref );
+				++n_fail;
+			}
+		}
+
+		++n_test;
+
+		free( x );
+	}
+
+	printf( "%% %lu of %lu checks failed\n", ( unsigned long )n_fail,
+	                                         ( unsigned long )n_test );
+
+	return n_fail;
+}
+
+// The loop of the reference BLAS idamax for unit stride.
+static dim_t idamax_loop( dim_t n, double* x )
+{
+	dim_t  i_max = 0;
+	double dmax  = fabs( x[0] );
+
+	for ( dim_t i = 1; i < n; ++i )
+	{
+		if ( fabs( x[i] ) > dmax )
+		{
+			i_max = i;
+			dmax  = fabs( x[i] );
+		}
+	}
+
+	return i_max;
+}
+
+// The loop of the reference BLAS dasum for unit stride.
+static double dasum_loop( dim_t n, double* x )
+{
+	double dtemp = 0.0;
+
+	for ( dim_t i = 0; i < n; ++i ) dtemp += fabs( x[i] );
+
+	return dtemp;
+}
+
+int main( int argc, char** argv )
+{
+	obj_t   x;
+	dim_t   p;
+	dim_t   p_begin, p_end, p_inc;
+	num_t   dt;
+	int     r, n_repeats;
+	dim_t   index;
+	double  sum;
+
+	double dtime;
+	double dtime_ref, dtime_max, dtime_min, dtime_sref, dtime_sum;
+	double bytes;
+
+	n_repeats = 100;
+
+	p_begin = 1000;
+	p_end   = 100000;
+	p_inc   = 11000;
+
+	if ( argc > 3 )
+	{
+		p_begin = atoi( argv[1] );
+		p_end   = atoi( argv[2] );
+		p_inc   = atoi( argv[3] );
+	}
+
+	if ( check_amxv() != 0 ) return 1;
+
+	dt = BLIS_DOUBLE;
+
+	printf( "%%                          GB/s\n" );
+	printf( "%%      n   idamax   amaxv   aminv   dasum   asumv\n" );
+
+	for ( p = p_begin; p <= p_end; p += p_inc )
+	{
+		double* buf;
+
+		bli_obj_create( dt, p, 1, 0, 0, &x );
+		bli_randv( &x );
+
+		buf = bli_obj_buffer( &x );
+
+		dtime_ref  = DBL_MAX;
+		dtime_max  = DBL_MAX;
+		dtime_min  = DBL_MAX;
+		dtime_sref = DBL_MAX;
+		dtime_sum  = DBL_MAX;
+
+		for ( r = 0; r < n_repeats; ++r )
+		{
+			dtime = bli_clock();
+			index = idamax_loop( p, buf );
+			dtime_ref = bli_clock_min_diff( dtime_ref, dtime );
+
+			dtime = bli_clock();
+			bli_damaxv( p, buf, 1, &index );
+			dtime_max = bli_clock_min_diff( dtime_max, dtime );
+
+			dtime = bli_clock();
+			bli_daminv( p, buf, 1, &index );
+			dtime_min = bli_clock_min_diff( dtime_min, dtime );
+
+			dtime = bli_clock();
+			sum = dasum_loop( p, buf );
+			dtime_sref = bli_clock_min_diff( dtime_sref, dtime );
+
+			dtime = bli_clock();
+			bli_dasumv( p, buf, 1, &sum );
+			dtime_sum = bli_clock_min_diff( dtime_sum, dtime );
+		}
+
+		bytes = 1.0 * p * bli_dt_size( dt );
+
+		printf( "%7lu  %7.2f %7.2f %7.2f %7.2f %7.2f\n",
+		        ( unsigned long )p,
+		        bytes / dtime_ref  / 1.0e9,
+		        bytes / dtime_max  / 1.0e9,
+		        bytes / dtime_min  / 1.0e9,
+		        bytes / dtime_sref / 1.0e9,
+		        bytes / dtime_sum  / 1.0e9 );
+
+		bli_obj_free( &x );
+	}
+
+	( void )index;
+	( void )sum;
+
+	return 0;
+}
@@ -0,0 +1,257 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include "blis.h"
+
+// Search for cache blocksizes (MC, KC, NC) and small/unpacked (sup)
+// thresholds that perform well on the running machine and write them to a
+// context profile. The profile may then be applied at initialization by
+// setting the BLIS_CNTX_PROFILE environment variable to its filename (see
+// frame/base/bli_cntx_profile.h).
+//
+// The blocksizes are tuned one at a time (KC, then MC, then NC), each by
+// timing gemm over a range of candidates around the current value while
+// holding the others fixed. The sup thresholds are set to the smallest
+// cubic problem size at which the conventional (packing) implementation
+// consistently outperforms the sup implementation. The search honors the
+// current threading settings (e.g. BLIS_NUM_THREADS), and so it should be
+// run with the settings under which the profile will be used.
+//
+// Usage: test_autotune.x [profile_file] [datatypes] [problem_size]
+//
+//   profile_file   the file to write (default: blis_cntx_profile.txt)
+//   datatypes      the datatypes to tune, a subset of "sdcz" (default: "sd")
+//   problem_size   m = n = k for the blocksize search (default: 1536)
+
+#define N_REPEATS 3
+
+static double tune_time_gemm
+     (
+       num_t   dt,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	obj_t  a, b, c;
+	double dtime_best = 1.0e9;
+
+	bli_obj_create( dt, m, k, 0, 0, &a );
+	bli_obj_create( dt, k, n, 0, 0, &b );
+	bli_obj_create( dt, m, n, 0, 0, &c );
+
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_randm( &c );
+
+	for ( int r = 0; r < N_REPEATS; ++r )
+	{
+		double dtime = bli_clock();
+
+		bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c, cntx, rntm );
+
+		dtime_best = bli_clock_min_diff( dtime_best, dtime );
+	}
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+
+	return dtime_best;
+}
+
+// Time gemm for each candidate value of the named blocksize, scaled from
+// its current value, and leave the fastest value set in cntx.
+static void tune_blksz
+     (
+       num_t       dt,
+       const char* name,
+       dim_t       m,
+       dim_t       n,
+       dim_t       k,
+       cntx_t*     cntx,
+       rntm_t*     rntm
+     )
+{
+	const double scales[] = { 0.25, 0.5, 0.75, 1.0, 1.25, 1.5, 2.0, 3.0 };
+	const int    n_scales = sizeof( scales ) / sizeof( double );
+
+	dim_t  val_orig  = bli_cntx_profile_get( name, dt, cntx );
+	dim_t  val_best  = val_orig;
+	double time_best = 1.0e9;
+	dim_t  val_prev  = -1;
+
+	for ( int i = 0; i < n_scales; ++i )
+	{
+		cntx_t cntx_l = *cntx;
+
+		// Candidates that round to an invalid or already-timed value are
+		// skipped.
+		if ( bli_cntx_profile_set( name, dt, ( dim_t )( scales[ i ] * val_orig ),
+		                           &cntx_l ) != BLIS_SUCCESS ) continue;
+
+		dim_t val = bli_cntx_profile_get( name, dt, &cntx_l );
+
+		if ( val == val_prev ) continue;
+		val_prev = val;
+
+		double dtime = tune_time_gemm( dt, m, n, k, &cntx_l, rntm );
+
+		printf( "%%   %s = %5ld: %8.4f s\n", name, ( long )val, dtime );
+
+		if ( dtime < time_best ) { time_best = dtime; val_best = val; }
+	}
+
+	bli_cntx_profile_set( name, dt, val_best, cntx );
+
+	printf( "%% %c %s: %ld -> %ld\n", "scdz"[ dt ], name,
+	        ( long )val_orig, ( long )val_best );
+}
+
+// Find the smallest cubic problem size at which the conventional
+// implementation is faster than the sup implementation for two consecutive
+// sizes, and set the sup thresholds to that size.
+static void tune_thresh
+     (
+       num_t   dt,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	const dim_t size_lo  = 32;
+	const dim_t size_hi  = 640;
+	const dim_t size_inc = 32;
+
+	// Skip datatypes for which the configuration does not use sup.
+	if ( bli_cntx_profile_get( "mt", dt, cntx ) <= 0 ) return;
+
+	cntx_t cntx_sup = *cntx;
+	rntm_t rntm_sup = *rntm;
+	rntm_t rntm_lrg = *rntm;
+	dim_t  thresh   = size_hi;
+	dim_t  n_wins   = 0;
+
+	// Force the sup implementation for every size by raising its
+	// thresholds, or force the conventional implementation by disabling
+	// sup via the rntm_t.
+	bli_cntx_profile_set( "mt", dt, size_hi + 1, &cntx_sup );
+	bli_cntx_profile_set( "nt", dt, size_hi + 1, &cntx_sup );
+	bli_cntx_profile_set( "kt", dt, size_hi + 1, &cntx_sup );
+	bli_rntm_enable_l3_sup( &rntm_sup );
+	bli_rntm_disable_l3_sup( &rntm_lrg );
+
+	for ( dim_t size = size_lo; size <= size_hi; size += size_inc )
+	{
+		double time_sup = tune_time_gemm( dt, size, size, size, &cntx_sup, &rntm_sup );
+		double time_lrg = tune_time_gemm( dt, size, size, size, cntx,      &rntm_lrg );
+
+		printf( "%%   size %4ld: sup %10.6f s  conv %10.6f s\n",
+		        ( long )size, time_sup, time_lrg );
+
+		if ( time_lrg < time_sup ) n_wins += 1;
+		else                       n_wins  = 0;
+
+		if ( n_wins == 2 ) { thresh = size - size_inc; break; }
+	}
+
+	printf( "%% %c mt/nt/kt: %ld -> %ld\n", "scdz"[ dt ],
+	        ( long )bli_cntx_profile_get( "mt", dt, cntx ), ( long )thresh );
+
+	bli_cntx_profile_set( "mt", dt, thresh, cntx );
+	bli_cntx_profile_set( "nt", dt, thresh, cntx );
+	bli_cntx_profile_set( "kt", dt, thresh, cntx );
+}
+
+int main( int argc, char** argv )
+{
+	const char* filename = ( argc > 1 ? argv[1] : "blis_cntx_profile.txt" );
+	const char* dts      = ( argc > 2 ? argv[2] : "sd" );
+	dim_t       size     = ( argc > 3 ? atoi( argv[3] ) : 1536 );
+
+	arch_t      id       = bli_arch_query_id();
+	cntx_t      cntx     = *bli_gks_query_cntx();
+	rntm_t      rntm;
+
+	bli_rntm_init_from_global( &rntm );
+
+	printf( "%% tuning for %s (%s)\n", bli_arch_string( id ),
+	        bli_info_get_enable_threading() ? "threaded" : "single-threaded" );
+
+	for ( const char* p = dts; *p != '\0'; ++p )
+	{
+		num_t  dt;
+		rntm_t rntm_l = rntm;
+
+		switch ( *p )
+		{
+			case 's': dt = BLIS_FLOAT;    break;
+			case 'd': dt = BLIS_DOUBLE;   break;
+			case 'c': dt = BLIS_SCOMPLEX; break;
+			case 'z': dt = BLIS_DCOMPLEX; break;
+			default:  continue;
+		}
+
+		// The blocksize search targets the conventional implementation.
+		bli_rntm_disable_l3_sup( &rntm_l );
+
+		tune_blksz( dt, "kc", size, size, size, &cntx, &rntm_l );
+		tune_blksz( dt, "mc", size, size, size, &cntx, &rntm_l );
+
+		// NC only matters when n exceeds it, so use a wider problem.
+		dim_t nc = bli_cntx_profile_get( "nc", dt, &cntx );
+		tune_blksz( dt, "nc", size / 2, bli_max( size, 2 * nc ), size / 2,
+		            &cntx, &rntm_l );
+
+		tune_thresh( dt, &cntx, &rntm );
+	}
+
+	if ( bli_cntx_profile_write( filename, id, &cntx ) != BLIS_SUCCESS )
+	{
+		printf( "%% could not write %s\n", filename );
+		return 1;
+	}
+
+	printf( "%% wrote %s; set BLIS_CNTX_PROFILE=%s to apply it\n",
+	        filename, filename );
+
+	return 0;
+}
+
@@ -0,0 +1,555 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include "blis.h"
+
+// Check the banded and packed level-2 operations against their dense
+// counterparts (gemv, hemv, symv, trmv, trsv, her, syr, her2, syr2) for each
+// datatype and every combination of uplo, transposition/conjugation, and
+// diagonal, and then time dgbmv for a few bandwidths against the column-
+// oriented loop of the reference BLAS. Bandwidth counts one read of each
+// element in the band.
+//
+// Usage: test_bandpack.x [p_begin p_end p_inc]
+
+static const num_t dts[] = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+
+// Compare with a relative tolerance: the kernels accumulate in a different
+// order than the dense operations. Any uplo attribute (as carried by packed
+// storage) is ignored.
+static bool near_equal( obj_t* x_in, obj_t* y_in )
+{
+	const num_t dt   = bli_obj_dt( x_in );
+	const num_t dt_r = bli_obj_dt_proj_to_real( x_in );
+	const double eps = ( bli_is_single_prec( dt ) ? 1.0e-4 : 1.0e-12 );
+
+	obj_t  x, y, d, norm_d, norm_y;
+	double nd, ny, junk;
+
+	bli_obj_alias_to( x_in, &x );
+	bli_obj_alias_to( y_in, &y );
+	bli_obj_set_uplo( BLIS_DENSE, &x );
+	bli_obj_set_uplo( BLIS_DENSE, &y );
+
+	bli_obj_create( dt, bli_obj_length( &x ), bli_obj_width( &x ), 0, 0, &d );
+	bli_obj_scalar_init_detached( dt_r, &norm_d );
+	bli_obj_scalar_init_detached( dt_r, &norm_y );
+
+	bli_copym( &x, &d );
+	bli_subm( &y, &d );
+	bli_normfm( &d, &norm_d );
+	bli_normfm( &y, &norm_y );
+	bli_getsc( &norm_d, &nd, &junk );
+	bli_getsc( &norm_y, &ny, &junk );
+
+	bli_obj_free( &d );
+
+	return nd <= eps * ( ny + 1.0 );
+}
+
+// Zero the elements of the m x n matrix a that lie more than kl below or ku
+// above the diagonal.
+static void zero_outside_band( dim_t kl, dim_t ku, obj_t* a )
+{
+	for ( dim_t j = 0; j < bli_obj_width( a ); ++j )
+	for ( dim_t i = 0; i < bli_obj_length( a ); ++i )
+		if ( i - j > kl || j - i > ku ) bli_setijm( 0.0, 0.0, i, j, a );
+}
+
+// Copy the band of a into the band storage ab, where row ku of ab holds the
+// diagonal.
+static void pack_band( dim_t kl, dim_t ku, obj_t* a, obj_t* ab )
+{
+	double ar, ai;
+
+	bli_setm( &BLIS_ZERO, ab );
+
+	for ( dim_t j = 0; j < bli_obj_width( a ); ++j )
+	for ( dim_t i = bli_max( 0, j - ku ); i < bli_min( bli_obj_length( a ), j + kl + 1 ); ++i )
+	{
+		bli_getijm( i, j, a, &ar, &ai );
+		bli_setijm( ar, ai, ku + i - j, j, ab );
+	}
+}
+
+// Copy the uplo triangle of the m x m matrix a into the packed vector ap.
+static void pack_tri( uplo_t uplo, obj_t* a, obj_t* ap )
+{
+	const dim_t m = bli_obj_length( a );
+	dim_t       p = 0;
+	double      ar, ai;
+
+	for ( dim_t j = 0; j < m; ++j )
+	for ( dim_t i = ( bli_is_upper( uplo ) ? 0 : j ); i < ( bli_is_upper( uplo ) ? j + 1 : m ); ++i )
+	{
+		bli_getijm( i, j, a, &ar, &ai );
+		bli_setijm( ar, ai, p++, 0, ap );
+	}
+}
+
+static dim_t n_fail = 0;
+static dim_t n_test = 0;
+
+static void report( bool eq, const char* op, num_t dt, int p0, int p1, int p2, int p3, int p4 )
+{
+	if ( !eq )
+	{
+		printf( "%s FAILED: dt %d params %d %d %d %d %d\n", op, ( int )dt, p0, p1, p2, p3, p4 );
+		++n_fail;
+	}
+	++n_test;
+}
+
+static void check_gbmv( void )
+{
+	const trans_t transs[] = { BLIS_NO_TRANSPOSE, BLIS_TRANSPOSE,
+	                           BLIS_CONJ_NO_TRANSPOSE, BLIS_CONJ_TRANSPOSE };
+	const dim_t   ms[]     = { 1, 9, 40 };
+	const dim_t   ks[]     = { 0, 2, 5 };
+
+	for ( dim_t di = 0; di < 4; ++di )
+	for ( dim_t ti = 0; ti < 4; ++ti )
+	for ( dim_t mi = 0; mi < 3; ++mi )
+	for ( dim_t ni = 0; ni < 3; ++ni )
+	for ( dim_t li = 0; li < 3; ++li )
+	for ( dim_t ui = 0; ui < 3; ++ui )
+	{
+		const num_t   dt    = dts[ di ];
+		const trans_t trans = transs[ ti ];
+		const dim_t   m     = ms[ mi ];
+		const dim_t   n     = ms[ ni ] + 1;
+		const dim_t   kl    = ks[ li ];
+		const dim_t   ku    = ks[ ui ];
+
+		obj_t alpha, beta, a, ab, x, y, y_ref;
+		dim_t m_x, m_y;
+
+		bli_set_dims_with_trans( trans, n, m, &m_x, &m_y );
+
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		bli_obj_create( dt, 1, 1, 0, 0, &beta );
+		bli_obj_create( dt, m, n, 0, 0, &a );
+		bli_obj_create( dt, kl + ku + 1, n, 0, 0, &ab );
+		bli_obj_create( dt, m_x, 1, 0, 0, &x );
+		bli_obj_create( dt, m_y, 1, 0, 0, &y );
+		bli_obj_create( dt, m_y, 1, 0, 0, &y_ref );
+
+		bli_setsc( 1.2, -0.3, &alpha );
+		bli_setsc( -0.7, 0.4, &beta );
+		bli_randm( &a );
+		bli_randv( &x );
+		bli_randv( &y );
+		bli_copyv( &y, &y_ref );
+
+		zero_outside_band( kl, ku, &a );
+		pack_band( kl, ku, &a, &ab );
+
+		bli_obj_set_conjtrans( trans, &a );
+		bli_obj_set_conjtrans( trans, &ab );
+		bli_obj_set_conj( BLIS_CONJUGATE, &x );
+
+		bli_gemv( &alpha, &a, &x, &beta, &y_ref );
+		bli_gbmv( kl, &alpha, &ab, &x, &beta, &y );
+
+		report( near_equal( &y, &y_ref ), "gbmv", dt, trans, m, n, kl, ku );
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &beta );
+		bli_obj_free( &a );
+		bli_obj_free( &ab );
+		bli_obj_free( &x );
+		bli_obj_free( &y );
+		bli_obj_free( &y_ref );
+	}
+}
+
+static void check_xbmv_xpmv( void )
+{
+	const uplo_t uplos[] = { BLIS_LOWER, BLIS_UPPER };
+	const dim_t  ms[]    = { 1, 9, 40 };
+	const dim_t  ks[]    = { 0, 1, 4, 100 };
+
+	for ( dim_t di = 0; di < 4; ++di )
+	for ( dim_t hi = 0; hi < 2; ++hi )
+	for ( dim_t ui = 0; ui < 2; ++ui )
+	for ( dim_t ci = 0; ci < 2; ++ci )
+	for ( dim_t mi = 0; mi < 3; ++mi )
+	for ( dim_t ki = 0; ki < 4; ++ki )
+	{
+		const num_t  dt    = dts[ di ];
+		const bool   herm  = hi;
+		const uplo_t uplo  = uplos[ ui ];
+		const conj_t conja = ( ci ? BLIS_CONJUGATE : BLIS_NO_CONJUGATE );
+		const dim_t  m     = ms[ mi ];
+		const dim_t  k     = bli_min( ks[ ki ], m - 1 );
+
+		obj_t alpha, beta, a, ab, ap, x, y, y_ref;
+
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		bli_obj_create( dt, 1, 1, 0, 0, &beta );
+		bli_obj_create( dt, m, m, 0, 0, &a );
+		bli_obj_create( dt, k + 1, m, 0, 0, &ab );
+		bli_obj_create( dt, ( m * ( m + 1 ) ) / 2, 1, 0, 0, &ap );
+		bli_obj_create( dt, m, 1, 0, 0, &x );
+		bli_obj_create( dt, m, 1, 0, 0, &y );
+		bli_obj_create( dt, m, 1, 0, 0, &y_ref );
+
+		bli_setsc( 1.2, -0.3, &alpha );
+		bli_setsc( -0.7, 0.4, &beta );
+		bli_randm( &a );
+		bli_randv( &x );
+
+		zero_outside_band( k, k, &a );
+		if ( bli_is_upper( uplo ) ) pack_band( 0, k, &a, &ab );
+		else                        pack_band( k, 0, &a, &ab );
+		pack_tri( uplo, &a, &ap );
+
+		bli_obj_set_struc( herm ? BLIS_HERMITIAN : BLIS_SYMMETRIC, &a );
+		bli_obj_set_uplo( uplo, &a );
+		bli_obj_set_uplo( uplo, &ab );
+		bli_obj_set_uplo( uplo, &ap );
+		bli_obj_set_conj( conja, &a );
+		bli_obj_set_conj( conja, &ab );
+		bli_obj_set_conj( conja, &ap );
+
+		// Band storage.
+		bli_randv( &y );
+		bli_copyv( &y, &y_ref );
+
+		if ( herm ) { bli_hemv( &alpha, &a, &x, &beta, &y_ref );
+		              bli_hbmv( &alpha, &ab, &x, &beta, &y ); }
+		else        { bli_symv( &alpha, &a, &x, &beta, &y_ref );
+		              bli_sbmv( &alpha, &ab, &x, &beta, &y ); }
+
+		report( near_equal( &y, &y_ref ), herm ? "hbmv" : "sbmv", dt, uplo, conja, m, k, 0 );
+
+		// Packed storage.
+		bli_randv( &y );
+		bli_copyv( &y, &y_ref );
+
+		if ( herm ) { bli_hemv( &alpha, &a, &x, &beta, &y_ref );
+		              bli_hpmv( &alpha, &ap, &x, &beta, &y ); }
+		else        { bli_symv( &alpha, &a, &x, &beta, &y_ref );
+		              bli_spmv( &alpha, &ap, &x, &beta, &y ); }
+
+		report( near_equal( &y, &y_ref ), herm ? "hpmv" : "spmv", dt, uplo, conja, m, k, 0 );
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &beta );
+		bli_obj_free( &a );
+		bli_obj_free( &ab );
+		bli_obj_free( &ap );
+		bli_obj_free( &x );
+		bli_obj_free( &y );
+		bli_obj_free( &y_ref );
+	}
+}
+
+static void check_txmv_txsv( void )
+{
+	const uplo_t  uplos[]  = { BLIS_LOWER, BLIS_UPPER };
+	const trans_t transs[] = { BLIS_NO_TRANSPOSE, BLIS_TRANSPOSE,
+	                           BLIS_CONJ_NO_TRANSPOSE, BLIS_CONJ_TRANSPOSE };
+	const diag_t  diags[]  = { BLIS_NONUNIT_DIAG, BLIS_UNIT_DIAG };
+	const dim_t   ms[]     = { 1, 9, 40 };
+	const dim_t   ks[]     = { 0, 1, 4, 100 };
+
+	for ( dim_t di = 0; di < 4; ++di )
+	for ( dim_t ui = 0; ui < 2; ++ui )
+	for ( dim_t ti = 0; ti < 4; ++ti )
+	for ( dim_t gi = 0; gi < 2; ++gi )
+	for ( dim_t mi = 0; mi < 3; ++mi )
+	for ( dim_t ki = 0; ki < 4; ++ki )
+	{
+		const num_t   dt    = dts[ di ];
+		const uplo_t  uplo  = uplos[ ui ];
+		const trans_t trans = transs[ ti ];
+		const diag_t  diag  = diags[ gi ];
+		const dim_t   m     = ms[ mi ];
+		const dim_t   k     = bli_min( ks[ ki ], m - 1 );
+
+		obj_t alpha, shift, a, ab, ap, x, x_ref;
+
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		bli_obj_create( dt, 1, 1, 0, 0, &shift );
+		bli_obj_create( dt, m, m, 0, 0, &a );
+		bli_obj_create( dt, k + 1, m, 0, 0, &ab );
+		bli_obj_create( dt, ( m * ( m + 1 ) ) / 2, 1, 0, 0, &ap );
+		bli_obj_create( dt, m, 1, 0, 0, &x );
+		bli_obj_create( dt, m, 1, 0, 0, &x_ref );
+
+		bli_setsc( 0.8, 0.3, &alpha );
+		bli_randm( &a );
+		bli_randv( &x_ref );
+
+		// Keep the solves well-conditioned, even with a unit diagonal.
+		bli_setsc( 1.0 / ( k + 1 ), 0.0, &shift );
+		bli_scalm( &shift, &a );
+		bli_setsc( 2.0, 0.0, &shift );
+		bli_shiftd( &shift, &a );
+
+		if ( bli_is_upper( uplo ) ) zero_outside_band( 0, k, &a );
+		else                        zero_outside_band( k, 0, &a );
+
+		if ( bli_is_upper( uplo ) ) pack_band( 0, k, &a, &ab );
+		else                        pack_band( k, 0, &a, &ab );
+		pack_tri( uplo, &a, &ap );
+
+		bli_obj_set_struc( BLIS_TRIANGULAR, &a );
+		bli_obj_set_uplo( uplo, &a );
+		bli_obj_set_uplo( uplo, &ab );
+		bli_obj_set_uplo( uplo, &ap );
+		bli_obj_set_conjtrans( trans, &a );
+		bli_obj_set_conjtrans( trans, &ab );
+		bli_obj_set_conjtrans( trans, &ap );
+		bli_obj_set_diag( diag, &a );
+		bli_obj_set_diag( diag, &ab );
+		bli_obj_set_diag( diag, &ap );
+
+		// Band storage.
+		bli_copyv( &x_ref, &x );
+		bli_trmv( &alpha, &a, &x_ref );
+		bli_tbmv( &alpha, &ab, &x );
+		report( near_equal( &x, &x_ref ), "tbmv", dt, uplo, trans, diag, m, k );
+
+		bli_copyv( &x_ref, &x );
+		bli_trsv( &alpha, &a, &x_ref );
+		bli_tbsv( &alpha, &ab, &x );
+		report( near_equal( &x, &x_ref ), "tbsv", dt, uplo, trans, diag, m, k );
+
+		// Packed storage.
+		bli_copyv( &x_ref, &x );
+		bli_trmv( &alpha, &a, &x_ref );
+		bli_tpmv( &alpha, &ap, &x );
+		report( near_equal( &x, &x_ref ), "tpmv", dt, uplo, trans, diag, m, k );
+
+		bli_copyv( &x_ref, &x );
+		bli_trsv( &alpha, &a, &x_ref );
+		bli_tpsv( &alpha, &ap, &x );
+		report( near_equal( &x, &x_ref ), "tpsv", dt, uplo, trans, diag, m, k );
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &shift );
+		bli_obj_free( &a );
+		bli_obj_free( &ab );
+		bli_obj_free( &ap );
+		bli_obj_free( &x );
+		bli_obj_free( &x_ref );
+	}
+}
+
+static void check_xpr( void )
+{
+	const uplo_t uplos[] = { BLIS_LOWER, BLIS_UPPER };
+	const dim_t  ms[]    = { 1, 9, 40 };
+
+	for ( dim_t di = 0; di < 4; ++di )
+	for ( dim_t hi = 0; hi < 2; ++hi )
+	for ( dim_t ui = 0; ui < 2; ++ui )
+	for ( dim_t ci = 0; ci < 4; ++ci )
+	for ( dim_t mi = 0; mi < 3; ++mi )
+	{
+		const num_t  dt    = dts[ di ];
+		const bool   herm  = hi;
+		const uplo_t uplo  = uplos[ ui ];
+		const conj_t conjx = ( ci & 1 ? BLIS_CONJUGATE : BLIS_NO_CONJUGATE );
+		const conj_t conjy = ( ci & 2 ? BLIS_CONJUGATE : BLIS_NO_CONJUGATE );
+		const dim_t  m     = ms[ mi ];
+		const dim_t  mp    = ( m * ( m + 1 ) ) / 2;
+
+		obj_t alpha, a, ap, ap_ref, x, y;
+
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		bli_obj_create( dt, m, m, 0, 0, &a );
+		bli_obj_create( dt, mp, 1, 0, 0, &ap );
+		bli_obj_create( dt, mp, 1, 0, 0, &ap_ref );
+		bli_obj_create( dt, m, 1, 0, 0, &x );
+		bli_obj_create( dt, m, 1, 0, 0, &y );
+
+		bli_randv( &x );
+		bli_randv( &y );
+		bli_obj_set_conj( conjx, &x );
+		bli_obj_set_conj( conjy, &y );
+
+		bli_obj_set_struc( herm ? BLIS_HERMITIAN : BLIS_SYMMETRIC, &a );
+		bli_obj_set_uplo( uplo, &a );
+		bli_obj_set_uplo( uplo, &ap );
+
+		// Rank-1 update (with a real alpha for her).
+		bli_setsc( 1.3, ( herm ? 0.0 : -0.6 ), &alpha );
+		bli_randm( &a );
+		pack_tri( uplo, &a, &ap );
+
+		if ( herm ) { bli_her( &alpha, &x, &a ); bli_hpr( &alpha, &x, &ap ); }
+		else        { bli_syr( &alpha, &x, &a ); bli_spr( &alpha, &x, &ap ); }
+
+		pack_tri( uplo, &a, &ap_ref );
+		report( near_equal( &ap, &ap_ref ), herm ? "hpr" : "spr", dt, uplo, conjx, m, 0, 0 );
+
+		// Rank-2 update.
+		bli_setsc( 1.3, -0.6, &alpha );
+		bli_randm( &a );
+		pack_tri( uplo, &a, &ap );
+
+		if ( herm ) { bli_her2( &alpha, &x, &y, &a ); bli_hpr2( &alpha, &x, &y, &ap ); }
+		else        { bli_syr2( &alpha, &x, &y, &a ); bli_spr2( &alpha, &x, &y, &ap ); }
+
+		pack_tri( uplo, &a, &ap_ref );
+		report( near_equal( &ap, &ap_ref ), herm ? "hpr2" : "spr2", dt, uplo, conjx, conjy, m, 0 );
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &a );
+		bli_obj_free( &ap );
+		bli_obj_free( &ap_ref );
+		bli_obj_free( &x );
+		bli_obj_free( &y );
+	}
+}
+
+// The column-oriented loop of the reference dgbmv (for trans = 'N').
+static void ref_dgbmv
+     (
+       dim_t m, dim_t n, dim_t kl, dim_t ku,
+       double alpha, double* a, inc_t lda, double* x,
+       double beta, double* y
+     )
+{
+	for ( dim_t i = 0; i < m; ++i ) y[ i ] *= beta;
+
+	for ( dim_t j = 0; j < n; ++j )
+	{
+		const double temp = alpha * x[ j ];
+		const dim_t  k    = ku - j;
+
+		for ( dim_t i = bli_max( 0, j - ku ); i < bli_min( m, j + kl + 1 ); ++i )
+			y[ i ] += temp * a[ k + i + j*lda ];
+	}
+}
+
+int main( int argc, char** argv )
+{
+	const dim_t bws[] = { 1, 2, 8, 32 };
+
+	dim_t p;
+	dim_t p_begin, p_end, p_inc;
+	int   r, n_repeats;
+
+	double dtime;
+	double dtime_old, dtime_new;
+	double bytes;
+
+	n_repeats = 3;
+
+	p_begin = 200000;
+	p_end   = 1000000;
+	p_inc   = 400000;
+
+	if ( argc > 3 )
+	{
+		p_begin = atoi( argv[1] );
+		p_end   = atoi( argv[2] );
+		p_inc   = atoi( argv[3] );
+	}
+
+	check_gbmv();
+	check_xbmv_xpmv();
+	check_txmv_txsv();
+	check_xpr();
+
+	printf( "%% %lu of %lu checks failed\n", ( unsigned long )n_fail,
+	                                         ( unsigned long )n_test );
+
+	if ( n_fail != 0 ) return 1;
+
+	printf( "%%       n   kl=ku   GB/s(ref)  GB/s(gbmv)  speedup  equal\n" );
+
+	for ( p = p_begin; p <= p_end; p += p_inc )
+	for ( dim_t bi = 0; bi < 4; ++bi )
+	{
+		const dim_t k   = bws[ bi ];
+		const dim_t lda = 2 * k + 1;
+
+		double* a     = malloc( lda * p * sizeof( double ) );
+		double* x     = malloc( p * sizeof( double ) );
+		double* y     = malloc( p * sizeof( double ) );
+		double* y_old = malloc( p * sizeof( double ) );
+		double  one   = 1.0;
+		double  zero  = 0.0;
+		bool    eq    = TRUE;
+
+		for ( dim_t i = 0; i < lda * p; ++i ) a[ i ] = ( double )( i % 7 ) - 3.0;
+		for ( dim_t i = 0; i < p; ++i ) x[ i ] = ( double )( i % 5 ) - 2.0;
+		for ( dim_t i = 0; i < p; ++i ) y[ i ] = y_old[ i ] = 0.0;
+
+		dtime_old = DBL_MAX;
+		dtime_new = DBL_MAX;
+
+		for ( r = 0; r < n_repeats; ++r )
+		{
+			dtime = bli_clock();
+			ref_dgbmv( p, p, k, k, 1.0, a, lda, x, 0.0, y_old );
+			dtime_old = bli_clock_min_diff( dtime_old, dtime );
+
+			dtime = bli_clock();
+			bli_dgbmv( BLIS_NO_TRANSPOSE, BLIS_NO_CONJUGATE, p, p, k, k,
+			           &one, a, 1, lda, x, 1,
+			           &zero, y, 1 );
+			dtime_new = bli_clock_min_diff( dtime_new, dtime );
+		}
+
+		// The inputs are small integers, so both orders are exact.
+		for ( dim_t i = 0; i < p; ++i ) eq = eq && ( y[ i ] == y_old[ i ] );
+
+		bytes = ( double )lda * p * sizeof( double );
+
+		printf( "%8lu   %5lu   %9.2f  %10.2f  %7.2f  %5s\n",
+		        ( unsigned long )p, ( unsigned long )k,
+		        bytes / dtime_old / 1.0e9,
+		        bytes / dtime_new / 1.0e9,
+		        dtime_old / dtime_new,
+		        eq ? "yes" : "NO" );
+
+		free( a );
+		free( x );
+		free( y );
+		free( y_old );
+	}
+
+	return 0;
+}
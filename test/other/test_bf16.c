@@ -0,0 +1,185 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include "blis.h"
+
+// Compare sgemm when B is packed in float against sgemm when B is packed
+// in bfloat16. The problems have a small m and a large k x n B, so that
+// reading the packed B panels accounts for much of the memory traffic.
+// Besides gflops, the relative error (in the Frobenius norm) of each
+// result against a double-precision product of the same operands is
+// reported. Sup handling is disabled for both runs so that they differ
+// only in how B is packed.
+//
+// Usage: test_bf16.x [m] [p_begin p_end p_inc]
+
+int main( int argc, char** argv )
+{
+	obj_t a, b, c, c_bf;
+	obj_t ad, bd, cd, cs;
+	obj_t alpha, beta;
+	obj_t norm_ref, norm_diff;
+	dim_t m, n, k;
+	dim_t p;
+	dim_t p_begin, p_end, p_inc;
+	num_t dt;
+	int   r, n_repeats;
+	rntm_t rntm_reg, rntm_bf;
+
+	double dtime;
+	double dtime_reg, dtime_bf;
+	double nref, err_reg, err_bf;
+	double dummy;
+
+	n_repeats = 3;
+
+	m       = 96;
+	p_begin = 1000;
+	p_end   = 4000;
+	p_inc   = 1000;
+
+	if ( argc > 1 ) m       = atoi( argv[1] );
+	if ( argc > 4 )
+	{
+		p_begin = atoi( argv[2] );
+		p_end   = atoi( argv[3] );
+		p_inc   = atoi( argv[4] );
+	}
+
+	dt = BLIS_FLOAT;
+
+	bli_rntm_init( &rntm_reg );
+	bli_rntm_init( &rntm_bf );
+	bli_rntm_disable_l3_sup( &rntm_reg );
+	bli_rntm_disable_l3_sup( &rntm_bf );
+	bli_rntm_set_pack_b_bf16( TRUE, &rntm_bf );
+
+	bli_obj_scalar_init_detached( BLIS_DOUBLE, &norm_ref );
+	bli_obj_scalar_init_detached( BLIS_DOUBLE, &norm_diff );
+
+	printf( "%% m = %lu\n", ( unsigned long )m );
+	printf( "%%    m     k     n   gflops(f32)  gflops(bf16)  speedup   relerr(f32)   relerr(bf16)\n" );
+
+	for ( p = p_begin; p <= p_end; p += p_inc )
+	{
+		k = p; n = p;
+
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		bli_obj_create( dt, 1, 1, 0, 0, &beta );
+
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, k, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+		bli_obj_create( dt, m, n, 0, 0, &c_bf );
+
+		bli_obj_create( BLIS_DOUBLE, m, k, 0, 0, &ad );
+		bli_obj_create( BLIS_DOUBLE, k, n, 0, 0, &bd );
+		bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &cd );
+		bli_obj_create( BLIS_DOUBLE, m, n, 0, 0, &cs );
+
+		bli_randm( &a );
+		bli_randm( &b );
+
+		bli_setsc(       1.0,  0.0, &alpha );
+		bli_setsc(       0.0,  0.0, &beta );
+
+		bli_setm( &BLIS_ZERO, &c );
+		bli_setm( &BLIS_ZERO, &c_bf );
+
+		dtime_reg = DBL_MAX;
+		dtime_bf  = DBL_MAX;
+
+		for ( r = 0; r < n_repeats; ++r )
+		{
+			dtime = bli_clock();
+
+			bli_gemm_ex( &alpha, &a, &b, &beta, &c, NULL, &rntm_reg );
+
+			dtime_reg = bli_clock_min_diff( dtime_reg, dtime );
+
+			dtime = bli_clock();
+
+			bli_gemm_ex( &alpha, &a, &b, &beta, &c_bf, NULL, &rntm_bf );
+
+			dtime_bf = bli_clock_min_diff( dtime_bf, dtime );
+		}
+
+		// Compute the reference product in double precision.
+		bli_castm( &a, &ad );
+		bli_castm( &b, &bd );
+		bli_gemm( &BLIS_ONE, &ad, &bd, &BLIS_ZERO, &cd );
+		bli_normfm( &cd, &norm_ref );
+		bli_getsc( &norm_ref, &nref, &dummy );
+
+		bli_castm( &c, &cs );
+		bli_subm( &cd, &cs );
+		bli_normfm( &cs, &norm_diff );
+		bli_getsc( &norm_diff, &err_reg, &dummy );
+
+		bli_castm( &c_bf, &cs );
+		bli_subm( &cd, &cs );
+		bli_normfm( &cs, &norm_diff );
+		bli_getsc( &norm_diff, &err_bf, &dummy );
+
+		printf( "%6lu %5lu %5lu   %9.2f     %9.2f    %6.3f   %10.3e     %10.3e\n",
+		        ( unsigned long )m,
+		        ( unsigned long )k,
+		        ( unsigned long )n,
+		        ( 2.0 * m * k * n ) / ( dtime_reg * 1.0e9 ),
+		        ( 2.0 * m * k * n ) / ( dtime_bf  * 1.0e9 ),
+		        dtime_reg / dtime_bf,
+		        err_reg / nref,
+		        err_bf  / nref );
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &beta );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_bf );
+
+		bli_obj_free( &ad );
+		bli_obj_free( &bd );
+		bli_obj_free( &cd );
+		bli_obj_free( &cs );
+	}
+
+	return 0;
+}
+
@@ -0,0 +1,436 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <math.h>
+#include "blis.h"
+
+// Check cblas_?gemm and cblas_?gemv in both row- and column-major order
+// against a naive reference, for every datatype, every combination of
+// transpose arguments, empty, unit and odd dimensions, padded leading
+// dimensions, and (for gemv) negative and non-unit increments. Then time
+// row-major ConjTrans zgemv, which BLIS now receives with A's row-major
+// strides, against the column-major mapping that the reference CBLAS used
+// (conjugating x into a buffer and y in place around a NoTrans call).
+//
+// Requires a library configured with --enable-cblas.
+//
+// Usage: test_cblas_rowmajor.x [p_begin p_end p_inc]
+
+#ifdef BLIS_ENABLE_CBLAS
+
+static const num_t dts[] = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+
+static const enum CBLAS_TRANSPOSE transs[] = { CblasNoTrans, CblasTrans, CblasConjTrans };
+
+static const dim_t gemm_dims[] = { 0, 1, 3, 17 };
+static const dim_t gemv_dims[] = { 0, 1, 3, 17, 40 };
+static const int   incs[][2]   = { { 1, 1 }, { -2, 1 }, { 1, 3 }, { 3, -2 } };
+
+#define N_ELEMS( a ) ( ( dim_t )( sizeof( a ) / sizeof( a[0] ) ) )
+
+// Element i of a buffer of datatype dt, as a pair of doubles.
+static void get_elem( num_t dt, void* p, dim_t i, double* re, double* im )
+{
+	switch ( dt )
+	{
+		case BLIS_FLOAT:    *re = ( ( float*    )p )[ i ];      *im = 0.0; break;
+		case BLIS_DOUBLE:   *re = ( ( double*   )p )[ i ];      *im = 0.0; break;
+		case BLIS_SCOMPLEX: *re = ( ( scomplex* )p )[ i ].real; *im = ( ( scomplex* )p )[ i ].imag; break;
+		default:            *re = ( ( dcomplex* )p )[ i ].real; *im = ( ( dcomplex* )p )[ i ].imag; break;
+	}
+}
+
+static void set_elem( num_t dt, void* p, dim_t i, double re, double im )
+{
+	switch ( dt )
+	{
+		case BLIS_FLOAT:    ( ( float*    )p )[ i ] = re; break;
+		case BLIS_DOUBLE:   ( ( double*   )p )[ i ] = re; break;
+		case BLIS_SCOMPLEX: ( ( scomplex* )p )[ i ].real = re; ( ( scomplex* )p )[ i ].imag = im; break;
+		default:            ( ( dcomplex* )p )[ i ].real = re; ( ( dcomplex* )p )[ i ].imag = im; break;
+	}
+}
+
+static void* alloc_rand( num_t dt, dim_t n )
+{
+	void* p = malloc( bli_dt_size( dt ) * bli_max( n, 1 ) );
+
+	for ( dim_t i = 0; i < n; ++i )
+		set_elem( dt, p, i, 2.0 * rand() / RAND_MAX - 1.0,
+		                    bli_is_complex( dt ) ? 2.0 * rand() / RAND_MAX - 1.0 : 0.0 );
+
+	return p;
+}
+
+// Index of the logical element ( i, j ) of a matrix with leading dimension
+// ld stored in the given order.
+static dim_t idx( enum CBLAS_ORDER order, dim_t i, dim_t j, dim_t ld )
+{
+	return ( order == CblasRowMajor ? i*ld + j : i + j*ld );
+}
+
+// Logical element ( i, j ) of op( A ), where A is stored in the given order.
+static void get_op( num_t dt, enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE trans,
+                    void* a, dim_t ld, dim_t i, dim_t j, double* re, double* im )
+{
+	if ( trans == CblasNoTrans ) get_elem( dt, a, idx( order, i, j, ld ), re, im );
+	else                         get_elem( dt, a, idx( order, j, i, ld ), re, im );
+
+	if ( trans == CblasConjTrans ) *im = -*im;
+}
+
+// Index of element i of a vector of length n with increment inc, following
+// the BLAS convention for negative increments.
+static dim_t vidx( dim_t i, dim_t n, int inc )
+{
+	return ( inc > 0 ? i*inc : ( n - 1 - i )*( -inc ) );
+}
+
+static double eps_of( num_t dt )
+{
+	return ( bli_is_float( dt ) || bli_is_scomplex( dt ) ? FLT_EPSILON : DBL_EPSILON );
+}
+
+// Compare the computed element ( cr, ci ) with the reference ( rr, ri ),
+// where mag bounds the magnitude of the terms that were summed.
+static bool close_enough( num_t dt, double cr, double ci, double rr, double ri,
+                          double mag, dim_t k )
+{
+	const double tol = 8.0 * eps_of( dt ) * ( k + 2 ) * bli_max( mag, 1.0 );
+
+	return ( fabs( cr - rr ) <= tol && fabs( ci - ri ) <= tol );
+}
+
+static void call_gemm( num_t dt, enum CBLAS_ORDER order,
+                       enum CBLAS_TRANSPOSE ta, enum CBLAS_TRANSPOSE tb,
+                       dim_t m, dim_t n, dim_t k, double* alpha,
+                       void* a, dim_t lda, void* b, dim_t ldb,
+                       double* beta, void* c, dim_t ldc )
+{
+	float    as = alpha[0], bs = beta[0];
+	scomplex ac = { alpha[0], alpha[1] }, bc = { beta[0], beta[1] };
+	dcomplex az = { alpha[0], alpha[1] }, bz = { beta[0], beta[1] };
+
+	switch ( dt )
+	{
+		case BLIS_FLOAT:    cblas_sgemm( order, ta, tb, m, n, k, as, a, lda, b, ldb, bs, c, ldc ); break;
+		case BLIS_DOUBLE:   cblas_dgemm( order, ta, tb, m, n, k, alpha[0], a, lda, b, ldb, beta[0], c, ldc ); break;
+		case BLIS_SCOMPLEX: cblas_cgemm( order, ta, tb, m, n, k, &ac, a, lda, b, ldb, &bc, c, ldc ); break;
+		default:            cblas_zgemm( order, ta, tb, m, n, k, &az, a, lda, b, ldb, &bz, c, ldc ); break;
+	}
+}
+
+static void call_gemv( num_t dt, enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE ta,
+                       dim_t m, dim_t n, double* alpha, void* a, dim_t lda,
+                       void* x, int incx, double* beta, void* y, int incy )
+{
+	float    as = alpha[0], bs = beta[0];
+	scomplex ac = { alpha[0], alpha[1] }, bc = { beta[0], beta[1] };
+	dcomplex az = { alpha[0], alpha[1] }, bz = { beta[0], beta[1] };
+
+	switch ( dt )
+	{
+		case BLIS_FLOAT:    cblas_sgemv( order, ta, m, n, as, a, lda, x, incx, bs, y, incy ); break;
+		case BLIS_DOUBLE:   cblas_dgemv( order, ta, m, n, alpha[0], a, lda, x, incx, beta[0], y, incy ); break;
+		case BLIS_SCOMPLEX: cblas_cgemv( order, ta, m, n, &ac, a, lda, x, incx, &bc, y, incy ); break;
+		default:            cblas_zgemv( order, ta, m, n, &az, a, lda, x, incx, &bz, y, incy ); break;
+	}
+}
+
+// Run one gemm case and return TRUE if it matches the reference.
+static bool check_gemm( num_t dt, enum CBLAS_ORDER order,
+                        enum CBLAS_TRANSPOSE ta, enum CBLAS_TRANSPOSE tb,
+                        dim_t m, dim_t n, dim_t k )
+{
+	double alpha[2] = { 0.7, bli_is_complex( dt ) ? -0.3 : 0.0 };
+	double beta[2]  = { 0.4, bli_is_complex( dt ) ?  0.2 : 0.0 };
+
+	// Stored dimensions of A ( m x k or k x m ), B ( k x n or n x k ) and C,
+	// each padded by three in the leading dimension.
+	const dim_t ar = ( ta == CblasNoTrans ? m : k ), ac = ( ta == CblasNoTrans ? k : m );
+	const dim_t br = ( tb == CblasNoTrans ? k : n ), bc = ( tb == CblasNoTrans ? n : k );
+	const dim_t lda = ( order == CblasRowMajor ? ac : ar ) + 3;
+	const dim_t ldb = ( order == CblasRowMajor ? bc : br ) + 3;
+	const dim_t ldc = ( order == CblasRowMajor ? n  : m  ) + 3;
+	const dim_t na  = lda * ( order == CblasRowMajor ? ar : ac );
+	const dim_t nb  = ldb * ( order == CblasRowMajor ? br : bc );
+	const dim_t nc  = ldc * ( order == CblasRowMajor ? m  : n  );
+
+	void* a  = alloc_rand( dt, na );
+	void* b  = alloc_rand( dt, nb );
+	void* c  = alloc_rand( dt, nc );
+	void* c0 = malloc( bli_dt_size( dt ) * bli_max( nc, 1 ) );
+	bool  ok = TRUE;
+
+	memcpy( c0, c, bli_dt_size( dt ) * nc );
+
+	call_gemm( dt, order, ta, tb, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc );
+
+	// Check every element of C's buffer, including the padding, which must
+	// be left untouched.
+	for ( dim_t i = 0; i < nc; ++i )
+	{
+		double cr, ci, rr, ri;
+
+		get_elem( dt, c,  i, &cr, &ci );
+		get_elem( dt, c0, i, &rr, &ri );
+
+		const dim_t ii = ( order == CblasRowMajor ? i / ldc : i % ldc );
+		const dim_t jj = ( order == CblasRowMajor ? i % ldc : i / ldc );
+		double      mag = 0.0;
+
+		if ( ii < m && jj < n )
+		{
+			double sr = 0.0, si = 0.0;
+
+			for ( dim_t l = 0; l < k; ++l )
+			{
+				double xr, xi, yr, yi;
+
+				get_op( dt, order, ta, a, lda, ii, l,  &xr, &xi );
+				get_op( dt, order, tb, b, ldb, l,  jj, &yr, &yi );
+
+				sr  += xr*yr - xi*yi;
+				si  += xr*yi + xi*yr;
+				mag += ( fabs( xr ) + fabs( xi ) ) * ( fabs( yr ) + fabs( yi ) );
+			}
+
+			const double tr = alpha[0]*sr - alpha[1]*si + beta[0]*rr - beta[1]*ri;
+			const double ti = alpha[0]*si + alpha[1]*sr + beta[0]*ri + beta[1]*rr;
+
+			mag += fabs( rr ) + fabs( ri );
+			rr = tr; ri = ti;
+		}
+
+		if ( !close_enough( dt, cr, ci, rr, ri, mag, k ) ) ok = FALSE;
+	}
+
+	free( a ); free( b ); free( c ); free( c0 );
+
+	return ok;
+}
+
+// Run one gemv case and return TRUE if it matches the reference.
+static bool check_gemv( num_t dt, enum CBLAS_ORDER order, enum CBLAS_TRANSPOSE ta,
+                        dim_t m, dim_t n, int incx, int incy )
+{
+	double alpha[2] = { 0.7, bli_is_complex( dt ) ? -0.3 : 0.0 };
+	double beta[2]  = { 0.4, bli_is_complex( dt ) ?  0.2 : 0.0 };
+
+	const dim_t lda  = ( order == CblasRowMajor ? n : m ) + 3;
+	const dim_t na   = lda * ( order == CblasRowMajor ? m : n );
+	const dim_t lenx = ( ta == CblasNoTrans ? n : m );
+	const dim_t leny = ( ta == CblasNoTrans ? m : n );
+	const dim_t nx   = bli_max( lenx, 1 ) * abs( incx );
+	const dim_t ny   = bli_max( leny, 1 ) * abs( incy );
+
+	void* a  = alloc_rand( dt, na );
+	void* x  = alloc_rand( dt, nx );
+	void* y  = alloc_rand( dt, ny );
+	void* y0 = malloc( bli_dt_size( dt ) * ny );
+	bool  ok = TRUE;
+
+	memcpy( y0, y, bli_dt_size( dt ) * ny );
+
+	call_gemv( dt, order, ta, m, n, alpha, a, lda, x, incx, beta, y, incy );
+
+	// Check every element of y's buffer, including those skipped by the
+	// increment, which must be left untouched.
+	for ( dim_t p = 0; p < ny; ++p )
+	{
+		double cr, ci, rr, ri, mag = 0.0;
+
+		get_elem( dt, y,  p, &cr, &ci );
+		get_elem( dt, y0, p, &rr, &ri );
+
+		// As in the BLAS, y is left untouched when x has no elements.
+		if ( p % abs( incy ) == 0 && p / abs( incy ) < leny && lenx > 0 )
+		{
+			const dim_t i  = ( incy > 0 ? p / incy : leny - 1 - p / ( -incy ) );
+			double      sr = 0.0, si = 0.0;
+
+			for ( dim_t l = 0; l < lenx; ++l )
+			{
+				double ar_, ai_, xr, xi;
+
+				get_op( dt, order, ta, a, lda, i, l, &ar_, &ai_ );
+				get_elem( dt, x, vidx( l, lenx, incx ), &xr, &xi );
+
+				sr  += ar_*xr - ai_*xi;
+				si  += ar_*xi + ai_*xr;
+				mag += ( fabs( ar_ ) + fabs( ai_ ) ) * ( fabs( xr ) + fabs( xi ) );
+			}
+
+			const double tr = alpha[0]*sr - alpha[1]*si + beta[0]*rr - beta[1]*ri;
+			const double ti = alpha[0]*si + alpha[1]*sr + beta[0]*ri + beta[1]*rr;
+
+			mag += fabs( rr ) + fabs( ri );
+			rr = tr; ri = ti;
+		}
+
+		if ( !close_enough( dt, cr, ci, rr, ri, mag, lenx ) ) ok = FALSE;
+	}
+
+	free( a ); free( x ); free( y ); free( y0 );
+
+	return ok;
+}
+
+// Row-major ConjTrans zgemv, mapped to column-major NoTrans the way the
+// reference CBLAS does: y := conj( conj(alpha) * A^T * conj(x) +
+// conj(beta) * conj(y) ).
+static void zgemv_colmajor_mapping( dim_t m, dim_t n, dcomplex* alpha, dcomplex* a,
+                                    dim_t lda, dcomplex* x, dcomplex* beta, dcomplex* y )
+{
+	dcomplex  alpha_c = { alpha->real, -alpha->imag };
+	dcomplex  beta_c  = { beta->real,  -beta->imag  };
+	dcomplex* xc      = malloc( m * sizeof( dcomplex ) );
+
+	for ( dim_t i = 0; i < m; ++i ) { xc[ i ].real = x[ i ].real; xc[ i ].imag = -x[ i ].imag; }
+	for ( dim_t j = 0; j < n; ++j ) y[ j ].imag = -y[ j ].imag;
+
+	cblas_zgemv( CblasColMajor, CblasNoTrans, n, m, &alpha_c, a, lda, xc, 1, &beta_c, y, 1 );
+
+	for ( dim_t j = 0; j < n; ++j ) y[ j ].imag = -y[ j ].imag;
+
+	free( xc );
+}
+
+int main( int argc, char** argv )
+{
+	dim_t p_begin = 64, p_end = 2048, p_inc = 0;
+	int   n_checks = 0, n_failed = 0;
+	int   n_repeats = 5;
+
+	if ( argc == 4 )
+	{
+		p_begin = atoi( argv[1] );
+		p_end   = atoi( argv[2] );
+		p_inc   = atoi( argv[3] );
+	}
+
+	srand( 1 );
+
+	for ( dim_t d = 0; d < N_ELEMS( dts ); ++d )
+	for ( int o = 0; o < 2; ++o )
+	{
+		const num_t            dt    = dts[ d ];
+		const enum CBLAS_ORDER order = ( o == 0 ? CblasRowMajor : CblasColMajor );
+
+		for ( dim_t ta = 0; ta < N_ELEMS( transs ); ++ta )
+		for ( dim_t tb = 0; tb < N_ELEMS( transs ); ++tb )
+		for ( dim_t im = 0; im < N_ELEMS( gemm_dims ); ++im )
+		for ( dim_t in = 0; in < N_ELEMS( gemm_dims ); ++in )
+		for ( dim_t ik = 0; ik < N_ELEMS( gemm_dims ); ++ik )
+		{
+			const dim_t m = gemm_dims[ im ], n = gemm_dims[ in ], k = gemm_dims[ ik ];
+
+			n_checks += 1;
+
+			if ( !check_gemm( dt, order, transs[ ta ], transs[ tb ], m, n, k ) )
+			{
+				n_failed += 1;
+				printf( "FAILED: ?gemm dt=%s %s ta=%d tb=%d m=%ld n=%ld k=%ld\n",
+				        bli_dt_string( dt ), o == 0 ? "row" : "col", ( int )ta, ( int )tb,
+				        ( long )m, ( long )n, ( long )k );
+			}
+		}
+
+		for ( dim_t ta = 0; ta < N_ELEMS( transs ); ++ta )
+		for ( dim_t im = 0; im < N_ELEMS( gemv_dims ); ++im )
+		for ( dim_t in = 0; in < N_ELEMS( gemv_dims ); ++in )
+		for ( dim_t ii = 0; ii < N_ELEMS( incs ); ++ii )
+		{
+			const dim_t m = gemv_dims[ im ], n = gemv_dims[ in ];
+
+			n_checks += 1;
+
+			if ( !check_gemv( dt, order, transs[ ta ], m, n, incs[ ii ][0], incs[ ii ][1] ) )
+			{
+				n_failed += 1;
+				printf( "FAILED: ?gemv dt=%s %s ta=%d m=%ld n=%ld incx=%d incy=%d\n",
+				        bli_dt_string( dt ), o == 0 ? "row" : "col", ( int )ta,
+				        ( long )m, ( long )n, incs[ ii ][0], incs[ ii ][1] );
+			}
+		}
+	}
+
+	printf( "%% %d of %d checks failed\n", n_failed, n_checks );
+
+	// Time row-major ConjTrans zgemv on square problems.
+	printf( "%%                  GFLOPS\n" );
+	printf( "%%      n   native  mapping\n" );
+
+	for ( dim_t n = p_begin; n <= p_end; n = ( p_inc > 0 ? n + p_inc : 2*n ) )
+	{
+		dcomplex  alpha = { 0.7, -0.3 }, beta = { 0.4, 0.2 };
+		dcomplex* a     = alloc_rand( BLIS_DCOMPLEX, n * n );
+		dcomplex* x     = alloc_rand( BLIS_DCOMPLEX, n );
+		dcomplex* y     = alloc_rand( BLIS_DCOMPLEX, n );
+		double    t_nat = DBL_MAX, t_map = DBL_MAX;
+		const int n_inner = bli_max( 1, ( int )( 4000000 / ( n * n ) ) );
+
+		for ( int r = 0; r < n_repeats; ++r )
+		{
+			double t0 = bli_clock();
+			for ( int i = 0; i < n_inner; ++i )
+				cblas_zgemv( CblasRowMajor, CblasConjTrans, n, n, &alpha, a, n, x, 1, &beta, y, 1 );
+			t_nat = bli_clock_min_diff( t_nat, t0 );
+
+			t0 = bli_clock();
+			for ( int i = 0; i < n_inner; ++i )
+				zgemv_colmajor_mapping( n, n, &alpha, a, n, x, &beta, y );
+			t_map = bli_clock_min_diff( t_map, t0 );
+		}
+
+		const double flops = 8.0 * n * n * n_inner;
+
+		printf( "%8ld %8.2f %8.2f\n", ( long )n,
+		        flops / t_nat / 1.0e9, flops / t_map / 1.0e9 );
+
+		free( a ); free( x ); free( y );
+	}
+
+	return ( n_failed > 0 ? 1 : 0 );
+}
+
+#else
+
+int main( int argc, char** argv )
+{
+	printf( "%s: BLIS was not configured with --enable-cblas.\n", argv[0] );
+	return 0;
+}
+
+#endif
@@ -0,0 +1,89 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include "blis.h"
+
+// Measure the latency of library initialization: the first call to
+// bli_init(), which also includes one-time work such as hardware detection,
+// followed by repeated bli_finalize()/bli_init() cycles.
+//
+// Usage: test_init.x [n_repeats]
+
+static int cmp_dbl( const void* a, const void* b )
+{
+	double x = *( const double* )a, y = *( const double* )b;
+	return ( x > y ) - ( x < y );
+}
+
+int main( int argc, char** argv )
+{
+	int     n_repeats = ( argc > 1 ? atoi( argv[1] ) : 100 );
+	double* times;
+	double  t_first;
+
+	if ( n_repeats < 1 ) n_repeats = 1;
+
+	times = malloc( n_repeats * sizeof( double ) );
+
+	t_first = bli_clock();
+	bli_init();
+	t_first = bli_clock() - t_first;
+
+	for ( int r = 0; r < n_repeats; ++r )
+	{
+		bli_finalize();
+
+		double t = bli_clock();
+		bli_init();
+		times[ r ] = bli_clock() - t;
+	}
+
+	qsort( times, n_repeats, sizeof( double ), cmp_dbl );
+
+	printf( "arch:             %s\n", bli_arch_string( bli_arch_query_id() ) );
+	printf( "first bli_init(): %10.1f us\n", 1.0e6 * t_first );
+	printf( "re-init (min):    %10.1f us\n", 1.0e6 * times[ 0 ] );
+	printf( "re-init (median): %10.1f us\n", 1.0e6 * times[ n_repeats / 2 ] );
+
+	bli_finalize();
+	free( times );
+
+	return 0;
+}
+
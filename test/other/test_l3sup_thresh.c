@@ -0,0 +1,176 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include "blis.h"
+
+// Compare the sup and conventional implementations of herk and trmm across
+// a range of problem shapes, to check the stricter thresholds that
+// bli_herksup_ref() and bli_trmmsup_ref() enforce on top of the gemm sup
+// thresholds. The sup thresholds of a private copy of the context are
+// raised so that the sup handlers accept every problem, and each shape is
+// timed with sup handling enabled and disabled via the rntm_t. Each line
+// reports which of the two implementations was faster.
+//
+// Usage: test_l3sup_thresh.x [dt]
+//
+//   dt       one of s, d (default: d)
+
+#define N_REPEATS 7
+
+static double time_op
+     (
+       opid_t  op,
+       side_t  side,
+       obj_t*  a,
+       obj_t*  c,
+       cntx_t* cntx,
+       rntm_t* rntm
+     )
+{
+	double dtime_best = 1.0e9;
+
+	for ( int r = 0; r < N_REPEATS; ++r )
+	{
+		double dtime = bli_clock();
+
+		if ( op == BLIS_HERK )
+			bli_herk_ex( &BLIS_ONE, a, &BLIS_ONE, c, cntx, rntm );
+		else
+			bli_trmm_ex( side, &BLIS_ONE, a, c, cntx, rntm );
+
+		dtime_best = bli_clock_min_diff( dtime_best, dtime );
+	}
+
+	return dtime_best;
+}
+
+static void report
+     (
+       char*   label,
+       dim_t   m,
+       dim_t   n,
+       dim_t   k,
+       double  flops,
+       double  time_conv,
+       double  time_sup
+     )
+{
+	printf( "  %-7s %5ld %5ld %5ld %9.2f %9.2f   %s\n", label,
+	        ( long )m, ( long )n, ( long )k,
+	        flops / time_conv / 1.0e9, flops / time_sup / 1.0e9,
+	        time_sup < time_conv ? "sup" : "conv" );
+}
+
+int main( int argc, char** argv )
+{
+	num_t  dt = BLIS_DOUBLE;
+	cntx_t cntx;
+	rntm_t rntm_sup, rntm_conv;
+
+	if ( argc > 1 && argv[1][0] == 's' ) dt = BLIS_FLOAT;
+
+	// Use a copy of the native context whose sup thresholds never reject
+	// a problem, leaving the decision to the handlers being measured.
+	cntx = *bli_gks_query_cntx();
+	bli_blksz_set_def( 100000, dt, bli_cntx_get_l3_sup_thresh( BLIS_MT, &cntx ) );
+	bli_blksz_set_def( 100000, dt, bli_cntx_get_l3_sup_thresh( BLIS_NT, &cntx ) );
+	bli_blksz_set_def( 100000, dt, bli_cntx_get_l3_sup_thresh( BLIS_KT, &cntx ) );
+
+	bli_rntm_init( &rntm_sup );
+	bli_rntm_init( &rntm_conv );
+	bli_rntm_disable_l3_sup( &rntm_conv );
+
+	printf( "%% gemm sup thresholds (mt nt kt): %ld %ld %ld\n",
+	        ( long )bli_cntx_get_l3_sup_thresh_dt( dt, BLIS_MT, bli_gks_query_cntx() ),
+	        ( long )bli_cntx_get_l3_sup_thresh_dt( dt, BLIS_NT, bli_gks_query_cntx() ),
+	        ( long )bli_cntx_get_l3_sup_thresh_dt( dt, BLIS_KT, bli_gks_query_cntx() ) );
+	printf( "%% %-7s %5s %5s %5s %9s %9s   %s\n",
+	        "op", "m", "n", "k", "gf(conv)", "gf(sup)", "faster" );
+
+	// herk: C is m x m and A is m x k.
+	for ( dim_t k = 48; k <= 256; k += 208 )
+	for ( dim_t m = 40; m <= 320; m += 40 )
+	{
+		obj_t a, c;
+
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, m, m, 0, 0, &c );
+		bli_obj_set_struc( BLIS_HERMITIAN, &c );
+		bli_obj_set_uplo( BLIS_LOWER, &c );
+		bli_randm( &a );
+		bli_randm( &c );
+
+		report( "herk", m, m, k, ( double )m * ( m + 1 ) * k,
+		        time_op( BLIS_HERK, BLIS_LEFT, &a, &c, &cntx, &rntm_conv ),
+		        time_op( BLIS_HERK, BLIS_LEFT, &a, &c, &cntx, &rntm_sup ) );
+
+		bli_obj_free( &a );
+		bli_obj_free( &c );
+	}
+
+	// trmm: B is m x n and A is k x k, where k is m (left) or n (right).
+	// Sweep the order of A with the other dimension of B equal to it, and
+	// then sweep each dimension of B with the other one fixed and large.
+	for ( int sd = 0; sd < 2; ++sd )
+	for ( int shape = 0; shape < 3; ++shape )
+	for ( dim_t p = 16; p <= 112; p += 16 )
+	{
+		side_t side = ( sd == 0 ? BLIS_LEFT : BLIS_RIGHT );
+		dim_t  m    = ( shape == 2 ? 256 : p );
+		dim_t  n    = ( shape == 1 ? 256 : p );
+		dim_t  k    = ( sd == 0 ? m : n );
+		obj_t  a, b;
+
+		bli_obj_create( dt, k, k, 0, 0, &a );
+		bli_obj_create( dt, m, n, 0, 0, &b );
+		bli_obj_set_struc( BLIS_TRIANGULAR, &a );
+		bli_obj_set_uplo( BLIS_LOWER, &a );
+		bli_randm( &a );
+		bli_randm( &b );
+
+		report( sd == 0 ? "trmm_l" : "trmm_r", m, n, k, ( double )m * n * k,
+		        time_op( BLIS_TRMM, side, &a, &b, &cntx, &rntm_conv ),
+		        time_op( BLIS_TRMM, side, &a, &b, &cntx, &rntm_sup ) );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+	}
+
+	return 0;
+}
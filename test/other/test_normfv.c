@@ -0,0 +1,204 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include <math.h>
+#include "blis.h"
+
+// Check normfv against a long double reference for vectors whose elements
+// are tiny, huge, subnormal, or contain NaN or Inf, at unit and non-unit
+// stride, and then time double-precision normfv against dotv over the same
+// vector (the unscaled sum of squares that normfv must stay close to).
+//
+// Usage: test_normfv.x [p_begin p_end p_inc]
+
+static bool near( double got, long double ref, double eps )
+{
+	const double r = ( double )ref;
+
+	if ( isnan( r ) ) return isnan( got );
+	if ( isinf( r ) ) return got == r;
+
+	return fabs( got - r ) <= eps * r;
+}
+
+static dim_t check_normfv( void )
+{
+	const double scales[] = { 1.0, 0x1p-600, 0x1p600, 0x1p-1070, 0x1p1000 };
+	const dim_t  ns[]     = { 0, 1, 7, 8, 9, 16, 31, 33, 100, 1001 };
+	const inc_t  incs[]   = { 1, 3 };
+	dim_t        n_fail   = 0;
+	dim_t        n_test   = 0;
+
+	for ( dim_t si = 0; si < 5; ++si )
+	for ( dim_t ni = 0; ni < 10; ++ni )
+	for ( dim_t ii = 0; ii < 2; ++ii )
+	for ( dim_t sp = 0; sp < 3; ++sp )
+	{
+		const double scale = scales[ si ];
+		const dim_t  n     = ns[ ni ];
+		const inc_t  incx  = incs[ ii ];
+		const dim_t  len   = 2 * n * incx + 2;
+
+		double* x  = malloc( len * sizeof( double ) );
+		float*  xs = malloc( len * sizeof( float ) );
+
+		long double ssq_d = 0.0L, ssq_s = 0.0L, ssq_z = 0.0L;
+		double      norm_d, norm_z;
+		float       norm_s;
+
+		for ( dim_t i = 0; i < len; ++i )
+		{
+			const double r = ( double )( rand() % 2001 - 1000 ) / 1000.0;
+
+			x[ i ]  = scale * r;
+			xs[ i ] = ( float )r;
+		}
+
+		// Plant a special value in the middle of the vector.
+		if ( n > 0 && sp == 1 ) { x[ ( n / 2 ) * incx ] = NAN;      xs[ ( n / 2 ) * incx ] = NAN; }
+		if ( n > 0 && sp == 2 ) { x[ ( n / 2 ) * incx ] = INFINITY; xs[ ( n / 2 ) * incx ] = INFINITY; }
+
+		for ( dim_t i = 0; i < n; ++i )
+		{
+			const long double xd  = x[ i * incx ];
+			const long double xsv = xs[ i * incx ];
+			const long double xr  = x[ 2 * i * incx + 0 ];
+			const long double xi  = x[ 2 * i * incx + 1 ];
+
+			ssq_d += xd * xd;
+			ssq_s += xsv * xsv;
+			ssq_z += xr * xr + xi * xi;
+		}
+
+		bli_dnormfv( n, x, incx, &norm_d );
+		bli_snormfv( n, xs, incx, &norm_s );
+		bli_znormfv( n, ( dcomplex* )x, incx, &norm_z );
+
+		if ( !near( norm_d, sqrtl( ssq_d ), 1.0e-14 ) ||
+		     !near( norm_z, sqrtl( ssq_z ), 1.0e-14 ) ||
+		     ( scale == 1.0 && !near( norm_s, sqrtl( ssq_s ), 1.0e-6 ) ) )
+		{
+			printf( "normfv FAILED: scale %a n %d incx %d special %d: %a %a %a\n",
+			        scale, ( int )n, ( int )incx, ( int )sp,
+			        norm_d, norm_z, ( double )norm_s );
+			++n_fail;
+		}
+
+		++n_test;
+
+		free( x );
+		free( xs );
+	}
+
+	printf( "%% %lu of %lu checks failed\n", ( unsigned long )n_fail,
+	                                         ( unsigned long )n_test );
+
+	return n_fail;
+}
+
+int main( int argc, char** argv )
+{
+	obj_t x, norm, rho;
+	dim_t p;
+	dim_t p_begin, p_end, p_inc;
+	num_t dt;
+	int   r, n_repeats;
+
+	double dtime;
+	double dtime_dot, dtime_nrm;
+	double bytes;
+
+	n_repeats = 100;
+
+	p_begin = 1000;
+	p_end   = 100000;
+	p_inc   = 11000;
+
+	if ( argc > 3 )
+	{
+		p_begin = atoi( argv[1] );
+		p_end   = atoi( argv[2] );
+		p_inc   = atoi( argv[3] );
+	}
+
+	if ( check_normfv() != 0 ) return 1;
+
+	dt = BLIS_DOUBLE;
+
+	bli_obj_scalar_init_detached( dt, &norm );
+	bli_obj_scalar_init_detached( dt, &rho );
+
+	printf( "%%      n   GB/s(dotv)  GB/s(normfv)  ratio\n" );
+
+	for ( p = p_begin; p <= p_end; p += p_inc )
+	{
+		bli_obj_create( dt, p, 1, 0, 0, &x );
+
+		bli_randv( &x );
+
+		dtime_dot = DBL_MAX;
+		dtime_nrm = DBL_MAX;
+
+		for ( r = 0; r < n_repeats; ++r )
+		{
+			dtime = bli_clock();
+			bli_dotv( &x, &x, &rho );
+			dtime_dot = bli_clock_min_diff( dtime_dot, dtime );
+
+			dtime = bli_clock();
+			bli_normfv( &x, &norm );
+			dtime_nrm = bli_clock_min_diff( dtime_nrm, dtime );
+		}
+
+		// dotv reads x twice, but both reads come from the same lines.
+		bytes = 1.0 * p * bli_dt_size( dt );
+
+		printf( "%7lu   %10.2f  %12.2f  %5.2f\n",
+		        ( unsigned long )p,
+		        bytes / dtime_dot / 1.0e9,
+		        bytes / dtime_nrm / 1.0e9,
+		        dtime_dot / dtime_nrm );
+
+		bli_obj_free( &x );
+	}
+
+	return 0;
+}
@@ -0,0 +1,172 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include "blis.h"
+
+// Calibrate the minimum amount of work per thread used when the number of
+// threads is chosen automatically for level-3 operations (see
+// bli_rntm_set_nt_min_work(), the BLIS_NT_MIN_WORK environment variable,
+// and BLIS_THREAD_MIN_NR_PANELS). For each of a range of cubic gemm problem
+// sizes, every thread count from 1 to nt_max is timed with no minimum work
+// per thread, and the work per thread at the fastest thread count is
+// recorded, both as m*n*k / nt and as the number of mc x nr blocks of C per
+// thread. For sizes at which fewer than nt_max threads were fastest, these
+// values approximate the point below which adding threads no longer pays
+// off; the medians across those sizes are reported as the recommended
+// settings.
+//
+// Usage: test_nt_calib.x [nt_max] [dt]
+//
+//   nt_max   the largest thread count to try (default: BLIS_NUM_THREADS)
+//   dt       one of s, d, c, z (default: d)
+
+#define N_REPEATS 3
+
+static int cmp_dbl( const void* a, const void* b )
+{
+	double x = *( const double* )a, y = *( const double* )b;
+	return ( x > y ) - ( x < y );
+}
+
+int main( int argc, char** argv )
+{
+	const dim_t sizes[] = { 48, 64, 96, 128, 160, 192, 256, 320,
+	                        384, 448, 512, 640, 768, 1024 };
+	const int   n_sizes = sizeof( sizes ) / sizeof( dim_t );
+
+	dim_t  nt_max = ( argc > 1 ? atoi( argv[1] ) : bli_thread_get_num_threads() );
+	num_t  dt     = BLIS_DOUBLE;
+	double works[ sizeof( sizes ) / sizeof( dim_t ) ];
+	double panels[ sizeof( sizes ) / sizeof( dim_t ) ];
+	int    n_works = 0;
+
+	if ( argc > 2 )
+	{
+		if      ( argv[2][0] == 's' ) dt = BLIS_FLOAT;
+		else if ( argv[2][0] == 'c' ) dt = BLIS_SCOMPLEX;
+		else if ( argv[2][0] == 'z' ) dt = BLIS_DCOMPLEX;
+	}
+
+	if ( !bli_info_get_enable_threading() || nt_max < 2 )
+	{
+		printf( "%% multithreading must be enabled and nt_max > 1\n" );
+		return 1;
+	}
+
+	cntx_t* cntx = bli_gks_query_cntx();
+	dim_t   mc   = bli_cntx_get_blksz_def_dt( dt, BLIS_MC, cntx );
+	dim_t   nr   = bli_cntx_get_blksz_def_dt( dt, BLIS_NR, cntx );
+
+	printf( "%% %6s %4s %12s %12s %14s %10s\n",
+	        "size", "nt", "time(nt=1)", "time(best)", "work/thread", "nr panels" );
+
+	for ( int s = 0; s < n_sizes; ++s )
+	{
+		dim_t  size     = sizes[ s ];
+		double time_1   = 0.0;
+		double time_bst = 1.0e9;
+		dim_t  nt_bst   = 1;
+		obj_t  a, b, c;
+
+		bli_obj_create( dt, size, size, 0, 0, &a );
+		bli_obj_create( dt, size, size, 0, 0, &b );
+		bli_obj_create( dt, size, size, 0, 0, &c );
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c );
+
+		for ( dim_t nt = 1; nt <= nt_max; ++nt )
+		{
+			rntm_t rntm;
+			double dtime_best = 1.0e9;
+
+			// Use the conventional implementation with a fixed thread count
+			// and no minimum work per thread.
+			bli_rntm_init( &rntm );
+			bli_rntm_set_num_threads( nt, &rntm );
+			bli_rntm_set_nt_min_work( 0, &rntm );
+			bli_rntm_disable_l3_sup( &rntm );
+
+			for ( int r = 0; r < N_REPEATS; ++r )
+			{
+				double dtime = bli_clock();
+
+				bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c, NULL, &rntm );
+
+				dtime_best = bli_clock_min_diff( dtime_best, dtime );
+			}
+
+			if ( nt == 1 ) time_1 = dtime_best;
+			if ( dtime_best < time_bst ) { time_bst = dtime_best; nt_bst = nt; }
+		}
+
+		double work  = ( double )size * size * size / nt_bst;
+		double panel = ( double )size * size / nt_bst / ( ( double )mc * nr );
+
+		printf( "  %6ld %4ld %12.6f %12.6f %14.0f %10.1f\n", ( long )size,
+		        ( long )nt_bst, time_1, time_bst, work, panel );
+
+		if ( nt_bst < nt_max )
+		{
+			works[ n_works ]  = work;
+			panels[ n_works ] = panel;
+			n_works += 1;
+		}
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+	}
+
+	if ( n_works == 0 )
+	{
+		printf( "%% nt_max threads were fastest at every size; no minimum needed\n" );
+		return 0;
+	}
+
+	qsort( works,  n_works, sizeof( double ), cmp_dbl );
+	qsort( panels, n_works, sizeof( double ), cmp_dbl );
+
+	printf( "%% recommended: BLIS_NT_MIN_WORK=%.0f\n", works[ n_works / 2 ] );
+	printf( "%% recommended: BLIS_THREAD_MIN_NR_PANELS=%.0f (currently %d)\n",
+	        bli_max( panels[ n_works / 2 ], 1.0 ), ( int )BLIS_THREAD_MIN_NR_PANELS );
+
+	return 0;
+}
+
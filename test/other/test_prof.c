@@ -0,0 +1,133 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include "blis.h"
+
+// Report the per-thread phase breakdown (packing, macrokernel, barriers,
+// pba checkout, and sup vs. conventional dispatch) of dgemm for a range of
+// problem sizes. BLIS must be configured with --enable-profiling; otherwise
+// all counters remain zero.
+//
+// Usage: test_prof.x [nt] [p_begin p_end p_inc]
+
+int main( int argc, char** argv )
+{
+	obj_t   a, b, c;
+	dim_t   p;
+	dim_t   p_begin, p_end, p_inc;
+	dim_t   nt;
+	num_t   dt;
+	rntm_t  rntm;
+	prof_t* prof;
+	prof_t  global;
+
+	nt      = 1;
+	p_begin = 40;
+	p_end   = 2000;
+	p_inc   = 392;
+
+	if ( argc > 1 ) nt = atoi( argv[1] );
+	if ( argc > 4 )
+	{
+		p_begin = atoi( argv[2] );
+		p_end   = atoi( argv[3] );
+		p_inc   = atoi( argv[4] );
+	}
+
+	if ( !bli_info_get_enable_profiling() )
+		printf( "%% warning: BLIS was configured without --enable-profiling.\n" );
+
+	dt = BLIS_DOUBLE;
+
+	prof = malloc( nt * sizeof( prof_t ) );
+
+	bli_prof_reset();
+
+	for ( p = p_begin; p <= p_end; p += p_inc )
+	{
+		bli_obj_create( dt, p, p, 0, 0, &a );
+		bli_obj_create( dt, p, p, 0, 0, &b );
+		bli_obj_create( dt, p, p, 0, 0, &c );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c );
+
+		for ( dim_t t = 0; t < nt; ++t ) bli_prof_clear( &prof[ t ] );
+
+		bli_rntm_init( &rntm );
+		bli_rntm_set_num_threads( nt, &rntm );
+		bli_rntm_set_prof( prof, nt, &rntm );
+
+		double dtime = bli_clock();
+
+		bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c, NULL, &rntm );
+
+		dtime = bli_clock_min_diff( 1.0e9, dtime );
+
+		printf( "%% m = n = k = %4lu  total %8.4f s\n", ( unsigned long )p, dtime );
+
+		for ( dim_t t = 0; t < nt; ++t )
+		{
+			printf( "  tid %2lu:", ( unsigned long )t );
+			for ( dim_t i = 0; i < BLIS_NUM_PROF_IDS; ++i )
+				printf( "  %s %8.4f s (%6lu)", bli_prof_string( i ),
+				        bli_prof_time( i, &prof[ t ] ),
+				        ( unsigned long )bli_prof_count( i, &prof[ t ] ) );
+			printf( "\n" );
+		}
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+	}
+
+	bli_prof_query( &global );
+
+	printf( "%% process-wide aggregate:\n" );
+	for ( dim_t i = 0; i < BLIS_NUM_PROF_IDS; ++i )
+		printf( "  %-8s %8.4f s (%6lu)\n", bli_prof_string( i ),
+		        bli_prof_time( i, &global ),
+		        ( unsigned long )bli_prof_count( i, &global ) );
+
+	free( prof );
+
+	return 0;
+}
+
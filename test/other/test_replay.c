@@ -0,0 +1,397 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include "blis.h"
+
+// Replay a workload captured by running an application with the
+// BLIS_CAPTURE_FILE environment variable set (see frame/base/bli_capture.h).
+// Each distinct call shape in the capture file is re-executed with synthetic
+// (random) data, using the recorded dimensions, transposition, structure,
+// strides, and threading settings, and the best-of-n_repeats time and
+// throughput are reported along with the number of times the shape occurred.
+// Note that BLIS_CAPTURE_FILE should NOT be set when running this driver.
+//
+// Usage: test_replay.x capture_file [n_repeats]
+
+typedef struct
+{
+	capture_rec_t rec;
+	dim_t         count;
+} shape_t;
+
+// Return the strides recorded for an m x n operand if they describe a valid
+// row- or column-stored matrix, or zeros (ie: default column storage)
+// otherwise.
+static void replay_strides( dim_t m, dim_t n, inc_t* rs, inc_t* cs )
+{
+	bool ok = ( *rs > 0 && *cs > 0 ) &&
+	          ( ( *rs == 1 && *cs >= bli_max( m, 1 ) ) ||
+	            ( *cs == 1 && *rs >= bli_max( n, 1 ) ) );
+
+	if ( !ok ) { *rs = 0; *cs = 0; }
+}
+
+static void replay_create( num_t dt, dim_t m, dim_t n, inc_t rs, inc_t cs,
+                           obj_t* x )
+{
+	replay_strides( m, n, &rs, &cs );
+
+	bli_obj_create( dt, m, n, rs, cs, x );
+	bli_randm( x );
+}
+
+// Create a square structured operand. Triangular operands are made
+// diagonally dominant so that solves remain well-conditioned.
+static void replay_create_struc( num_t dt, dim_t m, inc_t rs, inc_t cs,
+                                 struc_t struc, uplo_t uplo, diag_t diag,
+                                 obj_t* x )
+{
+	replay_strides( m, m, &rs, &cs );
+
+	bli_obj_create( dt, m, m, rs, cs, x );
+	bli_obj_set_struc( struc, x );
+	bli_obj_set_uplo( uplo, x );
+	bli_randm( x );
+
+	if ( struc == BLIS_TRIANGULAR )
+	{
+		obj_t shift;
+
+		bli_obj_create_1x1( dt, &shift );
+		bli_setsc( ( double )m, 0.0, &shift );
+		bli_shiftd( &shift, x );
+		bli_obj_free( &shift );
+
+		bli_obj_set_diag( diag, x );
+	}
+}
+
+static char replay_dt_char( num_t dt )
+{
+	return ( dt == BLIS_FLOAT    ? 's' :
+	         dt == BLIS_DOUBLE   ? 'd' :
+	         dt == BLIS_SCOMPLEX ? 'c' : 'z' );
+}
+
+static double replay_flops( capture_rec_t* r )
+{
+	double m = r->m, n = r->n, k = r->k;
+	double f;
+
+	switch ( r->op )
+	{
+		case BLIS_CAPTURE_GEMM:  f = 2.0 * m * n * k;                     break;
+		case BLIS_CAPTURE_GEMMT: f = 1.0 * m * m * k;                     break;
+		case BLIS_CAPTURE_HEMM:
+		case BLIS_CAPTURE_SYMM:  f = 2.0 * m * n * ( r->side == BLIS_LEFT ? m : n ); break;
+		case BLIS_CAPTURE_HERK:
+		case BLIS_CAPTURE_SYRK:  f = 1.0 * m * m * k;                     break;
+		case BLIS_CAPTURE_HER2K:
+		case BLIS_CAPTURE_SYR2K: f = 2.0 * m * m * k;                     break;
+		case BLIS_CAPTURE_TRMM3: f = 2.0 * m * n * ( r->side == BLIS_LEFT ? m : n ); break;
+		case BLIS_CAPTURE_TRMM:
+		case BLIS_CAPTURE_TRSM:  f = 1.0 * m * n * ( r->side == BLIS_LEFT ? m : n ); break;
+		case BLIS_CAPTURE_GEMV:
+		case BLIS_CAPTURE_GER:   f = 2.0 * m * n;                         break;
+		case BLIS_CAPTURE_HEMV:
+		case BLIS_CAPTURE_SYMV:  f = 2.0 * m * m;                         break;
+		case BLIS_CAPTURE_TRMV:
+		case BLIS_CAPTURE_TRSV:  f = 1.0 * m * m;                         break;
+		default:                 f = 0.0;                                 break;
+	}
+
+	if ( bli_is_complex( r->dt ) ) f *= 4.0;
+
+	return f;
+}
+
+// Execute one call of the given shape and return the elapsed time.
+static double replay_exec( capture_rec_t* r, rntm_t* rntm )
+{
+	num_t   dt    = r->dt;
+	capop_t op    = r->op;
+	trans_t transa = r->trans_a;
+	trans_t transb = r->trans_b;
+	side_t  side  = r->side;
+	uplo_t  uplo  = r->uplo;
+	diag_t  diag  = r->diag;
+	dim_t   m     = r->m;
+	dim_t   n     = r->n;
+	dim_t   k     = r->k;
+	dim_t   ma    = ( side == BLIS_LEFT ? m : n );
+
+	obj_t   a, b, c;
+	dim_t   m_a, n_a, m_b, n_b;
+	double  dtime;
+
+	bool    has_b = TRUE;
+	bool    has_c = TRUE;
+
+	switch ( op )
+	{
+		case BLIS_CAPTURE_GEMM:
+		case BLIS_CAPTURE_GEMMT:
+		case BLIS_CAPTURE_HERK:
+		case BLIS_CAPTURE_SYRK:
+		case BLIS_CAPTURE_HER2K:
+		case BLIS_CAPTURE_SYR2K:
+			bli_set_dims_with_trans( transa, m, k, &m_a, &n_a );
+			bli_set_dims_with_trans( transb, k, n, &m_b, &n_b );
+			if ( op == BLIS_CAPTURE_HER2K || op == BLIS_CAPTURE_SYR2K )
+				bli_set_dims_with_trans( transb, m, k, &m_b, &n_b );
+			replay_create( dt, m_a, n_a, r->rs_a, r->cs_a, &a );
+			replay_create( dt, m_b, n_b, r->rs_b, r->cs_b, &b );
+			replay_create( dt, m,   n,   r->rs_c, r->cs_c, &c );
+			bli_obj_set_conjtrans( transa, &a );
+			bli_obj_set_conjtrans( transb, &b );
+			if ( op != BLIS_CAPTURE_GEMM )
+			{
+				bli_obj_set_struc( op == BLIS_CAPTURE_HERK ||
+				                   op == BLIS_CAPTURE_HER2K ? BLIS_HERMITIAN
+				                                            : BLIS_SYMMETRIC, &c );
+				if ( op == BLIS_CAPTURE_GEMMT ) bli_obj_set_struc( BLIS_GENERAL, &c );
+				bli_obj_set_uplo( uplo, &c );
+			}
+			if ( op == BLIS_CAPTURE_HERK || op == BLIS_CAPTURE_SYRK ) has_b = FALSE;
+			break;
+
+		case BLIS_CAPTURE_HEMM:
+		case BLIS_CAPTURE_SYMM:
+			replay_create_struc( dt, ma, r->rs_a, r->cs_a,
+			                     op == BLIS_CAPTURE_HEMM ? BLIS_HERMITIAN
+			                                             : BLIS_SYMMETRIC,
+			                     uplo, BLIS_NONUNIT_DIAG, &a );
+			replay_create( dt, m, n, r->rs_b, r->cs_b, &b );
+			replay_create( dt, m, n, r->rs_c, r->cs_c, &c );
+			bli_obj_set_conjtrans( transa, &a );
+			break;
+
+		case BLIS_CAPTURE_TRMM3:
+		case BLIS_CAPTURE_TRMM:
+		case BLIS_CAPTURE_TRSM:
+			replay_create_struc( dt, ma, r->rs_a, r->cs_a, BLIS_TRIANGULAR,
+			                     uplo, diag, &a );
+			bli_obj_set_conjtrans( transa, &a );
+			if ( op == BLIS_CAPTURE_TRMM3 )
+			{
+				replay_create( dt, m, n, r->rs_b, r->cs_b, &b );
+				bli_obj_set_conjtrans( transb, &b );
+			}
+			else has_b = FALSE;
+			replay_create( dt, m, n, r->rs_c, r->cs_c, &c );
+			break;
+
+		case BLIS_CAPTURE_GEMV:
+		case BLIS_CAPTURE_GER:
+			replay_create( dt, m, n, r->rs_a, r->cs_a, &a );
+			bli_obj_set_conjtrans( transa, &a );
+			if ( op == BLIS_CAPTURE_GEMV )
+				bli_set_dims_with_trans( transa, m, n, &m_a, &n_a );
+			else
+				{ m_a = m; n_a = n; }
+			replay_create( dt, op == BLIS_CAPTURE_GEMV ? n_a : m_a, 1, 0, 0, &b );
+			replay_create( dt, op == BLIS_CAPTURE_GEMV ? m_a : n_a, 1, 0, 0, &c );
+			break;
+
+		case BLIS_CAPTURE_HEMV:
+		case BLIS_CAPTURE_SYMV:
+			replay_create_struc( dt, m, r->rs_a, r->cs_a,
+			                     op == BLIS_CAPTURE_HEMV ? BLIS_HERMITIAN
+			                                             : BLIS_SYMMETRIC,
+			                     uplo, BLIS_NONUNIT_DIAG, &a );
+			replay_create( dt, m, 1, 0, 0, &b );
+			replay_create( dt, m, 1, 0, 0, &c );
+			break;
+
+		case BLIS_CAPTURE_TRMV:
+		case BLIS_CAPTURE_TRSV:
+			replay_create_struc( dt, m, r->rs_a, r->cs_a, BLIS_TRIANGULAR,
+			                     uplo, diag, &a );
+			bli_obj_set_conjtrans( transa, &a );
+			replay_create( dt, m, 1, 0, 0, &b );
+			has_c = FALSE;
+			break;
+
+		default:
+			return 0.0;
+	}
+
+	dtime = bli_clock();
+
+	switch ( op )
+	{
+		case BLIS_CAPTURE_GEMM:  bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c, NULL, rntm ); break;
+		case BLIS_CAPTURE_GEMMT: bli_gemmt_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c, NULL, rntm ); break;
+		case BLIS_CAPTURE_HEMM:  bli_hemm_ex( side, &BLIS_ONE, &a, &b, &BLIS_ONE, &c, NULL, rntm ); break;
+		case BLIS_CAPTURE_SYMM:  bli_symm_ex( side, &BLIS_ONE, &a, &b, &BLIS_ONE, &c, NULL, rntm ); break;
+		case BLIS_CAPTURE_HERK:  bli_herk_ex( &BLIS_ONE, &a, &BLIS_ONE, &c, NULL, rntm ); break;
+		case BLIS_CAPTURE_SYRK:  bli_syrk_ex( &BLIS_ONE, &a, &BLIS_ONE, &c, NULL, rntm ); break;
+		case BLIS_CAPTURE_HER2K: bli_her2k_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c, NULL, rntm ); break;
+		case BLIS_CAPTURE_SYR2K: bli_syr2k_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c, NULL, rntm ); break;
+		case BLIS_CAPTURE_TRMM3: bli_trmm3_ex( side, &BLIS_ONE, &a, &b, &BLIS_ONE, &c, NULL, rntm ); break;
+		case BLIS_CAPTURE_TRMM:  bli_trmm_ex( side, &BLIS_ONE, &a, &c, NULL, rntm ); break;
+		case BLIS_CAPTURE_TRSM:  bli_trsm_ex( side, &BLIS_ONE, &a, &c, NULL, rntm ); break;
+		case BLIS_CAPTURE_GEMV:  bli_gemv_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c, NULL, rntm ); break;
+		case BLIS_CAPTURE_GER:   bli_ger_ex( &BLIS_ONE, &b, &c, &a, NULL, rntm ); break;
+		case BLIS_CAPTURE_HEMV:  bli_hemv_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c, NULL, rntm ); break;
+		case BLIS_CAPTURE_SYMV:  bli_symv_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c, NULL, rntm ); break;
+		case BLIS_CAPTURE_TRMV:  bli_trmv_ex( &BLIS_ONE, &a, &b, NULL, rntm ); break;
+		case BLIS_CAPTURE_TRSV:  bli_trsv_ex( &BLIS_ONE, &a, &b, NULL, rntm ); break;
+		default: break;
+	}
+
+	dtime = bli_clock() - dtime;
+
+	bli_obj_free( &a );
+	if ( has_b ) bli_obj_free( &b );
+	if ( has_c ) bli_obj_free( &c );
+
+	return dtime;
+}
+
+int main( int argc, char** argv )
+{
+	FILE*         file;
+	capture_hdr_t hdr;
+	capture_rec_t rec;
+	shape_t*      shapes   = NULL;
+	dim_t         n_shapes = 0;
+	dim_t         n_alloc  = 0;
+	dim_t         n_calls  = 0;
+	int           n_repeats;
+
+	if ( argc < 2 )
+	{
+		printf( "usage: %s capture_file [n_repeats]\n", argv[0] );
+		return 1;
+	}
+
+	n_repeats = ( argc > 2 ? atoi( argv[2] ) : 3 );
+
+	file = fopen( argv[1], "rb" );
+
+	if ( file == NULL )
+	{
+		printf( "%% could not open %s\n", argv[1] );
+		return 1;
+	}
+
+	if ( fread( &hdr, sizeof( capture_hdr_t ), 1, file ) != 1 ||
+	     strncmp( hdr.magic, BLIS_CAPTURE_MAGIC, sizeof( hdr.magic ) ) != 0 ||
+	     hdr.version  != BLIS_CAPTURE_VERSION ||
+	     hdr.rec_size != sizeof( capture_rec_t ) )
+	{
+		printf( "%% %s is not a compatible BLIS capture file\n", argv[1] );
+		return 1;
+	}
+
+	// Collapse the recorded calls into distinct shapes, preserving the
+	// order in which each shape first occurred.
+	while ( fread( &rec, sizeof( capture_rec_t ), 1, file ) == 1 )
+	{
+		dim_t s;
+
+		n_calls += 1;
+
+		for ( s = 0; s < n_shapes; ++s )
+			if ( memcmp( &shapes[ s ].rec, &rec, sizeof( capture_rec_t ) ) == 0 )
+				break;
+
+		if ( s < n_shapes ) { shapes[ s ].count += 1; continue; }
+
+		if ( n_shapes == n_alloc )
+		{
+			n_alloc = 2 * n_alloc + 16;
+			shapes  = realloc( shapes, n_alloc * sizeof( shape_t ) );
+		}
+
+		shapes[ n_shapes ].rec   = rec;
+		shapes[ n_shapes ].count = 1;
+		n_shapes += 1;
+	}
+
+	fclose( file );
+
+	printf( "%% %ld calls, %ld distinct shapes\n", ( long )n_calls, ( long )n_shapes );
+	printf( "%% %-6s %2s %2s %2s %1s %6s %6s %6s %4s %8s %12s %8s\n",
+	        "op", "dt", "ta", "tb", "s", "m", "n", "k", "nt",
+	        "count", "time(s)", "gflops" );
+
+	double time_total = 0.0;
+
+	for ( dim_t s = 0; s < n_shapes; ++s )
+	{
+		capture_rec_t* r = &shapes[ s ].rec;
+		rntm_t         rntm;
+		double         dtime_best = 1.0e9;
+
+		bli_rntm_init( &rntm );
+
+		if ( r->ways[ 0 ] > 0 && r->ways[ 1 ] > 0 && r->ways[ 2 ] > 0 &&
+		     r->ways[ 3 ] > 0 && r->ways[ 4 ] > 0 )
+			bli_rntm_set_ways( r->ways[ 0 ], r->ways[ 1 ], r->ways[ 2 ],
+			                   r->ways[ 3 ], r->ways[ 4 ], &rntm );
+		else if ( r->n_threads > 0 )
+			bli_rntm_set_num_threads( r->n_threads, &rntm );
+
+		for ( int i = 0; i < n_repeats; ++i )
+			dtime_best = bli_fmin( dtime_best, replay_exec( r, &rntm ) );
+
+		double gflops = replay_flops( r ) / ( dtime_best * 1.0e9 );
+
+		time_total += shapes[ s ].count * dtime_best;
+
+		printf( "  %-6s %2c %2d %2d %1c %6ld %6ld %6ld %4d %8ld %12.6f %8.3f\n",
+		        bli_capture_op_string( r->op ),
+		        replay_dt_char( r->dt ),
+		        r->trans_a != BLIS_NO_TRANSPOSE,
+		        r->trans_b != BLIS_NO_TRANSPOSE,
+		        r->side == BLIS_LEFT ? 'l' : 'r',
+		        ( long )r->m, ( long )r->n, ( long )r->k,
+		        r->n_threads,
+		        ( long )shapes[ s ].count, dtime_best, gflops );
+	}
+
+	printf( "%% estimated total time for the recorded mix: %.6f s\n", time_total );
+
+	free( shapes );
+
+	return 0;
+}
+
@@ -0,0 +1,304 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include <math.h>
+#include "blis.h"
+
+// Check rotv and rotmv (every value of the rotmv flag) against a scalar
+// reference for each datatype at unit and non-unit stride, and then time
+// drotv against the scalar loop of the reference BLAS. Bandwidth counts one
+// read and one write of each element of x and y.
+//
+// Usage: test_rotv.x [p_begin p_end p_inc]
+
+static const num_t dts[] = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+
+// Apply h = [ h11 h12; h21 h22 ] to the real and imaginary parts of each
+// pair ( x[i], y[i] ) in double precision.
+static void rot_ref( dim_t n_real, double* x, double* y, const double* h )
+{
+	for ( dim_t i = 0; i < n_real; ++i )
+	{
+		const double xi = x[ i ];
+		const double yi = y[ i ];
+
+		x[ i ] = h[ 0 ] * xi + h[ 2 ] * yi;
+		y[ i ] = h[ 1 ] * xi + h[ 3 ] * yi;
+	}
+}
+
+static void load( num_t dt, dim_t n_real, void* buf, inc_t inc, double* v, bool to_buf )
+{
+	const dim_t n_elem = ( bli_is_complex( dt ) ? 2 : 1 );
+
+	for ( dim_t i = 0; i < n_real; ++i )
+	{
+		const dim_t j = ( i / n_elem ) * inc * n_elem + i % n_elem;
+
+		if ( bli_is_single_prec( dt ) )
+		{
+			if ( to_buf ) ( ( float* )buf )[ j ] = ( float )v[ i ];
+			else          v[ i ] = ( ( float* )buf )[ j ];
+		}
+		else
+		{
+			if ( to_buf ) ( ( double* )buf )[ j ] = v[ i ];
+			else          v[ i ] = ( ( double* )buf )[ j ];
+		}
+	}
+}
+
+static void call_rot( num_t dt, int op, dim_t n, void* x, inc_t incx,
+                      void* y, inc_t incy, double c, double s, double* param )
+{
+	float cs = ( float )c, ss = ( float )s, params[ 5 ];
+
+	for ( dim_t i = 0; i < 5; ++i ) params[ i ] = ( float )param[ i ];
+
+	if ( op == 0 )
+	{
+		if      ( dt == BLIS_FLOAT    ) bli_srotv( n, x, incx, y, incy, &cs, &ss );
+		else if ( dt == BLIS_DOUBLE   ) bli_drotv( n, x, incx, y, incy, &c, &s );
+		else if ( dt == BLIS_SCOMPLEX ) bli_crotv( n, x, incx, y, incy, &cs, &ss );
+		else                            bli_zrotv( n, x, incx, y, incy, &c, &s );
+	}
+	else
+	{
+		if      ( dt == BLIS_FLOAT    ) bli_srotmv( n, x, incx, y, incy, params );
+		else if ( dt == BLIS_DOUBLE   ) bli_drotmv( n, x, incx, y, incy, param );
+		else if ( dt == BLIS_SCOMPLEX ) bli_crotmv( n, x, incx, y, incy, params );
+		else                            bli_zrotmv( n, x, incx, y, incy, param );
+	}
+}
+
+static dim_t check_rot( void )
+{
+	const dim_t ns[]   = { 0, 1, 3, 4, 7, 8, 15, 16, 17, 31, 33, 64, 100, 1001 };
+	const inc_t incs[] = { 1, 3 };
+	dim_t       n_fail = 0;
+	dim_t       n_test = 0;
+
+	for ( dim_t di = 0; di < 4; ++di )
+	for ( dim_t ni = 0; ni < 14; ++ni )
+	for ( dim_t ix = 0; ix < 2; ++ix )
+	for ( dim_t iy = 0; iy < 2; ++iy )
+	for ( int   op = 0; op < 5; ++op )
+	{
+		const num_t  dt     = dts[ di ];
+		const dim_t  n      = ns[ ni ];
+		const inc_t  incx   = incs[ ix ];
+		const inc_t  incy   = incs[ iy ];
+		const dim_t  n_real = n * ( bli_is_complex( dt ) ? 2 : 1 );
+		const double eps    = ( bli_is_single_prec( dt ) ? 1.0e-5 : 1.0e-13 );
+		const double theta  = 0.3 + 0.1 * ni;
+		const double c      = cos( theta );
+		const double s      = sin( theta );
+
+		// op 0 is rotv; ops 1-4 are rotmv with flag -2, -1, 0, 1.
+		double param[ 5 ] = { ( double )op - 3.0, 1.25, -0.5, 0.75, 1.5 };
+		double h[ 4 ];
+
+		if      ( op == 0 )         { h[0] = c;        h[1] = -s;       h[2] = s;        h[3] = c; }
+		else if ( param[ 0 ] < -1.5 ) { h[0] = 1.0;      h[1] = 0.0;      h[2] = 0.0;      h[3] = 1.0; }
+		else if ( param[ 0 ] <  0.0 ) { h[0] = param[1]; h[1] = param[2]; h[2] = param[3]; h[3] = param[4]; }
+		else if ( param[ 0 ] == 0.0 ) { h[0] = 1.0;      h[1] = param[2]; h[2] = param[3]; h[3] = 1.0; }
+		else                          { h[0] = param[1]; h[1] = -1.0;     h[2] = 1.0;      h[3] = param[4]; }
+
+		// Pad each buffer so that writes past the last element (or into the
+		// gaps between strided elements) are detected.
+		const dim_t len = ( n + 1 ) * 3 * 2 + 8;
+
+		double* xb = malloc( len * sizeof( double ) );
+		double* yb = malloc( len * sizeof( double ) );
+		double* xr = malloc( ( n_real + 1 ) * sizeof( double ) );
+		double* yr = malloc( ( n_real + 1 ) * sizeof( double ) );
+		double* xg = malloc( ( n_real + 1 ) * sizeof( double ) );
+		double* yg = malloc( ( n_real + 1 ) * sizeof( double ) );
+		double  err = 0.0;
+
+		for ( dim_t i = 0; i < len; ++i ) xb[ i ] = yb[ i ] = -7.0;
+		if ( bli_is_single_prec( dt ) )
+			for ( dim_t i = 0; i < len; ++i ) ( ( float* )xb )[ i ] = ( ( float* )yb )[ i ] = -7.0f;
+
+		for ( dim_t i = 0; i < n_real; ++i )
+		{
+			xr[ i ] = ( double )( rand() % 2001 - 1000 ) / 1000.0;
+			yr[ i ] = ( double )( rand() % 2001 - 1000 ) / 1000.0;
+		}
+
+		load( dt, n_real, xb, incx, xr, TRUE );
+		load( dt, n_real, yb, incy, yr, TRUE );
+		load( dt, n_real, xb, incx, xr, FALSE );
+		load( dt, n_real, yb, incy, yr, FALSE );
+
+		call_rot( dt, op, n, xb, incx, yb, incy, c, s, param );
+		rot_ref( n_real, xr, yr, h );
+
+		load( dt, n_real, xb, incx, xg, FALSE );
+		load( dt, n_real, yb, incy, yg, FALSE );
+
+		for ( dim_t i = 0; i < n_real; ++i )
+		{
+			err = bli_fmax( err, fabs( xg[ i ] - xr[ i ] ) );
+			err = bli_fmax( err, fabs( yg[ i ] - yr[ i ] ) );
+		}
+
+		// Count untouched padding: every element outside x and y must
+		// still hold the sentinel.
+		{
+			const dim_t n_elem  = ( bli_is_complex( dt ) ? 2 : 1 );
+			dim_t       n_sent  = 0;
+
+			for ( dim_t i = 0; i < len; ++i )
+			{
+				const double xv = ( bli_is_single_prec( dt ) ? ( ( float* )xb )[ i ] : xb[ i ] );
+				const double yv = ( bli_is_single_prec( dt ) ? ( ( float* )yb )[ i ] : yb[ i ] );
+				const bool   in_x = ( i / n_elem ) % incx == 0 && i / n_elem / incx < n;
+				const bool   in_y = ( i / n_elem ) % incy == 0 && i / n_elem / incy < n;
+
+				if ( !in_x && xv != -7.0 ) ++n_sent;
+				if ( !in_y && yv != -7.0 ) ++n_sent;
+			}
+
+			if ( n_sent != 0 ) err = 1.0;
+		}
+
+		if ( err > eps )
+		{
+			printf( "%s FAILED: dt %d n %d incx %d incy %d flag %g: err %g\n",
+			        op == 0 ? "rotv" : "rotmv", ( int )dt, ( int )n,
+			        ( int )incx, ( int )incy, op == 0 ? 0.0 : param[ 0 ], err );
+			++n_fail;
+		}
+
+		++n_test;
+
+		free( xb ); free( yb );
+		free( xr ); free( yr );
+		free( xg ); free( yg );
+	}
+
+	printf( "%% %lu of %lu checks failed\n", ( unsigned long )n_fail,
+	                                         ( unsigned long )n_test );
+
+	return n_fail;
+}
+
+// The loop of the reference BLAS drot for unit stride.
+static void drot_loop( dim_t n, double* x, double* y, double c, double s )
+{
+	for ( dim_t i = 0; i < n; ++i )
+	{
+		const double t = c * x[ i ] + s * y[ i ];
+
+		y[ i ] = c * y[ i ] - s * x[ i ];
+		x[ i ] = t;
+	}
+}
+
+int main( int argc, char** argv )
+{
+	obj_t   x, y;
+	dim_t   p;
+	dim_t   p_begin, p_end, p_inc;
+	num_t   dt;
+	int     r, n_repeats;
+	double  c, s;
+
+	double dtime;
+	double dtime_loop, dtime_rotv;
+	double bytes;
+
+	n_repeats = 100;
+
+	p_begin = 1000;
+	p_end   = 100000;
+	p_inc   = 11000;
+
+	if ( argc > 3 )
+	{
+		p_begin = atoi( argv[1] );
+		p_end   = atoi( argv[2] );
+		p_inc   = atoi( argv[3] );
+	}
+
+	if ( check_rot() != 0 ) return 1;
+
+	dt = BLIS_DOUBLE;
+	c  = cos( 0.5 );
+	s  = sin( 0.5 );
+
+	printf( "%%      n   GB/s(loop)  GB/s(rotv)  ratio\n" );
+
+	for ( p = p_begin; p <= p_end; p += p_inc )
+	{
+		bli_obj_create( dt, p, 1, 0, 0, &x );
+		bli_obj_create( dt, p, 1, 0, 0, &y );
+
+		bli_randv( &x );
+		bli_randv( &y );
+
+		dtime_loop = DBL_MAX;
+		dtime_rotv = DBL_MAX;
+
+		for ( r = 0; r < n_repeats; ++r )
+		{
+			dtime = bli_clock();
+			drot_loop( p, bli_obj_buffer( &x ), bli_obj_buffer( &y ), c, s );
+			dtime_loop = bli_clock_min_diff( dtime_loop, dtime );
+
+			dtime = bli_clock();
+			bli_drotv( p, bli_obj_buffer( &x ), 1, bli_obj_buffer( &y ), 1, &c, &s );
+			dtime_rotv = bli_clock_min_diff( dtime_rotv, dtime );
+		}
+
+		bytes = 4.0 * p * bli_dt_size( dt );
+
+		printf( "%7lu   %10.2f  %10.2f  %5.2f\n",
+		        ( unsigned long )p,
+		        bytes / dtime_loop / 1.0e9,
+		        bytes / dtime_rotv / 1.0e9,
+		        dtime_loop / dtime_rotv );
+
+		bli_obj_free( &x );
+		bli_obj_free( &y );
+	}
+
+	return 0;
+}
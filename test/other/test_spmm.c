@@ -0,0 +1,185 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "blis.h"
+
+// Compare bli_dcsrmm() and bli_dcscmm() against dense dgemm on randomly
+// generated sparse matrices.
+//
+// usage: test_spmm.x [density] [p_begin p_end p_inc]
+
+int main( int argc, char** argv )
+{
+	double density = 0.05;
+	dim_t  p_begin = 500, p_end = 2000, p_inc = 500;
+	dim_t  n_repeats = 3;
+
+	if ( argc > 1 ) density = atof( argv[1] );
+	if ( argc > 4 )
+	{
+		p_begin = atol( argv[2] );
+		p_end   = atol( argv[3] );
+		p_inc   = atol( argv[4] );
+	}
+
+	double alpha = 1.5, beta = -0.5;
+
+	printf( "%% density = %g\n", density );
+	printf( "%%  m/k      n     nnz   gemm(s)     csr(s)     csc(s)   err_csr    err_csc\n" );
+
+	for ( dim_t p = p_begin; p <= p_end; p += p_inc )
+	{
+		const dim_t m = p, k = p, n = p;
+
+		obj_t a, b, c, c_csr, c_csc;
+
+		bli_obj_create( BLIS_DOUBLE, m, k, 1, m, &a );
+		bli_obj_create( BLIS_DOUBLE, k, n, 1, k, &b );
+		bli_obj_create( BLIS_DOUBLE, m, n, 1, m, &c );
+		bli_obj_create( BLIS_DOUBLE, m, n, 1, m, &c_csr );
+		bli_obj_create( BLIS_DOUBLE, m, n, 1, m, &c_csc );
+
+		bli_randm( &b );
+		bli_randm( &c );
+		bli_copym( &c, &c_csr );
+		bli_copym( &c, &c_csc );
+
+		// Sparsify A by keeping each entry with probability density. (All
+		// matrices are created with explicit strides so that their buffers
+		// can be indexed directly.)
+		double* ap = bli_obj_buffer( &a );
+		for ( dim_t j = 0; j < k; ++j )
+		for ( dim_t i = 0; i < m; ++i )
+		{
+			double r = ( double )rand() / RAND_MAX;
+			ap[ i + j*m ] = ( r < density ? 2.0 * r / density - 1.0 : 0.0 );
+		}
+
+		// Build csr and csc copies of A.
+		inc_t*  rptr = malloc( ( m + 1 ) * sizeof( inc_t ) );
+		inc_t*  cptr = malloc( ( k + 1 ) * sizeof( inc_t ) );
+		dim_t   nnz  = 0;
+
+		for ( dim_t i = 0; i < m; ++i )
+		for ( dim_t j = 0; j < k; ++j ) if ( ap[ i + j*m ] != 0.0 ) ++nnz;
+
+		double* rval = malloc( nnz * sizeof( double ) );
+		double* cval = malloc( nnz * sizeof( double ) );
+		dim_t*  rind = malloc( nnz * sizeof( dim_t ) );
+		dim_t*  cind = malloc( nnz * sizeof( dim_t ) );
+
+		dim_t q = 0;
+		for ( dim_t i = 0; i < m; ++i )
+		{
+			rptr[ i ] = q;
+			for ( dim_t j = 0; j < k; ++j )
+				if ( ap[ i + j*m ] != 0.0 ) { rval[ q ] = ap[ i + j*m ]; rind[ q++ ] = j; }
+		}
+		rptr[ m ] = q;
+
+		q = 0;
+		for ( dim_t j = 0; j < k; ++j )
+		{
+			cptr[ j ] = q;
+			for ( dim_t i = 0; i < m; ++i )
+				if ( ap[ i + j*m ] != 0.0 ) { cval[ q ] = ap[ i + j*m ]; cind[ q++ ] = i; }
+		}
+		cptr[ k ] = q;
+
+		double t_gemm = 1.0e9, t_csr = 1.0e9, t_csc = 1.0e9;
+
+		for ( dim_t r = 0; r < n_repeats; ++r )
+		{
+			obj_t alphao, betao, ct;
+			bli_obj_scalar_init_detached( BLIS_DOUBLE, &alphao );
+			bli_obj_scalar_init_detached( BLIS_DOUBLE, &betao );
+			bli_setsc( alpha, 0.0, &alphao );
+			bli_setsc( beta,  0.0, &betao );
+
+			bli_obj_create( BLIS_DOUBLE, m, n, 1, m, &ct );
+
+			bli_copym( &c, &ct );
+			double t0 = bli_clock();
+			bli_gemm( &alphao, &a, &b, &betao, &ct );
+			t_gemm = bli_clock_min_diff( t_gemm, t0 );
+			if ( r == 0 ) bli_copym( &ct, &c );
+
+			bli_copym( &c_csr, &ct );
+			t0 = bli_clock();
+			bli_dcsrmm( m, n, k, &alpha, rval, rptr, rind,
+			            bli_obj_buffer( &b ), 1, k, &beta,
+			            bli_obj_buffer( &ct ), 1, m );
+			t_csr = bli_clock_min_diff( t_csr, t0 );
+			if ( r == 0 ) bli_copym( &ct, &c_csr );
+
+			bli_copym( &c_csc, &ct );
+			t0 = bli_clock();
+			bli_dcscmm( m, n, k, &alpha, cval, cptr, cind,
+			            bli_obj_buffer( &b ), 1, k, &beta,
+			            bli_obj_buffer( &ct ), 1, m );
+			t_csc = bli_clock_min_diff( t_csc, t0 );
+			if ( r == 0 ) bli_copym( &ct, &c_csc );
+
+			bli_obj_free( &ct );
+		}
+
+		double e_csr, e_csc, nrm, dummy;
+		obj_t  norm;
+		bli_obj_scalar_init_detached( BLIS_DOUBLE, &norm );
+
+		bli_normfm( &c, &norm ); bli_getsc( &norm, &nrm, &dummy );
+		bli_subm( &c, &c_csr );
+		bli_subm( &c, &c_csc );
+		bli_normfm( &c_csr, &norm ); bli_getsc( &norm, &e_csr, &dummy );
+		bli_normfm( &c_csc, &norm ); bli_getsc( &norm, &e_csc, &dummy );
+
+		printf( "%6lu %6lu %8lu  %9.4f  %9.4f  %9.4f  %8.2e  %8.2e\n",
+		        ( unsigned long )m, ( unsigned long )n, ( unsigned long )nnz,
+		        t_gemm, t_csr, t_csc, e_csr / nrm, e_csc / nrm );
+
+		free( rptr ); free( cptr ); free( rval ); free( cval );
+		free( rind ); free( cind );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_csr );
+		bli_obj_free( &c_csc );
+	}
+
+	return 0;
+}
+
@@ -0,0 +1,168 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include "blis.h"
+
+// Compare the accuracy and performance of gemm performed via one or more
+// levels of Strassen's algorithm against the conventional gemm algorithm.
+// Accuracy is reported as the Frobenius norm of the difference from the
+// conventional result, relative to ||A||_F ||B||_F.
+//
+// Usage: test_strassen.x [levels] [p_begin p_end p_inc]
+
+int main( int argc, char** argv )
+{
+	obj_t a, b, c, c_nat;
+	obj_t c_save;
+	obj_t alpha, beta;
+	obj_t norm;
+	dim_t m, n, k;
+	dim_t p;
+	dim_t p_begin, p_end, p_inc;
+	dim_t levels;
+	num_t dt;
+	int   r, n_repeats;
+	rntm_t rntm_nat, rntm_str;
+
+	double dtime;
+	double dtime_nat, dtime_str;
+	double gflops_nat, gflops_str;
+	double norm_a, norm_b, norm_d, dummy;
+
+	n_repeats = 3;
+
+	levels  = 1;
+	p_begin = 2048;
+	p_end   = 8192;
+	p_inc   = 2048;
+
+	if ( argc > 1 ) levels  = atoi( argv[1] );
+	if ( argc > 4 )
+	{
+		p_begin = atoi( argv[2] );
+		p_end   = atoi( argv[3] );
+		p_inc   = atoi( argv[4] );
+	}
+
+	//dt = BLIS_FLOAT;
+	dt = BLIS_DOUBLE;
+
+	bli_rntm_init( &rntm_nat );
+	bli_rntm_init( &rntm_str );
+	bli_rntm_set_strassen_levels( levels, &rntm_str );
+
+	printf( "%% levels = %lu, BLIS_STRASSEN_MIN_DIM = %lu\n",
+	        ( unsigned long )levels, ( unsigned long )BLIS_STRASSEN_MIN_DIM );
+	printf( "%%    m     k     n   gflops(nat)  gflops(str)  speedup   rel err\n" );
+
+	for ( p = p_begin; p <= p_end; p += p_inc )
+	{
+		m = p; n = p; k = p;
+
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		bli_obj_create( dt, 1, 1, 0, 0, &beta );
+		bli_obj_create( dt, 1, 1, 0, 0, &norm );
+
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, k, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+		bli_obj_create( dt, m, n, 0, 0, &c_nat );
+		bli_obj_create( dt, m, n, 0, 0, &c_save );
+
+		bli_randm( &a );
+		bli_randm( &b );
+		bli_randm( &c );
+
+		bli_setsc(  (0.9/1.0), 0.0, &alpha );
+		bli_setsc( -(1.1/1.0), 0.0, &beta );
+
+		bli_copym( &c, &c_save );
+
+		dtime_nat = DBL_MAX;
+		dtime_str = DBL_MAX;
+
+		for ( r = 0; r < n_repeats; ++r )
+		{
+			bli_copym( &c_save, &c_nat );
+
+			dtime = bli_clock();
+
+			bli_gemm_ex( &alpha, &a, &b, &beta, &c_nat, NULL, &rntm_nat );
+
+			dtime_nat = bli_clock_min_diff( dtime_nat, dtime );
+
+			bli_copym( &c_save, &c );
+
+			dtime = bli_clock();
+
+			bli_gemm_ex( &alpha, &a, &b, &beta, &c, NULL, &rntm_str );
+
+			dtime_str = bli_clock_min_diff( dtime_str, dtime );
+		}
+
+		gflops_nat = ( 2.0 * m * k * n ) / ( dtime_nat * 1.0e9 );
+		gflops_str = ( 2.0 * m * k * n ) / ( dtime_str * 1.0e9 );
+
+		bli_normfm( &a, &norm ); bli_getsc( &norm, &norm_a, &dummy );
+		bli_normfm( &b, &norm ); bli_getsc( &norm, &norm_b, &dummy );
+
+		bli_subm( &c_nat, &c );
+		bli_normfm( &c, &norm ); bli_getsc( &norm, &norm_d, &dummy );
+
+		printf( "%6lu %5lu %5lu   %9.2f    %9.2f   %6.3f   %8.2e\n",
+		        ( unsigned long )m,
+		        ( unsigned long )k,
+		        ( unsigned long )n,
+		        gflops_nat, gflops_str, dtime_nat / dtime_str,
+		        norm_d / ( norm_a * norm_b ) );
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &beta );
+		bli_obj_free( &norm );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_nat );
+		bli_obj_free( &c_save );
+	}
+
+	return 0;
+}
+
@@ -0,0 +1,162 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include "blis.h"
+
+// Compare gemm with beta = 0 when C is written with regular stores against
+// gemm when C is written with non-temporal (streaming) stores. The problems
+// have a small k, so that writing C accounts for much of the memory traffic.
+// Besides gflops, the rate at which C is written is reported in GB/s. The
+// results of the two runs are checked to be identical. Sup handling is
+// disabled for both runs so that they differ only in how C is stored.
+//
+// Usage: test_stream.x [k] [p_begin p_end p_inc]
+
+int main( int argc, char** argv )
+{
+	obj_t a, b, c, c_str;
+	obj_t alpha, beta;
+	dim_t m, n, k;
+	dim_t p;
+	dim_t p_begin, p_end, p_inc;
+	num_t dt;
+	int   r, n_repeats;
+	bool  equal;
+	rntm_t rntm_reg, rntm_str;
+
+	double dtime;
+	double dtime_reg, dtime_str;
+	double bytes_c;
+
+	n_repeats = 3;
+
+	k       = 64;
+	p_begin = 2000;
+	p_end   = 8000;
+	p_inc   = 2000;
+
+	if ( argc > 1 ) k       = atoi( argv[1] );
+	if ( argc > 4 )
+	{
+		p_begin = atoi( argv[2] );
+		p_end   = atoi( argv[3] );
+		p_inc   = atoi( argv[4] );
+	}
+
+	//dt = BLIS_FLOAT;
+	dt = BLIS_DOUBLE;
+
+	bli_rntm_init( &rntm_reg );
+	bli_rntm_init( &rntm_str );
+	bli_rntm_disable_l3_sup( &rntm_reg );
+	bli_rntm_disable_l3_sup( &rntm_str );
+	bli_rntm_set_stream_c( TRUE, &rntm_str );
+
+	printf( "%% k = %lu\n", ( unsigned long )k );
+	printf( "%%    m     k     n   gflops(reg)  gflops(str)  GB/s(reg)  GB/s(str)  speedup  equal\n" );
+
+	for ( p = p_begin; p <= p_end; p += p_inc )
+	{
+		m = p; n = p;
+
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		bli_obj_create( dt, 1, 1, 0, 0, &beta );
+
+		bli_obj_create( dt, m, k, 0, 0, &a );
+		bli_obj_create( dt, k, n, 0, 0, &b );
+		bli_obj_create( dt, m, n, 0, 0, &c );
+		bli_obj_create( dt, m, n, 0, 0, &c_str );
+
+		bli_randm( &a );
+		bli_randm( &b );
+
+		bli_setsc(  (0.9/1.0), 0.0, &alpha );
+		bli_setsc(       0.0,  0.0, &beta );
+
+		// Touch C once so that the first timed run does not include the
+		// cost of faulting in its pages.
+		bli_setm( &BLIS_ZERO, &c );
+		bli_setm( &BLIS_ZERO, &c_str );
+
+		dtime_reg = DBL_MAX;
+		dtime_str = DBL_MAX;
+
+		for ( r = 0; r < n_repeats; ++r )
+		{
+			dtime = bli_clock();
+
+			bli_gemm_ex( &alpha, &a, &b, &beta, &c, NULL, &rntm_reg );
+
+			dtime_reg = bli_clock_min_diff( dtime_reg, dtime );
+
+			dtime = bli_clock();
+
+			bli_gemm_ex( &alpha, &a, &b, &beta, &c_str, NULL, &rntm_str );
+
+			dtime_str = bli_clock_min_diff( dtime_str, dtime );
+		}
+
+		bli_eqm( &c, &c_str, &equal );
+
+		bytes_c = ( double )m * n * bli_obj_elem_size( &c );
+
+		printf( "%6lu %5lu %5lu   %9.2f    %9.2f   %8.2f   %8.2f   %6.3f   %s\n",
+		        ( unsigned long )m,
+		        ( unsigned long )k,
+		        ( unsigned long )n,
+		        ( 2.0 * m * k * n ) / ( dtime_reg * 1.0e9 ),
+		        ( 2.0 * m * k * n ) / ( dtime_str * 1.0e9 ),
+		        bytes_c / ( dtime_reg * 1.0e9 ),
+		        bytes_c / ( dtime_str * 1.0e9 ),
+		        dtime_reg / dtime_str,
+		        ( equal ? "yes" : "NO" ) );
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &beta );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &c );
+		bli_obj_free( &c_str );
+	}
+
+	return 0;
+}
+
@@ -0,0 +1,107 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include "blis.h"
+
+// Record the timeline of a multithreaded dgemm and write it as Chrome trace
+// JSON, which may be loaded into chrome://tracing or https://ui.perfetto.dev.
+// BLIS must be configured with --enable-tracing; otherwise the trace will
+// contain no events.
+//
+// Usage: test_trace.x [nt] [m n k] [filename]
+
+int main( int argc, char** argv )
+{
+	obj_t       a, b, c;
+	dim_t       m, n, k;
+	dim_t       nt;
+	num_t       dt;
+	rntm_t      rntm;
+	const char* filename;
+
+	nt       = 1;
+	m        = 1000;
+	n        = 1000;
+	k        = 1000;
+	filename = "blis_trace.json";
+
+	if ( argc > 1 ) nt = atoi( argv[1] );
+	if ( argc > 4 )
+	{
+		m = atoi( argv[2] );
+		n = atoi( argv[3] );
+		k = atoi( argv[4] );
+	}
+	if ( argc > 5 ) filename = argv[5];
+
+	if ( !bli_info_get_enable_tracing() )
+		printf( "%% warning: BLIS was configured without --enable-tracing.\n" );
+
+	dt = BLIS_DOUBLE;
+
+	bli_obj_create( dt, m, k, 0, 0, &a );
+	bli_obj_create( dt, k, n, 0, 0, &b );
+	bli_obj_create( dt, m, n, 0, 0, &c );
+
+	bli_randm( &a );
+	bli_randm( &b );
+	bli_randm( &c );
+
+	bli_rntm_init( &rntm );
+	bli_rntm_set_num_threads( nt, &rntm );
+
+	// Discard any events from a warm-up call so that the timeline only
+	// reflects the steady state.
+	bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c, NULL, &rntm );
+	bli_trace_reset();
+
+	bli_gemm_ex( &BLIS_ONE, &a, &b, &BLIS_ONE, &c, NULL, &rntm );
+
+	if ( bli_trace_dump( filename ) == BLIS_SUCCESS )
+		printf( "%% wrote %s\n", filename );
+	else
+		printf( "%% could not write %s\n", filename );
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+
+	return 0;
+}
+
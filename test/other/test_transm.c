@@ -0,0 +1,279 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name of The University of Texas nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include "blis.h"
+
+// Check omatcopy and imatcopy against scal2m for each datatype, every
+// transposition/conjugation, and every combination of row and column
+// storage, and then time the out-of-place and in-place transposition of
+// square double-precision matrices against copym with a transposed source
+// (the path that was used before omatcopy existed). Bandwidth counts one
+// read and one write of each element.
+//
+// Usage: test_transm.x [p_begin p_end p_inc]
+
+static void create_stored( num_t dt, dim_t m, dim_t n, bool row, obj_t* x )
+{
+	// Pad the leading dimension so that it differs from the matrix size.
+	if ( row ) bli_obj_create( dt, m, n, n + 3, 1, x );
+	else       bli_obj_create( dt, m, n, 1, m + 3, x );
+}
+
+// Compare with a relative tolerance: the complex products alpha * a may be
+// contracted into fma differently by each kernel.
+static bool near_equal( obj_t* x, obj_t* y )
+{
+	const num_t dt   = bli_obj_dt( x );
+	const num_t dt_r = bli_obj_dt_proj_to_real( x );
+	const double eps = ( bli_is_single_prec( dt ) ? 1.0e-6 : 1.0e-14 );
+
+	obj_t  d, norm_d, norm_y;
+	double nd, ny, junk;
+
+	bli_obj_create( dt, bli_obj_length( x ), bli_obj_width( x ), 0, 0, &d );
+	bli_obj_scalar_init_detached( dt_r, &norm_d );
+	bli_obj_scalar_init_detached( dt_r, &norm_y );
+
+	bli_copym( x, &d );
+	bli_subm( y, &d );
+	bli_normfm( &d, &norm_d );
+	bli_normfm( y, &norm_y );
+	bli_getsc( &norm_d, &nd, &junk );
+	bli_getsc( &norm_y, &ny, &junk );
+
+	bli_obj_free( &d );
+
+	return nd <= eps * ny;
+}
+
+static dim_t check_omatcopy( void )
+{
+	const num_t   dts[]    = { BLIS_FLOAT, BLIS_DOUBLE, BLIS_SCOMPLEX, BLIS_DCOMPLEX };
+	const trans_t transs[] = { BLIS_NO_TRANSPOSE, BLIS_TRANSPOSE,
+	                           BLIS_CONJ_NO_TRANSPOSE, BLIS_CONJ_TRANSPOSE };
+	const dim_t   ms[]     = { 1, 7, 33, 100 };
+	const dim_t   ns[]     = { 1, 5, 64, 129 };
+	dim_t         n_fail   = 0;
+	dim_t         n_test   = 0;
+
+	for ( dim_t di = 0; di < 4; ++di )
+	for ( dim_t ti = 0; ti < 4; ++ti )
+	for ( dim_t mi = 0; mi < 4; ++mi )
+	for ( dim_t ni = 0; ni < 4; ++ni )
+	for ( dim_t s  = 0; s  < 4; ++s  )
+	{
+		const num_t   dt    = dts[ di ];
+		const trans_t trans = transs[ ti ];
+		const dim_t   m     = ms[ mi ];
+		const dim_t   n     = ns[ ni ];
+		const bool    row_a = s & 1;
+		const bool    row_b = s & 2;
+
+		obj_t alpha, a, b, b_ref;
+		dim_t m_a, n_a;
+		bool  eq;
+
+		bli_set_dims_with_trans( trans, m, n, &m_a, &n_a );
+
+		bli_obj_create( dt, 1, 1, 0, 0, &alpha );
+		create_stored( dt, m_a, n_a, row_a, &a );
+		create_stored( dt, m,   n,   row_b, &b );
+		create_stored( dt, m,   n,   row_b, &b_ref );
+
+		bli_setsc( -1.5, 0.5, &alpha );
+		bli_randm( &a );
+		bli_setm( &BLIS_ZERO, &b );
+
+		bli_obj_set_conjtrans( trans, &a );
+
+		bli_scal2m( &alpha, &a, &b_ref );
+		bli_omatcopy( &alpha, &a, &b );
+
+		eq = near_equal( &b, &b_ref );
+		if ( !eq )
+		{
+			printf( "omatcopy FAILED: dt %d trans %d m %d n %d row_a %d row_b %d\n",
+			        ( int )dt, ( int )trans, ( int )m, ( int )n, ( int )row_a, ( int )row_b );
+			++n_fail;
+		}
+
+		// In place: overwrite a copy of A, with B laid out in the same
+		// storage direction as A and with the same leading dimension
+		// when A is square (so that it is transposed tile by tile).
+		{
+			const inc_t ld_a = row_a ? bli_obj_row_stride( &a ) : bli_obj_col_stride( &a );
+			const inc_t ld_b = ( m == n ? ld_a : ( row_a ? n : m ) );
+			const inc_t rs_b = row_a ? ld_b : 1;
+			const inc_t cs_b = row_a ? 1    : ld_b;
+			const siz_t es   = bli_dt_size( dt );
+			const dim_t len  = bli_max( m_a * n_a, m * n ) + 3 * bli_max( m, n ) + 3 * bli_max( m_a, n_a );
+
+			void* buf = malloc( len * es );
+			obj_t w, wb;
+
+			memset( buf, 0, len * es );
+
+			bli_obj_create_with_attached_buffer( dt, m_a, n_a, buf,
+			                                     bli_obj_row_stride( &a ),
+			                                     bli_obj_col_stride( &a ), &w );
+			bli_obj_set_conjtrans( BLIS_NO_TRANSPOSE, &a );
+			bli_copym( &a, &w );
+			bli_obj_set_conjtrans( trans, &w );
+
+			bli_obj_create_with_attached_buffer( dt, m, n, buf, rs_b, cs_b, &wb );
+
+			bli_imatcopy( &alpha, &w, &wb );
+
+			eq = near_equal( &wb, &b_ref );
+			if ( !eq )
+			{
+				printf( "imatcopy FAILED: dt %d trans %d m %d n %d row_a %d\n",
+				        ( int )dt, ( int )trans, ( int )m, ( int )n, ( int )row_a );
+				++n_fail;
+			}
+
+			free( buf );
+		}
+
+		n_test += 2;
+
+		bli_obj_free( &alpha );
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &b_ref );
+	}
+
+	printf( "%% %lu of %lu checks failed\n", ( unsigned long )n_fail,
+	                                         ( unsigned long )n_test );
+
+	return n_fail;
+}
+
+int main( int argc, char** argv )
+{
+	obj_t a, b, b_old;
+	dim_t p;
+	dim_t p_begin, p_end, p_inc;
+	num_t dt;
+	int   r, n_repeats;
+
+	double dtime;
+	double dtime_old, dtime_new, dtime_inp;
+	double bytes;
+
+	n_repeats = 3;
+
+	p_begin = 1000;
+	p_end   = 8000;
+	p_inc   = 1000;
+
+	if ( argc > 3 )
+	{
+		p_begin = atoi( argv[1] );
+		p_end   = atoi( argv[2] );
+		p_inc   = atoi( argv[3] );
+	}
+
+	if ( check_omatcopy() != 0 ) return 1;
+
+	dt = BLIS_DOUBLE;
+
+	printf( "%%    m     n   GB/s(copym)  GB/s(omatcopy)  GB/s(imatcopy)  speedup  equal\n" );
+
+	for ( p = p_begin; p <= p_end; p += p_inc )
+	{
+		bool eq;
+
+		bli_obj_create( dt, p, p, 0, 0, &a );
+		bli_obj_create( dt, p, p, 0, 0, &b );
+		bli_obj_create( dt, p, p, 0, 0, &b_old );
+
+		bli_randm( &a );
+		bli_setm( &BLIS_ZERO, &b );
+		bli_setm( &BLIS_ZERO, &b_old );
+
+		bli_obj_toggle_trans( &a );
+
+		dtime_old = DBL_MAX;
+		dtime_new = DBL_MAX;
+		dtime_inp = DBL_MAX;
+
+		for ( r = 0; r < n_repeats; ++r )
+		{
+			dtime = bli_clock();
+			bli_copym( &a, &b_old );
+			dtime_old = bli_clock_min_diff( dtime_old, dtime );
+
+			dtime = bli_clock();
+			bli_omatcopy( &BLIS_ONE, &a, &b );
+			dtime_new = bli_clock_min_diff( dtime_new, dtime );
+
+			// Transposing b in place twice leaves it unchanged.
+			bli_obj_toggle_trans( &b );
+
+			dtime = bli_clock();
+			bli_imatcopy( &BLIS_ONE, &b, &b );
+			dtime_inp = bli_clock_min_diff( dtime_inp, dtime );
+
+			bli_imatcopy( &BLIS_ONE, &b, &b );
+
+			bli_obj_toggle_trans( &b );
+		}
+
+		bli_eqm( &b, &b_old, &eq );
+
+		bytes = 2.0 * p * p * bli_dt_size( dt );
+
+		printf( "%5lu %5lu   %10.2f  %14.2f  %14.2f  %7.2f  %5s\n",
+		        ( unsigned long )p, ( unsigned long )p,
+		        bytes / dtime_old / 1.0e9,
+		        bytes / dtime_new / 1.0e9,
+		        bytes / dtime_inp / 1.0e9,
+		        dtime_old / dtime_new,
+		        eq ? "yes" : "NO" );
+
+		bli_obj_free( &a );
+		bli_obj_free( &b );
+		bli_obj_free( &b_old );
+	}
+
+	return 0;
+}
+
@@ -0,0 +1,383 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include "test_libblis.h"
+
+
+// Static variables.
+static char*     op_str                    = "gbmv";
+static char*     o_types                   = "mvv"; // a x y
+static char*     p_types                   = "hc";  // transa conjx
+static thresh_t  thresh[BLIS_NUM_FP_TYPES] = { { 1e-04, 1e-05 },   // warn, pass for s
+                                               { 1e-04, 1e-05 },   // warn, pass for c
+                                               { 1e-13, 1e-14 },   // warn, pass for d
+                                               { 1e-13, 1e-14 } }; // warn, pass for z
+
+// The number of threads requested from gbmv. The number actually used is
+// limited by the size of the band, so the band is chosen wide enough for
+// the threaded path to be taken in multithreaded builds.
+static dim_t     n_threads                 = 4;
+
+// Local prototypes.
+void libblis_test_gbmv_deps
+     (
+       thread_data_t* tdata,
+       test_params_t* params,
+       test_op_t*     op
+     );
+
+void libblis_test_gbmv_experiment
+     (
+       test_params_t* params,
+       test_op_t*     op,
+       iface_t        iface,
+       char*          dc_str,
+       char*          pc_str,
+       char*          sc_str,
+       unsigned int   p_cur,
+       double*        perf,
+       double*        resid
+     );
+
+void libblis_test_gbmv_impl
+     (
+       iface_t   iface,
+       dim_t     kl,
+       obj_t*    alpha,
+       obj_t*    a,
+       obj_t*    x,
+       obj_t*    beta,
+       obj_t*    y
+     );
+
+void libblis_test_gbmv_check
+     (
+       test_params_t* params,
+       obj_t*         alpha,
+       obj_t*         a,
+       obj_t*         x,
+       obj_t*         beta,
+       obj_t*         y,
+       obj_t*         y_orig,
+       double*        resid
+     );
+
+
+
+void libblis_test_gbmv_deps
+     (
+       thread_data_t* tdata,
+       test_params_t* params,
+       test_op_t*     op
+     )
+{
+	libblis_test_randv( tdata, params, &(op->ops->randv) );
+	libblis_test_randm( tdata, params, &(op->ops->randm) );
+	libblis_test_normfv( tdata, params, &(op->ops->normfv) );
+	libblis_test_subv( tdata, params, &(op->ops->subv) );
+	libblis_test_copyv( tdata, params, &(op->ops->copyv) );
+	libblis_test_gemv( tdata, params, &(op->ops->gemv) );
+}
+
+
+
+void libblis_test_gbmv
+     (
+       thread_data_t* tdata,
+       test_params_t* params,
+       test_op_t*     op
+     )
+{
+
+	// Return early if this test has already been done.
+	if ( libblis_test_op_is_done( op ) ) return;
+
+	// Return early if operation is disabled.
+	if ( libblis_test_op_is_disabled( op ) ||
+	     libblis_test_l2_is_disabled( op ) ) return;
+
+	// Call dependencies first.
+	if ( TRUE ) libblis_test_gbmv_deps( tdata, params, op );
+
+	// Execute the test driver for each implementation requested.
+	//if ( op->front_seq == ENABLE )
+	{
+		libblis_test_op_driver( tdata,
+		                        params,
+		                        op,
+		                        BLIS_TEST_SEQ_FRONT_END,
+		                        op_str,
+		                        p_types,
+		                        o_types,
+		                        thresh,
+		                        libblis_test_gbmv_experiment );
+	}
+}
+
+
+
+void libblis_test_gbmv_experiment
+     (
+       test_params_t* params,
+       test_op_t*     op,
+       iface_t        iface,
+       char*          dc_str,
+       char*          pc_str,
+       char*          sc_str,
+       unsigned int   p_cur,
+       double*        perf,
+       double*        resid
+     )
+{
+	unsigned int n_repeats = params->n_repeats;
+	unsigned int i;
+
+	double       time_min  = DBL_MAX;
+	double       time;
+
+	num_t        datatype;
+
+	dim_t        m, n;
+	dim_t        kl, ku;
+	dim_t        m_x, m_y;
+
+	trans_t      transa;
+	conj_t       conjx;
+
+	obj_t        alpha, a, ab, x, beta, y;
+	obj_t        y_save;
+
+	double       ar, ai;
+
+
+	// Use the datatype of the first char in the datatype combination string.
+	bli_param_map_char_to_blis_dt( dc_str[0], &datatype );
+
+	// Map the dimension specifier to actual dimensions. These are the
+	// dimensions of A before transa is applied, as for the BLAS.
+	m = libblis_test_get_dim_from_prob_size( op->dim_spec[0], p_cur );
+	n = libblis_test_get_dim_from_prob_size( op->dim_spec[1], p_cur );
+
+	// Map parameter characters to BLIS constants.
+	bli_param_map_char_to_blis_trans( pc_str[0], &transa );
+	bli_param_map_char_to_blis_conj( pc_str[1], &conjx );
+
+	// Choose the number of subdiagonals and superdiagonals in the band.
+	kl = m / 2;
+	ku = n / 2;
+
+	bli_set_dims_with_trans( transa, n, m, &m_x, &m_y );
+
+	// Create test scalars.
+	bli_obj_scalar_init_detached( datatype, &alpha );
+	bli_obj_scalar_init_detached( datatype, &beta );
+
+	// Create test operands (vectors and/or matrices). The dense copy of A
+	// is used only to compute the reference result.
+	bli_obj_create( datatype, m, n, 0, 0, &a );
+	libblis_test_mobj_create( params, datatype, BLIS_NO_TRANSPOSE,
+	                          sc_str[0], kl + ku + 1, n, &ab );
+	libblis_test_vobj_create( params, datatype,
+	                          sc_str[1], m_x,  &x );
+	libblis_test_vobj_create( params, datatype,
+	                          sc_str[2], m_y,  &y );
+	libblis_test_vobj_create( params, datatype,
+	                          sc_str[2], m_y,  &y_save );
+
+	// Set alpha and beta.
+	if ( bli_obj_is_real( &y ) )
+	{
+		bli_setsc(  2.0,  0.0, &alpha );
+		bli_setsc( -1.0,  0.0, &beta );
+	}
+	else
+	{
+		bli_setsc(  1.0,  2.0, &alpha );
+		bli_setsc(  1.0, -1.0, &beta );
+	}
+
+	// Randomize A and zero the elements outside of its band. Then copy the
+	// band into band storage, where row ku holds the diagonal.
+	libblis_test_mobj_randomize( params, TRUE, &a );
+	bli_setm( &BLIS_ZERO, &ab );
+
+	for ( dim_t j = 0; j < n; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		if ( i - j > kl || j - i > ku )
+		{
+			bli_setijm( 0.0, 0.0, i, j, &a );
+		}
+		else
+		{
+			bli_getijm( i, j, &a, &ar, &ai );
+			bli_setijm( ar, ai, ku + i - j, j, &ab );
+		}
+	}
+
+	// Randomize x and y, and save y.
+	libblis_test_vobj_randomize( params, TRUE, &x );
+	libblis_test_vobj_randomize( params, TRUE, &y );
+	bli_copyv( &y, &y_save );
+
+	// Apply the parameters.
+	bli_obj_set_conjtrans( transa, &a );
+	bli_obj_set_conjtrans( transa, &ab );
+	bli_obj_set_conj( conjx, &x );
+
+	// Repeat the experiment n_repeats times and record results. 
+	for ( i = 0; i < n_repeats; ++i )
+	{
+		bli_copyv( &y_save, &y );
+
+		time = bli_clock();
+
+		libblis_test_gbmv_impl( iface, kl, &alpha, &ab, &x, &beta, &y );
+
+		time_min = bli_clock_min_diff( time_min, time );
+	}
+
+	// Estimate the performance of the best experiment repeat.
+	*perf = ( 2.0 * ( kl + ku + 1 ) * n ) / time_min / FLOPS_PER_UNIT_PERF;
+	if ( bli_obj_is_complex( &y ) ) *perf *= 4.0;
+
+	// Perform checks.
+	libblis_test_gbmv_check( params, &alpha, &a, &x, &beta, &y, &y_save, resid );
+
+	// Zero out performance and residual if output vector is empty.
+	libblis_test_check_empty_problem( &y, perf, resid );
+
+	// Free the test objects.
+	bli_obj_free( &a );
+	bli_obj_free( &ab );
+	bli_obj_free( &x );
+	bli_obj_free( &y );
+	bli_obj_free( &y_save );
+}
+
+
+
+void libblis_test_gbmv_impl
+     (
+       iface_t   iface,
+       dim_t     kl,
+       obj_t*    alpha,
+       obj_t*    a,
+       obj_t*    x,
+       obj_t*    beta,
+       obj_t*    y
+     )
+{
+	rntm_t rntm;
+
+	bli_rntm_init( &rntm );
+	bli_rntm_set_num_threads( n_threads, &rntm );
+
+	switch ( iface )
+	{
+		case BLIS_TEST_SEQ_FRONT_END:
+		bli_gbmv_ex( kl, alpha, a, x, beta, y, NULL, &rntm );
+		break;
+
+		default:
+		libblis_test_printf_error( "Invalid interface type.\n" );
+	}
+}
+
+
+
+void libblis_test_gbmv_check
+     (
+       test_params_t* params,
+       obj_t*         alpha,
+       obj_t*         a,
+       obj_t*         x,
+       obj_t*         beta,
+       obj_t*         y,
+       obj_t*         y_orig,
+       double*        resid
+     )
+{
+	num_t  dt      = bli_obj_dt( y );
+	num_t  dt_real = bli_obj_dt_proj_to_real( y );
+
+	dim_t  m_y     = bli_obj_vector_dim( y );
+
+	obj_t  y_ref;
+	obj_t  norm;
+
+	double nrm_ref, junk;
+
+	//
+	// Pre-conditions:
+	// - a is randomized within its band and zero outside of it.
+	// - x is randomized.
+	// - y_orig is randomized.
+	// Note:
+	// - alpha and beta should have non-zero imaginary components in the
+	//   complex cases in order to more fully exercise the implementation.
+	//
+	// Under these conditions, we assume that the implementation for
+	//
+	//   y := beta * y_orig + alpha * transa(A) * conjx(x)
+	//
+	// is functioning correctly if
+	//
+	//   normfv( y - y_ref ) / normfv( y_ref )
+	//
+	// is negligible, where y_ref is computed by gemv with the dense copy
+	// of A.
+	//
+
+	bli_obj_scalar_init_detached( dt_real, &norm );
+
+	bli_obj_create( dt, m_y, 1, 0, 0, &y_ref );
+
+	bli_copyv( y_orig, &y_ref );
+
+	bli_gemv( alpha, a, x, beta, &y_ref );
+
+	bli_normfv( &y_ref, &norm );
+	bli_getsc( &norm, &nrm_ref, &junk );
+
+	bli_subv( y, &y_ref );
+	bli_normfv( &y_ref, &norm );
+	bli_getsc( &norm, resid, &junk );
+
+	if ( nrm_ref != 0.0 ) *resid /= nrm_ref;
+
+	bli_obj_free( &y_ref );
+}
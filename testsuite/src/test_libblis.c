@@ -247,6 +247,7 @@ void libblis_test_level1v_ops( thread_data_t* tdata, test_params_t* params, test
 {
 	libblis_test_addv( tdata, params, &(ops->addv) );
 	libblis_test_amaxv( tdata, params, &(ops->amaxv) );
+	libblis_test_aminv( tdata, params, &(ops->aminv) );
 	libblis_test_axpbyv( tdata, params, &(ops->axpbyv) );
 	libblis_test_axpyv( tdata, params, &(ops->axpyv) );
 	libblis_test_copyv( tdata, params, &(ops->copyv) );
@@ -273,6 +274,8 @@ void libblis_test_level1m_ops( thread_data_t* tdata, test_params_t* params, test
 	libblis_test_setm( tdata, params, &(ops->setm) );
 	libblis_test_subm( tdata, params, &(ops->subm) );
 	libblis_test_xpbym( tdata, params, &(ops->xpbym) );
+	libblis_test_omatcopy( tdata, params, &(ops->omatcopy) );
+	libblis_test_imatcopy( tdata, params, &(ops->imatcopy) );
 }
 
 
@@ -300,6 +303,8 @@ void libblis_test_level2_ops( thread_data_t* tdata, test_params_t* params, test_
 	libblis_test_syr2( tdata, params, &(ops->syr2) );
 	libblis_test_trmv( tdata, params, &(ops->trmv) );
 	libblis_test_trsv( tdata, params, &(ops->trsv) );
+	libblis_test_gbmv( tdata, params, &(ops->gbmv) );
+	libblis_test_hpmv( tdata, params, &(ops->hpmv) );
 }
 
 
@@ -326,6 +331,7 @@ void libblis_test_level3_ops( thread_data_t* tdata, test_params_t* params, test_
 	libblis_test_trmm( tdata, params, &(ops->trmm) );
 	libblis_test_trmm3( tdata, params, &(ops->trmm3) );
 	libblis_test_trsm( tdata, params, &(ops->trsm) );
+	libblis_test_spmm( tdata, params, &(ops->spmm) );
 }
 
 
@@ -362,6 +368,7 @@ void libblis_test_read_ops_file( char* input_filename, test_ops_t* ops )
 	// Level-1v
 	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_M,   1, &(ops->addv) );
 	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_M,   0, &(ops->amaxv) );
+	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_M,   0, &(ops->aminv) );
 	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_M,   1, &(ops->axpbyv) );
 	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_M,   1, &(ops->axpyv) );
 	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_M,   1, &(ops->copyv) );
@@ -384,6 +391,8 @@ void libblis_test_read_ops_file( char* input_filename, test_ops_t* ops )
 	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_MN,  0, &(ops->setm) );
 	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_MN,  1, &(ops->subm) );
 	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_MN,  1, &(ops->xpbym) );
+	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_MN,  1, &(ops->omatcopy) );
+	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_MN,  1, &(ops->imatcopy) );
 
 	// Level-1f
 	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_M,   2, &(ops->axpy2v) );
@@ -403,6 +412,8 @@ void libblis_test_read_ops_file( char* input_filename, test_ops_t* ops )
 	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_M,   3, &(ops->syr2) );
 	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_M,   3, &(ops->trmv) );
 	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_M,   3, &(ops->trsv) );
+	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_MN,  2, &(ops->gbmv) );
+	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_M,   3, &(ops->hpmv) );
 
 	// Level-3 micro-kernels
 	libblis_test_read_op_info( ops, input_stream, BLIS_NOID, BLIS_TEST_DIMS_K,   0, &(ops->gemm_ukr) );
@@ -421,6 +432,7 @@ void libblis_test_read_ops_file( char* input_filename, test_ops_t* ops )
 	libblis_test_read_op_info( ops, input_stream, BLIS_TRMM,  BLIS_TEST_DIMS_MN,  4, &(ops->trmm) );
 	libblis_test_read_op_info( ops, input_stream, BLIS_TRMM3, BLIS_TEST_DIMS_MN,  5, &(ops->trmm3) );
 	libblis_test_read_op_info( ops, input_stream, BLIS_TRSM,  BLIS_TEST_DIMS_MN,  4, &(ops->trsm) );
+	libblis_test_read_op_info( ops, input_stream, BLIS_NOID,  BLIS_TEST_DIMS_MNK, 0, &(ops->spmm) );
 
 	// Output the section overrides.
 	libblis_test_output_section_overrides( stdout, ops );
@@ -833,6 +845,8 @@ void libblis_test_output_params_struct( FILE* os, test_params_t* params )
 	rntm_t gemm, herk, trmm_l, trmm_r, trsm_l, trsm_r;
 	dim_t  m = 1000, n = 1000, k = 1000;
 
+	cntx = bli_gks_query_cntx();
+
 	bli_rntm_init_from_global( &gemm   );
 	bli_rntm_init_from_global( &herk   );
 	bli_rntm_init_from_global( &trmm_l );
@@ -840,12 +854,12 @@ void libblis_test_output_params_struct( FILE* os, test_params_t* params )
 	bli_rntm_init_from_global( &trsm_l );
 	bli_rntm_init_from_global( &trsm_r );
 
-	bli_rntm_set_ways_for_op( BLIS_GEMM, BLIS_LEFT,  m, n, k, &gemm );
-	bli_rntm_set_ways_for_op( BLIS_HERK, BLIS_LEFT,  m, n, k, &herk );
-	bli_rntm_set_ways_for_op( BLIS_TRMM, BLIS_LEFT,  m, n, k, &trmm_l );
-	bli_rntm_set_ways_for_op( BLIS_TRMM, BLIS_RIGHT, m, n, k, &trmm_r );
-	bli_rntm_set_ways_for_op( BLIS_TRSM, BLIS_LEFT,  m, n, k, &trsm_l );
-	bli_rntm_set_ways_for_op( BLIS_TRSM, BLIS_RIGHT, m, n, k, &trsm_r );
+	bli_rntm_set_ways_for_op( BLIS_GEMM, BLIS_LEFT,  BLIS_DOUBLE, m, n, k, cntx, &gemm );
+	bli_rntm_set_ways_for_op( BLIS_HERK, BLIS_LEFT,  BLIS_DOUBLE, m, n, k, cntx, &herk );
+	bli_rntm_set_ways_for_op( BLIS_TRMM, BLIS_LEFT,  BLIS_DOUBLE, m, n, k, cntx, &trmm_l );
+	bli_rntm_set_ways_for_op( BLIS_TRMM, BLIS_RIGHT, BLIS_DOUBLE, m, n, k, cntx, &trmm_r );
+	bli_rntm_set_ways_for_op( BLIS_TRSM, BLIS_LEFT,  BLIS_DOUBLE, m, n, k, cntx, &trsm_l );
+	bli_rntm_set_ways_for_op( BLIS_TRSM, BLIS_RIGHT, BLIS_DOUBLE, m, n, k, cntx, &trsm_r );
 
 	// Output some system parameters.
 	libblis_test_fprintf_c( os, "\n" );
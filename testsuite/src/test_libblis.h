@@ -224,6 +224,7 @@ typedef struct test_ops_s
 	// level-1v
 	test_op_t addv;
 	test_op_t amaxv;
+	test_op_t aminv;
 	test_op_t axpbyv;
 	test_op_t axpyv;
 	test_op_t copyv;
@@ -246,6 +247,8 @@ typedef struct test_ops_s
 	test_op_t setm;
 	test_op_t subm;
 	test_op_t xpbym;
+	test_op_t omatcopy;
+	test_op_t imatcopy;
 
 	// level-1f
 	test_op_t axpy2v;
@@ -265,6 +268,8 @@ typedef struct test_ops_s
 	test_op_t syr2;
 	test_op_t trmv;
 	test_op_t trsv;
+	test_op_t gbmv;
+	test_op_t hpmv;
 
 	// level-3 micro-kernels
 	test_op_t gemm_ukr;
@@ -283,6 +288,7 @@ typedef struct test_ops_s
 	test_op_t trmm;
 	test_op_t trmm3;
 	test_op_t trsm;
+	test_op_t spmm;
 
 } test_ops_t;
 
@@ -498,6 +504,7 @@ char libblis_test_proj_dtchar_to_precchar( char dt_char );
 // Level-1v
 #include "test_addv.h"
 #include "test_amaxv.h"
+#include "test_aminv.h"
 #include "test_axpbyv.h"
 #include "test_axpyv.h"
 #include "test_copyv.h"
@@ -520,6 +527,8 @@ char libblis_test_proj_dtchar_to_precchar( char dt_char );
 #include "test_setm.h"
 #include "test_subm.h"
 #include "test_xpbym.h"
+#include "test_omatcopy.h"
+#include "test_imatcopy.h"
 
 // Level-1f kernels
 #include "test_axpy2v.h"
@@ -539,6 +548,8 @@ char libblis_test_proj_dtchar_to_precchar( char dt_char );
 #include "test_syr2.h"
 #include "test_trmv.h"
 #include "test_trsv.h"
+#include "test_gbmv.h"
+#include "test_hpmv.h"
 
 // Level-3 micro-kernels
 #include "test_gemm_ukr.h"
@@ -557,4 +568,5 @@ char libblis_test_proj_dtchar_to_precchar( char dt_char );
 #include "test_trmm.h"
 #include "test_trmm3.h"
 #include "test_trsm.h"
+#include "test_spmm.h"
 
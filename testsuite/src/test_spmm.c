@@ -0,0 +1,498 @@
+/*
+
+   BLIS
+   An object-based framework for developing high-performance BLAS-like
+   libraries.
+
+   Copyright (C) 2014, The University of Texas at Austin
+   Copyright (C) 2018 - 2019, Advanced Micro Devices, Inc.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are
+   met:
+    - Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    - Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    - Neither the name(s) of the copyright holder(s) nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+   HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "blis.h"
+#include "test_libblis.h"
+
+
+// Static variables.
+static char*     op_str                    = "spmm";
+static char*     o_types                   = "mmm"; // a b c
+static char*     p_types                   = "";    // (no parameters)
+static thresh_t  thresh[BLIS_NUM_FP_TYPES] = { { 1e-04, 1e-05 },   // warn, pass for s
+                                               { 1e-04, 1e-05 },   // warn, pass for c
+                                               { 1e-13, 1e-14 },   // warn, pass for d
+                                               { 1e-13, 1e-14 } }; // warn, pass for z
+
+// Local prototypes.
+void libblis_test_spmm_deps
+     (
+       thread_data_t* tdata,
+       test_params_t* params,
+       test_op_t*     op
+     );
+
+void libblis_test_spmm_experiment
+     (
+       test_params_t* params,
+       test_op_t*     op,
+       iface_t        iface,
+       char*          dc_str,
+       char*          pc_str,
+       char*          sc_str,
+       unsigned int   p_cur,
+       double*        perf,
+       double*        resid
+     );
+
+bool libblis_test_spmm_is_nz
+     (
+       dim_t i,
+       dim_t j
+     );
+
+dim_t libblis_test_spmm_compress
+     (
+       bool    is_csr,
+       obj_t*  a,
+       void*   a_val,
+       inc_t*  a_ptr,
+       dim_t*  a_ind
+     );
+
+void libblis_test_spmm_impl
+     (
+       iface_t   iface,
+       bool      is_csr,
+       obj_t*    alpha,
+       void*     a_val,
+       inc_t*    a_ptr,
+       dim_t*    a_ind,
+       obj_t*    b,
+       obj_t*    beta,
+       obj_t*    c
+     );
+
+void libblis_test_spmm_check
+     (
+       test_params_t* params,
+       obj_t*         alpha,
+       obj_t*         a,
+       obj_t*         b,
+       obj_t*         beta,
+       obj_t*         c,
+       obj_t*         c_orig,
+       double*        resid
+     );
+
+
+
+void libblis_test_spmm_deps
+     (
+       thread_data_t* tdata,
+       test_params_t* params,
+       test_op_t*     op
+     )
+{
+	libblis_test_randm( tdata, params, &(op->ops->randm) );
+	libblis_test_setm( tdata, params, &(op->ops->setm) );
+	libblis_test_normfm( tdata, params, &(op->ops->normfm) );
+	libblis_test_subm( tdata, params, &(op->ops->subm) );
+	libblis_test_copym( tdata, params, &(op->ops->copym) );
+	libblis_test_gemm( tdata, params, &(op->ops->gemm) );
+}
+
+
+
+void libblis_test_spmm
+     (
+       thread_data_t* tdata,
+       test_params_t* params,
+       test_op_t*     op
+     )
+{
+
+	// Return early if this test has already been done.
+	if ( libblis_test_op_is_done( op ) ) return;
+
+	// Return early if operation is disabled.
+	if ( libblis_test_op_is_disabled( op ) ||
+	     libblis_test_l3_is_disabled( op ) ) return;
+
+	// Call dependencies first.
+	if ( TRUE ) libblis_test_spmm_deps( tdata, params, op );
+
+	// Execute the test driver for each implementation requested.
+	//if ( op->front_seq == ENABLE )
+	{
+		libblis_test_op_driver( tdata,
+		                        params,
+		                        op,
+		                        BLIS_TEST_SEQ_FRONT_END,
+		                        op_str,
+		                        p_types,
+		                        o_types,
+		                        thresh,
+		                        libblis_test_spmm_experiment );
+	}
+}
+
+
+
+void libblis_test_spmm_experiment
+     (
+       test_params_t* params,
+       test_op_t*     op,
+       iface_t        iface,
+       char*          dc_str,
+       char*          pc_str,
+       char*          sc_str,
+       unsigned int   p_cur,
+       double*        perf,
+       double*        resid
+     )
+{
+	unsigned int n_repeats = params->n_repeats;
+	unsigned int i, f;
+
+	double       time_min  = DBL_MAX;
+	double       time;
+
+	num_t        datatype;
+
+	dim_t        m, n, k;
+	dim_t        nnz;
+
+	obj_t        alpha, a, b, beta, c;
+	obj_t        c_save;
+
+	void*        a_val;
+	inc_t*       a_ptr;
+	dim_t*       a_ind;
+
+	double       resid_f;
+
+	err_t        r_val;
+
+
+	// Use the datatype of the first char in the datatype combination string.
+	bli_param_map_char_to_blis_dt( dc_str[0], &datatype );
+
+	// Map the dimension specifier to actual dimensions.
+	m = libblis_test_get_dim_from_prob_size( op->dim_spec[0], p_cur );
+	n = libblis_test_get_dim_from_prob_size( op->dim_spec[1], p_cur );
+	k = libblis_test_get_dim_from_prob_size( op->dim_spec[2], p_cur );
+
+	// Create test scalars.
+	bli_obj_scalar_init_detached( datatype, &alpha );
+	bli_obj_scalar_init_detached( datatype, &beta );
+
+	// Create test operands (vectors and/or matrices).
+	libblis_test_mobj_create( params, datatype, BLIS_NO_TRANSPOSE,
+	                          sc_str[1], m, k, &a );
+	libblis_test_mobj_create( params, datatype, BLIS_NO_TRANSPOSE,
+	                          sc_str[2], k, n, &b );
+	libblis_test_mobj_create( params, datatype, BLIS_NO_TRANSPOSE,
+	                          sc_str[0], m, n, &c );
+	libblis_test_mobj_create( params, datatype, BLIS_NO_TRANSPOSE,
+	                          sc_str[0], m, n, &c_save );
+
+	// Set alpha and beta.
+	if ( bli_obj_is_real( &c ) )
+	{
+		bli_setsc(  1.2,  0.0, &alpha );
+		bli_setsc(  0.9,  0.0, &beta );
+	}
+	else
+	{
+		bli_setsc(  1.2,  0.8, &alpha );
+		bli_setsc(  0.9,  1.0, &beta );
+	}
+
+	// Randomize A, B, and C, and save C. Then zero out all but a sparse
+	// pattern of the elements of A.
+	libblis_test_mobj_randomize( params, TRUE, &a );
+	libblis_test_mobj_randomize( params, TRUE, &b );
+	libblis_test_mobj_randomize( params, TRUE, &c );
+	bli_copym( &c, &c_save );
+
+	for ( dim_t j = 0; j < k; ++j )
+	for ( dim_t i = 0; i < m; ++i )
+	{
+		if ( !libblis_test_spmm_is_nz( i, j ) )
+			bli_setijm( 0.0, 0.0, i, j, &a );
+	}
+
+	// Allocate the compressed copies of A. Both formats hold the same
+	// number of nonzeros, and a_ptr is large enough for either.
+	nnz   = libblis_test_spmm_compress( TRUE, &a, NULL, NULL, NULL );
+	a_val = bli_malloc_user( bli_max( nnz, 1 ) * bli_obj_elem_size( &a ), &r_val );
+	a_ptr = bli_malloc_user( ( bli_max( m, k ) + 1 ) * sizeof( inc_t ), &r_val );
+	a_ind = bli_malloc_user( bli_max( nnz, 1 ) * sizeof( dim_t ), &r_val );
+
+	*resid = 0.0;
+
+	// Test the compressed sparse row (f == 0) and compressed sparse column
+	// (f == 1) formats in turn, and report the larger of the residuals.
+	for ( f = 0; f < 2; ++f )
+	{
+		bool is_csr = ( f == 0 );
+
+		libblis_test_spmm_compress( is_csr, &a, a_val, a_ptr, a_ind );
+
+		// Repeat the experiment n_repeats times and record results. 
+		for ( i = 0; i < n_repeats; ++i )
+		{
+			bli_copym( &c_save, &c );
+
+			time = bli_clock();
+
+			libblis_test_spmm_impl( iface, is_csr, &alpha, a_val, a_ptr, a_ind,
+			                        &b, &beta, &c );
+
+			time_min = bli_clock_min_diff( time_min, time );
+		}
+
+		// Perform checks.
+		libblis_test_spmm_check( params, &alpha, &a, &b, &beta, &c, &c_save, &resid_f );
+
+		*resid = bli_max( *resid, resid_f );
+	}
+
+	// Estimate the performance of the best experiment repeat.
+	*perf = ( 2.0 * nnz * n ) / time_min / FLOPS_PER_UNIT_PERF;
+	if ( bli_obj_is_complex( &c ) ) *perf *= 4.0;
+
+	// Zero out performance and residual if output matrix is empty.
+	libblis_test_check_empty_problem( &c, perf, resid );
+
+	// Free the test objects.
+	bli_free_user( a_val );
+	bli_free_user( a_ptr );
+	bli_free_user( a_ind );
+
+	bli_obj_free( &a );
+	bli_obj_free( &b );
+	bli_obj_free( &c );
+	bli_obj_free( &c_save );
+}
+
+
+
+bool libblis_test_spmm_is_nz
+     (
+       dim_t i,
+       dim_t j
+     )
+{
+	// Keep about one element in ten, in a pattern that leaves some rows
+	// and columns with no nonzeros for the smaller problem sizes.
+	return ( ( 3 * i + 7 * j + i * j ) % 10 == 0 );
+}
+
+
+
+dim_t libblis_test_spmm_compress
+     (
+       bool    is_csr,
+       obj_t*  a,
+       void*   a_val,
+       inc_t*  a_ptr,
+       dim_t*  a_ind
+     )
+{
+	dim_t  m      = bli_obj_length( a );
+	dim_t  k      = bli_obj_width( a );
+	inc_t  rs     = bli_obj_row_stride( a );
+	inc_t  cs     = bli_obj_col_stride( a );
+	siz_t  esz    = bli_obj_elem_size( a );
+	char*  buf    = bli_obj_buffer_at_off( a );
+
+	// The outer loop runs over the rows of A for csr and over the columns
+	// of A for csc. If a_val is NULL, only the nonzeros are counted.
+	dim_t  n_out  = ( is_csr ? m : k );
+	dim_t  n_in   = ( is_csr ? k : m );
+	dim_t  q      = 0;
+
+	for ( dim_t o = 0; o < n_out; ++o )
+	{
+		if ( a_val != NULL ) a_ptr[ o ] = q;
+
+		for ( dim_t l = 0; l < n_in; ++l )
+		{
+			dim_t i = ( is_csr ? o : l );
+			dim_t j = ( is_csr ? l : o );
+
+			if ( !libblis_test_spmm_is_nz( i, j ) ) continue;
+
+			if ( a_val != NULL )
+			{
+				memcpy( ( char* )a_val + q * esz, buf + ( i * rs + j * cs ) * esz, esz );
+				a_ind[ q ] = l;
+			}
+			++q;
+		}
+	}
+
+	if ( a_val != NULL ) a_ptr[ n_out ] = q;
+
+	return q;
+}
+
+
+
+void libblis_test_spmm_impl
+     (
+       iface_t   iface,
+       bool      is_csr,
+       obj_t*    alpha,
+       void*     a_val,
+       inc_t*    a_ptr,
+       dim_t*    a_ind,
+       obj_t*    b,
+       obj_t*    beta,
+       obj_t*    c
+     )
+{
+	num_t  dt    = bli_obj_dt( c );
+
+	dim_t  m     = bli_obj_length( c );
+	dim_t  n     = bli_obj_width( c );
+	dim_t  k     = bli_obj_length( b );
+
+	void*  buf_alpha = bli_obj_buffer_for_1x1( dt, alpha );
+	void*  buf_beta  = bli_obj_buffer_for_1x1( dt, beta );
+
+	void*  buf_b = bli_obj_buffer_at_off( b );
+	inc_t  rs_b  = bli_obj_row_stride( b );
+	inc_t  cs_b  = bli_obj_col_stride( b );
+	void*  buf_c = bli_obj_buffer_at_off( c );
+	inc_t  rs_c  = bli_obj_row_stride( c );
+	inc_t  cs_c  = bli_obj_col_stride( c );
+
+	switch ( iface )
+	{
+		case BLIS_TEST_SEQ_FRONT_END:
+		if ( is_csr )
+		{
+			if      ( dt == BLIS_FLOAT )
+				bli_scsrmm( m, n, k, buf_alpha, a_val, a_ptr, a_ind,
+				            buf_b, rs_b, cs_b, buf_beta, buf_c, rs_c, cs_c );
+			else if ( dt == BLIS_DOUBLE )
+				bli_dcsrmm( m, n, k, buf_alpha, a_val, a_ptr, a_ind,
+				            buf_b, rs_b, cs_b, buf_beta, buf_c, rs_c, cs_c );
+			else if ( dt == BLIS_SCOMPLEX )
+				bli_ccsrmm( m, n, k, buf_alpha, a_val, a_ptr, a_ind,
+				            buf_b, rs_b, cs_b, buf_beta, buf_c, rs_c, cs_c );
+			else
+				bli_zcsrmm( m, n, k, buf_alpha, a_val, a_ptr, a_ind,
+				            buf_b, rs_b, cs_b, buf_beta, buf_c, rs_c, cs_c );
+		}
+		else
+		{
+			if      ( dt == BLIS_FLOAT )
+				bli_scscmm( m, n, k, buf_alpha, a_val, a_ptr, a_ind,
+				            buf_b, rs_b, cs_b, buf_beta, buf_c, rs_c, cs_c );
+			else if ( dt == BLIS_DOUBLE )
+				bli_dcscmm( m, n, k, buf_alpha, a_val, a_ptr, a_ind,
+				            buf_b, rs_b, cs_b, buf_beta, buf_c, rs_c, cs_c );
+			else if ( dt == BLIS_SCOMPLEX )
+				bli_ccscmm( m, n, k, buf_alpha, a_val, a_ptr, a_ind,
+				            buf_b, rs_b, cs_b, buf_beta, buf_c, rs_c, cs_c );
+			else
+				bli_zcscmm( m, n, k, buf_alpha, a_val, a_ptr, a_ind,
+				            buf_b, rs_b, cs_b, buf_beta, buf_c, rs_c, cs_c );
+		}
+		break;
+
+		default:
+		libblis_test_printf_error( "Invalid interface type.\n" );
+	}
+}
+
+
+
+void libblis_test_spmm_check
+     (
+       test_params_t* params,
+       obj_t*         alpha,
+       obj_t*         a,
+       obj_t*         b,
+       obj_t*         beta,
+       obj_t*         c,
+       obj_t*         c_orig,
+       double*        resid
+     )
+{
+	num_t  dt      = bli_obj_dt( c );
+	num_t  dt_real = bli_obj_dt_proj_to_real( c );
+
+	dim_t  m       = bli_obj_length( c );
+	dim_t  n       = bli_obj_width( c );
+
+	obj_t  c_ref;
+	obj_t  norm;
+
+	double nrm_ref, junk;
+
+	//
+	// Pre-conditions:
+	// - a is randomized and then sparsified.
+	// - b is randomized.
+	// - c_orig is randomized.
+	// - a holds the same elements as the sparse operand passed to the
+	//   implementation.
+	//
+	// Under these conditions, we assume that the implementation for
+	//
+	//   C := beta * C_orig + alpha * A * B
+	//
+	// is functioning correctly if
+	//
+	//   normfm( C - C_ref ) / normfm( C_ref )
+	//
+	// is negligible, where C_ref is computed by gemm with the dense copy
+	// of A.
+	//
+
+	bli_obj_scalar_init_detached( dt_real, &norm );
+
+	bli_obj_create( dt, m, n, 0, 0, &c_ref );
+
+	bli_copym( c_orig, &c_ref );
+
+	bli_gemm( alpha, a, b, beta, &c_ref );
+
+	bli_normfm( &c_ref, &norm );
+	bli_getsc( &norm, &nrm_ref, &junk );
+
+	bli_subm( c, &c_ref );
+	bli_normfm( &c_ref, &norm );
+	bli_getsc( &norm, resid, &junk );
+
+	if ( nrm_ref != 0.0 ) *resid /= nrm_ref;
+
+	bli_obj_free( &c_ref );
+}